@@ -15,6 +15,7 @@
  */
 
 #include "PartitionRead.h"
+#include "PartitionAuto.h"
 #include "PartitionExport.h"
 #include "HelperPath.h"
 
@@ -42,6 +43,8 @@ const char *opt_def = "--default";
 const char *opt_part_file = "--part_file";
 const char *opt_input_file = "--input_file";
 const char *opt_work_path = "--work_path";
+const char *opt_auto_parts = "--auto_parts";
+const char *opt_cost_file = "--cost_file";
 
 void print_version(void)
 {
@@ -57,12 +60,16 @@ void build_arser(arser::Arser &arser)
 
   arser.add_argument(opt_def).help("Default backend to assign");
 
-  arser.add_argument(opt_part_file)
-    .required(true)
-    .help("Partition file which provides backend to assign");
+  arser.add_argument(opt_part_file).help("Partition file which provides backend to assign");
   arser.add_argument(opt_input_file).required(true).help("Input circle model filename");
   arser.add_argument(opt_work_path)
     .help("Work folder of partition, input files exist and output files are produced");
+
+  arser.add_argument(opt_auto_parts)
+    .type(arser::DataType::INT32)
+    .help("Split into given number of balanced pipeline stages instead of partition rules");
+  arser.add_argument(opt_cost_file)
+    .help("onert exec_time.json profile for automatic partition, analytic cost if omitted");
 }
 
 std::unique_ptr<luci::Module> load_model(const std::string &input_path)
@@ -93,7 +100,14 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  std::string partition_file = arser.get<std::string>(opt_part_file);
+  if (!arser[opt_part_file] && !arser[opt_auto_parts])
+  {
+    std::cerr << "ERROR: Either " << opt_part_file << " or " << opt_auto_parts << " is required"
+              << std::endl;
+    std::cerr << arser;
+    return EXIT_FAILURE;
+  }
+
   std::string input_file = arser.get<std::string>(opt_input_file);
   std::string work_folder = ".";
 
@@ -102,7 +116,6 @@ int entry(int argc, char **argv)
     work_folder = arser.get<std::string>(opt_work_path);
   }
 
-  std::string partition_path = work_folder + "/" + partition_file;
   std::string input_path = work_folder + "/" + input_file;
 
   auto module = load_model(input_path);
@@ -126,9 +139,14 @@ int entry(int argc, char **argv)
   }
 
   // Read partition information
-  INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
-  auto partition = partee::read(partition_path);
-  INFO(l) << partition << std::endl;
+  luci::PartitionTable partition;
+  if (arser[opt_part_file])
+  {
+    INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
+    auto partition_path = work_folder + "/" + arser.get<std::string>(opt_part_file);
+    partition = partee::read(partition_path);
+    INFO(l) << partition << std::endl;
+  }
 
   // override with command line arguments
   {
@@ -142,6 +160,45 @@ int entry(int argc, char **argv)
       partition.default_group = arser.get<std::string>(opt_def);
     }
   }
+
+  // build partition rules from cost of nodes
+  if (arser[opt_auto_parts])
+  {
+    INFO(l) << "--- Auto PartitionConfig-----------------------" << std::endl;
+    auto parts = arser.get<int32_t>(opt_auto_parts);
+    if (parts <= 0)
+    {
+      std::cerr << "ERROR: " << opt_auto_parts << " should be positive" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (partition.groups.empty())
+    {
+      std::cerr << "ERROR: " << opt_bks << " or " << opt_part_file
+                << " is required to give backends" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    partee::CostModel cost;
+    if (arser[opt_cost_file])
+    {
+      auto cost_path = work_folder + "/" + arser.get<std::string>(opt_cost_file);
+      if (!cost.load_exec_time(cost_path, partition.groups.front()))
+        return EXIT_FAILURE;
+    }
+
+    auto default_group = partition.default_group;
+    partition = partee::auto_partition(module.get(), partition.groups, parts, cost);
+    if (!default_group.empty())
+      partition.default_group = default_group;
+
+    // save generated rules so that it can be reviewed or reused with --part_file
+    auto part_path = partee::make_part_path(work_folder, input_file);
+    if (!partee::export_part_file(part_path, partition))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
   if (!luci::validate(partition))
   {
     // NOTE error reason/message is put to std::cerr inside validate()
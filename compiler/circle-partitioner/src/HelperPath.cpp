@@ -66,4 +66,15 @@ std::string make_path(const std::string &base, const std::string &input, uint32_
   return base + "/" + filename + "." + seq_fmt + "_" + backend + "." + ext;
 }
 
+std::string make_part_path(const std::string &base, const std::string &input)
+{
+  auto filename = get_filename_ext(input);
+
+  auto pos = filename.find_last_of(".");
+  if (pos != std::string::npos)
+    filename = filename.substr(0, pos);
+
+  return base + "/" + filename + ".auto.part";
+}
+
 } // namespace partee
@@ -38,6 +38,11 @@ std::string get_filename_ext(const std::string &base);
 std::string make_path(const std::string &base, const std::string &input, uint32_t idx,
                       const std::string &backend);
 
+/**
+ * @brief Make partition file path for generated partition of input
+ */
+std::string make_part_path(const std::string &base, const std::string &input);
+
 } // namespace partee
 
 #endif // __CIRCLE_HELPER_PATH_H__
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionAuto.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <loco.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+
+// Splits with bottleneck stage within this ratio of the best one are considered balanced
+constexpr double kBalanceTolerance = 0.05;
+
+bool is_virtual(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+#define CIRCLE_NODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE: \
+    return false;
+#define CIRCLE_VNODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE: \
+    return true;
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * @brief Returns node which computes 'node', which is owner node for multiple output nodes
+ */
+const luci::CircleNode *producer_of(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CIRCLEBIDIRECTIONAL_SEQUENCE_LSTM_OUT:
+    case luci::CircleOpcode::CIRCLECUSTOMOUT:
+    case luci::CircleOpcode::CIRCLEIFOUT:
+    case luci::CircleOpcode::CIRCLENONMAXSUPPRESSIONV4OUT:
+    case luci::CircleOpcode::CIRCLENONMAXSUPPRESSIONV5OUT:
+    case luci::CircleOpcode::CIRCLESPLITOUT:
+    case luci::CircleOpcode::CIRCLESPLITVOUT:
+    case luci::CircleOpcode::CIRCLETOPKV2OUT:
+    case luci::CircleOpcode::CIRCLEUNIQUEOUT:
+    case luci::CircleOpcode::CIRCLEUNPACKOUT:
+    case luci::CircleOpcode::CIRCLEWHILEOUT:
+      return loco::must_cast<const luci::CircleNode *>(node->arg(0));
+    default:
+      break;
+  }
+  return node;
+}
+
+} // namespace
+
+namespace partee
+{
+
+std::vector<uint64_t>
+cut_bytes(const std::vector<luci::CircleNode *> &nodes,
+          const std::unordered_map<const luci::CircleNode *, size_t> &position)
+{
+  const auto count = nodes.size();
+
+  // value -> last position which reads it
+  std::unordered_map<const luci::CircleNode *, size_t> last_use;
+  for (size_t i = 0; i < count; ++i)
+  {
+    auto node = nodes[i];
+    for (uint32_t a = 0; a < node->arity(); ++a)
+    {
+      if (node->arg(a) == nullptr)
+        continue;
+      auto value = loco::must_cast<const luci::CircleNode *>(node->arg(a));
+      if (position.find(producer_of(value)) == position.end())
+        continue;
+      auto &last = last_use[value];
+      last = std::max(last, i);
+    }
+  }
+
+  std::vector<int64_t> diff(count + 1, 0);
+  for (auto &use : last_use)
+  {
+    auto first = position.at(producer_of(use.first));
+    auto last = use.second;
+    if (last <= first)
+      continue;
+    auto bytes = static_cast<int64_t>(tensor_bytes(use.first));
+    diff[first] += bytes;
+    diff[last] -= bytes;
+  }
+
+  std::vector<uint64_t> cut(count, 0);
+  int64_t running = 0;
+  for (size_t p = 0; p < count; ++p)
+  {
+    running += diff[p];
+    cut[p] = static_cast<uint64_t>(running);
+  }
+  return cut;
+}
+
+std::vector<size_t> split_stages(const std::vector<double> &costs,
+                                 const std::vector<uint64_t> &cut, size_t parts)
+{
+  const auto count = costs.size();
+  assert(parts >= 1 && parts <= count);
+
+  std::vector<double> prefix(count + 1, 0.0);
+  for (size_t i = 0; i < count; ++i)
+    prefix[i + 1] = prefix[i] + costs[i];
+
+  const double inf = std::numeric_limits<double>::infinity();
+
+  // bottleneck[k][i]: smallest cost of most expensive stage, first i nodes in k + 1 stages
+  std::vector<std::vector<double>> bottleneck(parts, std::vector<double>(count + 1, inf));
+  for (size_t i = 1; i <= count; ++i)
+    bottleneck[0][i] = prefix[i];
+  for (size_t k = 1; k < parts; ++k)
+  {
+    for (size_t i = k + 1; i <= count; ++i)
+    {
+      for (size_t j = k; j < i; ++j)
+      {
+        auto stage = std::max(bottleneck[k - 1][j], prefix[i] - prefix[j]);
+        bottleneck[k][i] = std::min(bottleneck[k][i], stage);
+      }
+    }
+  }
+  const auto bound = bottleneck[parts - 1][count] * (1.0 + kBalanceTolerance);
+
+  // cut_sum[k][i]: smallest sum of cut bytes, first i nodes in k + 1 stages within bound
+  std::vector<std::vector<double>> cut_sum(parts, std::vector<double>(count + 1, inf));
+  std::vector<std::vector<size_t>> from(parts, std::vector<size_t>(count + 1, 0));
+  for (size_t i = 1; i <= count; ++i)
+  {
+    if (prefix[i] <= bound)
+      cut_sum[0][i] = 0.0;
+  }
+  for (size_t k = 1; k < parts; ++k)
+  {
+    for (size_t i = k + 1; i <= count; ++i)
+    {
+      for (size_t j = k; j < i; ++j)
+      {
+        if (cut_sum[k - 1][j] == inf || prefix[i] - prefix[j] > bound)
+          continue;
+        auto sum = cut_sum[k - 1][j] + static_cast<double>(cut[j - 1]);
+        if (sum < cut_sum[k][i])
+        {
+          cut_sum[k][i] = sum;
+          from[k][i] = j;
+        }
+      }
+    }
+  }
+  assert(cut_sum[parts - 1][count] != inf);
+
+  std::vector<size_t> starts(parts, 0);
+  size_t end = count;
+  for (size_t k = parts - 1; k > 0; --k)
+  {
+    end = from[k][end];
+    starts[k] = end;
+  }
+  return starts;
+}
+
+luci::PartitionTable auto_partition(const luci::Module *module,
+                                    const std::vector<std::string> &groups, uint32_t parts,
+                                    const CostModel &cost)
+{
+  LOGGER(l);
+
+  assert(module != nullptr);
+  assert(!groups.empty());
+  assert(parts > 0);
+
+  luci::PartitionTable table;
+  table.groups = groups;
+  table.default_group = groups.front();
+  table.comply = luci::PartitionTable::COMPLY::OPNAME;
+
+  // TODO support multiple subgraphs
+  auto graph = module->graph();
+
+  std::vector<luci::CircleNode *> nodes;
+  std::unordered_map<const luci::CircleNode *, size_t> position;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto cnode = loco::must_cast<luci::CircleNode *>(node);
+    if (is_virtual(cnode))
+      continue;
+    position[cnode] = nodes.size();
+    nodes.push_back(cnode);
+  }
+  if (nodes.empty())
+    return table;
+
+  if (groups.size() == 1 && parts > 1)
+  {
+    std::cerr << "WARNING: stages of same backend are merged, use two or more backends"
+              << std::endl;
+  }
+
+  const auto costs = cost.costs(nodes);
+  const auto cut = cut_bytes(nodes, position);
+  const auto num_stages = std::min<size_t>(parts, nodes.size());
+  const auto starts = split_stages(costs, cut, num_stages);
+
+  for (size_t k = 0; k < num_stages; ++k)
+  {
+    const auto &group = groups[k % groups.size()];
+    const auto begin = starts[k];
+    const auto end = k + 1 < num_stages ? starts[k + 1] : nodes.size();
+
+    double stage_cost = 0.0;
+    for (size_t i = begin; i < end; ++i)
+    {
+      auto node = nodes[i];
+      stage_cost += costs[i];
+      if (node->name().empty())
+      {
+        std::cerr << "WARNING: node without name is assigned to default group" << std::endl;
+        continue;
+      }
+      auto result = table.byopnames.emplace(node->name(), group);
+      if (!result.second && result.first->second != group)
+      {
+        std::cerr << "WARNING: duplicate node name '" << node->name() << "' is assigned to '"
+                  << result.first->second << "'" << std::endl;
+      }
+    }
+
+    INFO(l) << "Stage " << k << ": " << group << ", nodes [" << begin << ", " << end
+            << "), cost " << stage_cost << ", cut " << (end < nodes.size() ? cut[end - 1] : 0)
+            << " bytes" << std::endl;
+  }
+
+  return table;
+}
+
+} // namespace partee
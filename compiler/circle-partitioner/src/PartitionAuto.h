@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_AUTO_H__
+#define __CIRCLE_PARTITION_AUTO_H__
+
+#include "PartitionCost.h"
+
+#include <luci/IR/Module.h>
+#include <luci/Partition.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace partee
+{
+
+/**
+ * @brief Returns bytes of tensors crossing each boundary between position p and p + 1
+ * @note  Constants and graph inputs are not counted as every partition can read them.
+ *        'nodes' are in topological order and 'position' maps each of them to its index.
+ */
+std::vector<uint64_t>
+cut_bytes(const std::vector<luci::CircleNode *> &nodes,
+          const std::unordered_map<const luci::CircleNode *, size_t> &position);
+
+/**
+ * @brief Returns first position of each stage after splitting costs into 'parts' stages
+ * @note  'parts' should be in [1, costs.size()]. Among splits whose most expensive stage is
+ *        within tolerance of the best one, sum of 'cut' at stage boundaries is minimized.
+ */
+std::vector<size_t> split_stages(const std::vector<double> &costs,
+                                 const std::vector<uint64_t> &cut, size_t parts);
+
+/**
+ * @brief Make PartitionTable that splits main graph into 'parts' pipeline stages
+ * @note  Nodes are split in topological order into contiguous stages so that the most
+ *        expensive stage is as cheap as possible, then cut tensor bytes are minimized
+ *        among splits within tolerance of that. Stage k is assigned to
+ *        groups[k % groups.size()] by op name, so comply is OPNAME.
+ */
+luci::PartitionTable auto_partition(const luci::Module *module,
+                                    const std::vector<std::string> &groups, uint32_t parts,
+                                    const CostModel &cost);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_AUTO_H__
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionAuto.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ *  input -> sqrt_a -> sqrt_b -> sqrt_c -> add -> output
+ *             |                           ^
+ *             +---------------------------+
+ */
+class SkipGraph : public TestIOGraph
+{
+public:
+  SkipGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+
+    _sqrt_a = make_sqrt("sqrt_a", input(), shape);
+    _sqrt_b = make_sqrt("sqrt_b", _sqrt_a, shape);
+    _sqrt_c = make_sqrt("sqrt_c", _sqrt_b, shape);
+
+    _add = g()->nodes()->create<luci::CircleAdd>();
+    _add->x(_sqrt_c);
+    _add->y(_sqrt_a);
+    _add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _add->dtype(loco::DataType::FLOAT32);
+    _add->shape(shape);
+    _add->name("add");
+
+    output()->from(_add);
+  }
+
+  // Nodes in topological order
+  std::vector<luci::CircleNode *> nodes(void) { return {_sqrt_a, _sqrt_b, _sqrt_c, _add}; }
+
+private:
+  luci::CircleSqrt *make_sqrt(const std::string &name, loco::Node *x, const ShapeU32 shape)
+  {
+    auto sqrt = g()->nodes()->create<luci::CircleSqrt>();
+    sqrt->x(x);
+    sqrt->dtype(loco::DataType::FLOAT32);
+    sqrt->shape(shape);
+    sqrt->name(name);
+    return sqrt;
+  }
+
+private:
+  luci::CircleSqrt *_sqrt_a = nullptr;
+  luci::CircleSqrt *_sqrt_b = nullptr;
+  luci::CircleSqrt *_sqrt_c = nullptr;
+  luci::CircleAdd *_add = nullptr;
+};
+
+} // namespace
+
+TEST(PartitionAutoTest, cut_bytes_skip_connection)
+{
+  SkipGraph g;
+  g.init({1, 4});
+
+  auto nodes = g.nodes();
+  std::unordered_map<const luci::CircleNode *, size_t> position;
+  for (size_t i = 0; i < nodes.size(); ++i)
+    position[nodes[i]] = i;
+
+  // sqrt_a is alive until add, so it crosses every boundary
+  auto cut = partee::cut_bytes(nodes, position);
+  ASSERT_EQ(4, cut.size());
+  EXPECT_EQ(16, cut[0]);
+  EXPECT_EQ(32, cut[1]);
+  EXPECT_EQ(32, cut[2]);
+  EXPECT_EQ(0, cut[3]);
+}
+
+TEST(PartitionAutoTest, split_stages_balanced)
+{
+  std::vector<double> costs{1, 1, 1, 1, 1, 1};
+  std::vector<uint64_t> cut(costs.size(), 0);
+
+  auto starts = partee::split_stages(costs, cut, 3);
+  EXPECT_EQ((std::vector<size_t>{0, 2, 4}), starts);
+}
+
+TEST(PartitionAutoTest, split_stages_single_part)
+{
+  std::vector<double> costs{3, 1, 2};
+  std::vector<uint64_t> cut(costs.size(), 0);
+
+  auto starts = partee::split_stages(costs, cut, 1);
+  EXPECT_EQ((std::vector<size_t>{0}), starts);
+}
+
+TEST(PartitionAutoTest, split_stages_cut_tie_break)
+{
+  // Splitting before or after the middle node gives the same bottleneck, 5
+  std::vector<double> costs{1, 4, 1};
+
+  auto starts = partee::split_stages(costs, {100, 10, 0}, 2);
+  EXPECT_EQ((std::vector<size_t>{0, 2}), starts);
+
+  starts = partee::split_stages(costs, {10, 100, 0}, 2);
+  EXPECT_EQ((std::vector<size_t>{0, 1}), starts);
+}
+
+TEST(PartitionAutoTest, split_stages_balance_over_cut)
+{
+  // Cut is never traded for a bottleneck worse than tolerance
+  std::vector<double> costs{1, 1, 1, 1};
+
+  auto starts = partee::split_stages(costs, {0, 1000, 0, 0}, 2);
+  EXPECT_EQ((std::vector<size_t>{0, 2}), starts);
+}
+
+TEST(PartitionAutoTest, auto_partition_parts_more_than_nodes)
+{
+  luci::Module module;
+
+  SkipGraph g;
+  g.init({1, 4});
+  g.transfer_to(&module);
+
+  // Stages are as many as nodes, and assigned to groups in turn
+  partee::CostModel cost;
+  auto table = partee::auto_partition(&module, {"cpu", "acl_cl"}, 8, cost);
+
+  EXPECT_EQ(luci::PartitionTable::COMPLY::OPNAME, table.comply);
+  EXPECT_EQ("cpu", table.default_group);
+  ASSERT_EQ(4, table.byopnames.size());
+  EXPECT_EQ("cpu", table.byopnames.at("sqrt_a"));
+  EXPECT_EQ("acl_cl", table.byopnames.at("sqrt_b"));
+  EXPECT_EQ("cpu", table.byopnames.at("sqrt_c"));
+  EXPECT_EQ("acl_cl", table.byopnames.at("add"));
+}
+
+TEST(PartitionAutoTest, auto_partition_two_parts)
+{
+  luci::Module module;
+
+  SkipGraph g;
+  g.init({1, 4});
+  g.transfer_to(&module);
+
+  // Analytic costs are 32, 32, 32 and 48 bytes, so [sqrt_a, sqrt_b] and [sqrt_c, add]
+  partee::CostModel cost;
+  auto table = partee::auto_partition(&module, {"cpu", "acl_cl"}, 2, cost);
+
+  ASSERT_EQ(4, table.byopnames.size());
+  EXPECT_EQ("cpu", table.byopnames.at("sqrt_a"));
+  EXPECT_EQ("cpu", table.byopnames.at("sqrt_b"));
+  EXPECT_EQ("acl_cl", table.byopnames.at("sqrt_c"));
+  EXPECT_EQ("acl_cl", table.byopnames.at("add"));
+}
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/DataTypeHelper.h>
+#include <luci/Log.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+// Rough arithmetic intensity where an op turns from memory bound to compute bound
+constexpr double kFlopsPerByte = 8.0;
+
+uint64_t num_elements(const luci::CircleNode *node)
+{
+  uint64_t count = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (node->dim(i).known())
+      count *= node->dim(i).value();
+  }
+  return count;
+}
+
+uint64_t dim_value(const luci::CircleNode *node, uint32_t axis)
+{
+  if (axis >= node->rank() || !node->dim(axis).known())
+    return 1;
+  return node->dim(axis).value();
+}
+
+const luci::CircleNode *arg_of(const luci::CircleNode *node, uint32_t index)
+{
+  return loco::must_cast<const luci::CircleNode *>(node->arg(index));
+}
+
+/**
+ * @brief Returns multiply-accumulate based FLOPs for compute heavy ops, 0 for others
+ */
+double flops_of(const luci::CircleNode *node)
+{
+  const auto out_elems = static_cast<double>(num_elements(node));
+
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CONV_2D:
+    {
+      // filter is OHWI
+      auto filter = loco::must_cast<const luci::CircleNode *>(
+        loco::must_cast<const luci::CircleConv2D *>(node)->filter());
+      return 2.0 * out_elems * dim_value(filter, 1) * dim_value(filter, 2) * dim_value(filter, 3);
+    }
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+    {
+      // filter is 1HWC
+      auto filter = loco::must_cast<const luci::CircleNode *>(
+        loco::must_cast<const luci::CircleDepthwiseConv2D *>(node)->filter());
+      return 2.0 * out_elems * dim_value(filter, 1) * dim_value(filter, 2);
+    }
+    case luci::CircleOpcode::FULLY_CONNECTED:
+    {
+      auto weights = loco::must_cast<const luci::CircleNode *>(
+        loco::must_cast<const luci::CircleFullyConnected *>(node)->weights());
+      return 2.0 * out_elems * dim_value(weights, 1);
+    }
+    case luci::CircleOpcode::TRANSPOSE_CONV:
+    {
+      // each input element is scattered to O x H x W outputs
+      auto tconv = loco::must_cast<const luci::CircleTransposeConv *>(node);
+      auto filter = loco::must_cast<const luci::CircleNode *>(tconv->filter());
+      auto input = loco::must_cast<const luci::CircleNode *>(tconv->outBackprop());
+      return 2.0 * num_elements(input) * dim_value(filter, 0) * dim_value(filter, 1) *
+             dim_value(filter, 2);
+    }
+    case luci::CircleOpcode::BATCH_MATMUL:
+    {
+      auto bmm = loco::must_cast<const luci::CircleBatchMatMul *>(node);
+      auto x = loco::must_cast<const luci::CircleNode *>(bmm->x());
+      if (x->rank() < 2)
+        return out_elems;
+      auto depth_axis = bmm->adj_x() ? x->rank() - 2 : x->rank() - 1;
+      return 2.0 * out_elems * dim_value(x, depth_axis);
+    }
+    default:
+      break;
+  }
+  return 0.0;
+}
+
+/**
+ * @brief Returns sum of input and output bytes, which is the size key of onert exec_time.json
+ */
+uint64_t io_bytes(const luci::CircleNode *node)
+{
+  uint64_t bytes = partee::tensor_bytes(node);
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    if (node->arg(i) == nullptr)
+      continue;
+    bytes += partee::tensor_bytes(arg_of(node, i));
+  }
+  return bytes;
+}
+
+/**
+ * @brief Returns operation name that onert uses as key in exec_time.json, empty if unknown
+ */
+std::string onert_op_name(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::ADD:
+      return "Add";
+    case luci::CircleOpcode::SUB:
+      return "Sub";
+    case luci::CircleOpcode::MUL:
+      return "Mul";
+    case luci::CircleOpcode::DIV:
+      return "Div";
+    case luci::CircleOpcode::AVERAGE_POOL_2D:
+      return "AvgPool2D";
+    case luci::CircleOpcode::MAX_POOL_2D:
+      return "MaxPool2D";
+    case luci::CircleOpcode::L2_POOL_2D:
+      return "L2Pool2D";
+    case luci::CircleOpcode::RELU:
+    case luci::CircleOpcode::RELU6:
+    case luci::CircleOpcode::RELU_N1_TO_1:
+      return "ReLU";
+    case luci::CircleOpcode::LOGISTIC:
+      return "Logistic";
+    case luci::CircleOpcode::TANH:
+      return "Tanh";
+    case luci::CircleOpcode::LEAKY_RELU:
+      return "LeakyRelu";
+    case luci::CircleOpcode::ELU:
+      return "ELU";
+    case luci::CircleOpcode::MEAN:
+      return "ReduceMean";
+    case luci::CircleOpcode::SUM:
+      return "ReduceSUM";
+    case luci::CircleOpcode::REDUCE_MAX:
+      return "ReduceMax";
+    case luci::CircleOpcode::CONV_2D:
+      return "Conv2D";
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+      return "DepthwiseConv2D";
+    case luci::CircleOpcode::FULLY_CONNECTED:
+      return "FullyConnected";
+    case luci::CircleOpcode::TRANSPOSE_CONV:
+      return "TransposeConv";
+    case luci::CircleOpcode::BATCH_MATMUL:
+      return "BatchMatMul";
+    case luci::CircleOpcode::CONCATENATION:
+      return "Concat";
+    case luci::CircleOpcode::RESHAPE:
+      return "Reshape";
+    case luci::CircleOpcode::SOFTMAX:
+      return "Softmax";
+    case luci::CircleOpcode::TRANSPOSE:
+      return "Transpose";
+    case luci::CircleOpcode::PAD:
+      return "Pad";
+    default:
+      break;
+  }
+  return "";
+}
+
+/**
+ * @brief Minimal reader for onert exec_time.json, which is nested objects and number arrays
+ */
+class ExecTimeReader
+{
+public:
+  ExecTimeReader(const std::string &text) : _text(text) {}
+
+public:
+  void object(const std::function<void(const std::string &)> &on_key)
+  {
+    expect('{');
+    if (accept('}'))
+      return;
+    do
+    {
+      auto key = string();
+      expect(':');
+      on_key(key);
+    } while (accept(','));
+    expect('}');
+  }
+
+  void array(const std::function<void(void)> &on_item)
+  {
+    expect('[');
+    if (accept(']'))
+      return;
+    do
+    {
+      on_item();
+    } while (accept(','));
+    expect(']');
+  }
+
+  double number(void)
+  {
+    skip_ws();
+    size_t used = 0;
+    double value = std::stod(_text.substr(_pos, 32), &used);
+    _pos += used;
+    return value;
+  }
+
+private:
+  std::string string(void)
+  {
+    expect('"');
+    auto end = _text.find('"', _pos);
+    if (end == std::string::npos)
+      throw std::runtime_error("Unterminated string");
+    auto str = _text.substr(_pos, end - _pos);
+    _pos = end + 1;
+    return str;
+  }
+
+  void skip_ws(void)
+  {
+    while (_pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos])))
+      _pos++;
+  }
+
+  bool accept(char c)
+  {
+    skip_ws();
+    if (_pos < _text.size() && _text[_pos] == c)
+    {
+      _pos++;
+      return true;
+    }
+    return false;
+  }
+
+  void expect(char c)
+  {
+    if (!accept(c))
+      throw std::runtime_error(std::string("Expected '") + c + "' at " + std::to_string(_pos));
+  }
+
+private:
+  const std::string &_text;
+  size_t _pos = 0;
+};
+
+using ExecTimeTable =
+  std::unordered_map<std::string, std::vector<std::pair<uint64_t, int64_t>>>; // per op name
+
+} // namespace
+
+namespace partee
+{
+
+uint64_t tensor_bytes(const luci::CircleNode *node)
+{
+  return num_elements(node) * luci::size(node->dtype());
+}
+
+double analytic_cost(const luci::CircleNode *node)
+{
+  auto flops = flops_of(node);
+  auto bytes = static_cast<double>(io_bytes(node));
+  return std::max(flops / kFlopsPerByte, bytes);
+}
+
+bool CostModel::load_exec_time(const std::string &path, const std::string &backend)
+{
+  LOGGER(l);
+
+  std::ifstream fs(path);
+  if (not fs.good())
+  {
+    std::cerr << "ERROR: Failed to open cost file: " << path << std::endl;
+    return false;
+  }
+  std::stringstream ss;
+  ss << fs.rdbuf();
+  const auto text = ss.str();
+
+  // backend -> op name -> samples, samples of quant and non-quant are merged
+  std::map<std::string, ExecTimeTable> tables;
+  try
+  {
+    ExecTimeReader reader(text);
+    reader.object([&](const std::string &be) {
+      auto &table = tables[be];
+      reader.object([&](const std::string &op) {
+        auto &samples = table[op];
+        reader.object([&](const std::string &) {
+          reader.array([&]() {
+            std::vector<double> item;
+            reader.array([&]() { item.push_back(reader.number()); });
+            if (item.size() != 2)
+              throw std::runtime_error("Invalid sample of " + op);
+            samples.emplace_back(static_cast<uint64_t>(item[0]), static_cast<int64_t>(item[1]));
+          });
+        });
+      });
+    });
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "ERROR: Failed to parse cost file: " << path << ": " << e.what() << std::endl;
+    return false;
+  }
+
+  if (tables.empty())
+  {
+    std::cerr << "ERROR: No backend in cost file: " << path << std::endl;
+    return false;
+  }
+
+  auto it = tables.find(backend);
+  if (it == tables.end())
+  {
+    it = tables.begin();
+    std::cerr << "WARNING: '" << backend << "' not in cost file, use '" << it->first << "'"
+              << std::endl;
+  }
+  _exec_time = it->second;
+
+  INFO(l) << "Cost: " << _exec_time.size() << " ops from '" << it->first << "'" << std::endl;
+  return true;
+}
+
+bool CostModel::profiled_time(const luci::CircleNode *node, double &time) const
+{
+  auto name = onert_op_name(node);
+  if (name.empty())
+    return false;
+  auto it = _exec_time.find(name);
+  if (it == _exec_time.end() || it->second.empty())
+    return false;
+
+  // Take sample of nearest size and scale it linearly with size
+  const auto size = io_bytes(node);
+  const std::pair<uint64_t, int64_t> *nearest = nullptr;
+  uint64_t nearest_diff = std::numeric_limits<uint64_t>::max();
+  for (auto &sample : it->second)
+  {
+    auto diff = sample.first > size ? sample.first - size : size - sample.first;
+    if (diff < nearest_diff)
+    {
+      nearest_diff = diff;
+      nearest = &sample;
+    }
+  }
+  assert(nearest != nullptr);
+
+  time = static_cast<double>(nearest->second);
+  if (nearest->first > 0)
+    time = time * static_cast<double>(size) / static_cast<double>(nearest->first);
+  return true;
+}
+
+std::vector<double> CostModel::costs(const std::vector<luci::CircleNode *> &nodes) const
+{
+  std::vector<double> result(nodes.size());
+  std::vector<bool> profiled(nodes.size(), false);
+  std::vector<double> ratios;
+
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    double time = 0.0;
+    auto analytic = analytic_cost(nodes[i]);
+    if (profiled_time(nodes[i], time))
+    {
+      result[i] = time;
+      profiled[i] = true;
+      if (analytic > 0.0)
+        ratios.push_back(time / analytic);
+    }
+    else
+    {
+      result[i] = analytic;
+    }
+  }
+
+  // Bring analytic costs to the unit of profiled time
+  if (!ratios.empty())
+  {
+    auto mid = ratios.begin() + ratios.size() / 2;
+    std::nth_element(ratios.begin(), mid, ratios.end());
+    const auto ratio = *mid;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+      if (!profiled[i])
+        result[i] *= ratio;
+    }
+  }
+
+  return result;
+}
+
+} // namespace partee
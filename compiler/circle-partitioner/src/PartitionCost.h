@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_COST_H__
+#define __CIRCLE_PARTITION_COST_H__
+
+#include <luci/IR/CircleNode.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace partee
+{
+
+/**
+ * @brief Returns size of output tensor of node in bytes, unknown dimension is counted as 1
+ */
+uint64_t tensor_bytes(const luci::CircleNode *node);
+
+/**
+ * @brief Returns analytic cost of node as max(FLOPs / kFlopsPerByte, bytes accessed)
+ */
+double analytic_cost(const luci::CircleNode *node);
+
+/**
+ * @brief CostModel provides per-node cost for automatic partitioning
+ * @note  Without profile, cost is analytic. With onert JSONExecTime profile loaded,
+ *        profiled nodes use measured time and others use analytic cost scaled by
+ *        median time/analytic ratio of profiled nodes.
+ */
+class CostModel
+{
+public:
+  /**
+   * @brief Load onert exec_time.json of 'backend', first backend in file if not found
+   * @return false if file cannot be read or parsed
+   */
+  bool load_exec_time(const std::string &path, const std::string &backend);
+
+  /**
+   * @brief Returns cost of each node in same order of nodes
+   */
+  std::vector<double> costs(const std::vector<luci::CircleNode *> &nodes) const;
+
+private:
+  bool profiled_time(const luci::CircleNode *node, double &time) const;
+
+private:
+  // onert operation name -> (input+output bytes, time in us)
+  std::unordered_map<std::string, std::vector<std::pair<uint64_t, int64_t>>> _exec_time;
+};
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_COST_H__
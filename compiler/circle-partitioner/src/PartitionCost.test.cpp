@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+#include <luci/IR/Nodes/CircleTanh.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ *  input -> tanh -> sqrt -> output
+ *
+ *  Tanh is known to onert exec_time.json while Sqrt is not
+ */
+class TanhSqrtGraph : public TestIOGraph
+{
+public:
+  TanhSqrtGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+
+    _tanh = g()->nodes()->create<luci::CircleTanh>();
+    _tanh->x(input());
+    _tanh->dtype(loco::DataType::FLOAT32);
+    _tanh->shape(shape);
+    _tanh->name("tanh");
+
+    _sqrt = g()->nodes()->create<luci::CircleSqrt>();
+    _sqrt->x(_tanh);
+    _sqrt->dtype(loco::DataType::FLOAT32);
+    _sqrt->shape(shape);
+    _sqrt->name("sqrt");
+
+    output()->from(_sqrt);
+  }
+
+  std::vector<luci::CircleNode *> nodes(void) { return {_tanh, _sqrt}; }
+
+private:
+  luci::CircleTanh *_tanh = nullptr;
+  luci::CircleSqrt *_sqrt = nullptr;
+};
+
+class CostFile
+{
+public:
+  CostFile(const std::string &text)
+  {
+    char name_template[] = "/tmp/partition_cost_XXXXXX";
+    int fd = mkstemp(name_template);
+    if (fd == -1)
+      throw std::runtime_error{"mkstemp failed"};
+    close(fd);
+    _path = name_template;
+
+    std::ofstream fs(_path);
+    fs << text;
+  }
+
+  ~CostFile() { std::remove(_path.c_str()); }
+
+  const std::string &path(void) const { return _path; }
+
+private:
+  std::string _path;
+};
+
+} // namespace
+
+TEST(PartitionCostTest, analytic_cost)
+{
+  TanhSqrtGraph g;
+  g.init({1, 4});
+
+  // No FLOPs are counted for elementwise ops, so cost is input and output bytes
+  partee::CostModel cost;
+  auto costs = cost.costs(g.nodes());
+  ASSERT_EQ(2, costs.size());
+  EXPECT_DOUBLE_EQ(32.0, costs[0]);
+  EXPECT_DOUBLE_EQ(32.0, costs[1]);
+}
+
+TEST(PartitionCostTest, load_exec_time)
+{
+  TanhSqrtGraph g;
+  g.init({1, 4});
+
+  // Size key of a sample is input and output bytes, 32 for tanh
+  CostFile file(R"({
+    "acl_cl": { "Tanh": { "0": [[32, 7]] } },
+    "cpu": {
+      "Tanh": { "0": [[32, 100], [128, 300]], "1": [] },
+      "Add": { "0": [[48, 20]] }
+    }
+  })");
+
+  partee::CostModel cost;
+  ASSERT_TRUE(cost.load_exec_time(file.path(), "cpu"));
+
+  // Sqrt is not profiled, so its analytic cost is scaled by time/analytic ratio of tanh
+  auto costs = cost.costs(g.nodes());
+  ASSERT_EQ(2, costs.size());
+  EXPECT_DOUBLE_EQ(100.0, costs[0]);
+  EXPECT_DOUBLE_EQ(100.0, costs[1]);
+}
+
+TEST(PartitionCostTest, load_exec_time_scale_by_size)
+{
+  TanhSqrtGraph g;
+  g.init({1, 4});
+
+  // Nearest sample is scaled linearly with size
+  CostFile file(R"({ "cpu": { "Tanh": { "0": [[64, 300]] } } })");
+
+  partee::CostModel cost;
+  ASSERT_TRUE(cost.load_exec_time(file.path(), "cpu"));
+
+  auto costs = cost.costs(g.nodes());
+  ASSERT_EQ(2, costs.size());
+  EXPECT_DOUBLE_EQ(150.0, costs[0]);
+}
+
+TEST(PartitionCostTest, load_exec_time_other_backend)
+{
+  TanhSqrtGraph g;
+  g.init({1, 4});
+
+  // First backend in file is used if the backend is not found
+  CostFile file(R"({ "acl_cl": { "Tanh": { "0": [[32, 7]] } } })");
+
+  partee::CostModel cost;
+  ASSERT_TRUE(cost.load_exec_time(file.path(), "cpu"));
+
+  auto costs = cost.costs(g.nodes());
+  ASSERT_EQ(2, costs.size());
+  EXPECT_DOUBLE_EQ(7.0, costs[0]);
+}
+
+TEST(PartitionCostTest, load_exec_time_no_file_NEG)
+{
+  partee::CostModel cost;
+  EXPECT_FALSE(cost.load_exec_time("/tmp/partition_cost_not_exist.json", "cpu"));
+}
+
+TEST(PartitionCostTest, load_exec_time_invalid_sample_NEG)
+{
+  CostFile file(R"({ "cpu": { "Tanh": { "0": [[32, 100, 1]] } } })");
+
+  partee::CostModel cost;
+  EXPECT_FALSE(cost.load_exec_time(file.path(), "cpu"));
+}
+
+TEST(PartitionCostTest, load_exec_time_broken_json_NEG)
+{
+  CostFile file(R"({ "cpu": { "Tanh": )");
+
+  partee::CostModel cost;
+  EXPECT_FALSE(cost.load_exec_time(file.path(), "cpu"));
+}
+
+TEST(PartitionCostTest, load_exec_time_empty_NEG)
+{
+  CostFile file("{}");
+
+  partee::CostModel cost;
+  EXPECT_FALSE(cost.load_exec_time(file.path(), "cpu"));
+}
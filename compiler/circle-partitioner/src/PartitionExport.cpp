@@ -18,6 +18,7 @@
 #include "HelperPath.h"
 
 #include <crew/PConfig.h>
+#include <crew/PConfigIni.h>
 
 #include <iostream>
 #include <fstream>
@@ -77,6 +78,39 @@ void pms2config(const luci::PartedModules &pms, crew::PConfig &pconfig)
   }
 }
 
+crew::Sections table2sections(const luci::PartitionTable &table)
+{
+  crew::Section partition;
+  partition.name = "partition";
+  std::string backends;
+  for (auto &group : table.groups)
+  {
+    if (!backends.empty())
+      backends += ",";
+    backends += group;
+  }
+  partition.items["backends"] = backends;
+  partition.items["default"] = table.default_group;
+
+  crew::Section rules;
+  if (table.comply == luci::PartitionTable::COMPLY::OPNAME)
+  {
+    partition.items["comply"] = "opname";
+    rules.name = "OPNAME";
+    for (auto &item : table.byopnames)
+      rules.items.emplace(item.first, item.second);
+  }
+  else
+  {
+    partition.items["comply"] = "opcode";
+    rules.name = "OPCODE";
+    for (auto &item : table.byopcodes)
+      rules.items.emplace(item.first, item.second);
+  }
+
+  return crew::Sections{partition, rules};
+}
+
 } // namespace
 
 namespace partee
@@ -142,4 +176,19 @@ bool export_part_conn_ini(const std::string &output_base, const std::string &inp
   return true;
 }
 
+bool export_part_file(const std::string &path, const luci::PartitionTable &table)
+{
+  try
+  {
+    crew::write_ini(path, table2sections(table));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "ERROR: Failed to write partition file: " << path << ": " << e.what()
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
 } // namespace partee
@@ -30,12 +30,22 @@ namespace partee
 bool export_part_conn_json(const std::string &output_base, const std::string &input,
                            const luci::Module *source, luci::PartedModules &pms);
 
+/**
+ * @brief This will save partition table to partition file in ini format
+ */
+bool export_part_file(const std::string &path, const luci::PartitionTable &table);
+
 /**
  * @brief This will save partition connection to ini format file
  */
 bool export_part_conn_ini(const std::string &output_base, const std::string &input,
                           const luci::Module *source, luci::PartedModules &pms);
 
+/**
+ * @brief This will save partition table to partition file in ini format
+ */
+bool export_part_file(const std::string &path, const luci::PartitionTable &table);
+
 } // namespace partee
 
 #endif // __CIRCLE_PARTITION_EXPORT_H__
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BF16_H__
+#define __NNFW_CKER_BF16_H__
+
+#include <cstdint>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// bfloat16 storage type, the upper half of a fp32. Arithmetic is always done in fp32.
+struct BFloat16
+{
+  uint16_t bits;
+};
+
+static_assert(sizeof(BFloat16) == 2, "BFloat16 must be 2 bytes");
+
+inline float Bf16ToFp32(BFloat16 h)
+{
+  const uint32_t bits = static_cast<uint32_t>(h.bits) << 16;
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Rounds to nearest, ties to even
+inline BFloat16 Fp32ToBf16(float f)
+{
+  uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+  if ((x & 0x7fffffff) > 0x7f800000)
+  {
+    // Keep nan quiet, as truncation could turn it into inf
+    return BFloat16{static_cast<uint16_t>((x >> 16) | 0x40)};
+  }
+  x += 0x7fff + ((x >> 16) & 1);
+  return BFloat16{static_cast<uint16_t>(x >> 16)};
+}
+
+// Plain loops of integer operations, which compilers vectorize
+inline void ConvertBf16ToFp32(const BFloat16 *input, float *output, int size)
+{
+  for (int i = 0; i < size; ++i)
+    output[i] = Bf16ToFp32(input[i]);
+}
+
+inline void ConvertFp32ToBf16(const float *input, BFloat16 *output, int size)
+{
+  for (int i = 0; i < size; ++i)
+    output[i] = Fp32ToBf16(input[i]);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BF16_H__
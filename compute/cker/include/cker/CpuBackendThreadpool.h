@@ -21,7 +21,10 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 namespace nnfw
 {
@@ -44,6 +47,60 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+// Below this many elements per task, the cost of waking up a worker is larger than the work
+// itself, so ParallelFor keeps the range on the calling thread.
+constexpr int64_t kMinWorkPerTask = 16 * 1024;
+
+// Number of tasks ParallelFor uses to split 'total' units, each costing 'work_per_unit' elements
+inline int GetTaskCount(const ruy::Context *ruy_context, int64_t total, int64_t work_per_unit)
+{
+  if (ruy_context == nullptr || total <= 1)
+    return 1;
+  const int64_t total_work = total * std::max<int64_t>(work_per_unit, 1);
+  const int64_t max_tasks_by_work = std::max<int64_t>(total_work / kMinWorkPerTask, 1);
+  return static_cast<int>(
+    std::min<int64_t>({static_cast<int64_t>(ruy_context->max_num_threads()), max_tasks_by_work,
+                       total}));
+}
+
+template <typename Fn> struct ParallelForTask : Task
+{
+  ParallelForTask(const Fn &fn, int64_t begin, int64_t end) : _fn(fn), _begin(begin), _end(end) {}
+
+  void Run() override { _fn(_begin, _end); }
+
+private:
+  const Fn &_fn;
+  int64_t _begin;
+  int64_t _end;
+};
+
+// Splits [0, total) into contiguous ranges and calls fn(begin, end) for each of them on the
+// threads of ruy_context. Kernels whose output ranges are independent can use this to shard the
+// work. With a null context, one thread or too little work, fn(0, total) runs inline.
+template <typename Fn>
+void ParallelFor(ruy::Context *ruy_context, int64_t total, int64_t work_per_unit, const Fn &fn)
+{
+  const int task_count = GetTaskCount(ruy_context, total, work_per_unit);
+  if (task_count <= 1)
+  {
+    if (total > 0)
+      fn(int64_t{0}, total);
+    return;
+  }
+
+  std::vector<ParallelForTask<Fn>> tasks;
+  tasks.reserve(task_count);
+  int64_t begin = 0;
+  for (int i = 0; i < task_count; ++i)
+  {
+    const int64_t end = begin + (total - begin) / (task_count - i);
+    tasks.emplace_back(fn, begin, end);
+    begin = end;
+  }
+  Execute(task_count, tasks.data(), ruy_context);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
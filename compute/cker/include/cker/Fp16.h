@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_H__
+#define __NNFW_CKER_FP16_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/neon/neon_check.h"
+#include "cker/x86/x86_check.h"
+
+#include <cstdint>
+#include <cstring>
+
+// Bulk conversion uses the NEON fp16 conversion instructions where the target has them (AArch64
+// and ARMv7 with VFPv4/fp16), and F16C on x86 hosts that report it.
+#if defined(USE_NEON) && (defined(__aarch64__) || (defined(__ARM_FP) && (__ARM_FP & 2)))
+#define CKER_NEON_FP16_CONVERT
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+// IEEE 754 binary16 storage type. Arithmetic is always done in fp32.
+struct Float16
+{
+  uint16_t bits;
+};
+
+static_assert(sizeof(Float16) == 2, "Float16 must be 2 bytes");
+
+inline float Fp16ToFp32(Float16 h)
+{
+  const uint32_t sign = static_cast<uint32_t>(h.bits & 0x8000) << 16;
+  const uint32_t exp = (h.bits >> 10) & 0x1f;
+  uint32_t mant = h.bits & 0x3ff;
+  uint32_t bits;
+  if (exp == 0x1f)
+  {
+    // inf or nan
+    bits = sign | 0x7f800000 | (mant << 13);
+  }
+  else if (exp != 0)
+  {
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  }
+  else if (mant == 0)
+  {
+    bits = sign;
+  }
+  else
+  {
+    // Subnormal: normalize the mantissa
+    uint32_t e = 0;
+    while ((mant & 0x400) == 0)
+    {
+      mant <<= 1;
+      ++e;
+    }
+    bits = sign | ((113 - e) << 23) | ((mant & 0x3ff) << 13);
+  }
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Rounds to nearest, ties to even
+inline Float16 Fp32ToFp16(float f)
+{
+  uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+  const uint16_t sign = static_cast<uint16_t>((x >> 16) & 0x8000);
+  x &= 0x7fffffff;
+
+  if (x >= 0x7f800000)
+  {
+    // inf or nan
+    return Float16{static_cast<uint16_t>(sign | (x > 0x7f800000 ? 0x7e00 : 0x7c00))};
+  }
+  if (x >= 0x477ff000)
+  {
+    // Rounds to a value beyond the fp16 range
+    return Float16{static_cast<uint16_t>(sign | 0x7c00)};
+  }
+  if (x < 0x38800000)
+  {
+    // Result is subnormal or zero
+    if (x < 0x33000000)
+      return Float16{sign};
+    const uint32_t e = x >> 23;
+    const uint32_t mant = (x & 0x7fffff) | 0x800000;
+    const uint32_t shift = 126 - e;
+    uint32_t bits = mant >> shift;
+    const uint32_t rem = mant & ((1u << shift) - 1);
+    const uint32_t half = 1u << (shift - 1);
+    if (rem > half || (rem == half && (bits & 1)))
+      ++bits;
+    return Float16{static_cast<uint16_t>(sign | bits)};
+  }
+  uint32_t r = x - 0x38000000;
+  r += 0xfff + ((r >> 13) & 1);
+  return Float16{static_cast<uint16_t>(sign | (r >> 13))};
+}
+
+inline void PortableConvertFp16ToFp32(const Float16 *input, float *output, int size)
+{
+  for (int i = 0; i < size; ++i)
+    output[i] = Fp16ToFp32(input[i]);
+}
+
+inline void PortableConvertFp32ToFp16(const float *input, Float16 *output, int size)
+{
+  for (int i = 0; i < size; ++i)
+    output[i] = Fp32ToFp16(input[i]);
+}
+
+// Dot product of a fp16 row with a fp32 vector, accumulated in fp32
+inline float PortableFp16DotProduct(const Float16 *a, const float *b, int size)
+{
+  float sum = 0.f;
+  for (int i = 0; i < size; ++i)
+    sum += Fp16ToFp32(a[i]) * b[i];
+  return sum;
+}
+
+#ifdef CKER_X86_SIMD
+
+namespace x86
+{
+
+CKER_TARGET_F16C inline void ConvertFp16ToFp32(const Float16 *input, float *output, int size)
+{
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+    _mm256_storeu_ps(output + i, _mm256_cvtph_ps(h));
+  }
+  PortableConvertFp16ToFp32(input + i, output + i, size - i);
+}
+
+CKER_TARGET_F16C inline void ConvertFp32ToFp16(const float *input, Float16 *output, int size)
+{
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), h);
+  }
+  PortableConvertFp32ToFp16(input + i, output + i, size - i);
+}
+
+CKER_TARGET_F16C inline float Fp16DotProduct(const Float16 *a, const float *b, int size)
+{
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  int i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    const __m256 a0 =
+      _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)));
+    const __m256 a1 =
+      _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i + 8)));
+    acc0 = _mm256_fmadd_ps(a0, _mm256_loadu_ps(b + i), acc0);
+    acc1 = _mm256_fmadd_ps(a1, _mm256_loadu_ps(b + i + 8), acc1);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    const __m256 a0 =
+      _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)));
+    acc0 = _mm256_fmadd_ps(a0, _mm256_loadu_ps(b + i), acc0);
+  }
+  __m256 acc = _mm256_add_ps(acc0, acc1);
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+  return _mm_cvtss_f32(sum) + PortableFp16DotProduct(a + i, b + i, size - i);
+}
+
+} // namespace x86
+
+#endif // CKER_X86_SIMD
+
+#ifdef CKER_NEON_FP16_CONVERT
+
+inline void NeonConvertFp16ToFp32(const Float16 *input, float *output, int size)
+{
+  int i = 0;
+  for (; i <= size - 4; i += 4)
+  {
+    const uint16x4_t h = vld1_u16(reinterpret_cast<const uint16_t *>(input + i));
+    vst1q_f32(output + i, vcvt_f32_f16(vreinterpret_f16_u16(h)));
+  }
+  PortableConvertFp16ToFp32(input + i, output + i, size - i);
+}
+
+inline void NeonConvertFp32ToFp16(const float *input, Float16 *output, int size)
+{
+  int i = 0;
+  for (; i <= size - 4; i += 4)
+  {
+    const float16x4_t h = vcvt_f16_f32(vld1q_f32(input + i));
+    vst1_u16(reinterpret_cast<uint16_t *>(output + i), vreinterpret_u16_f16(h));
+  }
+  PortableConvertFp32ToFp16(input + i, output + i, size - i);
+}
+
+inline float NeonFp16DotProduct(const Float16 *a, const float *b, int size)
+{
+  float32x4_t acc0 = vdupq_n_f32(0.f);
+  float32x4_t acc1 = vdupq_n_f32(0.f);
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const uint16x8_t h = vld1q_u16(reinterpret_cast<const uint16_t *>(a + i));
+    const float32x4_t a0 = vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(h)));
+    const float32x4_t a1 = vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(h)));
+    acc0 = vmlaq_f32(acc0, a0, vld1q_f32(b + i));
+    acc1 = vmlaq_f32(acc1, a1, vld1q_f32(b + i + 4));
+  }
+  const float32x4_t acc = vaddq_f32(acc0, acc1);
+  float sum = vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1) + vgetq_lane_f32(acc, 2) +
+              vgetq_lane_f32(acc, 3);
+  return sum + PortableFp16DotProduct(a + i, b + i, size - i);
+}
+
+#endif // CKER_NEON_FP16_CONVERT
+
+inline void ConvertFp16ToFp32(const Float16 *input, float *output, int size)
+{
+#if defined(CKER_X86_SIMD)
+  if (x86::HasF16c())
+    return x86::ConvertFp16ToFp32(input, output, size);
+#elif defined(CKER_NEON_FP16_CONVERT)
+  return NeonConvertFp16ToFp32(input, output, size);
+#endif
+  PortableConvertFp16ToFp32(input, output, size);
+}
+
+inline void ConvertFp32ToFp16(const float *input, Float16 *output, int size)
+{
+#if defined(CKER_X86_SIMD)
+  if (x86::HasF16c())
+    return x86::ConvertFp32ToFp16(input, output, size);
+#elif defined(CKER_NEON_FP16_CONVERT)
+  return NeonConvertFp32ToFp16(input, output, size);
+#endif
+  PortableConvertFp32ToFp16(input, output, size);
+}
+
+inline float Fp16DotProduct(const Float16 *a, const float *b, int size)
+{
+#if defined(CKER_X86_SIMD)
+  if (x86::HasF16c())
+    return x86::Fp16DotProduct(a, b, size);
+#elif defined(CKER_NEON_FP16_CONVERT)
+  return NeonFp16DotProduct(a, b, size);
+#endif
+  return PortableFp16DotProduct(a, b, size);
+}
+
+// result[b][r] += dot(matrix[r], vectors[b]) for a fp16 matrix of m_rows x m_cols and
+// n_batch fp32 vectors of m_cols. Rows are distributed over the context's threads.
+inline void Fp16MatrixBatchVectorMultiplyAccumulate(const Float16 *matrix, int m_rows, int m_cols,
+                                                    const float *vectors, int n_batch,
+                                                    float *result,
+                                                    ruy::Context *ruy_context = nullptr)
+{
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, m_rows, static_cast<int64_t>(m_cols) * n_batch, [&](int64_t begin, int64_t end) {
+      for (int b = 0; b < n_batch; ++b)
+      {
+        const float *vector = vectors + static_cast<int64_t>(b) * m_cols;
+        float *result_batch = result + static_cast<int64_t>(b) * m_rows;
+        for (int64_t r = begin; r < end; ++r)
+        {
+          result_batch[r] += Fp16DotProduct(matrix + r * m_cols, vector, m_cols);
+        }
+      }
+    });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_H__
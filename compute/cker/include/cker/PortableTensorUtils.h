@@ -22,6 +22,7 @@
 #include "cker/neon/neon_check.h"
 #include <ruy/context.h>
 
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 
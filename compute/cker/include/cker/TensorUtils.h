@@ -21,7 +21,9 @@
 #include "cker/Types.h"
 #include "cker/PortableTensorUtils.h"
 #include "cker/NeonTensorUtils.h"
+#include "cker/X86TensorUtils.h"
 #include "cker/neon/neon_check.h"
+#include "cker/x86/x86_check.h"
 
 #include <cstring>
 #include <cmath>
@@ -33,7 +35,7 @@ namespace cker
 
 inline void CwiseClipping(float *vector, const int v_size, const float clipping_value)
 {
-  NEON_OR_PORTABLE(CwiseClipping, vector, v_size, clipping_value);
+  SIMD_OR_PORTABLE(CwiseClipping, vector, v_size, clipping_value);
 }
 
 inline void VectorBatchVectorAdd(const float *vector, int v_size, int n_batch, float *batch_vector)
@@ -103,7 +105,7 @@ inline void VectorBatchVectorCwiseProductAccumulate(const T *vector, int v_size,
 
 inline bool IsZeroVector(const float *vector, int v_size)
 {
-  return NEON_OR_PORTABLE(IsZeroVector, vector, v_size);
+  return SIMD_OR_PORTABLE(IsZeroVector, vector, v_size);
 }
 
 inline void ApplyActivationToVector(const float *vector, int v_size,
@@ -114,13 +116,13 @@ inline void ApplyActivationToVector(const float *vector, int v_size,
 
 inline void Sub1Vector(const float *vector, int v_size, float *result)
 {
-  NEON_OR_PORTABLE(Sub1Vector, vector, v_size, result);
+  SIMD_OR_PORTABLE(Sub1Vector, vector, v_size, result);
 }
 
 inline void SymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
                                     float *min, float *max, float *scaling_factor)
 {
-  return NEON_OR_PORTABLE(SymmetricQuantizeFloats, values, size, quantized_values, min, max,
+  return SIMD_OR_PORTABLE(SymmetricQuantizeFloats, values, size, quantized_values, min, max,
                           scaling_factor);
 }
 
@@ -129,7 +131,7 @@ inline void MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int
                                                 const float *scaling_factors, int n_batch,
                                                 float *result, int result_stride)
 {
-  NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vector,
+  SIMD_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vector,
                    scaling_factors, n_batch, result, result_stride);
 }
 
@@ -137,7 +139,7 @@ inline void MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows,
                                                 const float *vector, int n_batch, float *result,
                                                 int result_stride)
 {
-  NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vector, n_batch,
+  SIMD_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vector, n_batch,
                    result, result_stride);
 }
 
@@ -147,7 +149,7 @@ inline void MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int
                                                 int32_t *scratch, float *result, int result_stride,
                                                 ruy::Context *ruy_context)
 {
-  NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vectors,
+  SIMD_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vectors,
                    scaling_factors, n_batch, scratch, result, result_stride, ruy_context);
 }
 
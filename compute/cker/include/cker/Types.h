@@ -111,6 +111,12 @@ struct SoftmaxParams
   float *table;
   uint8_t *uint8_table1;
   uint8_t *uint8_table2;
+  // int16 lookup tables of kInt16LUTSize entries
+  int16_t *exp_lut;
+  int16_t *one_over_one_plus_x_lut;
+  // int16 rescale from Q0.15 probability to output scale
+  int32_t output_multiplier;
+  int output_shift;
 };
 
 struct PackParams
@@ -321,6 +327,17 @@ struct RmsNormParams
   float epsilon;
 };
 
+enum class RoPEMode
+{
+  kGptNeox = 0, // rotate first half and second half of head
+  kGptJ = 1,    // rotate adjacent pairs of head
+};
+
+struct RoPEParams
+{
+  RoPEMode mode;
+};
+
 struct TransposeConvParams
 {
   PaddingType padding_type;
@@ -402,6 +419,13 @@ struct SpaceToDepthParams
 struct LeakyReluParams
 {
   float alpha;
+  // Quantized only
+  int32_t input_offset = 0;
+  int32_t output_offset = 0;
+  int32_t output_multiplier_alpha = 0;
+  int32_t output_shift_alpha = 0;
+  int32_t output_multiplier_identity = 0;
+  int32_t output_shift_identity = 0;
 };
 
 struct PadParams
@@ -23,7 +23,10 @@
 #include "neon/neon_check.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <cstdint>
+#include <functional>
 #include <fixedpoint/fixedpoint.h>
 
 namespace nnfw
@@ -99,6 +102,21 @@ inline int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t quantized_multip
     right_shift);
 }
 
+// For int16x8 kernels whose accumulators need 48 bits. The multiplier is reduced to 16 bits so the
+// product stays within int64.
+inline int32_t MultiplyByQuantizedMultiplier(int64_t x, int32_t quantized_multiplier, int shift)
+{
+  assert(quantized_multiplier >= 0);
+  assert(shift >= -31 && shift < 8);
+  assert(x >= -(static_cast<int64_t>(1) << 47) && x < (static_cast<int64_t>(1) << 47));
+
+  const int32_t reduced_multiplier =
+    (quantized_multiplier < 0x7FFF0000) ? ((quantized_multiplier + (1 << 15)) >> 16) : 0x7FFF;
+  const int total_shift = 15 - shift;
+  x = x * static_cast<int64_t>(reduced_multiplier) + (static_cast<int64_t>(1) << (total_shift - 1));
+  return static_cast<int32_t>(x >> total_shift);
+}
+
 inline int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x, int32_t quantized_multiplier,
                                                            int left_shift)
 {
@@ -113,6 +131,45 @@ inline int32_t MultiplyByQuantizedMultiplierSmallerThanOneExp(int32_t x,
     gemmlowp::SaturatingRoundingDoublingHighMul(x, quantized_multiplier), -left_shift);
 }
 
+// Number of entries of the int16 lookup tables. The last entry is only used for the slope.
+constexpr int kInt16LUTSize = 513;
+
+// Samples func over [min, max] into a Q0.15 table for LookupInt16Table. Each entry is biased by
+// half of the interpolation error at the midpoint of its segment.
+inline void PopulateInt16LookupTable(const std::function<double(double)> &func, double min,
+                                     double max, int16_t *table, const int num = kInt16LUTSize)
+{
+  const double step = (max - min) / (num - 1);
+  const double half_step = step / 2.0;
+  for (int i = 0; i < num - 1; i++)
+  {
+    const double sample_val = std::round(func(min + i * step) * 32768.0);
+    const double midpoint_interp_val =
+      std::round((func(min + (i + 1) * step) * 32768.0 + sample_val) / 2.0);
+    const double midpoint_val = std::round(func(min + i * step + half_step) * 32768.0);
+    const double midpoint_err = midpoint_interp_val - midpoint_val;
+    const double bias = std::round(midpoint_err / 2.0);
+    table[i] = static_cast<int16_t>(std::min(std::max(sample_val - bias, -32768.0), 32767.0));
+  }
+  table[num - 1] =
+    static_cast<int16_t>(std::min(std::max(std::round(func(max) * 32768.0), -32768.0), 32767.0));
+}
+
+// Linear interpolation in a table made by PopulateInt16LookupTable. value is the symmetric int16
+// position in [min, max] and the result is Q0.15.
+inline int16_t LookupInt16Table(int16_t value, const int16_t *lut)
+{
+  const uint16_t index = static_cast<uint16_t>(256 + (value >> 7));
+  assert(index < kInt16LUTSize - 1);
+  const int16_t offset = value & 0x7f;
+
+  const int16_t base = lut[index];
+  const int16_t slope = lut[index + 1] - lut[index];
+  // Q0.15 * Q0.7 = Q0.22, rounded back to Q0.15
+  const int32_t delta = (static_cast<int32_t>(slope) * offset + 64) >> 7;
+  return base + delta;
+}
+
 #ifdef USE_NEON
 inline int32x4x4_t MultiplyByQuantizedMultiplier4Rows(int32x4x4_t input_val,
                                                       int32_t quantized_multiplier, int32_t shift)
@@ -0,0 +1,585 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_TENSOR_UTILS_H__
+#define __NNFW_CKER_X86_TENSOR_UTILS_H__
+
+#include "cker/Types.h"
+#include "cker/x86/x86_check.h"
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#ifdef CKER_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+
+constexpr int kFloatsPerAvx2Lane = 8;
+
+namespace x86
+{
+
+CKER_TARGET_AVX2 inline float ReduceSum(__m256 v)
+{
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+  return _mm_cvtss_f32(sum);
+}
+
+CKER_TARGET_AVX2 inline int32_t ReduceSum(__m256i v)
+{
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+
+CKER_TARGET_AVX2 inline float ReduceMax(__m256 v)
+{
+  __m128 max = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+  max = _mm_max_ss(max, _mm_movehdup_ps(max));
+  return _mm_cvtss_f32(max);
+}
+
+CKER_TARGET_AVX2 inline float ReduceMin(__m256 v)
+{
+  __m128 min = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  min = _mm_min_ps(min, _mm_movehl_ps(min, min));
+  min = _mm_min_ss(min, _mm_movehdup_ps(min));
+  return _mm_cvtss_f32(min);
+}
+
+// Lane mask that enables the first 'count' lanes (0 <= count <= 8)
+CKER_TARGET_AVX2 inline __m256i TailMask(int count)
+{
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(count), lanes);
+}
+
+// Same rounding as std::round (half away from zero), bit-exact for every finite input
+CKER_TARGET_AVX2 inline __m256 RoundHalfAwayFromZero(__m256 x)
+{
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 truncated = _mm256_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  const __m256 fraction = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(x, truncated));
+  const __m256 round_up = _mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ);
+  const __m256 one = _mm256_or_ps(_mm256_set1_ps(1.0f), _mm256_and_ps(x, sign_mask));
+  return _mm256_add_ps(truncated, _mm256_and_ps(round_up, one));
+}
+
+// exp(x) with Cephes polynomial. The result is scaled by 2^n in two steps so that overflow and
+// underflow saturate to inf and zero like std::exp. NaN is propagated.
+CKER_TARGET_AVX2 inline __m256 Exp(__m256 x)
+{
+  x = _mm256_min_ps(_mm256_set1_ps(89.0f), x);
+  x = _mm256_max_ps(_mm256_set1_ps(-104.0f), x);
+
+  // exp(x) = 2^n * exp(r), n = round(x / ln2), |r| <= ln2 / 2
+  const __m256 n = _mm256_floor_ps(
+    _mm256_fmadd_ps(x, _mm256_set1_ps(1.44269504088896341f), _mm256_set1_ps(0.5f)));
+  __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x);
+  r = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), r);
+
+  __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(1.3981999507e-3f));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(8.3334519073e-3f));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(4.1665795894e-2f));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(1.6666665459e-1f));
+  y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(5.0000001201e-1f));
+  y = _mm256_fmadd_ps(y, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+
+  const __m256i n_int = _mm256_cvttps_epi32(n);
+  const __m256i n_half = _mm256_srai_epi32(n_int, 1);
+  const __m256i bias = _mm256_set1_epi32(127);
+  const __m256 scale1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n_half, bias), 23));
+  const __m256 scale2 = _mm256_castsi256_ps(
+    _mm256_slli_epi32(_mm256_add_epi32(_mm256_sub_epi32(n_int, n_half), bias), 23));
+  return _mm256_mul_ps(_mm256_mul_ps(y, scale1), scale2);
+}
+
+CKER_TARGET_AVX2 inline __m256 Logistic(__m256 x)
+{
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 exp_neg = Exp(_mm256_xor_ps(x, _mm256_set1_ps(-0.0f)));
+  return _mm256_div_ps(one, _mm256_add_ps(one, exp_neg));
+}
+
+// Rational approximation used by Eigen for float tanh
+CKER_TARGET_AVX2 inline __m256 Tanh(__m256 x)
+{
+  const __m256 clamp = _mm256_set1_ps(7.90531110763549805f);
+  const __m256 abs_x = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+  const __m256 tiny = _mm256_cmp_ps(abs_x, _mm256_set1_ps(0.0004f), _CMP_LT_OQ);
+  const __m256 xc = _mm256_max_ps(_mm256_xor_ps(clamp, _mm256_set1_ps(-0.0f)),
+                                  _mm256_min_ps(clamp, x));
+  const __m256 x2 = _mm256_mul_ps(xc, xc);
+
+  __m256 p = _mm256_set1_ps(-2.76076847742355e-16f);
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(2.00018790482477e-13f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(-8.60467152213735e-11f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(5.12229709037114e-08f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(1.48572235717979e-05f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(6.37261928875436e-04f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(4.89352455891786e-03f));
+  p = _mm256_mul_ps(p, xc);
+
+  __m256 q = _mm256_set1_ps(1.19825839466702e-06f);
+  q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(1.18534705686654e-04f));
+  q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(2.26843463243900e-03f));
+  q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(4.89352518554385e-03f));
+
+  return _mm256_blendv_ps(_mm256_div_ps(p, q), x, tiny);
+}
+
+struct ExpFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const { return Exp(x); }
+};
+
+struct LogisticFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const { return Logistic(x); }
+};
+
+struct TanhFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const { return Tanh(x); }
+};
+
+struct SqrtFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const { return _mm256_sqrt_ps(x); }
+};
+
+struct RsqrtFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const
+  {
+    return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(x));
+  }
+};
+
+struct SquareFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const { return _mm256_mul_ps(x, x); }
+};
+
+struct FloorFunctor
+{
+  CKER_TARGET_AVX2 __m256 operator()(__m256 x) const { return _mm256_floor_ps(x); }
+};
+
+template <typename F>
+CKER_TARGET_AVX2 inline void UnaryMap(const float *input, int size, float *output, const F &func)
+{
+  int i = 0;
+  for (; i <= size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    _mm256_storeu_ps(output + i, func(_mm256_loadu_ps(input + i)));
+  }
+  if (i < size)
+  {
+    const __m256i mask = TailMask(size - i);
+    _mm256_maskstore_ps(output + i, mask, func(_mm256_maskload_ps(input + i, mask)));
+  }
+}
+
+CKER_TARGET_AVX2 inline void MatrixBatchVectorMultiplyAccumulateAvx2(
+  const int8_t *__restrict__ matrix, const int m_rows, const int m_cols,
+  const int8_t *__restrict__ vectors, const float *scaling_factors, int n_batch,
+  float *__restrict__ result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      __m256i acc = _mm256_setzero_si256();
+      int col = 0;
+      for (; col <= m_cols - 16; col += 16)
+      {
+        // int8 x int8 products are summed in pairs by madd, which cannot overflow int32
+        const __m256i a = _mm256_cvtepi8_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(row_ptr + col)));
+        const __m256i b = _mm256_cvtepi8_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(vectors + col)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+      }
+      int32_t dotprod = ReduceSum(acc);
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+CKER_TARGET_AVX512 inline void MatrixBatchVectorMultiplyAccumulateAvx512(
+  const int8_t *__restrict__ matrix, const int m_rows, const int m_cols,
+  const int8_t *__restrict__ vectors, const float *scaling_factors, int n_batch,
+  float *__restrict__ result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      __m512i acc = _mm512_setzero_si512();
+      int col = 0;
+      for (; col <= m_cols - 32; col += 32)
+      {
+        const __m512i a = _mm512_cvtepi8_epi16(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row_ptr + col)));
+        const __m512i b = _mm512_cvtepi8_epi16(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(vectors + col)));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(a, b));
+      }
+      // The masked forms avoid the undefined-source intrinsics, which older GCC flags with
+      // -Wmaybe-uninitialized
+      const __m256i acc_low = _mm512_maskz_extracti64x4_epi64(0xF, acc, 0);
+      const __m256i acc_high = _mm512_maskz_extracti64x4_epi64(0xF, acc, 1);
+      int32_t dotprod = ReduceSum(_mm256_add_epi32(acc_low, acc_high));
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+} // namespace x86
+
+CKER_TARGET_AVX2 inline void X86CwiseClipping(float *vector, const int v_size,
+                                              const float clipping_value)
+{
+  const __m256 max_value = _mm256_set1_ps(clipping_value);
+  const __m256 min_value = _mm256_set1_ps(-clipping_value);
+  int i = 0;
+  for (; i <= v_size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    const __m256 v = _mm256_loadu_ps(vector + i);
+    _mm256_storeu_ps(vector + i, _mm256_max_ps(min_value, _mm256_min_ps(max_value, v)));
+  }
+  for (; i < v_size; i++)
+  {
+    vector[i] = std::max(std::min(clipping_value, vector[i]), -clipping_value);
+  }
+}
+
+CKER_TARGET_AVX2 inline bool X86IsZeroVector(const float *vector, int v_size)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  int i = 0;
+  for (; i <= v_size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    const __m256 not_zero = _mm256_cmp_ps(_mm256_loadu_ps(vector + i), zero, _CMP_NEQ_UQ);
+    if (_mm256_movemask_ps(not_zero) != 0)
+      return false;
+  }
+  for (; i < v_size; ++i)
+  {
+    if (vector[i] != 0.0f)
+      return false;
+  }
+  return true;
+}
+
+CKER_TARGET_AVX2 inline void X86Sub1Vector(const float *vector, int v_size, float *result)
+{
+  const __m256 one = _mm256_set1_ps(1.0f);
+  int i = 0;
+  for (; i <= v_size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    _mm256_storeu_ps(result + i, _mm256_sub_ps(one, _mm256_loadu_ps(vector + i)));
+  }
+  for (; i < v_size; i++)
+  {
+    result[i] = 1.0f - vector[i];
+  }
+}
+
+CKER_TARGET_AVX2 inline void X86SymmetricQuantizeFloats(const float *values, const int size,
+                                                        int8_t *quantized_values,
+                                                        float *min_value, float *max_value,
+                                                        float *scaling_factor)
+{
+  __m256 min_v = _mm256_set1_ps(values[0]);
+  __m256 max_v = min_v;
+  int i = 0;
+  for (; i <= size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    const __m256 v = _mm256_loadu_ps(values + i);
+    min_v = _mm256_min_ps(min_v, v);
+    max_v = _mm256_max_ps(max_v, v);
+  }
+  *min_value = x86::ReduceMin(min_v);
+  *max_value = x86::ReduceMax(max_v);
+  for (; i < size; ++i)
+  {
+    *min_value = std::min(*min_value, values[i]);
+    *max_value = std::max(*max_value, values[i]);
+  }
+
+  const int kScale = 127;
+  const float range = std::max(std::abs(*min_value), std::abs(*max_value));
+  if (range == 0)
+  {
+    memset(quantized_values, 0, size * sizeof(int8_t));
+    *scaling_factor = 1;
+    return;
+  }
+  *scaling_factor = range / kScale;
+  const float scaling_factor_inv = kScale / range;
+
+  const __m256 inv = _mm256_set1_ps(scaling_factor_inv);
+  const __m256i max_q = _mm256_set1_epi32(kScale);
+  const __m256i min_q = _mm256_set1_epi32(-kScale);
+  i = 0;
+  for (; i <= size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    const __m256 scaled = _mm256_mul_ps(_mm256_loadu_ps(values + i), inv);
+    __m256i q = _mm256_cvttps_epi32(x86::RoundHalfAwayFromZero(scaled));
+    q = _mm256_min_epi32(max_q, _mm256_max_epi32(min_q, q));
+    const __m128i q16 = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(quantized_values + i), _mm_packs_epi16(q16, q16));
+  }
+  for (; i < size; ++i)
+  {
+    const int32_t quantized_value =
+      static_cast<int32_t>(std::round(values[i] * scaling_factor_inv));
+    quantized_values[i] = std::min(kScale, std::max(-kScale, quantized_value));
+  }
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                   const int m_rows, const int m_cols,
+                                                   const int8_t *__restrict__ vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   float *__restrict__ result, int result_stride)
+{
+  if (x86::HasAvx512())
+    x86::MatrixBatchVectorMultiplyAccumulateAvx512(matrix, m_rows, m_cols, vectors,
+                                                   scaling_factors, n_batch, result, result_stride);
+  else
+    x86::MatrixBatchVectorMultiplyAccumulateAvx2(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                                 n_batch, result, result_stride);
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                   const int m_rows, const int m_cols,
+                                                   const int8_t *__restrict__ vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   int32_t *, float *__restrict__ result,
+                                                   int result_stride, ruy::Context *)
+{
+  X86MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors, n_batch,
+                                         result, result_stride);
+}
+
+CKER_TARGET_AVX2 inline void X86MatrixBatchVectorMultiplyAccumulate(const float *matrix,
+                                                                    int m_rows, int m_cols,
+                                                                    const float *vector,
+                                                                    int n_batch, float *result,
+                                                                    int result_stride)
+{
+  float *result_in_batch = result;
+  for (int b = 0; b < n_batch; b++)
+  {
+    const float *matrix_ptr = matrix;
+    const float *vector_in_batch = vector + b * m_cols;
+    for (int r = 0; r < m_rows; r++, matrix_ptr += m_cols)
+    {
+      __m256 acc = _mm256_setzero_ps();
+      int c = 0;
+      for (; c <= m_cols - kFloatsPerAvx2Lane; c += kFloatsPerAvx2Lane)
+      {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_ptr + c), _mm256_loadu_ps(vector_in_batch + c),
+                              acc);
+      }
+      float dot_prod = x86::ReduceSum(acc);
+      for (; c < m_cols; c++)
+      {
+        dot_prod += matrix_ptr[c] * vector_in_batch[c];
+      }
+      *result_in_batch += dot_prod;
+      result_in_batch += result_stride;
+    }
+  }
+}
+
+CKER_TARGET_AVX2 inline void X86Exp(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::ExpFunctor());
+}
+
+CKER_TARGET_AVX2 inline void X86Logistic(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::LogisticFunctor());
+}
+
+CKER_TARGET_AVX2 inline void X86Tanh(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::TanhFunctor());
+}
+
+CKER_TARGET_AVX2 inline void X86Sqrt(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::SqrtFunctor());
+}
+
+CKER_TARGET_AVX2 inline void X86Rsqrt(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::RsqrtFunctor());
+}
+
+CKER_TARGET_AVX2 inline void X86Square(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::SquareFunctor());
+}
+
+CKER_TARGET_AVX2 inline void X86Floor(const float *input, int size, float *output)
+{
+  x86::UnaryMap(input, size, output, x86::FloorFunctor());
+}
+
+// Softmax over the innermost 'input_size' elements for each of 'batch_size' rows
+CKER_TARGET_AVX2 inline void X86Softmax(const float *in, const int input_size,
+                                        const int batch_size, const float beta, float *out)
+{
+  const __m256 beta_v = _mm256_set1_ps(beta);
+  for (int b = 0; b < batch_size; b++, in += input_size, out += input_size)
+  {
+    __m256 max_v = _mm256_set1_ps(in[0]);
+    int i = 0;
+    for (; i <= input_size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+    {
+      max_v = _mm256_max_ps(max_v, _mm256_loadu_ps(in + i));
+    }
+    float max_coeff = x86::ReduceMax(max_v);
+    for (; i < input_size; i++)
+    {
+      max_coeff = std::max(max_coeff, in[i]);
+    }
+
+    const __m256 max_coeff_v = _mm256_set1_ps(max_coeff);
+    __m256 sum_v = _mm256_setzero_ps();
+    i = 0;
+    for (; i <= input_size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+    {
+      const __m256 e =
+        x86::Exp(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(in + i), max_coeff_v), beta_v));
+      _mm256_storeu_ps(out + i, e);
+      sum_v = _mm256_add_ps(sum_v, e);
+    }
+    if (i < input_size)
+    {
+      const __m256i mask = x86::TailMask(input_size - i);
+      const __m256 x = _mm256_maskload_ps(in + i, mask);
+      const __m256 e = _mm256_and_ps(
+        x86::Exp(_mm256_mul_ps(_mm256_sub_ps(x, max_coeff_v), beta_v)), _mm256_castsi256_ps(mask));
+      _mm256_maskstore_ps(out + i, mask, e);
+      sum_v = _mm256_add_ps(sum_v, e);
+    }
+
+    const __m256 reciprocal_sum_exp = _mm256_set1_ps(1.f / x86::ReduceSum(sum_v));
+    i = 0;
+    for (; i <= input_size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+    {
+      _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(out + i), reciprocal_sum_exp));
+    }
+    for (; i < input_size; i++)
+    {
+      out[i] *= _mm256_cvtss_f32(reciprocal_sum_exp);
+    }
+  }
+}
+
+// Quantizes 'size' floats with std::round semantics and returns how many elements were written.
+// The remaining tail is left to the caller's scalar loop.
+template <typename OutputT>
+CKER_TARGET_AVX2 inline int X86Quantize(const float *input, int size, OutputT *output,
+                                        const float scale, const int32_t zero_point)
+{
+  const __m256 scale_v = _mm256_set1_ps(scale);
+  // Clamping before adding the zero point keeps the float to int conversion in range
+  const __m256 min_v =
+    _mm256_set1_ps(static_cast<float>(std::numeric_limits<OutputT>::min() - zero_point));
+  const __m256 max_v =
+    _mm256_set1_ps(static_cast<float>(std::numeric_limits<OutputT>::max() - zero_point));
+  const __m256i zero_point_v = _mm256_set1_epi32(zero_point);
+
+  int i = 0;
+  for (; i <= size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    __m256 v = x86::RoundHalfAwayFromZero(_mm256_div_ps(_mm256_loadu_ps(input + i), scale_v));
+    v = _mm256_min_ps(max_v, _mm256_max_ps(min_v, v));
+    const __m256i q = _mm256_add_epi32(_mm256_cvttps_epi32(v), zero_point_v);
+    const __m128i q16 = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+    if (std::is_same<OutputT, int16_t>::value)
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), q16);
+    else if (std::is_same<OutputT, int8_t>::value)
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi16(q16, q16));
+    else
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(output + i), _mm_packus_epi16(q16, q16));
+  }
+  return i;
+}
+
+// Dequantizes with the same arithmetic as the scalar path (int subtraction, then one float
+// multiply) and returns how many elements were written.
+template <typename InputT>
+CKER_TARGET_AVX2 inline int X86Dequantize(const InputT *input, int size, float *output,
+                                          const float scale, const int32_t zero_point)
+{
+  const __m256 scale_v = _mm256_set1_ps(scale);
+  const __m256i zero_point_v = _mm256_set1_epi32(zero_point);
+
+  int i = 0;
+  for (; i <= size - kFloatsPerAvx2Lane; i += kFloatsPerAvx2Lane)
+  {
+    __m256i v;
+    if (std::is_same<InputT, int16_t>::value)
+      v = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i)));
+    else if (std::is_same<InputT, int8_t>::value)
+      v = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + i)));
+    else
+      v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + i)));
+    v = _mm256_sub_epi32(v, zero_point_v);
+    _mm256_storeu_ps(output + i, _mm256_mul_ps(scale_v, _mm256_cvtepi32_ps(v)));
+  }
+  return i;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // CKER_X86_SIMD
+
+#endif // __NNFW_CKER_X86_TENSOR_UTILS_H__
@@ -566,6 +566,228 @@ SpatialConvolutionBackwardKernel(const Input &input, const OutputBackward &outpu
     .reverse(kernel_reverse);
 }
 
+/** SpatialConvolutionBackwardInputOHWI
+ *
+ * \brief Same as SpatialConvolutionBackwardInput for row-major tensors, but the kernel is
+ * given as (filters, kernel_cols, kernel_rows, channels), which is the OHWI layout of
+ * circle models, instead of (kernel_cols, kernel_rows, channels, filters).
+ *
+ * The kernel is reversed and shuffled into the contraction layout as the original does, so
+ * no separate transpose of the kernel is needed.
+ */
+template <typename OutputBackward, typename Kernel>
+EIGEN_ALWAYS_INLINE static auto
+SpatialConvolutionBackwardInputOHWI(const Kernel &kernel, const OutputBackward &output_backward,
+                                    typename internal::traits<OutputBackward>::Index inputRows,
+                                    typename internal::traits<OutputBackward>::Index inputCols,
+                                    const DenseIndex row_stride = 1,
+                                    const DenseIndex col_stride = 1,
+                                    const DenseIndex row_in_stride = 1,
+                                    const DenseIndex col_in_stride = 1)
+{
+  typedef typename internal::traits<OutputBackward>::Index TensorIndex;
+  typedef typename internal::traits<OutputBackward>::Scalar OutScalar;
+  TensorRef<
+    Tensor<typename internal::traits<Kernel>::Scalar, internal::traits<Kernel>::NumDimensions,
+           internal::traits<Kernel>::Layout, TensorIndex>>
+    kern(kernel);
+  TensorRef<Tensor<OutScalar, internal::traits<OutputBackward>::NumDimensions,
+                   internal::traits<OutputBackward>::Layout, TensorIndex>>
+    out(output_backward);
+
+  EIGEN_STATIC_ASSERT(internal::traits<Kernel>::Layout == RowMajor &&
+                        internal::traits<OutputBackward>::Layout == RowMajor,
+                      YOU_MADE_A_PROGRAMMING_MISTAKE);
+
+  static const int NumDims = internal::traits<OutputBackward>::NumDimensions;
+
+  const TensorIndex kernelFilters = kern.dimensions()[0];
+  const TensorIndex kernelChannels = kern.dimensions()[3];
+  const TensorIndex kernelRows = kern.dimensions()[2];
+  const TensorIndex kernelCols = kern.dimensions()[1];
+
+  const TensorIndex kernelRowsEff = kernelRows + (kernelRows - 1) * (row_in_stride - 1);
+  const TensorIndex kernelColsEff = kernelCols + (kernelCols - 1) * (col_in_stride - 1);
+
+  const TensorIndex outputRows = output_backward.dimension(NumDims - 2);
+  const TensorIndex outputCols = output_backward.dimension(NumDims - 3);
+
+  // Computing the forward padding
+  const TensorIndex forward_pad_top =
+    numext::maxi<Index>(0, ((outputRows - 1) * row_stride + kernelRowsEff - inputRows) / 2);
+  const TensorIndex forward_pad_left =
+    numext::maxi<Index>(0, ((outputCols - 1) * col_stride + kernelColsEff - inputCols) / 2);
+  const TensorIndex padding_top = kernelRowsEff - 1 - forward_pad_top;
+  const TensorIndex padding_left = kernelColsEff - 1 - forward_pad_left;
+
+  const TensorIndex padding_bottom =
+    inputRows - (outputRows - 1) * row_stride - 2 - padding_top + kernelRowsEff;
+  const TensorIndex padding_right =
+    inputCols - (outputCols - 1) * col_stride - 2 - padding_left + kernelColsEff;
+
+  eigen_assert(padding_top >= 0);
+  eigen_assert(padding_left >= 0);
+  eigen_assert(padding_bottom >= 0);
+  eigen_assert(padding_right >= 0);
+
+  // Reverse the kernel along rows and cols
+  const array<bool, 4> kernel_reverse{false, true, true, false};
+  //  From: filters x cols x rows x channels
+  //  To:   channels x cols x rows x filters
+  const array<TensorIndex, 4> kernel_shuffle{3, 1, 2, 0};
+
+  DSizes<TensorIndex, 2> kernel_dims;
+  kernel_dims[0] = kernelChannels;
+  kernel_dims[1] = kernelFilters * kernelRows * kernelCols;
+
+  DSizes<TensorIndex, 2> pre_contract_dims;
+  pre_contract_dims[1] = kernelFilters * kernelRows * kernelCols;
+  pre_contract_dims[0] = inputRows * inputCols;
+  for (int i = 0; i < NumDims - 3; ++i)
+  {
+    pre_contract_dims[0] *= out.dimension(i);
+  }
+
+  array<IndexPair<TensorIndex>, 1> contract_dims;
+  contract_dims[0] = IndexPair<TensorIndex>(1, 1);
+
+  DSizes<TensorIndex, NumDims> post_contract_dims;
+  post_contract_dims[NumDims - 1] = kernelChannels;
+  post_contract_dims[NumDims - 2] = inputRows;
+  post_contract_dims[NumDims - 3] = inputCols;
+  for (int i = 0; i < NumDims - 3; ++i)
+  {
+    post_contract_dims[i] = out.dimension(i);
+  }
+
+  return output_backward
+    .extract_image_patches(kernelRows, kernelCols, 1, 1, row_in_stride, col_in_stride, row_stride,
+                           col_stride, padding_top, padding_bottom, padding_left, padding_right,
+                           OutScalar(0))
+    .reshape(pre_contract_dims)
+    .contract(
+      kernel.reverse(kernel_reverse).eval().shuffle(kernel_shuffle).eval().reshape(kernel_dims),
+      contract_dims)
+    .reshape(post_contract_dims);
+}
+
+/** SpatialConvolutionBackwardKernelOHWI
+ *
+ * \brief Same as SpatialConvolutionBackwardKernel for row-major tensors, but the result is
+ * (filters, kernel_cols, kernel_rows, channels), which is the OHWI layout of circle models.
+ *
+ * The contraction already produces this order, so the shuffle of the original is skipped.
+ */
+template <typename OutputBackward, typename Input>
+EIGEN_ALWAYS_INLINE static auto
+SpatialConvolutionBackwardKernelOHWI(const Input &input, const OutputBackward &output_backward,
+                                     typename internal::traits<Input>::Index kernelRows,
+                                     typename internal::traits<Input>::Index kernelCols,
+                                     const DenseIndex row_stride = 1,
+                                     const DenseIndex col_stride = 1,
+                                     const DenseIndex row_in_stride = 1,
+                                     const DenseIndex col_in_stride = 1)
+{
+  typedef typename internal::traits<Input>::Index TensorIndex;
+  typedef typename internal::traits<OutputBackward>::Scalar OutScalar;
+  TensorRef<Tensor<typename internal::traits<Input>::Scalar, internal::traits<Input>::NumDimensions,
+                   internal::traits<Input>::Layout, TensorIndex>>
+    in(input);
+  TensorRef<Tensor<OutScalar, internal::traits<OutputBackward>::NumDimensions,
+                   internal::traits<OutputBackward>::Layout, TensorIndex>>
+    out(output_backward);
+
+  EIGEN_STATIC_ASSERT(internal::traits<Input>::Layout == RowMajor &&
+                        internal::traits<OutputBackward>::Layout == RowMajor,
+                      YOU_MADE_A_PROGRAMMING_MISTAKE);
+
+  // stride and in_stride cannot both be larger than 1
+  eigen_assert(!(row_stride > 1 && row_in_stride > 1));
+  eigen_assert(!(col_stride > 1 && col_in_stride > 1));
+
+  static const int NumDims = internal::traits<Input>::NumDimensions;
+  EIGEN_STATIC_ASSERT(internal::traits<Input>::NumDimensions ==
+                        internal::traits<OutputBackward>::NumDimensions,
+                      YOU_MADE_A_PROGRAMMING_MISTAKE);
+  EIGEN_STATIC_ASSERT(NumDims == 4, YOU_MADE_A_PROGRAMMING_MISTAKE);
+
+  const TensorIndex inputRows = in.dimension(NumDims - 2);
+  const TensorIndex inputCols = in.dimension(NumDims - 3);
+
+  const TensorIndex outputRows = output_backward.dimension(NumDims - 2);
+  const TensorIndex outputCols = output_backward.dimension(NumDims - 3);
+
+  const TensorIndex kernelFilters = out.dimensions()[NumDims - 1];
+  const TensorIndex kernelChannels = in.dimensions()[NumDims - 1];
+
+  const TensorIndex kernelRowsEff = kernelRows + (kernelRows - 1) * (row_in_stride - 1);
+  const TensorIndex kernelColsEff = kernelCols + (kernelCols - 1) * (col_in_stride - 1);
+
+  const TensorIndex batch = in.dimension(0);
+
+  // Computing the forward padding
+  const TensorIndex padRows =
+    numext::maxi<Index>(0, (outputRows - 1) * row_stride + kernelRowsEff - inputRows);
+  const TensorIndex padCols =
+    numext::maxi<Index>(0, (outputCols - 1) * col_stride + kernelColsEff - inputCols);
+
+  TensorIndex padding_top = padRows / 2;
+  TensorIndex padding_left = padCols / 2;
+
+  // Compute paddings for output_backward before extracting patches.
+  const TensorIndex expanded_out_rows = (outputRows - 1) * row_stride + 1;
+  const TensorIndex expanded_out_cols = (outputCols - 1) * col_stride + 1;
+
+  const TensorIndex padded_out_rows = inputRows + kernelRowsEff - 1;
+  const TensorIndex padded_out_cols = inputCols + kernelColsEff - 1;
+
+  const TensorIndex top_pad_rows = kernelRowsEff - 1 - padding_top;
+  const TensorIndex left_pad_cols = kernelColsEff - 1 - padding_left;
+
+  const TensorIndex bottom_pad_rows = padded_out_rows - expanded_out_rows - top_pad_rows;
+  const TensorIndex right_pad_cols = padded_out_cols - expanded_out_cols - left_pad_cols;
+
+  // From: [batch, out_cols, out_rows, out_depth]
+  // To:   [out_depth, out_cols, out_rows, batch]
+  const array<TensorIndex, 4> output_backward_shuffle{3, 1, 2, 0};
+  // From: [batch, in_cols, in_rows, in_depth]
+  // To:   [in_cols, in_rows, batch, in_depth]
+  const array<TensorIndex, 4> input_shuffle{1, 2, 0, 3};
+
+  DSizes<TensorIndex, 2> input_dims;
+  input_dims[1] = kernelChannels;
+  input_dims[0] = inputCols * inputRows * batch;
+
+  DSizes<TensorIndex, 2> pre_contract_dims;
+  pre_contract_dims[1] = inputCols * inputRows * batch;
+  pre_contract_dims[0] = kernelFilters * kernelCols * kernelRows;
+
+  array<IndexPair<TensorIndex>, 1> contract_dims;
+  contract_dims[0] = IndexPair<TensorIndex>(1, 0);
+
+  // [out_depth, kernel_cols, kernel_rows, in_depth] is already OHWI
+  DSizes<TensorIndex, NumDims> post_contract_dims;
+  post_contract_dims[0] = kernelFilters;
+  post_contract_dims[1] = kernelCols;
+  post_contract_dims[2] = kernelRows;
+  post_contract_dims[3] = kernelChannels;
+
+  // Reverse kernel backprop rows and cols.
+  const array<bool, 4> kernel_reverse{false, true, true, false};
+
+  const auto output_backward_shuffled = output_backward.shuffle(output_backward_shuffle).eval();
+  const auto input_shuffled = input.shuffle(input_shuffle).eval().reshape(input_dims);
+
+  return output_backward_shuffled
+    .extract_image_patches(inputRows, inputCols, row_in_stride, col_in_stride, 1, 1, row_stride,
+                           col_stride, top_pad_rows, bottom_pad_rows, left_pad_cols,
+                           right_pad_cols, OutScalar(0))
+    .reshape(pre_contract_dims)
+    .contract(input_shuffled, contract_dims)
+    .reshape(post_contract_dims)
+    .reverse(kernel_reverse);
+}
+
 } // end namespace Eigen
 
 #endif // __NNFW_CKER_EGIEN_EIGEN_BACKWARD_SPATIAL_CONVOLUTIONS_H__
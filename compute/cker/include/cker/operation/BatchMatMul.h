@@ -23,7 +23,7 @@
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
-#include "cker/operation/reference/BatchMatMul.h"
+#include "cker/operation/optimized/BatchMatMul.h"
 
 #include <vector>
 
@@ -78,7 +78,7 @@ public:
 
   void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
                   const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context = nullptr)
   {
     // Assume lhs and rhs is not constant
     // TODO Handle constant input
@@ -93,32 +93,75 @@ public:
       transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, _temp_lhs.data());
     }
 
-    Shape new_lhs_shape = adj_x ? lhs_shape : swapRowColDims(lhs_shape);
-    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
+    // lhs is [..., rows, depth] and rhs is [..., cols, depth] after transposition
+    const Shape &new_lhs_shape = adj_x ? _temp_lhs_shape : lhs_shape;
+    const Shape &new_rhs_shape = adj_y ? rhs_shape : _temp_rhs_shape;
     const float *new_lhs_data = adj_x ? _temp_lhs.data() : lhs_data;
     const float *new_rhs_data = adj_y ? rhs_data : _temp_rhs.data();
 
-    // Note we pass RHS args first, LHS args second
-    // Check accumulative dimensions of lhs and rhs of are equal
-    assert(Shape::ExtendedShape(5, new_rhs_shape).Dims(4) ==
-           Shape::ExtendedShape(5, new_lhs_shape).Dims(3));
-    reference::BatchMatMul(new_rhs_shape, new_rhs_data, new_lhs_shape, new_lhs_data, output_shape,
-                           output_data);
+    optimized::BatchMatMul(new_lhs_shape, new_lhs_data, new_rhs_shape, new_rhs_data, output_shape,
+                           output_data, ruy_context);
   }
 
-private:
-  Shape swapRowColDims(const Shape &shape)
+  void operator()(const FullyConnectedParams &params, const Shape &lhs_shape,
+                  const int8_t *lhs_data, const Shape &rhs_shape, const int8_t *rhs_data,
+                  bool adj_x, bool adj_y, const Shape &output_shape, int8_t *output_data,
+                  ruy::Context *ruy_context = nullptr)
+  {
+    // NOTE Temporary buffers are sized for float, so they are large enough for int8 also
+    int8_t *temp_lhs = reinterpret_cast<int8_t *>(_temp_lhs.data());
+    int8_t *temp_rhs = reinterpret_cast<int8_t *>(_temp_rhs.data());
+
+    if (!adj_y)
+    {
+      transposeRowsCols(rhs_shape, rhs_data, _temp_rhs_shape, temp_rhs);
+    }
+
+    if (adj_x)
+    {
+      transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, temp_lhs);
+    }
+
+    const Shape &new_lhs_shape = adj_x ? _temp_lhs_shape : lhs_shape;
+    const Shape &new_rhs_shape = adj_y ? rhs_shape : _temp_rhs_shape;
+    const int8_t *new_lhs_data = adj_x ? temp_lhs : lhs_data;
+    const int8_t *new_rhs_data = adj_y ? rhs_data : temp_rhs;
+
+    optimized::BatchMatMul(params, new_lhs_shape, new_lhs_data, new_rhs_shape, new_rhs_data,
+                           output_shape, output_data, ruy_context);
+  }
+
+  void operator()(const Shape &lhs_shape, const Float16 *lhs_data, const Shape &rhs_shape,
+                  const Float16 *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                  Float16 *output_data, ruy::Context *ruy_context = nullptr)
   {
-    Shape swapped_shape(shape);
-    const uint32_t dims = shape.DimensionsCount();
-    swapped_shape.SetDim(dims - 2, shape.Dims(dims - 1));
-    swapped_shape.SetDim(dims - 1, shape.Dims(dims - 2));
+    // NOTE Temporary buffers are sized for float, so they are large enough for fp16 also
+    Float16 *temp_lhs = reinterpret_cast<Float16 *>(_temp_lhs.data());
+    Float16 *temp_rhs = reinterpret_cast<Float16 *>(_temp_rhs.data());
+
+    if (!adj_y)
+    {
+      transposeRowsCols(rhs_shape, rhs_data, _temp_rhs_shape, temp_rhs);
+    }
 
-    return swapped_shape;
+    if (adj_x)
+    {
+      transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, temp_lhs);
+    }
+
+    const Shape &new_lhs_shape = adj_x ? _temp_lhs_shape : lhs_shape;
+    const Shape &new_rhs_shape = adj_y ? rhs_shape : _temp_rhs_shape;
+    const Float16 *new_lhs_data = adj_x ? temp_lhs : lhs_data;
+    const Float16 *new_rhs_data = adj_y ? rhs_data : temp_rhs;
+
+    optimized::BatchMatMul(new_lhs_shape, new_lhs_data, new_rhs_shape, new_rhs_data, output_shape,
+                           output_data, ruy_context);
   }
 
-  void transposeRowsCols(const Shape &input_shape, const float *input_data,
-                         const Shape &output_shape, float *output_data)
+private:
+  template <typename T>
+  void transposeRowsCols(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                         T *output_data)
   {
     TransposeParams params;
     int rank = input_shape.DimensionsCount();
@@ -130,7 +173,7 @@ private:
     params.perm[rank - 2] = rank - 1;
     params.perm[rank - 1] = rank - 2;
 
-    Transpose<float>(params, input_shape, input_data, output_shape, output_data);
+    Transpose<T>(params, input_shape, input_data, output_shape, output_data);
   }
 
 private:
@@ -18,8 +18,12 @@
 #ifndef __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 #define __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 
+#include <algorithm>
 #include <functional>
 #include <stdexcept>
+#include <vector>
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -362,6 +366,196 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+// fp16 operands are widened to fp32 in small chunks and computed with the float kernel
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const Float16 *input1_data, const Shape &input2_shape,
+                               const Float16 *input2_data, const Shape &output_shape,
+                               Float16 *output_data)
+{
+  constexpr int kChunkSize = 256;
+  float input1[kChunkSize];
+  float input2[kChunkSize];
+  float output[kChunkSize];
+  const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  for (int begin = 0; begin < flat_size; begin += kChunkSize)
+  {
+    const int count = std::min(kChunkSize, flat_size - begin);
+    const Shape chunk_shape{count};
+    ConvertFp16ToFp32(input1_data + begin, input1, count);
+    ConvertFp16ToFp32(input2_data + begin, input2, count);
+    BinaryArithmeticOp<op_type>(params, chunk_shape, input1, chunk_shape, input2, chunk_shape,
+                                output);
+    ConvertFp32ToFp16(output, output_data + begin, count);
+  }
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const Float16 *input1_data, const Shape &input2_shape,
+                                        const Float16 *input2_data, const Shape &output_shape,
+                                        Float16 *output_data)
+{
+  std::vector<float> input1(input1_shape.FlatSize());
+  std::vector<float> input2(input2_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  ConvertFp16ToFp32(input1_data, input1.data(), input1.size());
+  ConvertFp16ToFp32(input2_data, input2.data(), input2.size());
+  BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1.data(), input2_shape,
+                                       input2.data(), output_shape, output.data());
+  ConvertFp32ToFp16(output.data(), output_data, output.size());
+}
+
+// int16 operands are symmetrically quantized (zero offsets). They share the quant8 arithmetic,
+// which stays within int32 as long as ADD/SUB use a left_shift of at most 15.
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const int16_t *input1_data, const Shape &input2_shape,
+                               const int16_t *input2_data, const Shape &output_shape,
+                               int16_t *output_data)
+{
+  const int size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  switch (op_type)
+  {
+    case nnfw::cker::BinaryArithmeticOpType::ADD:
+    case nnfw::cker::BinaryArithmeticOpType::SUB:
+      for (int i = 0; i < size; ++i)
+        output_data[i] =
+          static_cast<int16_t>(optimized::quant8_sum(params, input1_data[i], input2_data[i]));
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::MUL:
+      for (int i = 0; i < size; ++i)
+        output_data[i] =
+          static_cast<int16_t>(optimized::quant8_mul(params, input1_data[i], input2_data[i]));
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::DIV:
+    case nnfw::cker::BinaryArithmeticOpType::POW:
+      throw std::runtime_error{"Quant16 Symm NYI"};
+    default:
+      assert(false);
+      break;
+  }
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const int16_t *input1_data, const Shape &input2_shape,
+                                        const int16_t *input2_data, const Shape &output_shape,
+                                        int16_t *output_data)
+{
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error(
+      std::string("cker::BroadcastBinaryArithmeticOp: Unsupported rank size : ") +
+      std::to_string(output_shape.DimensionsCount()));
+
+  std::function<int16_t(const int16_t &, const int16_t &)> fn;
+  switch (op_type)
+  {
+    case nnfw::cker::BinaryArithmeticOpType::ADD:
+    case nnfw::cker::BinaryArithmeticOpType::SUB:
+      fn = [&params](const int16_t &a, const int16_t &b) -> int16_t {
+        return static_cast<int16_t>(optimized::quant8_sum(params, a, b));
+      };
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::MUL:
+      fn = [&params](const int16_t &a, const int16_t &b) -> int16_t {
+        return static_cast<int16_t>(optimized::quant8_mul(params, a, b));
+      };
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::DIV:
+    case nnfw::cker::BinaryArithmeticOpType::POW:
+      throw std::runtime_error{"Quant16 Symm NYI"};
+    default:
+      assert(false);
+      return;
+  }
+  reference::BroadcastBinaryArithmeticOpSlow<int16_t>(params, input1_shape, input1_data,
+                                                      input2_shape, input2_data, output_shape,
+                                                      output_data, fn);
+}
+
+// Same as above, but the flattened output is sharded over the threads of ruy_context
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const T *input1_data, const Shape &input2_shape,
+                               const T *input2_data, const Shape &output_shape, T *output_data,
+                               ruy::Context *ruy_context)
+{
+  if (cpu_backend_threadpool::GetTaskCount(ruy_context, output_shape.FlatSize(), 1) <= 1)
+  {
+    BinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape, input2_data,
+                                output_shape, output_data);
+    return;
+  }
+
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, output_shape.FlatSize(), 1, [&](int64_t begin, int64_t end) {
+      const Shape slice_shape{static_cast<int>(end - begin)};
+      BinaryArithmeticOp<op_type>(params, slice_shape, input1_data + begin, slice_shape,
+                                  input2_data + begin, slice_shape, output_data + begin);
+    });
+}
+
+// Same as above, but the outermost output dimension is sharded over the threads of ruy_context.
+// Each shard is re-classified with ProcessBroadcastShapes since slicing can turn a broadcast into
+// an elementwise op.
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const T *input1_data, const Shape &input2_shape,
+                                        const T *input2_data, const Shape &output_shape,
+                                        T *output_data, ruy::Context *ruy_context)
+{
+  const int rank = output_shape.DimensionsCount();
+  const int outer_size = rank > 0 ? output_shape.Dims(0) : 1;
+  const int64_t inner_size = outer_size > 0 ? output_shape.FlatSize() / outer_size : 0;
+  // Unsupported cases must throw on the calling thread, so they are left to the serial path
+  const bool unsupported =
+    rank > 4 ||
+    ((is_quant8<T>::value || std::is_same<T, int16_t>::value) &&
+     (op_type == BinaryArithmeticOpType::DIV || op_type == BinaryArithmeticOpType::POW));
+  if (unsupported || cpu_backend_threadpool::GetTaskCount(ruy_context, outer_size, inner_size) <= 1)
+  {
+    BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                         input2_data, output_shape, output_data);
+    return;
+  }
+
+  const Shape extended_shape1 = Shape::ExtendedShape(rank, input1_shape);
+  const Shape extended_shape2 = Shape::ExtendedShape(rank, input2_shape);
+  const int64_t inner_size1 = extended_shape1.FlatSize() / extended_shape1.Dims(0);
+  const int64_t inner_size2 = extended_shape2.FlatSize() / extended_shape2.Dims(0);
+
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, outer_size, inner_size, [&](int64_t begin, int64_t end) {
+      const int count = static_cast<int>(end - begin);
+      Shape output_slice(output_shape);
+      output_slice.SetDim(0, count);
+      Shape input1_slice(extended_shape1);
+      Shape input2_slice(extended_shape2);
+      const T *input1_ptr = input1_data;
+      const T *input2_ptr = input2_data;
+      if (extended_shape1.Dims(0) != 1)
+      {
+        input1_slice.SetDim(0, count);
+        input1_ptr += begin * inner_size1;
+      }
+      if (extended_shape2.Dims(0) != 1)
+      {
+        input2_slice.SetDim(0, count);
+        input2_ptr += begin * inner_size2;
+      }
+
+      BinaryArithmeticOpParam slice_params = params;
+      if (ProcessBroadcastShapes(input1_slice, input2_slice, &slice_params))
+        BroadcastBinaryArithmeticOp<op_type>(slice_params, input1_slice, input1_ptr, input2_slice,
+                                             input2_ptr, output_slice,
+                                             output_data + begin * inner_size);
+      else
+        BinaryArithmeticOp<op_type>(slice_params, input1_slice, input1_ptr, input2_slice,
+                                    input2_ptr, output_slice, output_data + begin * inner_size);
+    });
+}
+
 } // namespace cker
 } // namespace nnfw
 
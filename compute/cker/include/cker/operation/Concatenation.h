@@ -18,9 +18,11 @@
 #ifndef __NNFW_CKER_CONCATENATION_H__
 #define __NNFW_CKER_CONCATENATION_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cmath>
 
@@ -32,7 +34,7 @@ namespace cker
 template <typename Scalar>
 inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
                           const Scalar *const *input_data, const Shape &output_shape,
-                          Scalar *output_data)
+                          Scalar *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = params.axis;
   int inputs_count = params.inputs_count;
@@ -68,16 +70,31 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     base_inner_size *= output_shape.Dims(i);
   }
 
-  Scalar *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
-  {
-    for (int i = 0; i < inputs_count; ++i)
-    {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
-      memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
-      output_ptr += copy_size;
-    }
-  }
+  // Each (outer index, input) pair is one contiguous copy. They are sharded as a flat range so that
+  // concatenation along the outermost axis is split across inputs as well.
+  const int64_t row_size = output_shape.Dims(axis) * base_inner_size;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, outer_size * inputs_count, row_size / std::max(inputs_count, 1),
+    [&](int64_t begin, int64_t end) {
+      int64_t k = begin / inputs_count;
+      int i = static_cast<int>(begin % inputs_count);
+      Scalar *output_ptr = output_data + k * row_size;
+      for (int j = 0; j < i; ++j)
+      {
+        output_ptr += input_shapes[j]->Dims(axis) * base_inner_size;
+      }
+      for (int64_t unit = begin; unit < end; ++unit)
+      {
+        const int64_t copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
+        memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
+        output_ptr += copy_size;
+        if (++i == inputs_count)
+        {
+          i = 0;
+          ++k;
+        }
+      }
+    });
 }
 
 // quantized as it takes scale as a floating point value. This should be fixed
@@ -23,6 +23,7 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/Fp16Conv.h"
 #include <iostream>
 #include <vector>
 
@@ -158,6 +159,15 @@ public:
                                    filter_shape, filter_data, nullptr /* filter_zero_point */,
                                    bias_shape, bias_data, output_shape, output_data);
   }
+  void operator()(const ConvParams &params, const Shape &input_shape, const Float16 *input_data,
+                  const Shape &filter_shape, const Float16 *filter_data, const Shape &bias_shape,
+                  const Float16 *bias_data, const Shape &output_shape, Float16 *output_data,
+                  ruy::Context *ruy_context = nullptr)
+  {
+    optimized::ConvFp16(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                        bias_data, output_shape, output_data, ruy_context);
+  }
+
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
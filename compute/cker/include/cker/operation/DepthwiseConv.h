@@ -24,6 +24,7 @@
 #include "cker/neon/neon_check.h"
 #include "cker/operation/optimized/DepthwiseConvFloat.h"
 #include "cker/operation/optimized/DepthwiseConvUint8.h"
+#include "cker/operation/optimized/Fp16Conv.h"
 #include "cker/operation/optimized/integer_ops/DepthwiseConvInt8.h"
 #include "cker/operation/reference/integer_ops/DepthwiseConvUInt8.h"
 #include "cker/operation/reference/integer_ops/DepthwiseConvHybrid.h"
@@ -182,11 +183,22 @@ inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_
   cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
 }
 
-void DepthwiseConvOp(const DepthwiseConvParams &params, const Shape &input_shape,
-                     const float *input_data, const Shape &filter_shape, const float *filter_data,
-                     const Shape &bias_shape, const float *bias_data, float *padded_filter_data,
-                     bool pad_filter, float *filter_buffers_data, const Shape &output_shape,
-                     float *output_data)
+inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                          const Float16 *input_data, const Shape &filter_shape,
+                          const Float16 *filter_data, const Shape &bias_shape,
+                          const Float16 *bias_data, const Shape &output_shape,
+                          Float16 *output_data, ruy::Context *ruy_context)
+{
+  optimized::DepthwiseConvFp16(params, input_shape, input_data, filter_shape, filter_data,
+                               bias_shape, bias_data, output_shape, output_data, ruy_context);
+}
+
+inline void DepthwiseConvOp(const DepthwiseConvParams &params, const Shape &input_shape,
+                            const float *input_data, const Shape &filter_shape,
+                            const float *filter_data, const Shape &bias_shape,
+                            const float *bias_data, float *padded_filter_data, bool pad_filter,
+                            float *filter_buffers_data, const Shape &output_shape,
+                            float *output_data)
 {
   if (params.stride_height != params.stride_width)
     throw std::runtime_error("Not support different length strides");
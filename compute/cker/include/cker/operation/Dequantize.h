@@ -19,6 +19,7 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/X86TensorUtils.h"
 #include "cker/neon/neon_check.h"
 
 namespace nnfw
@@ -68,6 +69,9 @@ inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
     vst1q_f32(output_data + i, result_low);
     vst1q_f32(output_data + i + 4, result_high);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = X86Dequantize(input_data, flat_size, output_data, scale, zero_point);
 #endif // NEON
   for (; i < flat_size; ++i)
   {
@@ -103,6 +107,9 @@ inline void Dequantize(const Shape &input_shape, const int8_t *input_data,
     vst1q_f32(output_data + i, result_low);
     vst1q_f32(output_data + i + 4, result_high);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = X86Dequantize(input_data, flat_size, output_data, scale, zero_point);
 #endif // NEON
   for (; i < flat_size; ++i)
   {
@@ -136,6 +143,9 @@ inline void Dequantize(const Shape &input_shape, const int16_t *input_data,
     vst1q_f32(output_data + i, result_low);
     vst1q_f32(output_data + i + 4, result_high);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = X86Dequantize(input_data, flat_size, output_data, scale, zero_point);
 #endif // NEON
   for (; i < flat_size; ++i)
   {
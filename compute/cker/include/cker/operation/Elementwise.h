@@ -21,6 +21,7 @@
 #include "cker/eigen/Utils.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/X86TensorUtils.h"
 #include <Eigen/Core>
 
 namespace nnfw
@@ -60,6 +61,13 @@ inline void Rsqrt(const Shape &input_shape, const float *input_data, const Shape
                   float *output_data)
 {
   const int size = MatchingFlatSize(input_shape, output_shape);
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Rsqrt(input_data, size, output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
   for (int i = 0; i < size; i++)
   {
     output_data[i] = 1.f / std::sqrt(input_data[i]);
@@ -91,6 +99,13 @@ inline void Floor(const Shape &input_shape, const float *input_data, const Shape
                   float *output_data)
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Floor(input_data, flat_size, output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
 
   for (int i = 0; i < flat_size; i++)
   {
@@ -102,6 +117,13 @@ inline void Sqrt(const Shape &input_shape, const float *input_data, const Shape
                  float *output_data)
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Sqrt(input_data, flat_size, output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
 
   for (int i = 0; i < flat_size; i++)
   {
@@ -113,6 +135,13 @@ inline void Square(const Shape &input_shape, const float *input_data, const Shap
                    float *output_data)
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Square(input_data, flat_size, output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
 
   for (int i = 0; i < flat_size; i++)
   {
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_EXP_H__
 
 #include "cker/Shape.h"
+#include "cker/X86TensorUtils.h"
 
 #include <cmath>
 
@@ -31,6 +32,13 @@ inline void Exp(const Shape &input_shape, const float *input_data, const Shape &
                 float *output_data)
 {
   const int size = MatchingFlatSize(input_shape, output_shape);
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Exp(input_data, size, output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
   for (int i = 0; i < size; i++)
   {
     output_data[i] = std::exp(input_data[i]);
@@ -22,6 +22,7 @@
 #include "cker/operation/FullyConnectedDense16x1.h"
 #include "cker/operation/FullyConnectedSparse16x1.h"
 #include "cker/operation/optimized/Gemm.h"
+#include "cker/Fp16.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -36,7 +37,9 @@ namespace cker
 class FCTempArena
 {
 public:
-  FCTempArena(void) : prepared(false), input_quantized(), scaling_factors(), accum_scratch()
+  FCTempArena(void)
+    : prepared(false), input_quantized(), scaling_factors(), accum_scratch(), input_float(),
+      output_float()
   {
     // DO NOTHING
   }
@@ -57,6 +60,9 @@ public:
   std::vector<int8_t> input_quantized;
   std::vector<float> scaling_factors;
   std::vector<int32_t> accum_scratch;
+  // fp32 staging buffers for the fp16 kernel
+  std::vector<float> input_float;
+  std::vector<float> output_float;
 };
 
 #if defined(CKER_X86_PLATFORM)
@@ -182,6 +188,102 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+namespace detail
+{
+
+// Symmetric int16 input/output with int8 (int16x8) or int16 weights and int64 bias. The
+// accumulator needs up to 48 bits, so it is kept in int64. rescale(acc, out_c) scales the
+// accumulator of output channel out_c to the output.
+template <typename WeightT, typename RescaleFn>
+inline void FullyConnectedInt16(const FullyConnectedParams &params, const Shape &input_shape,
+                                const int16_t *input_data, const Shape &filter_shape,
+                                const WeightT *filter_data, const Shape &bias_shape,
+                                const int64_t *bias_data, const Shape &output_shape,
+                                int16_t *output_data, RescaleFn rescale)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  const int32_t filter_offset = params.weights_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(params.input_offset == 0);
+  assert(output_offset == 0);
+
+  assert(output_activation_min <= output_activation_max);
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+    MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      int64_t acc = 0;
+      for (int d = 0; d < accum_depth; ++d)
+      {
+        int32_t input_val = input_data[b * accum_depth + d];
+        int32_t filter_val = filter_data[out_c * accum_depth + d];
+        acc += (filter_val + filter_offset) * input_val;
+      }
+      if (bias_data)
+      {
+        acc += bias_data[out_c];
+      }
+      int32_t acc_scaled = rescale(acc, out_c);
+      acc_scaled += output_offset;
+      acc_scaled = std::max(acc_scaled, output_activation_min);
+      acc_scaled = std::min(acc_scaled, output_activation_max);
+      output_data[out_c + output_depth * b] = static_cast<int16_t>(acc_scaled);
+    }
+  }
+}
+
+} // namespace detail
+
+// Symmetric int16 input/output with int8 (int16x8) or int16 weights and int64 bias
+template <typename WeightT>
+inline typename std::enable_if_t<std::is_same<WeightT, int8_t>::value ||
+                                 std::is_same<WeightT, int16_t>::value>
+FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+               const int16_t *input_data, const Shape &filter_shape, const WeightT *filter_data,
+               const Shape &bias_shape, const int64_t *bias_data, const Shape &output_shape,
+               int16_t *output_data)
+{
+  const int32_t output_multiplier = params.output_multiplier;
+  const int output_shift = params.output_shift;
+  detail::FullyConnectedInt16(params, input_shape, input_data, filter_shape, filter_data,
+                              bias_shape, bias_data, output_shape, output_data,
+                              [&](int64_t acc, int) {
+                                return MultiplyByQuantizedMultiplier(acc, output_multiplier,
+                                                                     output_shift);
+                              });
+}
+
+// Same as above, but weights are quantized per output channel, so each output channel has its
+// own multiplier and shift
+template <typename WeightT>
+inline typename std::enable_if_t<std::is_same<WeightT, int8_t>::value ||
+                                 std::is_same<WeightT, int16_t>::value>
+FullyConnectedPerChannel(const FullyConnectedParams &params, const int32_t *output_multiplier,
+                         const int *output_shift, const Shape &input_shape,
+                         const int16_t *input_data, const Shape &filter_shape,
+                         const WeightT *filter_data, const Shape &bias_shape,
+                         const int64_t *bias_data, const Shape &output_shape,
+                         int16_t *output_data)
+{
+  detail::FullyConnectedInt16(params, input_shape, input_data, filter_shape, filter_data,
+                              bias_shape, bias_data, output_shape, output_data,
+                              [&](int64_t acc, int out_c) {
+                                return MultiplyByQuantizedMultiplier(
+                                  acc, output_multiplier[out_c], output_shift[out_c]);
+                              });
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
@@ -250,6 +352,50 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
   return;
 }
 
+// fp16 input, weights, bias and output. Products are accumulated in fp32 and rounded once.
+inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                           const Float16 *input_data, const Shape &weights_shape,
+                           const Float16 *weights_data, const Shape &, const Float16 *bias_data,
+                           const Shape &, Float16 *output_data, FCTempArena &temp_arena,
+                           ruy::Context *ruy_context = nullptr)
+{
+  const int total_input_size = input_shape.FlatSize();
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = total_input_size / input_size;
+  const int num_units = weights_shape.Dims(0);
+  const int output_size = batch_size * num_units;
+
+  temp_arena.input_float.resize(total_input_size);
+  temp_arena.output_float.resize(output_size);
+  float *input_float = temp_arena.input_float.data();
+  float *output_float = temp_arena.output_float.data();
+
+  ConvertFp16ToFp32(input_data, input_float, total_input_size);
+
+  // Output = bias if bias tensor exists.
+  if (bias_data)
+  {
+    ConvertFp16ToFp32(bias_data, output_float, num_units);
+    for (int b = 1; b < batch_size; ++b)
+      std::copy(output_float, output_float + num_units, output_float + b * num_units);
+  }
+  else
+  {
+    ZeroVector(output_float, output_size);
+  }
+
+  // Compute output += weight * input
+  Fp16MatrixBatchVectorMultiplyAccumulate(weights_data, num_units, input_size, input_float,
+                                          batch_size, output_float, ruy_context);
+
+  for (int i = 0; i < output_size; ++i)
+  {
+    output_float[i] = ActivationFunctionWithMinMax(output_float[i], params.float_activation_min,
+                                                   params.float_activation_max);
+  }
+  ConvertFp32ToFp16(output_float, output_data, output_size);
+}
+
 inline void FullyConnectedSparseWeightRandom(const FullyConnectedParams &params,
                                              const Shape &input_shape, const float *input_data,
                                              const Shape &weights_shape, const float *weights_data,
@@ -38,7 +38,7 @@ namespace cker
 class MatMulBCast
 {
 public:
-  MatMulBCast(Shape &shape_x, Shape &shape_y)
+  MatMulBCast(const Shape &shape_x, const Shape &shape_y)
   {
     if (shape_x.DimensionsCount() < 2 || shape_y.DimensionsCount() < 2)
       return;
@@ -58,7 +58,9 @@ public:
       y[i] = shape_y.Dims(i);
     }
 
-    _batch_bcast = std::make_unique<BCast>(std::move(x), std::move(y));
+    _batch_bcast = std::make_unique<BCast>(std::move(x), std::move(y),
+                                           /*fewer_dims_optimization=*/true,
+                                           /*return_flattened_batch_indices=*/true);
     if (!_batch_bcast->IsValid())
       return;
 
@@ -80,6 +82,12 @@ public:
   int32_t output_batch_size() const { return _output_batch_size; }
   const Shape &output_batch_shape() const { return _output_shape; }
 
+  bool IsBroadcastingRequired() const { return _batch_bcast->IsBroadcastingRequired(); }
+  // Mapping from the flattened output batch indices to x's and y's flattened batch indices.
+  // Empty if broadcasting is not required.
+  const std::vector<int32_t> &x_batch_indices() const { return _batch_bcast->x_batch_indices(); }
+  const std::vector<int32_t> &y_batch_indices() const { return _batch_bcast->y_batch_indices(); }
+
 private:
   std::unique_ptr<BCast> _batch_bcast;
 
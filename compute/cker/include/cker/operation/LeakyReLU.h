@@ -20,8 +20,10 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/Utils.h"
 
 #include <cmath>
+#include <limits>
 
 namespace nnfw
 {
@@ -41,6 +43,29 @@ inline void LeakyReLU(const LeakyReluParams &params, const Shape &input_shape,
   }
 }
 
+template <typename T>
+inline void QuantizeLeakyRelu(const LeakyReluParams &params, const Shape &input_shape,
+                              const T *input_data, const Shape &output_shape, T *output_data)
+{
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  static const int32_t quantized_min = std::numeric_limits<T>::min();
+  static const int32_t quantized_max = std::numeric_limits<T>::max();
+
+  for (int i = 0; i < flat_size; ++i)
+  {
+    const int32_t input_value = input_data[i] - params.input_offset;
+    const bool is_positive = input_value >= 0;
+    const int32_t multiplier =
+      is_positive ? params.output_multiplier_identity : params.output_multiplier_alpha;
+    const int32_t shift = is_positive ? params.output_shift_identity : params.output_shift_alpha;
+    const int32_t unclamped_output =
+      params.output_offset + MultiplyByQuantizedMultiplier(input_value, multiplier, shift);
+    const T clamped_output =
+      static_cast<T>(std::min(quantized_max, std::max(quantized_min, unclamped_output)));
+    output_data[i] = clamped_output;
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_LOGISTIC_H__
 
 #include "cker/Shape.h"
+#include "cker/X86TensorUtils.h"
 #include "cker/eigen/Utils.h"
 
 #include <cmath>
@@ -32,6 +33,13 @@ namespace cker
 inline void Logistic(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                      float *output_data)
 {
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Logistic(input_data, MatchingFlatSize(input_shape, output_shape), output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
   auto input_map = MapAsVector(input_data, input_shape);
   auto output_map = MapAsVector(output_data, output_shape);
 
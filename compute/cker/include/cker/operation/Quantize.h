@@ -22,6 +22,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/X86TensorUtils.h"
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -88,6 +89,9 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
     const int8x8_t combined_val_narrowed = vmovn_s16(combined_val);
     vst1_s8(output_data + i, combined_val_narrowed);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = X86Quantize(input_data, flat_size, output_data, scale, zero_point);
 #endif // NEON
 
   for (; i < flat_size; ++i)
@@ -141,6 +145,9 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
     const uint8x8_t combined_val_narrowed = vmovn_u16(combined_val);
     vst1_u8(output_data + i, combined_val_narrowed);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = X86Quantize(input_data, flat_size, output_data, scale, zero_point);
 #endif // NEON
 
   for (; i < flat_size; ++i)
@@ -193,6 +200,9 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
     vst1_s16(output_data + i, narrowed_val_0);
     vst1_s16(output_data + i + 4, narrowed_val_1);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = X86Quantize(input_data, flat_size, output_data, scale, zero_point);
 #endif // NEON
 
   for (; i < flat_size; ++i)
@@ -18,11 +18,15 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -114,10 +118,19 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
 }
 #endif // NEON
 
+// Returns true if dimension 0 is kept by the reduction, so that slices along it can be reduced
+// independently of each other.
+inline bool IsOuterDimKept(const Shape &input_shape, const int *axis, const int num_axis)
+{
+  return input_shape.DimensionsCount() > 1 && input_shape.Dims(0) > 1 &&
+         std::find(axis, axis + num_axis, 0) == axis + num_axis;
+}
+
 template <typename In, typename Out>
-inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
+inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &output_shape,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       Out reducer(const Out current, const In in), Out *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -132,20 +145,42 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
       input_size *= input_dims[idx];
     }
     reduce_size = input_dims[input_num_dims - 1];
-    for (int idx = 0; idx < input_size; idx++)
-    {
-      for (int r_idx = 0; r_idx < reduce_size; r_idx++)
-      {
-        if (r_idx == 0)
-        {
-          output_data[idx] = input_data[idx * reduce_size];
-        }
-        else
+    cpu_backend_threadpool::ParallelFor(
+      ruy_context, input_size, reduce_size, [&](int64_t begin, int64_t end) {
+        for (int64_t idx = begin; idx < end; idx++)
         {
-          output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+          for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+          {
+            if (r_idx == 0)
+            {
+              output_data[idx] = input_data[idx * reduce_size];
+            }
+            else
+            {
+              output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+            }
+          }
         }
-      }
-    }
+      });
+    return true;
+  }
+
+  // Slices along a kept outer dimension map to disjoint output slices
+  if (IsOuterDimKept(input_shape, axis, num_axis) &&
+      cpu_backend_threadpool::GetTaskCount(ruy_context, input_dims[0],
+                                           input_shape.FlatSize() / input_dims[0]) > 1)
+  {
+    const int64_t input_inner_size = input_shape.FlatSize() / input_dims[0];
+    const int64_t output_inner_size = output_shape.FlatSize() / input_dims[0];
+    cpu_backend_threadpool::ParallelFor(
+      ruy_context, input_dims[0], input_inner_size, [&](int64_t begin, int64_t end) {
+        Shape input_slice(input_shape);
+        input_slice.SetDim(0, static_cast<int>(end - begin));
+        std::vector<int> slice_iter(input_num_dims);
+        ReduceImpl<In, Out>(input_data + begin * input_inner_size, input_slice, output_shape, axis,
+                            num_axis, slice_iter.data(), reducer,
+                            output_data + begin * output_inner_size);
+      });
     return true;
   }
 
@@ -250,7 +285,8 @@ public:
   template <typename T>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, T reducer(const T current, const T in),
+                            ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -266,7 +302,8 @@ public:
     }
 
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
-                            num_resolved_axis, temp_index_data(), reducer, output_data);
+                            num_resolved_axis, temp_index_data(), reducer, output_data,
+                            ruy_context);
   }
 
   // Computes the mean of elements across dimensions given in axis.
@@ -26,7 +26,7 @@ namespace nnfw
 namespace cker
 {
 
-float round_nearest(float value)
+inline float round_nearest(float value)
 {
   if (value < 0)
   {
@@ -52,10 +52,35 @@ template <typename In, typename Out>
 inline bool ReduceMeanImpl(const In *input_data, const Shape &input_shape, const int *axis,
                            const int num_axis, int *input_iter,
                            Out reducer(const Out current, const In in, int normalizer),
-                           Out *output_data)
+                           Out *output_data, ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
+
+  // Slices along a kept outer dimension map to disjoint output slices
+  if (IsOuterDimKept(input_shape, axis, num_axis) &&
+      cpu_backend_threadpool::GetTaskCount(ruy_context, input_dims[0],
+                                           input_shape.FlatSize() / input_dims[0]) > 1)
+  {
+    const int64_t input_inner_size = input_shape.FlatSize() / input_dims[0];
+    int64_t output_inner_size = 1;
+    for (int idx = 1; idx < input_num_dims; ++idx)
+    {
+      if (std::find(axis, axis + num_axis, idx) == axis + num_axis)
+        output_inner_size *= input_dims[idx];
+    }
+    cpu_backend_threadpool::ParallelFor(
+      ruy_context, input_dims[0], input_inner_size, [&](int64_t begin, int64_t end) {
+        Shape input_slice(input_shape);
+        input_slice.SetDim(0, static_cast<int>(end - begin));
+        std::vector<int> slice_iter(input_num_dims);
+        ReduceMeanImpl<In, Out>(input_data + begin * input_inner_size, input_slice, axis, num_axis,
+                                slice_iter.data(), reducer,
+                                output_data + begin * output_inner_size);
+      });
+    return true;
+  }
+
   int normalizer = 1;
   // Reset input iterator.
   for (int idx = 0; idx < input_num_dims; ++idx)
@@ -151,7 +176,8 @@ public:
   template <typename In, typename Out>
   inline bool ReduceOp(const Shape &input_shape, const In *input_data, const Shape &output_shape,
                        Out *output_data, const std::vector<int> &axes, bool, Out init_value,
-                       Out reducer(const Out current, const Out in, int normalizer))
+                       Out reducer(const Out current, const Out in, int normalizer),
+                       ruy::Context *ruy_context = nullptr)
   {
     int num_resolved_axis;
     num_resolved_axis = PrepareforReduce(input_shape, output_shape, axes, output_data, init_value);
@@ -160,7 +186,7 @@ public:
       return false;
     }
     return ReduceMeanImpl<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
-                                   temp_index_data(), reducer, output_data);
+                                   temp_index_data(), reducer, output_data, ruy_context);
   }
 
   template <typename In, typename Out>
@@ -209,13 +235,13 @@ private:
 
 template <typename In, typename Out>
 void Mean(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-          Out *output_data, const std::vector<int> &axes)
+          Out *output_data, const std::vector<int> &axes, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() > 0);
   ReduceMean m_obj;
   m_obj.ReduceOp<In, Out>(input_shape, input_data, output_shape, output_data, axes, true, (Out)0,
-                          mean_reducer);
+                          mean_reducer, ruy_context);
 }
 
 template <typename In, typename Out>
@@ -233,7 +259,7 @@ void MeanQ8Asymm(const Shape &input_shape, const In *input_data, float input_sca
 
 template <typename In, typename Out>
 void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-                   Out *output_data)
+                   Out *output_data, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() == 4);
@@ -245,21 +271,25 @@ void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &
   const int input_height = input_shape.Dims(1);
   const int input_width = input_shape.Dims(2);
 
-  for (int out_b = 0; out_b < output_batch; ++out_b)
-  {
-    for (int out_d = 0; out_d < output_depth; ++out_d)
-    {
-      float value = 0;
-      for (int in_h = 0; in_h < input_height; ++in_h)
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, static_cast<int64_t>(output_batch) * output_depth, input_height * input_width,
+    [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i)
       {
-        for (int in_w = 0; in_w < input_width; ++in_w)
+        const int out_b = static_cast<int>(i / output_depth);
+        const int out_d = static_cast<int>(i % output_depth);
+        float value = 0;
+        for (int in_h = 0; in_h < input_height; ++in_h)
         {
-          value += input_data[Offset(input_shape, out_b, in_h, in_w, out_d)];
+          for (int in_w = 0; in_w < input_width; ++in_w)
+          {
+            value += input_data[Offset(input_shape, out_b, in_h, in_w, out_d)];
+          }
         }
+        output_data[Offset(output_shape, out_b, 0, 0, out_d)] =
+          value / (input_width * input_height);
       }
-      output_data[Offset(output_shape, out_b, 0, 0, out_d)] = value / (input_width * input_height);
-    }
-  }
+    });
 }
 
 } // namespace cker
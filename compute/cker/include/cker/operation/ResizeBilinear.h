@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RESIZEBILINEAR_H__
 #define __NNFW_CKER_RESIZEBILINEAR_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <cmath>
@@ -69,21 +70,28 @@ inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t
 inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
                               int32_t depth, int32_t output_height, int32_t output_width,
                               const Shape &input_shape, const float *input_data,
-                              const Shape &output_shape, float *output_data)
+                              const Shape &output_shape, float *output_data,
+                              ruy::Context *ruy_context = nullptr)
 {
-  for (int b = 0; b < batches; b++)
-  {
-    for (int y0 = 0, y = 0; y <= output_height - 2; y += 2, y0++)
-    {
-      for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
+  // Each unit is one input row of one batch, which produces two output rows
+  const int32_t row_pairs = output_height / 2;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, static_cast<int64_t>(batches) * row_pairs, 2 * output_width * depth,
+    [&](int64_t begin, int64_t end) {
+      for (int64_t unit = begin; unit < end; ++unit)
       {
-        int32_t x1 = std::min(x0 + 1, input_width - 1);
-        int32_t y1 = std::min(y0 + 1, input_height - 1);
-        ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
-                                output_shape, output_data);
+        const int b = static_cast<int>(unit / row_pairs);
+        const int y0 = static_cast<int>(unit % row_pairs);
+        const int y = 2 * y0;
+        for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
+        {
+          int32_t x1 = std::min(x0 + 1, input_width - 1);
+          int32_t y1 = std::min(y0 + 1, input_height - 1);
+          ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
+                                  output_shape, output_data);
+        }
       }
-    }
-  }
+    });
 }
 
 inline void ResizeBilinearKernel(const float *input_ptr, int32_t depth, float scale,
@@ -119,52 +127,58 @@ inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t
                                   int32_t depth, int32_t output_height, int32_t output_width,
                                   float height_scale, float width_scale, const Shape &input_shape,
                                   const float *input_data, float *output_data,
-                                  const bool half_pixel_centers)
+                                  const bool half_pixel_centers,
+                                  ruy::Context *ruy_context = nullptr)
 {
-  memset(output_data, 0, batches * output_height * output_width * depth * sizeof(float));
-
-  int32_t output_offset = 0;
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
-      float input_y;
-      int32_t y0, y1;
-      ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
-                                 &y1);
-      for (int x = 0; x < output_width; ++x)
+  // Each unit is one output row of one batch
+  const int32_t row_size = output_width * depth;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, static_cast<int64_t>(batches) * output_height, 4 * row_size,
+    [&](int64_t begin, int64_t end) {
+      memset(output_data + begin * row_size, 0, (end - begin) * row_size * sizeof(float));
+
+      int64_t output_offset = begin * row_size;
+      for (int64_t unit = begin; unit < end; ++unit)
       {
-        float input_x;
-        int32_t x0, x1;
-        ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
-                                   &x1);
-        float *output_ptr = &output_data[output_offset];
-
-        // Run kernel on the 4 corners of the bilinear resize algorithm.
-        int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
-        float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
-        const float *input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y0, x1, 0);
-        scale = (1 - (input_y - y0)) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x0, 0);
-        scale = (input_y - y0) * (1 - (input_x - x0));
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x1, 0);
-        scale = (input_y - y0) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        output_offset += depth;
+        const int b = static_cast<int>(unit / output_height);
+        const int y = static_cast<int>(unit % output_height);
+        float input_y;
+        int32_t y0, y1;
+        ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y,
+                                   &y0, &y1);
+        for (int x = 0; x < output_width; ++x)
+        {
+          float input_x;
+          int32_t x0, x1;
+          ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x,
+                                     &x0, &x1);
+          float *output_ptr = &output_data[output_offset];
+
+          // Run kernel on the 4 corners of the bilinear resize algorithm.
+          int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
+          float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
+          const float *input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          input_offset = Offset(input_shape, b, y0, x1, 0);
+          scale = (1 - (input_y - y0)) * (input_x - x0);
+          input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          input_offset = Offset(input_shape, b, y1, x0, 0);
+          scale = (input_y - y0) * (1 - (input_x - x0));
+          input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          input_offset = Offset(input_shape, b, y1, x1, 0);
+          scale = (input_y - y0) * (input_x - x0);
+          input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          output_offset += depth;
+        }
       }
-    }
-  }
+    });
 }
 
 template <typename T>
@@ -211,7 +225,8 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = static_cast<int32_t>(MatchingDim(input_shape, 0, output_shape, 0));
   int32_t input_height = input_shape.Dims(1);
@@ -223,7 +238,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
       params.output_height == 2 * input_height && params.output_width == 2 * input_width)
   {
     ResizeBilinear2x2(batches, input_height, input_width, depth, params.output_height,
-                      params.output_width, input_shape, input_data, output_shape, output_data);
+                      params.output_width, input_shape, input_data, output_shape, output_data,
+                      ruy_context);
   }
   else
   {
@@ -240,7 +256,7 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
 
     ResizeBilinearGeneric(batches, input_height, input_width, depth, params.output_height,
                           params.output_width, height_scale, width_scale, input_shape, input_data,
-                          output_data, params.half_pixel_centers);
+                          output_data, params.half_pixel_centers, ruy_context);
   }
 }
 
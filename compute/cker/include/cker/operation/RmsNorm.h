@@ -17,54 +17,119 @@
 #ifndef __NNFW_CKER_RMS_NORM_H__
 #define __NNFW_CKER_RMS_NORM_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <Eigen/Core>
+
 #include <cmath>
+#include <cstdint>
 
 namespace nnfw
 {
 namespace cker
 {
+namespace rms_norm
+{
 
-inline void RmsNorm(const RmsNormParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &gamma_shape, const float *gamma_data, const Shape &output_shape,
-                    float *output_data)
+struct RmsNormArgs
 {
-  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int32_t heights = MatchingDim(input_shape, 1, output_shape, 1);
-  const int32_t widths = MatchingDim(input_shape, 2, output_shape, 2);
-  const int32_t channels = MatchingDim(input_shape, 3, output_shape, 3);
+  const float *input;
+  const float *gamma; // nullable
+  const float *beta;  // nullable
+  float *output;
+  int channels;
+  float epsilon;
+  bool single_gamma; // gamma of [1] is broadcast to all channels
+  bool single_beta;  // beta of [1] is broadcast to all channels
+};
 
-  if (gamma_shape.DimensionsCount() != 1 ||
-      gamma_shape.Dims(0) != input_shape.Dims(input_shape.DimensionsCount() - 1))
-    throw std::runtime_error("cker::RmsNorm: Unmatched gamma shape");
+// Whether scale or offset of @p shape is [1] or [channels]
+inline bool IsChannelParam(const Shape &shape, int channels)
+{
+  return shape.DimensionsCount() == 1 && (shape.Dims(0) == channels || shape.Dims(0) == 1);
+}
 
-  for (int32_t batch = 0; batch < batches; batch++)
+// Normalize rows [start, end) of [rows, channels]
+inline void RmsNormRows(const RmsNormArgs &args, int64_t start, int64_t end)
+{
+  using ConstArrayMap = Eigen::Map<const Eigen::ArrayXf>;
+  using ArrayMap = Eigen::Map<Eigen::ArrayXf>;
+
+  const int channels = args.channels;
+  for (int64_t row = start; row < end; ++row)
   {
-    for (int32_t height = 0; height < heights; height++)
-    {
-      for (int32_t width = 0; width < widths; width++)
-      {
-        double square_sum = 0.0f;
-        for (int32_t channel = 0; channel < channels; channel++)
-        {
-          double input_val = input_data[Offset(input_shape, batch, height, width, channel)];
-          square_sum += (input_val * input_val);
-        }
-        double rms = std::sqrt((square_sum / channels) + params.epsilon);
-        for (int32_t channel = 0; channel < channels; channel++)
-        {
-          double gamma = (gamma_data ? gamma_data[channel] : 1.0);
-          output_data[Offset(output_shape, batch, height, width, channel)] =
-            gamma * (input_data[Offset(input_shape, batch, height, width, channel)] / rms);
-        }
-      }
-    }
+    ConstArrayMap input(args.input + row * channels, channels);
+    ArrayMap output(args.output + row * channels, channels);
+
+    // Accumulate in double not to lose precision over long rows
+    const double square_sum = input.cast<double>().square().sum();
+    const float rms_inv = static_cast<float>(1.0 / std::sqrt(square_sum / channels + args.epsilon));
+    if (args.gamma == nullptr)
+      output = input * rms_inv;
+    else if (args.single_gamma)
+      output = input * (rms_inv * args.gamma[0]);
+    else
+      output = input * rms_inv * ConstArrayMap(args.gamma, channels);
+
+    if (args.beta == nullptr)
+      continue;
+    if (args.single_beta)
+      output += args.beta[0];
+    else
+      output += ConstArrayMap(args.beta, channels);
   }
 }
 
+} // namespace rms_norm
+
+/**
+ * @brief RmsNorm over the last dimension
+ *        output = input / sqrt(mean(input^2) + epsilon) * gamma + beta
+ *
+ * @param gamma_data  Scale of [channels] or [1], 1 if nullptr
+ * @param beta_data   Offset of [channels] or [1], 0 if nullptr
+ * @param ruy_context Context to get the thread pool from, single-threaded if nullptr
+ */
+inline void RmsNorm(const RmsNormParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &gamma_shape, const float *gamma_data, const Shape &beta_shape,
+                    const float *beta_data, const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
+{
+  const int rank = input_shape.DimensionsCount();
+  if (rank < 1 || output_shape.DimensionsCount() != rank)
+    throw std::runtime_error("cker::RmsNorm: Unmatched input and output rank");
+
+  const int channels = MatchingDim(input_shape, rank - 1, output_shape, rank - 1);
+  if (gamma_data && !rms_norm::IsChannelParam(gamma_shape, channels))
+    throw std::runtime_error("cker::RmsNorm: Unmatched gamma shape");
+  if (beta_data && !rms_norm::IsChannelParam(beta_shape, channels))
+    throw std::runtime_error("cker::RmsNorm: Unmatched beta shape");
+
+  const int64_t rows = MatchingFlatSizeSkipDim(input_shape, rank - 1, output_shape);
+  if (rows == 0 || channels == 0)
+    return;
+
+  const bool single_gamma = gamma_data && gamma_shape.Dims(0) != channels;
+  const bool single_beta = beta_data && beta_shape.Dims(0) != channels;
+  const rms_norm::RmsNormArgs args{input_data, gamma_data,     beta_data,    output_data,
+                                   channels,   params.epsilon, single_gamma, single_beta};
+
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, rows, channels,
+    [&args](int64_t begin, int64_t end) { rms_norm::RmsNormRows(args, begin, end); });
+}
+
+inline void RmsNorm(const RmsNormParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &gamma_shape, const float *gamma_data, const Shape &output_shape,
+                    float *output_data)
+{
+  RmsNorm(params, input_shape, input_data, gamma_shape, gamma_data, Shape{}, nullptr,
+          output_shape, output_data);
+}
+
 } // namespace cker
 } // namespace nnfw
 
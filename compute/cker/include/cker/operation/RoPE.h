@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ROPE_H__
+#define __NNFW_CKER_ROPE_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <Eigen/Core>
+
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace rope
+{
+
+struct RoPEArgs
+{
+  RoPEMode mode;
+  const float *input;
+  const float *sin_table;
+  const float *cos_table;
+  float *output;
+  int head_size;
+  int seq_len;
+  // Whether tables have a row per sequence position, otherwise single row is shared
+  bool table_per_position;
+};
+
+// Rotate rows [start, end) of [rows, head_size], where row % seq_len is the position
+inline void RoPERows(const RoPEArgs &args, int64_t start, int64_t end)
+{
+  using ConstArrayMap = Eigen::Map<const Eigen::ArrayXf>;
+  using ArrayMap = Eigen::Map<Eigen::ArrayXf>;
+  using ConstStridedMap = Eigen::Map<const Eigen::ArrayXf, 0, Eigen::InnerStride<2>>;
+  using StridedMap = Eigen::Map<Eigen::ArrayXf, 0, Eigen::InnerStride<2>>;
+
+  const int head_size = args.head_size;
+  const int half = head_size / 2;
+  for (int64_t row = start; row < end; ++row)
+  {
+    const float *in = args.input + row * head_size;
+    float *out = args.output + row * head_size;
+    const int64_t table_offset = args.table_per_position ? (row % args.seq_len) * head_size : 0;
+    const float *sin = args.sin_table + table_offset;
+    const float *cos = args.cos_table + table_offset;
+
+    if (args.mode == RoPEMode::kGptNeox)
+    {
+      // (x0, x1) = (in[i], in[i + half])
+      ConstArrayMap x0(in, half), x1(in + half, half);
+      ArrayMap(out, half) = x0 * ConstArrayMap(cos, half) - x1 * ConstArrayMap(sin, half);
+      ArrayMap(out + half, half) =
+        x0 * ConstArrayMap(sin + half, half) + x1 * ConstArrayMap(cos + half, half);
+    }
+    else
+    {
+      // (x0, x1) = (in[2i], in[2i + 1])
+      ConstStridedMap x0(in, half), x1(in + 1, half);
+      StridedMap(out, half) = x0 * ConstStridedMap(cos, half) - x1 * ConstStridedMap(sin, half);
+      StridedMap(out + 1, half) =
+        x0 * ConstStridedMap(sin + 1, half) + x1 * ConstStridedMap(cos + 1, half);
+    }
+  }
+}
+
+} // namespace rope
+
+/**
+ * @brief Rotary position embedding
+ *
+ * @param input_shape Shape of input, [batch, num_heads, seq_len, head_size]
+ * @param sin_shape   Shape of sin table, [..., seq_len or 1, head_size]
+ * @param cos_shape   Shape of cos table, same as sin_shape
+ * @param ruy_context Context to get the thread pool from, single-threaded if nullptr
+ */
+inline void RoPE(const RoPEParams &params, const Shape &input_shape, const float *input_data,
+                 const Shape &sin_shape, const float *sin_data, const Shape &cos_shape,
+                 const float *cos_data, const Shape &output_shape, float *output_data,
+                 ruy::Context *ruy_context = nullptr)
+{
+  if (input_shape.DimensionsCount() != 4)
+    throw std::runtime_error("cker::RoPE: Input rank must be 4");
+
+  const int seq_len = MatchingDim(input_shape, 2, output_shape, 2);
+  const int head_size = MatchingDim(input_shape, 3, output_shape, 3);
+  if (head_size % 2 != 0)
+    throw std::runtime_error("cker::RoPE: Head size must be even");
+
+  if (sin_shape != cos_shape)
+    throw std::runtime_error("cker::RoPE: Unmatched sin and cos table shape");
+  const int table_rank = sin_shape.DimensionsCount();
+  if (table_rank < 1 || sin_shape.Dims(table_rank - 1) != head_size)
+    throw std::runtime_error("cker::RoPE: Unmatched table head size");
+  const int table_rows = sin_shape.FlatSize() / head_size;
+  if (table_rows != 1 && table_rows != seq_len)
+    throw std::runtime_error("cker::RoPE: Table should have single row or a row per position");
+
+  const int64_t rows = MatchingFlatSizeSkipDim(input_shape, 3, output_shape);
+  if (rows == 0 || head_size == 0)
+    return;
+
+  const rope::RoPEArgs args{params.mode, input_data, sin_data, cos_data, output_data,
+                            head_size,   seq_len,    table_rows != 1};
+
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, rows, head_size,
+    [&args](int64_t begin, int64_t end) { rope::RoPERows(args, begin, end); });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ROPE_H__
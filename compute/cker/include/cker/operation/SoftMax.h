@@ -18,9 +18,12 @@
 #ifndef __NNFW_CKER_SOFTMAX_H__
 #define __NNFW_CKER_SOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
+#include "cker/X86TensorUtils.h"
 #include "cker/eigen/Utils.h"
 
 #if __aarch64__ && __clang__
@@ -30,6 +33,8 @@
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
 #include <cmath>
+#include <functional>
+#include <vector>
 
 namespace nnfw
 {
@@ -77,10 +82,28 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
 
 // Performs softmax along the input of size (input_size * batch_size).
 inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
-                    float *out)
+                    float *out, ruy::Context *ruy_context = nullptr)
 {
   assert(input_size > 0);
 
+  if (cpu_backend_threadpool::GetTaskCount(ruy_context, batch_size, input_size) > 1)
+  {
+    cpu_backend_threadpool::ParallelFor(
+      ruy_context, batch_size, input_size, [&](int64_t begin, int64_t end) {
+        Softmax(in + begin * input_size, input_size, static_cast<int>(end - begin), beta,
+                out + begin * input_size);
+      });
+    return;
+  }
+
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Softmax(in, input_size, batch_size, beta, out);
+    return;
+  }
+#endif // CKER_X86_SIMD
+
   // For each batch
   for (int b = 0; b < batch_size; b++)
   {
@@ -114,11 +137,39 @@ inline void Softmax(const float *in, const int input_size, const int batch_size,
 }
 
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   // Validate whether if shapes of input and output are the same
   MatchingFlatSize(input_shape, output_shape);
 
+  // Rows along the last dimension are normalized independently
+  if (input_shape.FlatSize() > 0)
+  {
+    const int depth = input_shape.Dims(input_shape.DimensionsCount() - 1);
+    const int outer_size = input_shape.FlatSize() / depth;
+    if (cpu_backend_threadpool::GetTaskCount(ruy_context, outer_size, depth) > 1)
+    {
+      cpu_backend_threadpool::ParallelFor(
+        ruy_context, outer_size, depth, [&](int64_t begin, int64_t end) {
+          const Shape slice_shape{static_cast<int>(end - begin), depth};
+          Softmax(params, slice_shape, input_data + begin * depth, slice_shape,
+                  output_data + begin * depth);
+        });
+      return;
+    }
+  }
+
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2() && input_shape.FlatSize() > 0)
+  {
+    const int depth = input_shape.Dims(input_shape.DimensionsCount() - 1);
+    X86Softmax(input_data, depth, input_shape.FlatSize() / depth, static_cast<float>(params.beta),
+               output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
+
   const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
   auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
   // Compute the exponential first, removing the max coefficient for numerical
@@ -131,6 +182,30 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   out_mat.array().rowwise() *= scale;
 }
 
+// fp16 storage, each row is normalized in fp32
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
+                    const Float16 *input_data, const Shape &output_shape, Float16 *output_data,
+                    ruy::Context *ruy_context = nullptr)
+{
+  MatchingFlatSize(input_shape, output_shape);
+  if (input_shape.FlatSize() == 0)
+    return;
+
+  const int depth = input_shape.Dims(input_shape.DimensionsCount() - 1);
+  const int outer_size = input_shape.FlatSize() / depth;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, outer_size, depth, [&](int64_t begin, int64_t end) {
+      std::vector<float> in(depth);
+      std::vector<float> out(depth);
+      for (int64_t i = begin; i < end; ++i)
+      {
+        ConvertFp16ToFp32(input_data + i * depth, in.data(), depth);
+        Softmax(in.data(), depth, 1, static_cast<float>(params.beta), out.data());
+        ConvertFp32ToFp16(out.data(), output_data + i * depth, depth);
+      }
+    });
+}
+
 template <typename T> inline int32_t QuantizeSoftmaxOutput(float prob_rescaled, int32_t zero_point)
 {
   const int32_t prob_rnd = static_cast<int32_t>(std::round(prob_rescaled));
@@ -196,6 +271,63 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   }
 }
 
+// Symmetric int16 softmax. params.exp_lut holds exp() over [-10, 0] and
+// params.one_over_one_plus_x_lut holds 1/(1+x) over [0, 1], and input_multiplier/input_left_shift
+// map input differences onto [-65535, 0]. Probabilities are computed in Q0.15, i.e. with scale
+// 1/32768, and output_multiplier/output_shift rescale them to the output scale.
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
+                    const int16_t *input_data, const Shape &output_shape, int16_t *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+  std::vector<int16_t> exp_result_Q015(depth);
+  for (int i = 0; i < outer_size; ++i)
+  {
+    int16_t max_in_row = std::numeric_limits<int16_t>::min();
+    for (int j = 0; j < depth; ++j)
+    {
+      max_in_row = std::max(max_in_row, input_data[i * depth + j]);
+    }
+
+    // exp(input - max), re-centered to the symmetric range of the table
+    int32_t sum_of_exps = 0; // Q16.15
+    for (int j = 0; j < depth; ++j)
+    {
+      const int32_t input_diff = input_data[i * depth + j] - max_in_row;
+      const int32_t scaled_diff =
+        MultiplyByQuantizedMultiplier(input_diff, params.input_multiplier, params.input_left_shift);
+      const int32_t sym_scaled_diff = scaled_diff + 32767;
+      const int16_t sat_sym_scaled_diff =
+        static_cast<int16_t>(std::min(std::max(sym_scaled_diff, -32768), 32767));
+      exp_result_Q015[j] = LookupInt16Table(sat_sym_scaled_diff, params.exp_lut);
+      sum_of_exps += exp_result_Q015[j];
+    }
+
+    // 1/sum_of_exps through the 1/(1 + x) table, with the sum normalized into [1, 2)
+    const int headroom_plus_one = CountLeadingZeros(static_cast<uint32_t>(sum_of_exps));
+    const int32_t shifted_sum = static_cast<int32_t>(
+      ((static_cast<int64_t>(sum_of_exps) << (headroom_plus_one - 1)) + (1 << 13)) >> 14);
+    const int32_t sym_shifted_sum = shifted_sum - ((1 << 15) + (1 << 16));
+    const int16_t sat_sym_shifted_sum =
+      static_cast<int16_t>(std::min(std::max(sym_shifted_sum, -32768), 32767));
+    const int16_t reciprocal_scale_Q015 =
+      LookupInt16Table(sat_sym_shifted_sum, params.one_over_one_plus_x_lut);
+
+    const int right_shift = 31 - headroom_plus_one;
+    const int64_t round = static_cast<int64_t>(1) << (right_shift - 1);
+    for (int j = 0; j < depth; ++j)
+    {
+      const int32_t result_Q015 = static_cast<int32_t>(
+        (static_cast<int64_t>(exp_result_Q015[j]) * reciprocal_scale_Q015 + round) >> right_shift);
+      const int32_t result =
+        MultiplyByQuantizedMultiplier(result_Q015, params.output_multiplier, params.output_shift);
+      output_data[i * depth + j] = static_cast<int16_t>(std::min(std::max(result, 0), 32767));
+    }
+  }
+}
+
 #ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
 // Looks up each element of <indices> in <table>, returns them in a vector.
 inline uint8x16_t aarch64_lookup_vector(const uint8x16x4_t table[4], uint8x16_t indices)
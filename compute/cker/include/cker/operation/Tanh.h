@@ -21,6 +21,7 @@
 #include "cker/eigen/Utils.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/X86TensorUtils.h"
 #include <Eigen/Core>
 
 namespace nnfw
@@ -31,6 +32,13 @@ namespace cker
 inline void Tanh(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                  float *output_data)
 {
+#ifdef CKER_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    X86Tanh(input_data, MatchingFlatSize(input_shape, output_shape), output_data);
+    return;
+  }
+#endif // CKER_X86_SIMD
   auto input_map = MapAsVector(input_data, input_shape);
   auto output_map = MapAsVector(output_data, output_shape);
   output_map.array() = input_map.array().tanh();
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_TRANSPOSE_H__
 #define __NNFW_CKER_TRANSPOSE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -293,23 +294,19 @@ size_t Flatten(const Shape &input_shape, const Shape &output_shape, const Transp
 // Transpose2D only deals with typical 2D matrix transpose ops.
 // Perform transpose by transposing 4x4 blocks of the input, proceeding from
 // left to right (down the rows) of the input, and then from top to bottom.
+// Rows [row_begin, row_end) of the input are written to the matching columns of the output, so
+// disjoint row ranges can be transposed concurrently.
 template <typename T>
-inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+inline void Transpose2DRows(int d0, int d1, int row_begin, int row_end, const T *input_data,
+                            T *output_data)
 {
-  assert(input_shape.DimensionsCount() == 2);
-  assert(output_shape.DimensionsCount() == 2);
-  UNUSED_RELEASE(output_shape);
-
-  const int d0 = input_shape.DimsData()[0];
-  const int d1 = input_shape.DimsData()[1];
   const int kLines = 4;
   const int kSkipSize = (kLines - 1) * d1;
 
-  const T *input = input_data;
+  const T *input = input_data + static_cast<int64_t>(row_begin) * d1;
 
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
+  int i = row_begin;
+  for (; i <= row_end - kLines; i += kLines)
   {
     T *output = output_data + i;
 
@@ -388,7 +385,7 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
       input += (d1 - j) + kSkipSize;
     }
   }
-  for (; i < d0; ++i)
+  for (; i < row_end; ++i)
   {
     T *output = output_data + i;
     for (int j = 0; j < d1; ++j)
@@ -400,11 +397,34 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
   }
 }
 
+template <typename T>
+inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                        T *output_data, ruy::Context *ruy_context = nullptr)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+  UNUSED_RELEASE(output_shape);
+
+  const int d0 = input_shape.DimsData()[0];
+  const int d1 = input_shape.DimsData()[1];
+  const int kLines = 4;
+
+  // Shard on blocks of kLines rows so that every task but the last keeps the 4x4 kernel
+  const int64_t num_blocks = (d0 + kLines - 1) / kLines;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, num_blocks, static_cast<int64_t>(kLines) * d1, [&](int64_t begin, int64_t end) {
+      Transpose2DRows(d0, d1, static_cast<int>(begin * kLines),
+                      static_cast<int>(std::min<int64_t>(end * kLines, d0)), input_data,
+                      output_data);
+    });
+}
+
 // TODO(alanchiao): see if we can reduce the number
 // of lines of code in branching without affecting latency.
 template <typename T>
 inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
-                        const T *input_data, const Shape &, T *output_data)
+                        const T *input_data, const Shape &, T *output_data,
+                        ruy::Context *ruy_context = nullptr)
 {
   int s2, s3;
   s2 = input_shape.Dims(1);
@@ -458,30 +478,33 @@ inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
   o_s[1] = input_shape.Dims(params.perm[1]);
   o_s[2] = input_shape.Dims(params.perm[2]);
 
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
-    {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, o_s[0], static_cast<int64_t>(o_s[1]) * o_s[2], [&](int64_t begin, int64_t end) {
+      for (int i1 = static_cast<int>(begin); i1 < end; ++i1)
       {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
+        for (int i2 = 0; i2 < o_s[1]; ++i2)
+        {
+          for (int i3 = 0; i3 < o_s[2]; ++i3)
+          {
+            const int i = i1 * p1 + i2 * p2 + i3 * p3;
+            const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
+            output_data[o] = input_data[i];
+          }
+        }
       }
-    }
-  }
+    });
 }
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int dims_cnt = input_shape.DimensionsCount();
 
   int dim0, dim1;
   if (IsTranspose2DApplicable(params, input_shape, &dim0, &dim1))
   {
-    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data);
+    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data, ruy_context);
     return;
   }
 
@@ -497,7 +520,7 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
   // Consider tradeoffs.
   if (dims_cnt == 3)
   {
-    Transpose3D(params, input_shape, input_data, output_shape, output_data);
+    Transpose3D(params, input_shape, input_data, output_shape, output_data, ruy_context);
     return;
   }
 
@@ -508,7 +531,8 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
 
 template <typename T>
 void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+               const T *input_data, const Shape &unshrunk_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   const int output_size = unshrunk_output_shape.DimensionsCount();
   assert(unshrunk_input_shape.DimensionsCount() <= 4);
@@ -560,10 +584,26 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
               &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
+    // Flattened chunks are independent, so the outer loop is sharded and each chunk runs serially
+    const int64_t num_chunks = total_size / non_flatten_size;
+    if (cpu_backend_threadpool::GetTaskCount(ruy_context, num_chunks, non_flatten_size) > 1)
+    {
+      cpu_backend_threadpool::ParallelFor(
+        ruy_context, num_chunks, non_flatten_size, [&](int64_t begin, int64_t end) {
+          for (int64_t c = begin; c < end; ++c)
+          {
+            TransposeImpl(non_flatten_params, non_flatten_input_shape,
+                          input_data + c * non_flatten_size, non_flatten_output_shape,
+                          output_data + c * non_flatten_size);
+          }
+        });
+      return;
+    }
+
     for (int i = 0; i < total_size; i += non_flatten_size)
     {
       TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
+                    non_flatten_output_shape, output_data + i, ruy_context);
     }
     return;
   }
@@ -571,7 +611,7 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
   // Call non-flattened case.
   TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
 
-                output_data);
+                output_data, ruy_context);
 }
 
 } // namespace cker
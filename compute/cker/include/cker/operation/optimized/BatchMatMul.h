@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+#define __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/Helper/MatmulBCast.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <Eigen/Core>
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+namespace batch_matmul
+{
+
+/**
+ * @brief Operands of BatchMatMul after transposition
+ *
+ * Every matrix is row-major and both operands are laid out with the accumulation dimension
+ * innermost, so that out[b](m, n) = dot(lhs[b](m, :), rhs_t[b](n, :)).
+ */
+template <typename T> struct BatchMatMulArgs
+{
+  const T *lhs;   // [lhs_batches, rows, depth]
+  const T *rhs_t; // [rhs_batches, cols, depth]
+  T *output;      // [out_batches, rows, cols]
+  int rows;
+  int cols;
+  int depth;
+  int out_batches;
+  // Batch index of lhs and rhs for each output batch, empty if no broadcasting is required
+  const std::vector<int32_t> *lhs_batch_indices;
+  const std::vector<int32_t> *rhs_batch_indices;
+};
+
+template <typename T> inline int LhsBatch(const BatchMatMulArgs<T> &args, int b)
+{
+  return args.lhs_batch_indices->empty() ? b : args.lhs_batch_indices->at(b);
+}
+
+template <typename T> inline int RhsBatch(const BatchMatMulArgs<T> &args, int b)
+{
+  return args.rhs_batch_indices->empty() ? b : args.rhs_batch_indices->at(b);
+}
+
+// Compute rows [row_start, row_end) of output batch b
+inline void MatMulRows(const BatchMatMulArgs<float> &args, int b, int row_start, int row_end)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ConstMatrixMap = Eigen::Map<const RowMajorMatrix>;
+  using MatrixMap = Eigen::Map<RowMajorMatrix>;
+
+  const int num_rows = row_end - row_start;
+  const float *lhs_ptr =
+    args.lhs + (static_cast<int64_t>(LhsBatch(args, b)) * args.rows + row_start) * args.depth;
+  const float *rhs_ptr =
+    args.rhs_t + static_cast<int64_t>(RhsBatch(args, b)) * args.cols * args.depth;
+  float *out_ptr = args.output + (static_cast<int64_t>(b) * args.rows + row_start) * args.cols;
+
+  ConstMatrixMap lhs(lhs_ptr, num_rows, args.depth);
+  ConstMatrixMap rhs_t(rhs_ptr, args.cols, args.depth);
+  MatrixMap out(out_ptr, num_rows, args.cols);
+  out.noalias() = lhs * rhs_t.transpose();
+}
+
+// Compute rows [row_start, row_end) of output batch b, accumulating in fp32
+inline void MatMulRows(const BatchMatMulArgs<Float16> &args, int b, int row_start, int row_end)
+{
+  const int depth = args.depth;
+  const Float16 *lhs_base =
+    args.lhs + static_cast<int64_t>(LhsBatch(args, b)) * args.rows * depth;
+  const Float16 *rhs_base =
+    args.rhs_t + static_cast<int64_t>(RhsBatch(args, b)) * args.cols * depth;
+
+  std::vector<float> lhs_row(depth);
+  std::vector<float> out_row(args.cols);
+  for (int m = row_start; m < row_end; ++m)
+  {
+    ConvertFp16ToFp32(lhs_base + static_cast<int64_t>(m) * depth, lhs_row.data(), depth);
+    for (int n = 0; n < args.cols; ++n)
+    {
+      const Float16 *rhs_row = rhs_base + static_cast<int64_t>(n) * depth;
+      out_row[n] = Fp16DotProduct(rhs_row, lhs_row.data(), depth);
+    }
+    ConvertFp32ToFp16(out_row.data(),
+                      args.output + (static_cast<int64_t>(b) * args.rows + m) * args.cols,
+                      args.cols);
+  }
+}
+
+template <typename T> void Run(const BatchMatMulArgs<T> &args, ruy::Context *ruy_context)
+{
+  // Work units are output rows flattened over all batches
+  const int64_t num_units = static_cast<int64_t>(args.out_batches) * args.rows;
+  if (num_units == 0 || args.cols == 0)
+    return;
+
+  const int64_t muls_per_unit = static_cast<int64_t>(args.cols) * args.depth;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, num_units, muls_per_unit, [&args](int64_t begin, int64_t end) {
+      int64_t unit = begin;
+      while (unit < end)
+      {
+        const int b = static_cast<int>(unit / args.rows);
+        const int row_start = static_cast<int>(unit % args.rows);
+        const int row_end = static_cast<int>(std::min<int64_t>(args.rows, row_start + end - unit));
+        MatMulRows(args, b, row_start, row_end);
+        unit += row_end - row_start;
+      }
+    });
+}
+
+/**
+ * @brief Run int8 BatchMatMul with ruy, one ruy::Mul per output batch
+ *
+ * ruy parallelizes each multiplication on the thread pool of ruy_context, and handles zero points
+ * and requantization as the int8 FullyConnected does.
+ */
+inline void Run(const FullyConnectedParams &params, const BatchMatMulArgs<int8_t> &args,
+                ruy::Context *ruy_context)
+{
+  if (args.out_batches == 0 || args.rows == 0 || args.cols == 0)
+    return;
+
+  // ruy::Mul always needs a context, which runs on the calling thread only by default
+  std::unique_ptr<ruy::Context> local_context;
+  if (ruy_context == nullptr)
+  {
+    local_context = std::make_unique<ruy::Context>();
+    ruy_context = local_context.get();
+  }
+
+  // Same as tflite::optimized_ops::BatchMatMul, dst^T = rhs_t * lhs^T in column-major order
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = args.cols;
+  lhs_params.cols = args.depth;
+  lhs_params.zero_point = -params.weights_offset;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = args.depth;
+  rhs_params.cols = args.rows;
+  rhs_params.zero_point = -params.input_offset;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = args.cols;
+  dst_params.cols = args.rows;
+  dst_params.zero_point = params.output_offset;
+
+  GemmParams<int32_t, int8_t> gemm_params;
+  gemm_params.multiplier_fixedpoint = params.output_multiplier;
+  gemm_params.multiplier_exponent = params.output_shift;
+  gemm_params.clamp_min = params.quantized_activation_min;
+  gemm_params.clamp_max = params.quantized_activation_max;
+
+  ruy::MulParams<int32_t, int8_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  for (int b = 0; b < args.out_batches; ++b)
+  {
+    const int8_t *lhs_ptr =
+      args.lhs + static_cast<int64_t>(LhsBatch(args, b)) * args.rows * args.depth;
+    const int8_t *rhs_ptr =
+      args.rhs_t + static_cast<int64_t>(RhsBatch(args, b)) * args.cols * args.depth;
+    int8_t *out_ptr = args.output + static_cast<int64_t>(b) * args.rows * args.cols;
+
+    ruy::Matrix<int8_t> ruy_lhs;
+    ruy::Matrix<int8_t> ruy_rhs;
+    ruy::Matrix<int8_t> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, rhs_ptr, &ruy_lhs);
+    ruy_support::MakeRuyMatrix(rhs_params, lhs_ptr, &ruy_rhs);
+    ruy_support::MakeRuyMatrix(dst_params, out_ptr, &ruy_dst);
+
+    ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+  }
+}
+
+} // namespace batch_matmul
+
+/**
+ * @brief BatchMatMul for operands whose accumulation dimension is innermost
+ *
+ * @param lhs_shape   Shape of lhs, [..., rows, depth]
+ * @param rhs_t_shape Shape of transposed rhs, [..., cols, depth]
+ * @param ruy_context Context to get the thread pool from, single-threaded if nullptr
+ *
+ * @note Batch dimensions of lhs and rhs are broadcast as MatMulBCast does
+ */
+inline void BatchMatMul(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_t_shape,
+                        const float *rhs_t_data, const Shape &, float *output_data,
+                        ruy::Context *ruy_context)
+{
+  const int lhs_rank = lhs_shape.DimensionsCount();
+  const int rhs_rank = rhs_t_shape.DimensionsCount();
+  assert(lhs_shape.Dims(lhs_rank - 1) == rhs_t_shape.Dims(rhs_rank - 1));
+
+  MatMulBCast bcast(lhs_shape, rhs_t_shape);
+  if (!bcast.IsValid())
+    throw std::runtime_error{"BatchMatMul: Invalid broadcasting dimensions"};
+
+  batch_matmul::BatchMatMulArgs<float> args;
+  args.lhs = lhs_data;
+  args.rhs_t = rhs_t_data;
+  args.output = output_data;
+  args.rows = lhs_shape.Dims(lhs_rank - 2);
+  args.cols = rhs_t_shape.Dims(rhs_rank - 2);
+  args.depth = lhs_shape.Dims(lhs_rank - 1);
+  args.out_batches = bcast.output_batch_size();
+  args.lhs_batch_indices = &bcast.x_batch_indices();
+  args.rhs_batch_indices = &bcast.y_batch_indices();
+
+  batch_matmul::Run(args, ruy_context);
+}
+
+inline void BatchMatMul(const Shape &lhs_shape, const Float16 *lhs_data, const Shape &rhs_t_shape,
+                        const Float16 *rhs_t_data, const Shape &, Float16 *output_data,
+                        ruy::Context *ruy_context)
+{
+  const int lhs_rank = lhs_shape.DimensionsCount();
+  const int rhs_rank = rhs_t_shape.DimensionsCount();
+  assert(lhs_shape.Dims(lhs_rank - 1) == rhs_t_shape.Dims(rhs_rank - 1));
+
+  MatMulBCast bcast(lhs_shape, rhs_t_shape);
+  if (!bcast.IsValid())
+    throw std::runtime_error{"BatchMatMul: Invalid broadcasting dimensions"};
+
+  batch_matmul::BatchMatMulArgs<Float16> args;
+  args.lhs = lhs_data;
+  args.rhs_t = rhs_t_data;
+  args.output = output_data;
+  args.rows = lhs_shape.Dims(lhs_rank - 2);
+  args.cols = rhs_t_shape.Dims(rhs_rank - 2);
+  args.depth = lhs_shape.Dims(lhs_rank - 1);
+  args.out_batches = bcast.output_batch_size();
+  args.lhs_batch_indices = &bcast.x_batch_indices();
+  args.rhs_batch_indices = &bcast.y_batch_indices();
+
+  batch_matmul::Run(args, ruy_context);
+}
+
+inline void BatchMatMul(const FullyConnectedParams &params, const Shape &lhs_shape,
+                        const int8_t *lhs_data, const Shape &rhs_t_shape, const int8_t *rhs_t_data,
+                        const Shape &, int8_t *output_data, ruy::Context *ruy_context)
+{
+  const int lhs_rank = lhs_shape.DimensionsCount();
+  const int rhs_rank = rhs_t_shape.DimensionsCount();
+  assert(lhs_shape.Dims(lhs_rank - 1) == rhs_t_shape.Dims(rhs_rank - 1));
+
+  MatMulBCast bcast(lhs_shape, rhs_t_shape);
+  if (!bcast.IsValid())
+    throw std::runtime_error{"BatchMatMul: Invalid broadcasting dimensions"};
+
+  batch_matmul::BatchMatMulArgs<int8_t> args;
+  args.lhs = lhs_data;
+  args.rhs_t = rhs_t_data;
+  args.output = output_data;
+  args.rows = lhs_shape.Dims(lhs_rank - 2);
+  args.cols = rhs_t_shape.Dims(rhs_rank - 2);
+  args.depth = lhs_shape.Dims(lhs_rank - 1);
+  args.out_batches = bcast.output_batch_size();
+  args.lhs_batch_indices = &bcast.x_batch_indices();
+  args.rhs_batch_indices = &bcast.y_batch_indices();
+
+  batch_matmul::Run(params, args, ruy_context);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
@@ -22,6 +22,7 @@
 #include <limits>
 #include <utility>
 #include "cker/neon/neon_check.h"
+#include "cker/x86/x86_check.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
@@ -223,7 +224,7 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &unswitched_pa
 }
 
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value, int32_t>
+inline typename std::enable_if_t<is_quant8<T>::value || std::is_same<T, int16_t>::value, int32_t>
 quant8_sum(const BinaryArithmeticOpParam &params, const T input1_data, const T input2_data)
 {
   const int32_t input1_val = params.input1_offset + input1_data;
@@ -440,6 +441,12 @@ struct BinaryOpFuncAddFloat
     return vaddq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_add_ps(a, b);
+  }
+#endif // CKER_X86_SIMD
   static inline float calculate(const float a, const float b) { return a + b; }
 };
 
@@ -451,6 +458,12 @@ struct BinaryOpFuncSubFloat
     return vsubq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_sub_ps(a, b);
+  }
+#endif // CKER_X86_SIMD
   static inline float calculate(const float a, const float b) { return a - b; }
 };
 
@@ -462,6 +475,12 @@ struct BinaryOpFuncMulFloat
     return vmulq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_mul_ps(a, b);
+  }
+#endif // CKER_X86_SIMD
   static inline float calculate(const float a, const float b) { return a * b; }
 };
 
@@ -475,6 +494,12 @@ struct BinaryOpFuncDivFloat
   }
 #endif // __aarch64__
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_div_ps(a, b);
+  }
+#endif // CKER_X86_SIMD
   static inline float calculate(const float a, const float b) { return a / b; }
 };
 
@@ -484,6 +509,12 @@ template <class BASEOPERATOR> struct BinaryOpFuncSwapArgs
   {
     return BASEOPERATOR::calculate(b, a);
   }
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return BASEOPERATOR::calculate(b, a);
+  }
+#endif // CKER_X86_SIMD
 };
 
 struct BinaryOpActivationFloatNone
@@ -500,6 +531,19 @@ struct BinaryOpActivationFloatNone
     return value;
   }
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value,
+                                                     const __m256 &ceilingParam)
+  {
+    (void)ceilingParam;
+    return value;
+  }
+  CKER_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    (void)floorParam;
+    return value;
+  }
+#endif // CKER_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -525,6 +569,18 @@ struct BinaryOpActivationFloatMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value,
+                                                     const __m256 &ceilingParam)
+  {
+    (void)ceilingParam;
+    return value;
+  }
+  CKER_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    return _mm256_max_ps(value, floorParam);
+  }
+#endif // CKER_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -548,6 +604,17 @@ struct BinaryOpActivationFloatMinMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef CKER_X86_SIMD
+  CKER_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value,
+                                                     const __m256 &ceilingParam)
+  {
+    return _mm256_min_ps(value, ceilingParam);
+  }
+  CKER_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    return _mm256_max_ps(value, floorParam);
+  }
+#endif // CKER_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     return std::min(value, ceilingParam);
@@ -558,6 +625,70 @@ struct BinaryOpActivationFloatMinMax
   }
 };
 
+#ifdef CKER_X86_SIMD
+// AVX2 bodies of BinaryOpElementwise/BinaryOpScalarBroadcast. They return the number of
+// elements processed and leave the remainder to the scalar loop.
+template <class OPERATOR, class ACTIVATION>
+CKER_TARGET_AVX2 inline int BinaryOpElementwiseX86(int size, const BinaryArithmeticOpParam &params,
+                                                   const float *input1_data,
+                                                   const float *input2_data, float *output_data)
+{
+  const auto activation_min = _mm256_set1_ps(params.float_activation_min);
+  const auto activation_max = _mm256_set1_ps(params.float_activation_max);
+  int i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    const auto a10 = _mm256_loadu_ps(input1_data + i);
+    const auto a11 = _mm256_loadu_ps(input1_data + i + 8);
+    const auto a20 = _mm256_loadu_ps(input2_data + i);
+    const auto a21 = _mm256_loadu_ps(input2_data + i + 8);
+    auto x0 = OPERATOR::calculate(a10, a20);
+    auto x1 = OPERATOR::calculate(a11, a21);
+    x0 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x0, activation_min), activation_max);
+    x1 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x1, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x0);
+    _mm256_storeu_ps(output_data + i + 8, x1);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    const auto a1 = _mm256_loadu_ps(input1_data + i);
+    const auto a2 = _mm256_loadu_ps(input2_data + i);
+    auto x = OPERATOR::calculate(a1, a2);
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x);
+  }
+  return i;
+}
+
+template <class OPERATOR, class ACTIVATION>
+CKER_TARGET_AVX2 inline int BinaryOpScalarBroadcastX86(int size,
+                                                       const BinaryArithmeticOpParam &params,
+                                                       const float broadcast_value,
+                                                       const float *input2_data, float *output_data)
+{
+  const auto activation_min = _mm256_set1_ps(params.float_activation_min);
+  const auto activation_max = _mm256_set1_ps(params.float_activation_max);
+  const auto broadcast_value_dup = _mm256_set1_ps(broadcast_value);
+  int i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    auto x0 = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i));
+    auto x1 = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i + 8));
+    x0 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x0, activation_min), activation_max);
+    x1 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x1, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x0);
+    _mm256_storeu_ps(output_data + i + 8, x1);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    auto x = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x);
+  }
+  return i;
+}
+#endif // CKER_X86_SIMD
+
 template <class OPERATOR, class ACTIVATION>
 inline void BinaryOpElementwise(int size, const BinaryArithmeticOpParam &params,
                                 const float *input1_data, const float *input2_data,
@@ -604,6 +735,10 @@ inline void BinaryOpElementwise(int size, const BinaryArithmeticOpParam &params,
       ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
     vst1q_f32(output_data + i, x_clamped);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = BinaryOpElementwiseX86<OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                     output_data);
 #endif // USE_NEON
   for (; i < size; i++)
   {
@@ -658,6 +793,10 @@ inline void BinaryOpScalarBroadcast(int size, const BinaryArithmeticOpParam &par
       ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
     vst1q_f32(output_data + i, x_clamped);
   }
+#elif defined(CKER_X86_SIMD)
+  if (x86::HasAvx2())
+    i = BinaryOpScalarBroadcastX86<OPERATOR, ACTIVATION>(size, params, broadcast_value, input2_data,
+                                                         output_data);
 #endif // USE_NEON
   for (; i < size; i++)
   {
@@ -892,7 +1031,7 @@ inline void BroadcastSubDispatch(const BinaryArithmeticOpParam &params, const Sh
 }
 
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value, int32_t>
+inline typename std::enable_if_t<is_quant8<T>::value || std::is_same<T, int16_t>::value, int32_t>
 quant8_mul(const BinaryArithmeticOpParam &params, const T input1_data, const T input2_data)
 {
   const int32_t input1_val = params.input1_offset + input1_data;
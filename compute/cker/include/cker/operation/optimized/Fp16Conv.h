@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_FP16_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_FP16_CONV_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Conv2D with fp16 storage. Each output pixel gathers its input patch into fp32 in the
+// (filter_y, filter_x, in_channel) order of an OHWI filter row, so every output channel is a
+// single fp16 x fp32 dot product with fp32 accumulation.
+inline void ConvFp16(const ConvParams &params, const Shape &input_shape, const Float16 *input_data,
+                     const Shape &filter_shape, const Float16 *filter_data,
+                     const Shape &bias_shape, const Float16 *bias_data, const Shape &output_shape,
+                     Float16 *output_data, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int patch_size = filter_height * filter_width * input_depth;
+
+  std::vector<float> bias(output_depth, 0.f);
+  if (bias_data)
+    ConvertFp16ToFp32(bias_data, bias.data(), output_depth);
+
+  const int64_t num_pixels = static_cast<int64_t>(batches) * output_height * output_width;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, num_pixels, static_cast<int64_t>(patch_size) * output_depth,
+    [&](int64_t begin, int64_t end) {
+      std::vector<float> patch(patch_size);
+      std::vector<float> out(output_depth);
+      for (int64_t pixel = begin; pixel < end; ++pixel)
+      {
+        const int batch = static_cast<int>(pixel / (output_height * output_width));
+        const int out_y = static_cast<int>(pixel / output_width % output_height);
+        const int out_x = static_cast<int>(pixel % output_width);
+        const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+        const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+
+        float *patch_ptr = patch.data();
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+            if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width)
+            {
+              ConvertFp16ToFp32(input_data + Offset(input_shape, batch, in_y, in_x, 0), patch_ptr,
+                                input_depth);
+            }
+            else
+            {
+              std::fill(patch_ptr, patch_ptr + input_depth, 0.f);
+            }
+            patch_ptr += input_depth;
+          }
+        }
+
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+        {
+          const float total = Fp16DotProduct(filter_data + out_channel * patch_size,
+                                             patch.data(), patch_size);
+          out[out_channel] = ActivationFunctionWithMinMax(total + bias[out_channel],
+                                                          params.float_activation_min,
+                                                          params.float_activation_max);
+        }
+        ConvertFp32ToFp16(out.data(), output_data + pixel * output_depth, output_depth);
+      }
+    });
+}
+
+// DepthwiseConv2D with fp16 storage and fp32 accumulation
+inline void DepthwiseConvFp16(const DepthwiseConvParams &params, const Shape &input_shape,
+                              const Float16 *input_data, const Shape &filter_shape,
+                              const Float16 *filter_data, const Shape &bias_shape,
+                              const Float16 *bias_data, const Shape &output_shape,
+                              Float16 *output_data, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int depth_multiplier = params.depth_multiplier;
+  assert(output_depth == input_depth * depth_multiplier);
+  UNUSED_RELEASE(input_depth);
+
+  // Filters are small and reused by every pixel, so widen them once
+  std::vector<float> filter(filter_shape.FlatSize());
+  ConvertFp16ToFp32(filter_data, filter.data(), filter_shape.FlatSize());
+  std::vector<float> bias(output_depth, 0.f);
+  if (bias_data)
+    ConvertFp16ToFp32(bias_data, bias.data(), output_depth);
+
+  const int64_t num_rows = static_cast<int64_t>(batches) * output_height;
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, num_rows,
+    static_cast<int64_t>(output_width) * output_depth * filter_height * filter_width,
+    [&](int64_t begin, int64_t end) {
+      std::vector<float> in(input_depth);
+      std::vector<float> acc(output_depth);
+      for (int64_t r = begin; r < end; ++r)
+      {
+        const int batch = static_cast<int>(r / output_height);
+        const int out_y = static_cast<int>(r % output_height);
+        const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+        for (int out_x = 0; out_x < output_width; ++out_x)
+        {
+          const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+          std::copy(bias.begin(), bias.end(), acc.begin());
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+            if (in_y < 0 || in_y >= input_height)
+              continue;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+              if (in_x < 0 || in_x >= input_width)
+                continue;
+              ConvertFp16ToFp32(input_data + Offset(input_shape, batch, in_y, in_x, 0), in.data(),
+                                input_depth);
+              const float *filter_ptr =
+                filter.data() + Offset(filter_shape, 0, filter_y, filter_x, 0);
+              for (int ic = 0; ic < input_depth; ++ic)
+              {
+                for (int m = 0; m < depth_multiplier; ++m)
+                {
+                  const int oc = ic * depth_multiplier + m;
+                  acc[oc] += in[ic] * filter_ptr[oc];
+                }
+              }
+            }
+          }
+          for (int oc = 0; oc < output_depth; ++oc)
+          {
+            acc[oc] = ActivationFunctionWithMinMax(acc[oc], params.float_activation_min,
+                                                   params.float_activation_max);
+          }
+          ConvertFp32ToFp16(acc.data(), output_data + Offset(output_shape, batch, out_y, out_x, 0),
+                            output_depth);
+        }
+      }
+    });
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_FP16_CONV_H__
@@ -32,6 +32,13 @@ namespace cker
 namespace train
 {
 
+// Layout of filter and filter gradient given to training kernels
+enum class ConvFilterLayout
+{
+  kHWIO, // Layout of Eigen(TensorFlow) kernels
+  kOHWI, // Layout of circle model, no transpose of weights and their gradients is needed
+};
+
 // From tensorflow/core/kernels/conv_2d.h
 namespace functor
 {
@@ -42,8 +49,15 @@ template <typename Device, typename T> struct SpatialConvolutionBackwardInputFun
                   typename TTypes<T, 4>::ConstTensor filter,
                   typename TTypes<T, 4>::ConstTensor output_backward, Eigen::DenseIndex col_stride,
                   Eigen::DenseIndex row_stride, Eigen::DenseIndex col_dilation,
-                  Eigen::DenseIndex row_dilation)
+                  Eigen::DenseIndex row_dilation, const ConvFilterLayout filter_layout)
   {
+    if (filter_layout == ConvFilterLayout::kOHWI)
+    {
+      input_backward.device(d) = Eigen::SpatialConvolutionBackwardInputOHWI(
+        filter, output_backward, input_backward.dimension(2), input_backward.dimension(1),
+        col_stride, row_stride, col_dilation, row_dilation);
+      return;
+    }
     input_backward.device(d) = Eigen::SpatialConvolutionBackwardInput(
       filter, output_backward, input_backward.dimension(2), input_backward.dimension(1), col_stride,
       row_stride, col_dilation, row_dilation);
@@ -58,13 +72,24 @@ template <typename Device, typename T> struct SpatialConvolutionBackwardInputWit
                   Eigen::DenseIndex padded_rows, Eigen::DenseIndex col_stride,
                   Eigen::DenseIndex row_stride, Eigen::DenseIndex col_dilation,
                   Eigen::DenseIndex row_dilation, Eigen::DenseIndex pad_left,
-                  Eigen::DenseIndex pad_top)
+                  Eigen::DenseIndex pad_top, const ConvFilterLayout filter_layout)
   {
     // We have to slice the result of a spatial convolution backward
     // input, before assigning it to the `input_backward` to remove padding.
     //
     // TODO(ezhulenev): Pass explicit paddings to Eigen and do not materialize
     // intermediate result in memory before slicing.
+    if (filter_layout == ConvFilterLayout::kOHWI)
+    {
+      input_backward.device(d) =
+        Eigen::SpatialConvolutionBackwardInputOHWI(filter, output_backward, padded_cols,
+                                                   padded_rows, col_stride, row_stride,
+                                                   col_dilation, row_dilation)
+          .eval()
+          .slice(Eigen::DSizes<Eigen::DenseIndex, 4>{0, pad_left, pad_top, 0},
+                 input_backward.dimensions());
+      return;
+    }
     input_backward.device(d) =
       Eigen::SpatialConvolutionBackwardInput(filter, output_backward, padded_cols, padded_rows,
                                              col_stride, row_stride, col_dilation, row_dilation)
@@ -86,7 +111,8 @@ template <typename Device, typename T> struct LaunchConv2DBackpropInputOpImpl
                   int filter_width, int row_dilation, int col_dilation, int row_stride /* H */,
                   int col_stride /* W */, const PaddingType &padding_type, int padding_top,
                   int padding_bottom, int padding_left, int padding_right, T *in_backprop_data,
-                  int in_backprop_height, int in_backprop_width, int input_depth)
+                  int in_backprop_height, int in_backprop_width, int input_depth,
+                  const ConvFilterLayout filter_layout)
   {
     // WARNING: Need to swap row/col, padding_top/padding_left, and
     // padding_bottom/padding_right when calling Eigen. Eigen expects tensors
@@ -94,18 +120,23 @@ template <typename Device, typename T> struct LaunchConv2DBackpropInputOpImpl
 
     eigen_support::EigenTensor in_backprop_t(in_backprop_data, batches, in_backprop_height,
                                              in_backprop_width, input_depth);
-    eigen_support::ConstEigenTensor filter_t(filter_data, filter_height, filter_width, input_depth,
-                                             output_depth);
     eigen_support::ConstEigenTensor out_backprop_t(out_backprop_data, batches, out_backprop_height,
                                                    out_backprop_width, output_depth);
 
+    eigen_support::ConstEigenTensor filter_t =
+      filter_layout == ConvFilterLayout::kOHWI
+        ? eigen_support::ConstEigenTensor(filter_data, output_depth, filter_height, filter_width,
+                                          input_depth)
+        : eigen_support::ConstEigenTensor(filter_data, filter_height, filter_width, input_depth,
+                                          output_depth);
+
     if (padding_type != PaddingType::kNone /* EXPLICIT */)
     {
       // If padding was not explicitly defined, Eigen spatial convolution
       // backward input will infer correct forward paddings from input tensors.
       functor::SpatialConvolutionBackwardInputFunc<Device, T>()(
         d, in_backprop_t, filter_t, out_backprop_t, col_stride, row_stride, col_dilation,
-        row_dilation);
+        row_dilation, filter_layout);
     }
     else
     {
@@ -113,7 +144,7 @@ template <typename Device, typename T> struct LaunchConv2DBackpropInputOpImpl
         d, in_backprop_t, filter_t, out_backprop_t,
         in_backprop_t.dimension(2) + (padding_left + padding_right),
         in_backprop_t.dimension(1) + (padding_top + padding_bottom), col_stride, row_stride,
-        col_dilation, row_dilation, padding_top, padding_left);
+        col_dilation, row_dilation, padding_top, padding_left, filter_layout);
     }
   }
 };
@@ -126,14 +157,15 @@ template <typename T> struct LaunchConv2DBackpropInputOp
                   int filter_width, int row_dilation, int col_dilation, int row_stride /* H */,
                   int col_stride /* W */, const PaddingType &padding_type, int padding_top,
                   int padding_bottom, int padding_left, int padding_right, T *in_backprop_data,
-                  int in_backprop_height, int in_backprop_width, int input_depth)
+                  int in_backprop_height, int in_backprop_width, int input_depth,
+                  const ConvFilterLayout filter_layout)
   {
     LaunchConv2DBackpropInputOpImpl<Eigen::ThreadPoolDevice, T> launcher;
     launcher(*eigen_support::GetThreadPoolDevice(), out_backprop_data, batches, out_backprop_height,
              out_backprop_width, output_depth, filter_data, filter_height, filter_width,
              row_dilation, col_dilation, row_stride, col_stride, padding_type, padding_top,
              padding_bottom, padding_left, padding_right, in_backprop_data, in_backprop_height,
-             in_backprop_width, input_depth);
+             in_backprop_width, input_depth, filter_layout);
   }
 };
 
@@ -145,10 +177,9 @@ template <typename T> struct LaunchConv2DBackpropFilterOp
                   int input_width, int input_depth, int row_dilation, int col_dilation,
                   int row_stride /* H */, int col_stride /* W */, const PaddingType &padding_type,
                   int padding_top, int padding_bottom, int padding_left, int padding_right,
-                  T *filter_backprop_data, int filter_backprop_height, int filter_backprop_width)
+                  T *filter_backprop_data, int filter_backprop_height, int filter_backprop_width,
+                  const ConvFilterLayout filter_layout)
   {
-    eigen_support::EigenTensor filter_backprop_t(filter_backprop_data, filter_backprop_height,
-                                                 filter_backprop_width, input_depth, output_depth);
     eigen_support::ConstEigenTensor input_t(input_data, batches, input_height, input_width,
                                             input_depth);
     eigen_support::ConstEigenTensor out_backprop_t(out_backprop_data, batches, out_backprop_height,
@@ -156,13 +187,32 @@ template <typename T> struct LaunchConv2DBackpropFilterOp
 
     const Eigen::ThreadPoolDevice &d = *eigen_support::GetThreadPoolDevice();
 
+    auto backprop_filter = [&](const auto &input) {
+      if (filter_layout == ConvFilterLayout::kOHWI)
+      {
+        eigen_support::EigenTensor filter_backprop_t(filter_backprop_data, output_depth,
+                                                     filter_backprop_height, filter_backprop_width,
+                                                     input_depth);
+        filter_backprop_t.device(d) = Eigen::SpatialConvolutionBackwardKernelOHWI(
+          input, out_backprop_t, filter_backprop_width, filter_backprop_height, col_stride,
+          row_stride, col_dilation, row_dilation);
+      }
+      else
+      {
+        eigen_support::EigenTensor filter_backprop_t(filter_backprop_data, filter_backprop_height,
+                                                     filter_backprop_width, input_depth,
+                                                     output_depth);
+        filter_backprop_t.device(d) = Eigen::SpatialConvolutionBackwardKernel(
+          input, out_backprop_t, filter_backprop_width, filter_backprop_height, col_stride,
+          row_stride, col_dilation, row_dilation);
+      }
+    };
+
     if (padding_type != PaddingType::kNone /* EXPLICIT */)
     {
       // If padding was not explicitly defined, Eigen spatial convolution
       // backward filter will infer correct forward paddings from input tensors.
-      filter_backprop_t.device(d) = Eigen::SpatialConvolutionBackwardKernel(
-        input_t, out_backprop_t, filter_backprop_t.dimension(1), filter_backprop_t.dimension(0),
-        col_stride, row_stride, col_dilation, row_dilation);
+      backprop_filter(input_t);
     }
     else
     {
@@ -178,9 +228,7 @@ template <typename T> struct LaunchConv2DBackpropFilterOp
 
       // TODO(ezhulenev): Pass explicit paddings to Eigen spatial backward
       // convolution and do not rely on tensor padding expression.
-      filter_backprop_t.device(d) = Eigen::SpatialConvolutionBackwardKernel(
-        padded_t, out_backprop_t, filter_backprop_t.dimension(1), filter_backprop_t.dimension(0),
-        col_stride, row_stride, col_dilation, row_dilation);
+      backprop_filter(padded_t);
     }
   }
 };
@@ -188,7 +236,8 @@ template <typename T> struct LaunchConv2DBackpropFilterOp
 inline void ConvInputGrad(const ConvParams &params, const Shape &incoming_shape,
                           const float *incoming_data, const Shape &filter_shape,
                           const float *filter_data, const int padding_bottom,
-                          const int padding_right, const Shape &grad_shape, float *grad_data)
+                          const int padding_right, const Shape &grad_shape, float *grad_data,
+                          const ConvFilterLayout filter_layout = ConvFilterLayout::kHWIO)
 {
   const int stride_rows = params.stride_height;
   const int stride_cols = params.stride_width;
@@ -202,13 +251,14 @@ inline void ConvInputGrad(const ConvParams &params, const Shape &incoming_shape,
   const int dilation_rows = params.dilation_height_factor;
   const int dilation_cols = params.dilation_width_factor;
 
+  const bool is_ohwi = filter_layout == ConvFilterLayout::kOHWI;
   const int batches = MatchingDim(grad_shape, 0, incoming_shape, 0);
-  const int input_depth = MatchingDim(filter_shape, 2, grad_shape, 3);
-  const int output_depth = MatchingDim(filter_shape, 3, incoming_shape, 3);
+  const int input_depth = MatchingDim(filter_shape, is_ohwi ? 3 : 2, grad_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, is_ohwi ? 0 : 3, incoming_shape, 3);
   const int grad_height = grad_shape.Dims(1);
   const int grad_width = grad_shape.Dims(2);
-  const int filter_height = filter_shape.Dims(0);
-  const int filter_width = filter_shape.Dims(1);
+  const int filter_height = filter_shape.Dims(is_ohwi ? 1 : 0);
+  const int filter_width = filter_shape.Dims(is_ohwi ? 2 : 1);
   const int incoming_height = incoming_shape.Dims(1);
   const int incoming_width = incoming_shape.Dims(2);
 
@@ -219,14 +269,15 @@ inline void ConvInputGrad(const ConvParams &params, const Shape &incoming_shape,
     incoming_data, batches, incoming_height, incoming_width, output_depth, filter_data,
     filter_height, filter_width, dilation_rows, dilation_cols, stride_rows, stride_cols, padding,
     padding_top, padding_bottom, padding_left, padding_right, grad_data, grad_height, grad_width,
-    input_depth);
+    input_depth, filter_layout);
 }
 
 inline void ConvFilterGrad(const ConvParams &params, const Shape &incoming_shape,
                            const float *incoming_data, const Shape &input_shape,
                            const float *input_data, const int padding_bottom,
                            const int padding_right, const Shape &filter_backprop_shape,
-                           float *filter_backprop_data)
+                           float *filter_backprop_data,
+                           const ConvFilterLayout filter_layout = ConvFilterLayout::kHWIO)
 {
   const int stride_rows = params.stride_height;
   const int stride_cols = params.stride_width;
@@ -240,13 +291,14 @@ inline void ConvFilterGrad(const ConvParams &params, const Shape &incoming_shape
   const int dilation_rows = params.dilation_height_factor;
   const int dilation_cols = params.dilation_width_factor;
 
+  const bool is_ohwi = filter_layout == ConvFilterLayout::kOHWI;
   const int batches = MatchingDim(input_shape, 0, incoming_shape, 0);
-  const int input_depth = MatchingDim(filter_backprop_shape, 2, input_shape, 3);
-  const int output_depth = MatchingDim(filter_backprop_shape, 3, incoming_shape, 3);
+  const int input_depth = MatchingDim(filter_backprop_shape, is_ohwi ? 3 : 2, input_shape, 3);
+  const int output_depth = MatchingDim(filter_backprop_shape, is_ohwi ? 0 : 3, incoming_shape, 3);
   const int input_height = input_shape.Dims(1);
   const int input_width = input_shape.Dims(2);
-  const int filter_backprop_height = filter_backprop_shape.Dims(0);
-  const int filter_backprop_width = filter_backprop_shape.Dims(1);
+  const int filter_backprop_height = filter_backprop_shape.Dims(is_ohwi ? 1 : 0);
+  const int filter_backprop_width = filter_backprop_shape.Dims(is_ohwi ? 2 : 1);
   const int incoming_height = incoming_shape.Dims(1);
   const int incoming_width = incoming_shape.Dims(2);
 
@@ -257,7 +309,7 @@ inline void ConvFilterGrad(const ConvParams &params, const Shape &incoming_shape
     incoming_data, batches, incoming_height, incoming_width, output_depth, input_data, input_height,
     input_width, input_depth, dilation_rows, dilation_cols, stride_rows, stride_cols, padding,
     padding_top, padding_bottom, padding_left, padding_right, filter_backprop_data,
-    filter_backprop_height, filter_backprop_width);
+    filter_backprop_height, filter_backprop_width, filter_layout);
 }
 
 } // namespace train
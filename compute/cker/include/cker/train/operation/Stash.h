@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPERATION_STASH_H__
+#define __NNFW_CKER_TRAIN_OPERATION_STASH_H__
+
+#include "cker/Bf16.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+// Largest finite fp16 value
+constexpr float kFp16Max = 65504.0f;
+
+// Converts to fp16, saturating values out of the fp16 range instead of making them inf, which
+// would turn every gradient depending on them into nan. nan stays nan.
+inline void ConvertFp32ToFp16Saturate(const float *input, Float16 *output, int size)
+{
+  constexpr int kChunkSize = 256;
+  float chunk[kChunkSize];
+  for (int i = 0; i < size; i += kChunkSize)
+  {
+    const int n = std::min(kChunkSize, size - i);
+    for (int j = 0; j < n; ++j)
+      chunk[j] = std::min(std::max(input[i + j], -kFp16Max), kFp16Max);
+    ConvertFp32ToFp16(chunk, output + i, n);
+  }
+}
+
+// Stash() keeps a fp32 activation in a 16-bit type between forwarding and backwarding, and
+// Unstash() restores it to fp32 before it is used by backwarding.
+template <typename T>
+void Stash(const Shape &shape, const float *input_data, T *stash_data,
+           ruy::Context *ruy_context = nullptr)
+{
+  static_assert(std::is_same_v<T, Float16> || std::is_same_v<T, BFloat16>,
+                "Stash supports only Float16 and BFloat16");
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, shape.FlatSize(), 1, [&](int64_t begin, int64_t end) {
+      const int size = static_cast<int>(end - begin);
+      if constexpr (std::is_same_v<T, Float16>)
+        ConvertFp32ToFp16Saturate(input_data + begin, stash_data + begin, size);
+      else
+        ConvertFp32ToBf16(input_data + begin, stash_data + begin, size);
+    });
+}
+
+template <typename T>
+void Unstash(const Shape &shape, const T *stash_data, float *output_data,
+             ruy::Context *ruy_context = nullptr)
+{
+  static_assert(std::is_same_v<T, Float16> || std::is_same_v<T, BFloat16>,
+                "Unstash supports only Float16 and BFloat16");
+  cpu_backend_threadpool::ParallelFor(
+    ruy_context, shape.FlatSize(), 1, [&](int64_t begin, int64_t end) {
+      const int size = static_cast<int>(end - begin);
+      if constexpr (std::is_same_v<T, Float16>)
+        ConvertFp16ToFp32(stash_data + begin, output_data + begin, size);
+      else
+        ConvertBf16ToFp32(stash_data + begin, output_data + begin, size);
+    });
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPERATION_STASH_H__
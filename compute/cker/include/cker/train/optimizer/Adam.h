@@ -18,10 +18,11 @@
 #ifndef __NNFW_CKER_TRAIN_OPTIMIZER_ADAM_H__
 #define __NNFW_CKER_TRAIN_OPTIMIZER_ADAM_H__
 
-#include "cker/eigen/training_ops.h"
-#include "cker/eigen/EigenSupport.h"
+#include "cker/train/optimizer/Utils.h"
+#include "cker/Shape.h"
 
-#include <vector>
+#include <cmath>
+#include <stdexcept>
 
 namespace nnfw
 {
@@ -30,52 +31,52 @@ namespace cker
 namespace train
 {
 
+// Single-pass Adam update of 'size' elements
+//   g   = grad + weight_decay * var
+//   m   = m + (g - m) * (1 - beta1)
+//   v   = v + (g^2 - v) * (1 - beta2)
+//   var = var - alpha * m / (sqrt(v) + epsilon)
+// where alpha is the bias-corrected learning rate
+inline void Adam(int64_t size, float *var_data, const float *grad_data, float *m_data,
+                 float *v_data, float alpha, float beta1, float beta2, float epsilon,
+                 float weight_decay, bool use_nesterov)
+{
+  using ArrayMap = Eigen::Map<Eigen::ArrayXf>;
+  using ConstArrayMap = Eigen::Map<const Eigen::ArrayXf>;
+
+  ParallelForOptimizerBlocks(size, 4, [&](int64_t offset, int64_t n) {
+    ArrayMap var(var_data + offset, n);
+    ArrayMap m(m_data + offset, n);
+    ArrayMap v(v_data + offset, n);
+    ConstArrayMap grad(grad_data + offset, n);
+
+    if (weight_decay != 0.f)
+    {
+      const auto g = grad + weight_decay * var;
+      m += (g - m) * (1.f - beta1);
+      v += (g.square() - v) * (1.f - beta2);
+      if (use_nesterov)
+        var -= (g * (1.f - beta1) + beta1 * m) * alpha / (v.sqrt() + epsilon);
+      else
+        var -= m * alpha / (v.sqrt() + epsilon);
+    }
+    else
+    {
+      m += (grad - m) * (1.f - beta1);
+      v += (grad.square() - v) * (1.f - beta2);
+      if (use_nesterov)
+        var -= (grad * (1.f - beta1) + beta1 * m) * alpha / (v.sqrt() + epsilon);
+      else
+        var -= m * alpha / (v.sqrt() + epsilon);
+    }
+  });
+}
+
 inline void Adam(const Shape &trainable_shape, float *trainable_data, const Shape &grad_shape,
                  const float *grad_data, const Shape &m_shape, float *m_data, const Shape &v_shape,
                  float *v_data, float beta1_power, float beta2_power, float learning_rate,
                  float beta1, float beta2, float epsilon, bool use_nesterov)
 {
-  Tensor trainable_tensor;
-  Tensor grad_tensor;
-  Tensor m_tensor;
-  Tensor v_tensor;
-  Tensor beta1_power_tensor;
-  Tensor beta2_power_tensor;
-  Tensor lr_tensor;
-  Tensor beta1_tensor;
-  Tensor beta2_tensor;
-  Tensor epsilon_tensor;
-
-  trainable_tensor.shape.ReplaceWith(trainable_shape.DimensionsCount(), trainable_shape.DimsData());
-  trainable_tensor.buffer = trainable_data;
-
-  grad_tensor.shape.ReplaceWith(grad_shape.DimensionsCount(), grad_shape.DimsData());
-  grad_tensor.buffer = const_cast<float *>(grad_data);
-
-  m_tensor.shape.ReplaceWith(m_shape.DimensionsCount(), m_shape.DimsData());
-  m_tensor.buffer = m_data;
-
-  v_tensor.shape.ReplaceWith(v_shape.DimensionsCount(), v_shape.DimsData());
-  v_tensor.buffer = v_data;
-
-  std::vector<float> beta1_power_vec{beta1_power};
-  beta1_power_tensor.buffer = beta1_power_vec.data();
-
-  std::vector<float> beta2_power_vec{beta2_power};
-  beta2_power_tensor.buffer = beta2_power_vec.data();
-
-  std::vector<float> lr_vec{learning_rate};
-  lr_tensor.buffer = lr_vec.data();
-
-  std::vector<float> beta1_vec{beta1};
-  beta1_tensor.buffer = beta1_vec.data();
-
-  std::vector<float> beta2_vec{beta2};
-  beta2_tensor.buffer = beta2_vec.data();
-
-  std::vector<float> epsilon_vec{epsilon};
-  epsilon_tensor.buffer = epsilon_vec.data();
-
   if (trainable_shape != m_shape)
     throw std::runtime_error("cker::Adam: output and m do not have the same shape");
 
@@ -85,13 +86,9 @@ inline void Adam(const Shape &trainable_shape, float *trainable_data, const Shap
   if (trainable_shape != grad_shape)
     throw std::runtime_error("cker::Adam: output and gradient do not have the same shape");
 
-  const training_ops::CPUDevice &device = *eigen_support::GetThreadPoolDevice();
-  training_ops::functor::ApplyAdam<training_ops::CPUDevice, float>()(
-    device, trainable_tensor.flat<float>(), m_tensor.flat<float>(), v_tensor.flat<float>(),
-    beta1_power_tensor.scalar<float>(), beta2_power_tensor.scalar<float>(),
-    lr_tensor.scalar<float>(), beta1_tensor.scalar<float>(), beta2_tensor.scalar<float>(),
-    epsilon_tensor.scalar<float>(), static_cast<const Tensor &>(grad_tensor).flat<float>(),
-    use_nesterov);
+  const float alpha = learning_rate * std::sqrt(1.f - beta2_power) / (1.f - beta1_power);
+  Adam(trainable_shape.FlatSize(), trainable_data, grad_data, m_data, v_data, alpha, beta1, beta2,
+       epsilon, 0.f, use_nesterov);
 }
 
 } // namespace train
@@ -18,10 +18,10 @@
 #ifndef __NNFW_CKER_TRAIN_OPTIMIZER_SGD_H__
 #define __NNFW_CKER_TRAIN_OPTIMIZER_SGD_H__
 
-#include "cker/eigen/training_ops.h"
-#include "cker/eigen/EigenSupport.h"
+#include "cker/train/optimizer/Utils.h"
+#include "cker/Shape.h"
 
-#include <vector>
+#include <stdexcept>
 
 namespace nnfw
 {
@@ -30,30 +30,61 @@ namespace cker
 namespace train
 {
 
-inline void GradientDescent(const Shape &output_shape, float *output_data, const Shape &grad_shape,
-                            const float *grad_data, float learning_rate)
+// Single-pass SGD update of 'size' elements
+//   g   = grad + weight_decay * var
+//   vel = momentum * vel + g                       (only if velocity is given)
+//   var = var - lr * (nesterov ? g + momentum * vel : vel)
+inline void GradientDescent(int64_t size, float *var_data, const float *grad_data,
+                            float *velocity_data, float learning_rate, float momentum,
+                            float weight_decay, bool use_nesterov)
 {
-  Tensor output_tensor;
-  Tensor grad_tensor;
-  Tensor lr_tensor;
+  using ArrayMap = Eigen::Map<Eigen::ArrayXf>;
+  using ConstArrayMap = Eigen::Map<const Eigen::ArrayXf>;
 
-  output_tensor.shape.ReplaceWith(output_shape.DimensionsCount(), output_shape.DimsData());
-  output_tensor.buffer = output_data;
+  const int num_buffers = velocity_data != nullptr ? 3 : 2;
+  ParallelForOptimizerBlocks(size, num_buffers, [&](int64_t offset, int64_t n) {
+    ArrayMap var(var_data + offset, n);
+    ConstArrayMap grad(grad_data + offset, n);
 
-  grad_tensor.shape.ReplaceWith(grad_shape.DimensionsCount(), grad_shape.DimsData());
-  grad_tensor.buffer = const_cast<float *>(grad_data);
+    if (velocity_data == nullptr)
+    {
+      if (weight_decay != 0.f)
+        var -= learning_rate * (grad + weight_decay * var);
+      else
+        var -= learning_rate * grad;
+      return;
+    }
 
-  std::vector<float> lr_vec{learning_rate};
-  lr_tensor.buffer = lr_vec.data();
+    ArrayMap vel(velocity_data + offset, n);
+    if (weight_decay != 0.f)
+    {
+      const auto g = grad + weight_decay * var;
+      vel = momentum * vel + g;
+      if (use_nesterov)
+        var -= learning_rate * (g + momentum * vel);
+      else
+        var -= learning_rate * vel;
+    }
+    else
+    {
+      vel = momentum * vel + grad;
+      if (use_nesterov)
+        var -= learning_rate * (grad + momentum * vel);
+      else
+        var -= learning_rate * vel;
+    }
+  });
+}
 
+inline void GradientDescent(const Shape &output_shape, float *output_data, const Shape &grad_shape,
+                            const float *grad_data, float learning_rate)
+{
   if (output_shape != grad_shape)
     throw std::runtime_error(
       "cker::GradientDescent: output and gradient do not have the same shape");
 
-  const training_ops::CPUDevice &device = *eigen_support::GetThreadPoolDevice();
-  training_ops::functor::ApplyGradientDescent<training_ops::CPUDevice, float>()(
-    device, output_tensor.flat<float>(), lr_tensor.scalar<float>(),
-    static_cast<const Tensor &>(grad_tensor).flat<float>());
+  GradientDescent(output_shape.FlatSize(), output_data, grad_data, nullptr, learning_rate, 0.f,
+                  0.f, false);
 }
 
 } // namespace train
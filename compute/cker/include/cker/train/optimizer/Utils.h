@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPTIMIZER_UTILS_H__
+#define __NNFW_CKER_TRAIN_OPTIMIZER_UTILS_H__
+
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+// Elements updated together by an optimizer kernel. Blocks of every buffer stay in L1 cache while
+// the fused update runs over them, so each buffer is read from memory only once.
+constexpr int64_t kOptimizerBlockSize = 1024;
+
+// Calls fn(offset, n) for every block of 'size' elements, sharding the blocks over the Eigen
+// thread pool. 'num_buffers' is the number of buffers read and written by fn.
+template <typename Function>
+void ParallelForOptimizerBlocks(int64_t size, int num_buffers, const Function &fn)
+{
+  const auto shard = [size, &fn](int64_t begin_block, int64_t end_block) {
+    const int64_t end = std::min(end_block * kOptimizerBlockSize, size);
+    for (int64_t offset = begin_block * kOptimizerBlockSize; offset < end;
+         offset += kOptimizerBlockSize)
+      fn(offset, std::min(kOptimizerBlockSize, end - offset));
+  };
+
+  const int64_t num_blocks = (size + kOptimizerBlockSize - 1) / kOptimizerBlockSize;
+  const double block_bytes = static_cast<double>(kOptimizerBlockSize) * sizeof(float);
+  const Eigen::TensorOpCost cost(block_bytes * num_buffers, block_bytes * num_buffers,
+                                 static_cast<double>(kOptimizerBlockSize) * 4 * num_buffers);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_blocks, cost, shard);
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPTIMIZER_UTILS_H__
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_CHECK_H__
+#define __NNFW_CKER_X86_CHECK_H__
+
+#include "cker/neon/neon_check.h"
+
+// CKER_X86_SIMD is defined when x86 vector code can be compiled. The vector code is built with
+// per-function target attributes so that the binary still runs on hosts without AVX2; the actual
+// path is selected at runtime by x86::HasAvx2() / x86::HasAvx512().
+#if defined(CKER_X86_PLATFORM) && !defined(USE_NEON) && !defined(CKER_DISABLE_X86_SIMD) && \
+  (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CKER_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#ifdef CKER_X86_SIMD
+
+#define CKER_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define CKER_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx2,fma")))
+#define CKER_TARGET_F16C __attribute__((target("avx2,fma,f16c")))
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+inline bool HasAvx2()
+{
+  static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  return supported;
+}
+
+inline bool HasAvx512()
+{
+  static const bool supported =
+    HasAvx2() && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+  return supported;
+}
+
+inline bool HasF16c()
+{
+  static const bool supported = HasAvx2() && __builtin_cpu_supports("f16c");
+  return supported;
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+// X86_OR_PORTABLE(SomeFunc, args) calls X86SomeFunc(args) if the host supports AVX2,
+// PortableSomeFunc(args) otherwise.
+#define X86_OR_PORTABLE(funcname, ...) \
+  (::nnfw::cker::x86::HasAvx2() ? X86##funcname(__VA_ARGS__) : Portable##funcname(__VA_ARGS__))
+
+#endif // CKER_X86_SIMD
+
+// SIMD_OR_PORTABLE(SomeFunc, args) picks the NEON or x86 vector implementation available on this
+// build, and falls back to PortableSomeFunc(args).
+#ifdef CKER_X86_SIMD
+#define SIMD_OR_PORTABLE(funcname, ...) X86_OR_PORTABLE(funcname, __VA_ARGS__)
+#else
+#define SIMD_OR_PORTABLE(funcname, ...) NEON_OR_PORTABLE(funcname, __VA_ARGS__)
+#endif // CKER_X86_SIMD
+
+#endif // __NNFW_CKER_X86_CHECK_H__
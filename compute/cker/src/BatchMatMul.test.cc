@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Naive BatchMatMul on 4D shapes, batch dimensions of size 1 are broadcast
+template <typename T, typename AccT>
+std::vector<AccT> naiveBatchMatMul(const Shape &lhs_shape, const std::vector<T> &lhs,
+                                   const Shape &rhs_shape, const std::vector<T> &rhs, bool adj_x,
+                                   bool adj_y, AccT lhs_offset = 0, AccT rhs_offset = 0)
+{
+  const int b0 = std::max(lhs_shape.Dims(0), rhs_shape.Dims(0));
+  const int b1 = std::max(lhs_shape.Dims(1), rhs_shape.Dims(1));
+  const int M = adj_x ? lhs_shape.Dims(3) : lhs_shape.Dims(2);
+  const int K = adj_x ? lhs_shape.Dims(2) : lhs_shape.Dims(3);
+  const int N = adj_y ? rhs_shape.Dims(2) : rhs_shape.Dims(3);
+
+  std::vector<AccT> out(b0 * b1 * M * N);
+  for (int i0 = 0; i0 < b0; ++i0)
+    for (int i1 = 0; i1 < b1; ++i1)
+    {
+      const int l0 = lhs_shape.Dims(0) == 1 ? 0 : i0, l1 = lhs_shape.Dims(1) == 1 ? 0 : i1;
+      const int r0 = rhs_shape.Dims(0) == 1 ? 0 : i0, r1 = rhs_shape.Dims(1) == 1 ? 0 : i1;
+      const T *l = lhs.data() + (l0 * lhs_shape.Dims(1) + l1) * M * K;
+      const T *r = rhs.data() + (r0 * rhs_shape.Dims(1) + r1) * K * N;
+      AccT *o = out.data() + (i0 * b1 + i1) * M * N;
+      for (int m = 0; m < M; ++m)
+        for (int n = 0; n < N; ++n)
+        {
+          AccT acc = 0;
+          for (int k = 0; k < K; ++k)
+          {
+            const AccT lv = (adj_x ? l[k * M + m] : l[m * K + k]) + lhs_offset;
+            const AccT rv = (adj_y ? r[n * K + k] : r[k * N + n]) + rhs_offset;
+            acc += lv * rv;
+          }
+          o[m * N + n] = acc;
+        }
+    }
+  return out;
+}
+
+template <typename T> std::vector<T> genData(int size, int mod)
+{
+  std::vector<T> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<T>((i * 7 + 3) % mod - mod / 2);
+  return data;
+}
+
+} // namespace
+
+TEST(CKer_Operation, BatchMatMul)
+{
+  struct Case
+  {
+    Shape lhs_shape;
+    Shape rhs_shape;
+    bool adj_x;
+    bool adj_y;
+  };
+  // clang-format off
+  std::vector<Case> cases = {
+    {{1, 2, 3, 4}, {1, 2, 4, 5}, false, false},
+    {{1, 2, 4, 3}, {1, 2, 4, 5}, true, false},
+    {{1, 2, 3, 4}, {1, 2, 5, 4}, false, true},
+    {{1, 2, 4, 3}, {1, 2, 5, 4}, true, true},
+    // Broadcast batch dimensions
+    {{2, 1, 3, 4}, {1, 3, 4, 5}, false, false},
+    {{1, 1, 3, 4}, {2, 3, 4, 5}, false, false},
+    {{2, 3, 3, 4}, {1, 1, 5, 4}, false, true},
+    // Large enough to be split over threads
+    {{2, 3, 64, 32}, {2, 3, 32, 48}, false, false},
+  };
+  // clang-format on
+
+  ruy::Context ruy_context;
+  for (int num_threads : {1, 4})
+  {
+    ruy_context.set_max_num_threads(num_threads);
+    for (const auto &c : cases)
+    {
+      const auto lhs = genData<float>(c.lhs_shape.FlatSize(), 11);
+      const auto rhs = genData<float>(c.rhs_shape.FlatSize(), 13);
+      const auto expected =
+        naiveBatchMatMul<float, float>(c.lhs_shape, lhs, c.rhs_shape, rhs, c.adj_x, c.adj_y);
+
+      const int M = c.adj_x ? c.lhs_shape.Dims(3) : c.lhs_shape.Dims(2);
+      const int N = c.adj_y ? c.rhs_shape.Dims(2) : c.rhs_shape.Dims(3);
+      Shape output_shape{std::max(c.lhs_shape.Dims(0), c.rhs_shape.Dims(0)),
+                         std::max(c.lhs_shape.Dims(1), c.rhs_shape.Dims(1)), M, N};
+      std::vector<float> output(output_shape.FlatSize());
+
+      nnfw::cker::BatchMatMul kernel;
+      kernel.prepare(c.lhs_shape, c.rhs_shape, c.adj_x, c.adj_y);
+      kernel(c.lhs_shape, lhs.data(), c.rhs_shape, rhs.data(), c.adj_x, c.adj_y, output_shape,
+             output.data(), &ruy_context);
+
+      ASSERT_EQ(output.size(), expected.size());
+      for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(output[i], expected[i], 1e-3f);
+    }
+  }
+}
+
+TEST(CKer_Operation, BatchMatMulInt8)
+{
+  Shape lhs_shape{2, 1, 16, 24};
+  Shape rhs_shape{1, 3, 24, 8};
+  Shape output_shape{2, 3, 16, 8};
+  const auto lhs = genData<int8_t>(lhs_shape.FlatSize(), 255);
+  const auto rhs = genData<int8_t>(rhs_shape.FlatSize(), 127);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Symmetric and asymmetric rhs
+  for (int32_t weights_offset : {0, -4})
+  {
+    nnfw::cker::FullyConnectedParams params;
+    params.input_offset = 5; // -lhs zero point
+    params.weights_offset = weights_offset;
+    params.output_offset = -3;
+    // Output scale is 2^-12 of accumulator scale
+    params.output_multiplier = 1 << 30;
+    params.output_shift = -11;
+    params.quantized_activation_min = -128;
+    params.quantized_activation_max = 127;
+
+    const auto acc = naiveBatchMatMul<int8_t, int32_t>(lhs_shape, lhs, rhs_shape, rhs, false,
+                                                       false, params.input_offset,
+                                                       params.weights_offset);
+
+    std::vector<int8_t> output(output_shape.FlatSize());
+
+    nnfw::cker::BatchMatMul kernel;
+    kernel.prepare(lhs_shape, rhs_shape, false, false);
+    kernel(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(), false, false, output_shape,
+           output.data(), &ruy_context);
+
+    ASSERT_EQ(output.size(), acc.size());
+    for (size_t i = 0; i < acc.size(); ++i)
+    {
+      int32_t expected = nnfw::cker::MultiplyByQuantizedMultiplier(acc[i], params.output_multiplier,
+                                                                   params.output_shift);
+      expected = std::min(127, std::max(-128, expected + params.output_offset));
+      EXPECT_EQ(output[i], expected);
+    }
+  }
+}
+
+TEST(CKer_Operation, neg_BatchMatMulInvalidBroadcast)
+{
+  Shape lhs_shape{1, 2, 3, 4};
+  Shape rhs_shape{1, 3, 4, 5};
+  Shape output_shape{1, 3, 3, 5};
+  std::vector<float> lhs(lhs_shape.FlatSize()), rhs(rhs_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::BatchMatMul kernel;
+  kernel.prepare(lhs_shape, rhs_shape, false, false);
+  EXPECT_ANY_THROW(kernel(lhs_shape, lhs.data(), rhs_shape, rhs.data(), false, false,
+                          output_shape, output.data()));
+}
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/Fp16.h>
+#include <cker/operation/BatchMatMul.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/optimized/Fp16Conv.h>
+#include <cker/operation/reference/Conv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+uint16_t ToBits(float value) { return Fp32ToFp16(value).bits; }
+
+float FromBits(uint16_t bits) { return Fp16ToFp32(Float16{bits}); }
+
+// Values that are exactly representable in fp16, so that the fp32 reference sees the same inputs
+std::vector<float> MakeData(int size, int seed = 0)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 7 + seed * 13) % 31 - 15) * 0.0625f;
+  return data;
+}
+
+std::vector<Float16> ToHalf(const std::vector<float> &data)
+{
+  std::vector<Float16> half(data.size());
+  ConvertFp32ToFp16(data.data(), half.data(), data.size());
+  return half;
+}
+
+// Compare to the fp32 result, allowing for the rounding of the fp16 output
+void ExpectNear(const std::vector<float> &expected, const std::vector<Float16> &actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    const float tolerance = std::max(1e-3f, std::abs(expected[i]) * 2e-3f);
+    EXPECT_NEAR(Fp16ToFp32(actual[i]), expected[i], tolerance) << "at " << i;
+  }
+}
+
+class CKer_Fp16 : public ::testing::Test
+{
+protected:
+  void SetUp() override { _ruy_context.set_max_num_threads(4); }
+
+  ruy::Context _ruy_context;
+};
+
+} // namespace
+
+TEST(CKer_Fp16Convert, KnownValues)
+{
+  EXPECT_EQ(ToBits(0.f), 0x0000);
+  EXPECT_EQ(ToBits(-0.f), 0x8000);
+  EXPECT_EQ(ToBits(1.f), 0x3c00);
+  EXPECT_EQ(ToBits(-2.f), 0xc000);
+  EXPECT_EQ(ToBits(65504.f), 0x7bff);
+  EXPECT_EQ(ToBits(0.1f), 0x2e66);
+
+  EXPECT_EQ(FromBits(0x3c00), 1.f);
+  EXPECT_EQ(FromBits(0xc000), -2.f);
+  EXPECT_EQ(FromBits(0x7bff), 65504.f);
+}
+
+TEST(CKer_Fp16Convert, Subnormals)
+{
+  const float min_subnormal = std::ldexp(1.f, -24);
+  EXPECT_EQ(ToBits(min_subnormal), 0x0001);
+  EXPECT_EQ(ToBits(-min_subnormal), 0x8001);
+  EXPECT_EQ(ToBits(std::ldexp(1023.f, -24)), 0x03ff);
+  // Halfway between 0 and the smallest subnormal rounds to even
+  EXPECT_EQ(ToBits(std::ldexp(1.f, -25)), 0x0000);
+  EXPECT_EQ(ToBits(std::ldexp(3.f, -25)), 0x0002);
+  EXPECT_EQ(ToBits(std::ldexp(1.f, -26)), 0x0000);
+
+  EXPECT_EQ(FromBits(0x0001), min_subnormal);
+  EXPECT_EQ(FromBits(0x03ff), std::ldexp(1023.f, -24));
+}
+
+TEST(CKer_Fp16Convert, InfAndNan)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(ToBits(inf), 0x7c00);
+  EXPECT_EQ(ToBits(-inf), 0xfc00);
+  // Overflow after rounding
+  EXPECT_EQ(ToBits(65520.f), 0x7c00);
+  EXPECT_EQ(ToBits(1e10f), 0x7c00);
+  EXPECT_EQ(ToBits(65519.f), 0x7bff);
+
+  const uint16_t nan_bits = ToBits(std::numeric_limits<float>::quiet_NaN());
+  EXPECT_EQ(nan_bits & 0x7c00, 0x7c00);
+  EXPECT_NE(nan_bits & 0x03ff, 0);
+
+  EXPECT_EQ(FromBits(0x7c00), inf);
+  EXPECT_EQ(FromBits(0xfc00), -inf);
+  EXPECT_TRUE(std::isnan(FromBits(0x7e00)));
+}
+
+TEST(CKer_Fp16Convert, RoundToNearestEven)
+{
+  // 1 + 2^-11 is halfway between 1 and the next fp16 value
+  EXPECT_EQ(ToBits(1.f + std::ldexp(1.f, -11)), 0x3c00);
+  EXPECT_EQ(ToBits(1.f + std::ldexp(3.f, -11)), 0x3c02);
+  EXPECT_EQ(ToBits(1.f + std::ldexp(1.f, -11) + std::ldexp(1.f, -20)), 0x3c01);
+}
+
+TEST(CKer_Fp16Convert, RoundTrip)
+{
+  for (uint32_t bits = 0; bits <= 0xffff; ++bits)
+  {
+    const uint16_t h = static_cast<uint16_t>(bits);
+    if ((h & 0x7c00) == 0x7c00 && (h & 0x03ff) != 0)
+      continue; // nan payloads are not preserved
+    EXPECT_EQ(ToBits(FromBits(h)), h) << "bits " << bits;
+  }
+}
+
+TEST(CKer_Fp16Convert, BulkMatchesScalar)
+{
+  std::vector<float> data(1003);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = std::ldexp(static_cast<float>(i) * 1.37f - 600.f, static_cast<int>(i % 40) - 30);
+
+  std::vector<Float16> half(data.size());
+  ConvertFp32ToFp16(data.data(), half.data(), data.size());
+  std::vector<float> back(data.size());
+  ConvertFp16ToFp32(half.data(), back.data(), half.size());
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    EXPECT_EQ(half[i].bits, ToBits(data[i])) << "at " << i;
+    EXPECT_EQ(back[i], FromBits(half[i].bits)) << "at " << i;
+  }
+}
+
+TEST_F(CKer_Fp16, FullyConnected)
+{
+  const int batch = 3, input_size = 77, num_units = 130;
+  const auto input = MakeData(batch * input_size, 1);
+  const auto weights = MakeData(num_units * input_size, 2);
+  const auto bias = MakeData(num_units, 3);
+
+  FullyConnectedParams params;
+  params.activation = FusedActivationFunctionType::kRelu;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> expected(batch * num_units);
+  for (int b = 0; b < batch; ++b)
+    for (int u = 0; u < num_units; ++u)
+    {
+      float acc = bias[u];
+      for (int i = 0; i < input_size; ++i)
+        acc += input[b * input_size + i] * weights[u * input_size + i];
+      expected[b * num_units + u] = std::max(acc, 0.f);
+    }
+
+  const auto input_h = ToHalf(input);
+  const auto weights_h = ToHalf(weights);
+  const auto bias_h = ToHalf(bias);
+  std::vector<Float16> output(batch * num_units);
+  FCTempArena arena;
+  FullyConnected(params, Shape{batch, input_size}, input_h.data(), Shape{num_units, input_size},
+                 weights_h.data(), Shape{num_units}, bias_h.data(), Shape{batch, num_units},
+                 output.data(), arena, &_ruy_context);
+  ExpectNear(expected, output);
+}
+
+TEST_F(CKer_Fp16, Conv)
+{
+  const Shape input_shape{2, 9, 11, 5};
+  const Shape filter_shape{7, 3, 3, 5};
+  const Shape bias_shape{7};
+  const Shape output_shape{2, 5, 6, 7};
+  const auto input = MakeData(input_shape.FlatSize(), 1);
+  const auto filter = MakeData(filter_shape.FlatSize(), 2);
+  const auto bias = MakeData(bias_shape.FlatSize(), 3);
+
+  ConvParams params;
+  params.padding_type = PaddingType::kSame;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = -1.f;
+  params.float_activation_max = 1.f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+                  bias.data(), output_shape, expected.data());
+
+  const auto input_h = ToHalf(input);
+  const auto filter_h = ToHalf(filter);
+  const auto bias_h = ToHalf(bias);
+  std::vector<Float16> output(output_shape.FlatSize());
+  optimized::ConvFp16(params, input_shape, input_h.data(), filter_shape, filter_h.data(),
+                      bias_shape, bias_h.data(), output_shape, output.data(), &_ruy_context);
+  ExpectNear(expected, output);
+}
+
+TEST_F(CKer_Fp16, DepthwiseConv)
+{
+  const Shape input_shape{1, 8, 8, 4};
+  const Shape filter_shape{1, 3, 3, 8};
+  const Shape bias_shape{8};
+  const Shape output_shape{1, 8, 8, 8};
+  const auto input = MakeData(input_shape.FlatSize(), 1);
+  const auto filter = MakeData(filter_shape.FlatSize(), 2);
+  const auto bias = MakeData(bias_shape.FlatSize(), 3);
+
+  DepthwiseConvParams params;
+  params.padding_type = PaddingType::kSame;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.depth_multiplier = 2;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> expected(output_shape.FlatSize());
+  DepthwiseConv<float, float>(params, input_shape, input.data(), filter_shape, filter.data(),
+                              bias_shape, bias.data(), output_shape, expected.data(), nullptr);
+
+  const auto input_h = ToHalf(input);
+  const auto filter_h = ToHalf(filter);
+  const auto bias_h = ToHalf(bias);
+  std::vector<Float16> output(output_shape.FlatSize());
+  DepthwiseConv(params, input_shape, input_h.data(), filter_shape, filter_h.data(), bias_shape,
+                bias_h.data(), output_shape, output.data(), &_ruy_context);
+  ExpectNear(expected, output);
+}
+
+TEST_F(CKer_Fp16, BatchMatMul)
+{
+  const Shape lhs_shape{2, 1, 33, 40};
+  const Shape rhs_shape{1, 3, 40, 17};
+  const Shape output_shape{2, 3, 33, 17};
+  const auto lhs = MakeData(lhs_shape.FlatSize(), 1);
+  const auto rhs = MakeData(rhs_shape.FlatSize(), 2);
+
+  std::vector<float> expected(output_shape.FlatSize());
+  BatchMatMul float_kernel;
+  float_kernel.prepare(lhs_shape, rhs_shape, false, false);
+  float_kernel(lhs_shape, lhs.data(), rhs_shape, rhs.data(), false, false, output_shape,
+               expected.data());
+
+  const auto lhs_h = ToHalf(lhs);
+  const auto rhs_h = ToHalf(rhs);
+  std::vector<Float16> output(output_shape.FlatSize());
+  BatchMatMul kernel;
+  kernel.prepare(lhs_shape, rhs_shape, false, false);
+  kernel(lhs_shape, lhs_h.data(), rhs_shape, rhs_h.data(), false, false, output_shape,
+         output.data(), &_ruy_context);
+  ExpectNear(expected, output);
+}
+
+TEST_F(CKer_Fp16, BinaryArithmetic)
+{
+  const Shape shape{4, 1000};
+  const auto input1 = MakeData(shape.FlatSize(), 1);
+  const auto input2 = MakeData(shape.FlatSize(), 2);
+
+  BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> expected(shape.FlatSize());
+  for (size_t i = 0; i < expected.size(); ++i)
+    expected[i] = input1[i] * input2[i];
+
+  const auto input1_h = ToHalf(input1);
+  const auto input2_h = ToHalf(input2);
+  std::vector<Float16> output(shape.FlatSize());
+  BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(params, shape, input1_h.data(), shape,
+                                                  input2_h.data(), shape, output.data(),
+                                                  &_ruy_context);
+  ExpectNear(expected, output);
+}
+
+TEST_F(CKer_Fp16, BroadcastBinaryArithmetic)
+{
+  const Shape shape1{4, 3, 50};
+  const Shape shape2{1, 1, 50};
+  const auto input1 = MakeData(shape1.FlatSize(), 1);
+  const auto input2 = MakeData(shape2.FlatSize(), 2);
+
+  BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  ASSERT_TRUE(ProcessBroadcastShapes(shape1, shape2, &params));
+
+  std::vector<float> expected(shape1.FlatSize());
+  for (size_t i = 0; i < expected.size(); ++i)
+    expected[i] = input1[i] + input2[i % 50];
+
+  const auto input1_h = ToHalf(input1);
+  const auto input2_h = ToHalf(input2);
+  std::vector<Float16> output(shape1.FlatSize());
+  BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::ADD>(params, shape1, input1_h.data(), shape2,
+                                                           input2_h.data(), shape1, output.data(),
+                                                           &_ruy_context);
+  ExpectNear(expected, output);
+}
+
+TEST_F(CKer_Fp16, Softmax)
+{
+  const Shape shape{16, 100};
+  const auto input = MakeData(shape.FlatSize(), 1);
+
+  SoftmaxParams params;
+  params.beta = 1.0;
+
+  std::vector<float> expected(shape.FlatSize());
+  Softmax(input.data(), 100, 16, 1.f, expected.data());
+
+  const auto input_h = ToHalf(input);
+  std::vector<Float16> output(shape.FlatSize());
+  Softmax(params, shape, input_h.data(), shape, output.data(), &_ruy_context);
+  ExpectNear(expected, output);
+}
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/LeakyReLU.h>
+#include <cker/operation/ReduceMean.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+template <typename T> std::vector<T> Quantize(const std::vector<float> &data, float scale)
+{
+  std::vector<T> quantized(data.size());
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    const float value = std::round(data[i] / scale);
+    quantized[i] = static_cast<T>(std::min<float>(
+      std::max<float>(value, std::numeric_limits<T>::min()), std::numeric_limits<T>::max()));
+  }
+  return quantized;
+}
+
+std::vector<float> MakeData(int size, float range, int seed = 0)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = range * static_cast<float>((i * 37 + seed * 11) % 101 - 50) / 50.0f;
+  return data;
+}
+
+// Dequantized values must be within one output quantum of the float result
+void ExpectNear(const std::vector<float> &expected, const std::vector<int16_t> &actual,
+                float scale, float quanta = 1.0f)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(expected[i], actual[i] * scale, scale * quanta) << "at " << i;
+}
+
+// Same as BinaryArithmeticLayer for symmetric int16 operands
+BinaryArithmeticOpParam AddOrSubParams(float scale1, float scale2, float output_scale, bool sub)
+{
+  BinaryArithmeticOpParam params;
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+  params.left_shift = 15;
+  const double norm_max_scale = 2 * std::max(scale1, scale2);
+  QuantizeMultiplier(scale1 / norm_max_scale, &params.input1_multiplier, &params.input1_shift);
+  QuantizeMultiplier(scale2 / norm_max_scale, &params.input2_multiplier, &params.input2_shift);
+  QuantizeMultiplier(norm_max_scale / (output_scale * (1 << params.left_shift)),
+                     &params.output_multiplier, &params.output_shift);
+  if (sub)
+    params.input2_multiplier *= -1;
+  return params;
+}
+
+TEST(CKer_Int16, MultiplyByQuantizedMultiplier64)
+{
+  const double multipliers[] = {0.75, 1.5e-3, 3.0e-6, 2.5};
+  const int64_t inputs[] = {0, 1, -1, 123456789, -987654321, (int64_t{1} << 40) + 7};
+  for (double multiplier : multipliers)
+  {
+    int32_t quantized_multiplier;
+    int shift;
+    QuantizeMultiplier(multiplier, &quantized_multiplier, &shift);
+    for (int64_t x : inputs)
+    {
+      const double expected = static_cast<double>(x) * multiplier;
+      if (std::abs(expected) > std::numeric_limits<int32_t>::max())
+        continue;
+      // The multiplier is reduced to 16 bits of precision
+      EXPECT_NEAR(expected, MultiplyByQuantizedMultiplier(x, quantized_multiplier, shift),
+                  std::abs(expected) * 4e-5 + 1.0);
+    }
+  }
+}
+
+TEST(CKer_Int16, AddSub)
+{
+  const float scale1 = 4.0f / 32767, scale2 = 2.0f / 32767, output_scale = 6.0f / 32767;
+  const auto input1 = Quantize<int16_t>(MakeData(96, 4.0f, 1), scale1);
+  const auto input2 = Quantize<int16_t>(MakeData(96, 2.0f, 2), scale2);
+  const Shape shape{2, 3, 4, 4};
+
+  for (bool sub : {false, true})
+  {
+    std::vector<float> expected(input1.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+      expected[i] = input1[i] * scale1 + (sub ? -1 : 1) * input2[i] * scale2;
+
+    auto params = AddOrSubParams(scale1, scale2, output_scale, sub);
+    std::vector<int16_t> output(input1.size());
+    if (sub)
+      BinaryArithmeticOp<BinaryArithmeticOpType::SUB>(params, shape, input1.data(), shape,
+                                                      input2.data(), shape, output.data());
+    else
+      BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(params, shape, input1.data(), shape,
+                                                      input2.data(), shape, output.data());
+    ExpectNear(expected, output, output_scale);
+  }
+}
+
+TEST(CKer_Int16, BroadcastAdd)
+{
+  const float scale1 = 4.0f / 32767, scale2 = 1.0f / 32767, output_scale = 5.0f / 32767;
+  const Shape shape1{2, 3, 4, 4};
+  const Shape shape2{1, 1, 1, 4};
+  const auto input1 = Quantize<int16_t>(MakeData(96, 4.0f, 3), scale1);
+  const auto input2 = Quantize<int16_t>(MakeData(4, 1.0f, 4), scale2);
+
+  std::vector<float> expected(input1.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    expected[i] = input1[i] * scale1 + input2[i % 4] * scale2;
+
+  auto params = AddOrSubParams(scale1, scale2, output_scale, false);
+  ASSERT_TRUE(ProcessBroadcastShapes(shape1, shape2, &params));
+  std::vector<int16_t> output(input1.size());
+  BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+    params, shape1, input1.data(), shape2, input2.data(), shape1, output.data());
+  ExpectNear(expected, output, output_scale);
+}
+
+TEST(CKer_Int16, Mul)
+{
+  const float scale1 = 2.0f / 32767, scale2 = 3.0f / 32767, output_scale = 6.0f / 32767;
+  const auto input1 = Quantize<int16_t>(MakeData(64, 2.0f, 5), scale1);
+  const auto input2 = Quantize<int16_t>(MakeData(64, 3.0f, 6), scale2);
+  const Shape shape{4, 16};
+
+  BinaryArithmeticOpParam params;
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+  QuantizeMultiplier(scale1 * scale2 / output_scale, &params.output_multiplier,
+                     &params.output_shift);
+
+  std::vector<float> expected(input1.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    expected[i] = input1[i] * scale1 * input2[i] * scale2;
+
+  std::vector<int16_t> output(input1.size());
+  BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(params, shape, input1.data(), shape,
+                                                  input2.data(), shape, output.data());
+  ExpectNear(expected, output, output_scale);
+
+  // Fused RELU clamps at the zero point
+  params.quantized_activation_min = 0;
+  BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(params, shape, input1.data(), shape,
+                                                  input2.data(), shape, output.data());
+  for (auto &value : expected)
+    value = std::max(value, 0.0f);
+  ExpectNear(expected, output, output_scale);
+}
+
+TEST(CKer_Int16, neg_DivNotSupported)
+{
+  BinaryArithmeticOpParam params;
+  const Shape shape{2};
+  const int16_t input[] = {1, 2};
+  int16_t output[2];
+  EXPECT_ANY_THROW(BinaryArithmeticOp<BinaryArithmeticOpType::DIV>(params, shape, input, shape,
+                                                                    input, shape, output));
+}
+
+template <typename WeightT> void TestFullyConnected(float weights_scale)
+{
+  const int batches = 3, input_depth = 40, output_depth = 5;
+  const float input_scale = 2.0f / 32767, output_scale = 8.0f / 32767;
+  const float bias_scale = input_scale * weights_scale;
+  const auto input_float = MakeData(batches * input_depth, 2.0f, 7);
+  const auto weights_float = MakeData(output_depth * input_depth, 0.5f, 8);
+  const auto bias_float = MakeData(output_depth, 1.0f, 9);
+  const auto input = Quantize<int16_t>(input_float, input_scale);
+  const auto weights = Quantize<WeightT>(weights_float, weights_scale);
+  const auto bias = Quantize<int64_t>(bias_float, bias_scale);
+
+  FullyConnectedParams params;
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+  QuantizeMultiplier(static_cast<double>(input_scale) * weights_scale / output_scale,
+                     &params.output_multiplier, &params.output_shift);
+
+  std::vector<float> expected(batches * output_depth);
+  for (int b = 0; b < batches; ++b)
+    for (int o = 0; o < output_depth; ++o)
+    {
+      double acc = bias[o] * static_cast<double>(bias_scale);
+      for (int d = 0; d < input_depth; ++d)
+        acc += static_cast<double>(input[b * input_depth + d]) * input_scale *
+               weights[o * input_depth + d] * weights_scale;
+      expected[b * output_depth + o] = static_cast<float>(acc);
+    }
+
+  std::vector<int16_t> output(batches * output_depth);
+  FullyConnected(params, Shape{batches, input_depth}, input.data(),
+                 Shape{output_depth, input_depth}, weights.data(), Shape{output_depth},
+                 bias.data(), Shape{batches, output_depth}, output.data());
+  // The 64-bit rescale keeps only 16 bits of the multiplier
+  ExpectNear(expected, output, output_scale, 2.0f);
+}
+
+TEST(CKer_Int16, FullyConnected16x8) { TestFullyConnected<int8_t>(0.5f / 127); }
+
+TEST(CKer_Int16, FullyConnected16x16) { TestFullyConnected<int16_t>(0.5f / 32767); }
+
+TEST(CKer_Int16, FullyConnectedPerChannel16x8)
+{
+  const int batches = 3, input_depth = 40, output_depth = 5;
+  const float input_scale = 2.0f / 32767, output_scale = 8.0f / 32767;
+  const auto input_float = MakeData(batches * input_depth, 2.0f, 7);
+  const auto input = Quantize<int16_t>(input_float, input_scale);
+
+  // Each row of weights has its own range, so it is quantized with its own scale
+  std::vector<float> weights_scales(output_depth);
+  std::vector<int8_t> weights;
+  std::vector<int64_t> bias;
+  std::vector<int32_t> output_multiplier(output_depth);
+  std::vector<int> output_shift(output_depth);
+  for (int o = 0; o < output_depth; ++o)
+  {
+    const float range = 0.1f * (o + 1);
+    weights_scales[o] = range / 127;
+    const auto row = Quantize<int8_t>(MakeData(input_depth, range, 8 + o), weights_scales[o]);
+    weights.insert(weights.end(), row.begin(), row.end());
+    bias.push_back(Quantize<int64_t>({0.1f * o}, input_scale * weights_scales[o])[0]);
+    QuantizeMultiplier(static_cast<double>(input_scale) * weights_scales[o] / output_scale,
+                       &output_multiplier[o], &output_shift[o]);
+  }
+
+  FullyConnectedParams params;
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+
+  std::vector<float> expected(batches * output_depth);
+  for (int b = 0; b < batches; ++b)
+    for (int o = 0; o < output_depth; ++o)
+    {
+      const double bias_scale = static_cast<double>(input_scale) * weights_scales[o];
+      double acc = bias[o] * bias_scale;
+      for (int d = 0; d < input_depth; ++d)
+        acc += static_cast<double>(input[b * input_depth + d]) * weights[o * input_depth + d] *
+               bias_scale;
+      expected[b * output_depth + o] = static_cast<float>(acc);
+    }
+
+  std::vector<int16_t> output(batches * output_depth);
+  FullyConnectedPerChannel(params, output_multiplier.data(), output_shift.data(),
+                           Shape{batches, input_depth}, input.data(),
+                           Shape{output_depth, input_depth}, weights.data(), Shape{output_depth},
+                           bias.data(), Shape{batches, output_depth}, output.data());
+  ExpectNear(expected, output, output_scale, 2.0f);
+}
+
+// Compare int16 Softmax with float softmax for the given output scale
+void TestSoftmax(float output_scale)
+{
+  const int rows = 3, depth = 10;
+  const float input_scale = 8.0f / 32767, beta = 1.0f;
+  const auto input = Quantize<int16_t>(MakeData(rows * depth, 8.0f, 10), input_scale);
+
+  std::vector<int16_t> exp_lut(kInt16LUTSize);
+  std::vector<int16_t> one_over_one_plus_x_lut(kInt16LUTSize);
+  PopulateInt16LookupTable([](double x) { return std::exp(x); }, -10.0, 0.0, exp_lut.data());
+  PopulateInt16LookupTable([](double x) { return 1.0 / (1.0 + x); }, 0.0, 1.0,
+                           one_over_one_plus_x_lut.data());
+
+  SoftmaxParams params;
+  params.exp_lut = exp_lut.data();
+  params.one_over_one_plus_x_lut = one_over_one_plus_x_lut.data();
+  int left_shift;
+  QuantizeMultiplier(input_scale * beta / (10.0 / 65535.0), &params.input_multiplier, &left_shift);
+  params.input_left_shift = left_shift;
+  QuantizeMultiplier((1.0 / 32768) / output_scale, &params.output_multiplier, &params.output_shift);
+
+  std::vector<float> expected(rows * depth);
+  for (int r = 0; r < rows; ++r)
+  {
+    float max_val = -INFINITY;
+    for (int d = 0; d < depth; ++d)
+      max_val = std::max(max_val, input[r * depth + d] * input_scale);
+    float sum = 0.0f;
+    for (int d = 0; d < depth; ++d)
+      sum += std::exp(input[r * depth + d] * input_scale - max_val);
+    for (int d = 0; d < depth; ++d)
+      expected[r * depth + d] = std::exp(input[r * depth + d] * input_scale - max_val) / sum;
+  }
+
+  std::vector<int16_t> output(rows * depth);
+  Softmax(params, Shape{rows, depth}, input.data(), Shape{rows, depth}, output.data());
+  // Allow for the table interpolation error
+  ExpectNear(expected, output, output_scale, 16.0f);
+}
+
+TEST(CKer_Int16, Softmax)
+{
+  // tflite fixes the output scale to 1/32768
+  TestSoftmax(1.0f / 32768);
+}
+
+TEST(CKer_Int16, Softmax_CircleQuantizerScale)
+{
+  // circle-quantizer sets the output scale to 1/32767
+  TestSoftmax(1.0f / 32767);
+}
+
+TEST(CKer_Int16, Mean)
+{
+  const float input_scale = 3.0f / 32767, output_scale = 2.0f / 32767;
+  const Shape input_shape{2, 4, 5, 3};
+  const Shape output_shape{2, 1, 1, 3};
+  const auto input = Quantize<int16_t>(MakeData(input_shape.FlatSize(), 3.0f, 11), input_scale);
+
+  std::vector<float> expected(output_shape.FlatSize(), 0.0f);
+  for (int b = 0; b < 2; ++b)
+    for (int i = 0; i < 20; ++i)
+      for (int c = 0; c < 3; ++c)
+        expected[b * 3 + c] += input[(b * 20 + i) * 3 + c] * input_scale / 20;
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  MeanQ8Asymm(input_shape, input.data(), input_scale, 0, output_shape, output.data(), output_scale,
+              0, std::vector<int>{1, 2});
+  ExpectNear(expected, output, output_scale);
+}
+
+TEST(CKer_Int16, LeakyRelu)
+{
+  const float input_scale = 4.0f / 32767, output_scale = 3.0f / 32767, alpha = 0.2f;
+  const auto data = MakeData(64, 4.0f, 5);
+  const auto input = Quantize<int16_t>(data, input_scale);
+
+  LeakyReluParams params{alpha};
+  QuantizeMultiplier(input_scale * alpha / output_scale, &params.output_multiplier_alpha,
+                     &params.output_shift_alpha);
+  QuantizeMultiplier(input_scale / output_scale, &params.output_multiplier_identity,
+                     &params.output_shift_identity);
+
+  std::vector<float> expected(input.size());
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    const float value = input[i] * input_scale;
+    expected[i] = std::min(std::max(value > 0 ? value : value * alpha, -32768 * output_scale),
+                           32767 * output_scale);
+  }
+
+  std::vector<int16_t> output(input.size());
+  const Shape shape{8, 8};
+  QuantizeLeakyRelu(params, shape, input.data(), shape, output.data());
+  ExpectNear(expected, output, output_scale);
+}
+
+void TestLookupTable(const std::function<double(double)> &func, float input_scale,
+                     float output_scale)
+{
+  // Table of the whole int16 input range, as cpu backend makes for Logistic and Tanh
+  std::vector<int16_t> table(kInt16LUTSize);
+  const double table_scale = output_scale * 32768.0;
+  PopulateInt16LookupTable([&](double x) { return func(x) / table_scale; }, -32768.0 * input_scale,
+                           32768.0 * input_scale, table.data());
+
+  std::vector<int16_t> input(256);
+  std::vector<float> expected(input.size());
+  std::vector<int16_t> output(input.size());
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    input[i] = static_cast<int16_t>(-32768 + static_cast<int>(i) * 257);
+    expected[i] = func(input[i] * input_scale);
+    output[i] = LookupInt16Table(input[i], table.data());
+  }
+  // Allow for the table interpolation error
+  ExpectNear(expected, output, output_scale, 4.0f);
+}
+
+TEST(CKer_Int16, LogisticLookupTable)
+{
+  auto logistic = [](double x) { return 1.0 / (1.0 + std::exp(-x)); };
+  TestLookupTable(logistic, 1.0f / 4096, 1.0f / 32768);
+  TestLookupTable(logistic, 1.0f / 2048, 1.0f / 32767);
+}
+
+TEST(CKer_Int16, TanhLookupTable)
+{
+  auto tanh = [](double x) { return std::tanh(x); };
+  TestLookupTable(tanh, 1.0f / 4096, 1.0f / 32768);
+  TestLookupTable(tanh, 1.0f / 8192, 1.0f / 32767);
+}
+
+} // namespace
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// Large enough for ParallelFor to split the work into several tasks
+constexpr int kRows = 64;
+constexpr int kCols = 1024;
+
+std::vector<float> MakeData(int size, int seed = 0)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 7 + seed * 13) % 31) * 0.25f - 3.5f;
+  return data;
+}
+
+class CKer_ParallelFor : public ::testing::Test
+{
+protected:
+  void SetUp() override { _ruy_context.set_max_num_threads(4); }
+
+  ruy::Context _ruy_context;
+};
+
+} // namespace
+
+TEST_F(CKer_ParallelFor, CoversRangeOnce)
+{
+  const int64_t total = 1000;
+  std::vector<std::atomic<int>> visits(total);
+  for (auto &v : visits)
+    v = 0;
+
+  EXPECT_EQ(cpu_backend_threadpool::GetTaskCount(&_ruy_context, total, kCols), 4);
+  cpu_backend_threadpool::ParallelFor(&_ruy_context, total, kCols,
+                                      [&](int64_t begin, int64_t end) {
+                                        for (int64_t i = begin; i < end; ++i)
+                                          visits[i]++;
+                                      });
+
+  for (int64_t i = 0; i < total; ++i)
+    EXPECT_EQ(visits[i], 1);
+}
+
+TEST_F(CKer_ParallelFor, SmallWorkStaysSerial)
+{
+  EXPECT_EQ(cpu_backend_threadpool::GetTaskCount(&_ruy_context, 16, 16), 1);
+  EXPECT_EQ(cpu_backend_threadpool::GetTaskCount(nullptr, 1 << 20, 1), 1);
+
+  int calls = 0;
+  cpu_backend_threadpool::ParallelFor(&_ruy_context, 16, 16, [&](int64_t begin, int64_t end) {
+    EXPECT_EQ(begin, 0);
+    EXPECT_EQ(end, 16);
+    calls++;
+  });
+  EXPECT_EQ(calls, 1);
+
+  cpu_backend_threadpool::ParallelFor(&_ruy_context, 0, 16, [&](int64_t, int64_t) { calls++; });
+  EXPECT_EQ(calls, 1);
+}
+
+TEST_F(CKer_ParallelFor, BinaryArithmetic)
+{
+  BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  const Shape shape{kRows, kCols};
+  const auto lhs = MakeData(shape.FlatSize(), 1);
+  const auto rhs = MakeData(shape.FlatSize(), 2);
+  std::vector<float> expected(shape.FlatSize());
+  std::vector<float> actual(shape.FlatSize());
+
+  BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(params, shape, lhs.data(), shape, rhs.data(),
+                                                  shape, expected.data());
+  BinaryArithmeticOp<BinaryArithmeticOpType::MUL, float>(params, shape, lhs.data(), shape,
+                                                         rhs.data(), shape, actual.data(),
+                                                         &_ruy_context);
+  EXPECT_EQ(actual, expected);
+
+  // Broadcast a row vector over every row
+  const Shape row_shape{1, kCols};
+  ASSERT_TRUE(ProcessBroadcastShapes(shape, row_shape, &params));
+  BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::SUB>(params, shape, lhs.data(), row_shape,
+                                                           rhs.data(), shape, expected.data());
+  BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::SUB, float>(
+    params, shape, lhs.data(), row_shape, rhs.data(), shape, actual.data(), &_ruy_context);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CKer_ParallelFor, Reduce)
+{
+  const Shape input_shape{kRows, 16, kCols / 16};
+  const auto input = MakeData(input_shape.FlatSize());
+
+  auto run = [&](const std::vector<int> &axes, const Shape &output_shape, ruy::Context *ctx) {
+    std::vector<float> output(output_shape.FlatSize());
+    Reduce reduce;
+    reduce.prepare(input_shape.DimensionsCount(), axes.size());
+    reduce.ReduceGeneric<float>(
+      input_shape, input.data(), output_shape, output.data(), axes, false, 0.f,
+      [](const float current, const float in) -> float { return current + in; }, ctx);
+    return output;
+  };
+
+  // Last axis and a middle axis
+  EXPECT_EQ(run({2}, Shape{kRows, 16}, &_ruy_context), run({2}, Shape{kRows, 16}, nullptr));
+  EXPECT_EQ(run({1}, Shape{kRows, kCols / 16}, &_ruy_context),
+            run({1}, Shape{kRows, kCols / 16}, nullptr));
+
+  const Shape mean_input_shape{kRows, 16, kCols / 16, 1};
+  const Shape mean_output_shape{kRows, 1, 1, 1};
+  std::vector<float> expected(mean_output_shape.FlatSize());
+  std::vector<float> actual(mean_output_shape.FlatSize());
+  Mean(mean_input_shape, input.data(), mean_output_shape, expected.data(), {1, 2});
+  Mean(mean_input_shape, input.data(), mean_output_shape, actual.data(), {1, 2}, &_ruy_context);
+  EXPECT_EQ(actual, expected);
+
+  MeanAxis1And2(mean_input_shape, input.data(), mean_output_shape, expected.data());
+  MeanAxis1And2(mean_input_shape, input.data(), mean_output_shape, actual.data(), &_ruy_context);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CKer_ParallelFor, Transpose)
+{
+  const auto input = MakeData(kRows * kCols);
+  std::vector<float> expected(input.size());
+  std::vector<float> actual(input.size());
+
+  // 2D, with a row count that is not a multiple of the 4x4 block
+  {
+    TransposeParams params{2, {1, 0}};
+    const Shape in_shape{kRows - 3, kCols};
+    const Shape out_shape{kCols, kRows - 3};
+    Transpose(params, in_shape, input.data(), out_shape, expected.data());
+    Transpose(params, in_shape, input.data(), out_shape, actual.data(), &_ruy_context);
+    EXPECT_EQ(actual, expected);
+  }
+
+  // 3D
+  {
+    TransposeParams params{3, {2, 0, 1}};
+    const Shape in_shape{kRows, 32, kCols / 32};
+    const Shape out_shape{kCols / 32, kRows, 32};
+    Transpose(params, in_shape, input.data(), out_shape, expected.data());
+    Transpose(params, in_shape, input.data(), out_shape, actual.data(), &_ruy_context);
+    EXPECT_EQ(actual, expected);
+  }
+
+  // 4D with a leading identity axis, which is flattened into independent chunks
+  {
+    TransposeParams params{4, {0, 2, 3, 1}};
+    const Shape in_shape{kRows, 8, 16, kCols / 128};
+    const Shape out_shape{kRows, 16, kCols / 128, 8};
+    Transpose(params, in_shape, input.data(), out_shape, expected.data());
+    Transpose(params, in_shape, input.data(), out_shape, actual.data(), &_ruy_context);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST_F(CKer_ParallelFor, Gather)
+{
+  const Shape input_shape{kRows, kCols};
+  const auto input = MakeData(input_shape.FlatSize());
+  std::vector<int32_t> coords;
+  for (int i = 0; i < kRows; ++i)
+    coords.push_back((i * 5) % kRows);
+  const Shape coords_shape{static_cast<int>(coords.size())};
+  const Shape output_shape{static_cast<int>(coords.size()), kCols};
+
+  GatherParams params{0};
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+  Gather<float>(params, input_shape, input.data(), coords_shape, coords.data(), output_shape,
+                expected.data());
+  Gather<float>(params, input_shape, input.data(), coords_shape, coords.data(), output_shape,
+                actual.data(), &_ruy_context);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CKer_ParallelFor, Concatenation)
+{
+  const Shape shape1{kRows, kCols / 2};
+  const Shape shape2{kRows, kCols / 4};
+  const Shape shape3{kRows, kCols / 4};
+  const auto data1 = MakeData(shape1.FlatSize(), 1);
+  const auto data2 = MakeData(shape2.FlatSize(), 2);
+  const auto data3 = MakeData(shape3.FlatSize(), 3);
+  const Shape *shapes[] = {&shape1, &shape2, &shape3};
+  const float *data[] = {data1.data(), data2.data(), data3.data()};
+
+  for (int8_t axis : {0, 1})
+  {
+    // Only the concatenated axis differs, so reuse inputs along axis 0 with matching widths
+    const Shape *axis_shapes[] = {&shape2, &shape3, &shape2};
+    const float *axis_data[] = {data2.data(), data3.data(), data2.data()};
+    const Shape output_shape =
+      axis == 0 ? Shape{3 * kRows, kCols / 4} : Shape{kRows, kCols};
+    ConcatenationParams params{};
+    params.axis = axis;
+    params.inputs_count = 3;
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    Concatenation<float>(params, axis == 0 ? axis_shapes : shapes, axis == 0 ? axis_data : data,
+                         output_shape, expected.data());
+    Concatenation<float>(params, axis == 0 ? axis_shapes : shapes, axis == 0 ? axis_data : data,
+                         output_shape, actual.data(), &_ruy_context);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST_F(CKer_ParallelFor, Softmax)
+{
+  const Shape shape{kRows, kCols};
+  const auto input = MakeData(shape.FlatSize());
+  SoftmaxParams params{};
+  params.beta = 1.0;
+
+  std::vector<float> expected(shape.FlatSize());
+  std::vector<float> actual(shape.FlatSize());
+  Softmax(params, shape, input.data(), shape, expected.data());
+  Softmax(params, shape, input.data(), shape, actual.data(), &_ruy_context);
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], 1e-6f);
+
+  Softmax(input.data(), kCols, kRows, 1.f, expected.data());
+  Softmax(input.data(), kCols, kRows, 1.f, actual.data(), &_ruy_context);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CKer_ParallelFor, ResizeBilinear)
+{
+  const Shape input_shape{2, 16, 16, 32};
+  const auto input = MakeData(input_shape.FlatSize());
+
+  // 2x2 upsample and a generic scale
+  for (int32_t out_size : {32, 27})
+  {
+    ResizeBilinearParams params{out_size, out_size, false, false};
+    const Shape output_shape{2, out_size, out_size, 32};
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    ResizeBilinear(params, input_shape, input.data(), output_shape, expected.data());
+    ResizeBilinear(params, input_shape, input.data(), output_shape, actual.data(),
+                   &_ruy_context);
+    EXPECT_EQ(actual, expected);
+  }
+}
@@ -17,6 +17,8 @@
 #include <cker/operation/RmsNorm.h>
 
 #include <gtest/gtest.h>
+#include <ruy/context.h>
+#include <cmath>
 #include <vector>
 
 TEST(CKer_Operation, RmsNorm)
@@ -67,6 +69,80 @@ TEST(CKer_Operation, RmsNorm)
   }
 }
 
+TEST(CKer_Operation, RmsNormBetaMultiThread)
+{
+  // [rows, channels] = [64, 512], large enough to be split over threads
+  const int rows = 64;
+  const int channels = 512;
+  nnfw::cker::Shape input_shape{2, 32, channels};
+  nnfw::cker::Shape output_shape{2, 32, channels};
+  nnfw::cker::Shape gamma_shape{channels};
+  nnfw::cker::Shape beta_shape{channels};
+
+  std::vector<float> input(rows * channels);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i * 37 % 101) - 50) * 0.05f;
+  std::vector<float> gamma(channels);
+  std::vector<float> beta(channels);
+  for (int c = 0; c < channels; ++c)
+  {
+    gamma[c] = 0.5f + static_cast<float>(c % 7) * 0.25f;
+    beta[c] = static_cast<float>(c % 5) * 0.1f - 0.2f;
+  }
+
+  nnfw::cker::RmsNormParams param;
+  param.epsilon = 1e-6f;
+
+  std::vector<float> expected_output(input.size());
+  for (int r = 0; r < rows; ++r)
+  {
+    double square_sum = 0.0;
+    for (int c = 0; c < channels; ++c)
+      square_sum += input[r * channels + c] * input[r * channels + c];
+    const double rms = std::sqrt(square_sum / channels + param.epsilon);
+    for (int c = 0; c < channels; ++c)
+      expected_output[r * channels + c] = gamma[c] * (input[r * channels + c] / rms) + beta[c];
+  }
+
+  ruy::Context ruy_context;
+  for (int num_threads : {1, 4})
+  {
+    ruy_context.set_max_num_threads(num_threads);
+    std::vector<float> output(expected_output.size());
+    nnfw::cker::RmsNorm(param, input_shape, input.data(), gamma_shape, gamma.data(), beta_shape,
+                        beta.data(), output_shape, output.data(), &ruy_context);
+
+    for (size_t i = 0; i < expected_output.size(); ++i)
+      EXPECT_NEAR(output[i], expected_output[i], 1e-4f);
+  }
+}
+
+TEST(CKer_Operation, RmsNormSingleGammaBeta)
+{
+  // gamma and beta of [1] are broadcast to all channels, as FuseRmsNormPass of luci makes
+  std::vector<float> input = {1, 2, 3, 4, -2, 2, -2, 2};
+  nnfw::cker::Shape input_shape{1, 2, 4};
+  nnfw::cker::Shape output_shape{1, 2, 4};
+
+  std::vector<float> gamma = {2};
+  nnfw::cker::Shape gamma_shape{1};
+  std::vector<float> beta = {0.5};
+  nnfw::cker::Shape beta_shape{1};
+
+  nnfw::cker::RmsNormParams param;
+  param.epsilon = 0;
+
+  // rms of rows are sqrt(7.5) and 2
+  std::vector<float> expected_output = {1.230297, 1.960593, 2.690890, 3.421187,
+                                        -1.5,     2.5,      -1.5,     2.5};
+  std::vector<float> output(expected_output.size());
+  nnfw::cker::RmsNorm(param, input_shape, input.data(), gamma_shape, gamma.data(), beta_shape,
+                      beta.data(), output_shape, output.data());
+
+  for (size_t i = 0; i < expected_output.size(); ++i)
+    EXPECT_NEAR(output[i], expected_output[i], 1e-5f);
+}
+
 TEST(CKer_Operation, neg_RmsNormWrongGammaDims)
 {
   {
@@ -78,8 +154,8 @@ TEST(CKer_Operation, neg_RmsNormWrongGammaDims)
     std::vector<float> output(expected_output.size());
     nnfw::cker::Shape output_shape{1, 2, 2, 2};
 
-    std::vector<float> gamma = {1};
-    nnfw::cker::Shape gamma_shape{1};
+    std::vector<float> gamma = {1, 1, 1};
+    nnfw::cker::Shape gamma_shape{3};
 
     nnfw::cker::RmsNormParams param;
     param.epsilon = 0.001f;
@@ -88,3 +164,22 @@ TEST(CKer_Operation, neg_RmsNormWrongGammaDims)
                                          gamma.data(), output_shape, output.data()));
   }
 }
+
+TEST(CKer_Operation, neg_RmsNormWrongBetaDims)
+{
+  std::vector<float> input = {0, 1, 2, 3, 4, 5, 6, 7};
+  nnfw::cker::Shape input_shape{1, 2, 2, 2};
+  std::vector<float> output(input.size());
+  nnfw::cker::Shape output_shape{1, 2, 2, 2};
+
+  std::vector<float> gamma = {1, 1};
+  nnfw::cker::Shape gamma_shape{2};
+  std::vector<float> beta = {0, 0, 0};
+  nnfw::cker::Shape beta_shape{3};
+
+  nnfw::cker::RmsNormParams param;
+  param.epsilon = 0.001f;
+
+  EXPECT_ANY_THROW(nnfw::cker::RmsNorm(param, input_shape, input.data(), gamma_shape, gamma.data(),
+                                       beta_shape, beta.data(), output_shape, output.data()));
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/RoPE.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::RoPEMode;
+using nnfw::cker::Shape;
+
+// Naive RoPE on [batch, num_heads, seq_len, head_size] with [table_rows, head_size] tables
+std::vector<float> naiveRoPE(RoPEMode mode, const Shape &shape, const std::vector<float> &input,
+                             const std::vector<float> &sin_table,
+                             const std::vector<float> &cos_table, int table_rows)
+{
+  const int seq_len = shape.Dims(2);
+  const int head_size = shape.Dims(3);
+  const int half = head_size / 2;
+  std::vector<float> output(input.size());
+  for (size_t row = 0; row < input.size() / head_size; ++row)
+  {
+    const float *in = input.data() + row * head_size;
+    float *out = output.data() + row * head_size;
+    const int t = (table_rows == 1) ? 0 : (row % seq_len) * head_size;
+    for (int i = 0; i < half; ++i)
+    {
+      const int i0 = (mode == RoPEMode::kGptNeox) ? i : 2 * i;
+      const int i1 = (mode == RoPEMode::kGptNeox) ? i + half : 2 * i + 1;
+      out[i0] = in[i0] * cos_table[t + i0] - in[i1] * sin_table[t + i0];
+      out[i1] = in[i0] * sin_table[t + i1] + in[i1] * cos_table[t + i1];
+    }
+  }
+  return output;
+}
+
+void verifyRoPE(RoPEMode mode, const Shape &shape, int table_rows, int num_threads)
+{
+  const int head_size = shape.Dims(3);
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i * 13 % 29) - 14) * 0.1f;
+  std::vector<float> sin_table(table_rows * head_size);
+  std::vector<float> cos_table(table_rows * head_size);
+  for (size_t i = 0; i < sin_table.size(); ++i)
+  {
+    sin_table[i] = std::sin(0.01f * i);
+    cos_table[i] = std::cos(0.01f * i);
+  }
+  const auto expected = naiveRoPE(mode, shape, input, sin_table, cos_table, table_rows);
+
+  Shape table_shape{1, 1, table_rows, head_size};
+  nnfw::cker::RoPEParams params;
+  params.mode = mode;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(num_threads);
+  std::vector<float> output(input.size());
+  nnfw::cker::RoPE(params, shape, input.data(), table_shape, sin_table.data(), table_shape,
+                   cos_table.data(), shape, output.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-5f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, RoPE)
+{
+  // Single row table (single position)
+  {
+    std::vector<float> input = {1, 2, 3, 4};
+    Shape shape{1, 1, 1, 4};
+    std::vector<float> sin_table = {0, 1, 0, 1};
+    std::vector<float> cos_table = {1, 0, 1, 0};
+    std::vector<float> expected_output = {1, -4, 3, 2};
+    std::vector<float> output(expected_output.size());
+
+    nnfw::cker::RoPEParams params;
+    params.mode = RoPEMode::kGptNeox;
+    nnfw::cker::RoPE(params, shape, input.data(), Shape{1, 1, 1, 4}, sin_table.data(),
+                     Shape{1, 1, 1, 4}, cos_table.data(), shape, output.data());
+
+    for (size_t i = 0; i < expected_output.size(); ++i)
+      EXPECT_NEAR(output[i], expected_output[i], 1e-5f);
+  }
+
+  for (auto mode : {RoPEMode::kGptNeox, RoPEMode::kGptJ})
+  {
+    for (int num_threads : {1, 4})
+    {
+      verifyRoPE(mode, Shape{1, 4, 1, 64}, 1, num_threads);
+      verifyRoPE(mode, Shape{2, 8, 16, 128}, 16, num_threads);
+    }
+  }
+}
+
+TEST(CKer_Operation, neg_RoPEWrongTableShape)
+{
+  std::vector<float> input(2 * 8);
+  Shape shape{1, 1, 2, 8};
+  std::vector<float> output(input.size());
+  nnfw::cker::RoPEParams params;
+  params.mode = RoPEMode::kGptNeox;
+
+  // Unmatched head size
+  {
+    std::vector<float> table(4);
+    EXPECT_ANY_THROW(nnfw::cker::RoPE(params, shape, input.data(), Shape{1, 4}, table.data(),
+                                      Shape{1, 4}, table.data(), shape, output.data()));
+  }
+
+  // Table rows is neither 1 nor seq_len
+  {
+    std::vector<float> table(3 * 8);
+    EXPECT_ANY_THROW(nnfw::cker::RoPE(params, shape, input.data(), Shape{3, 8}, table.data(),
+                                      Shape{3, 8}, table.data(), shape, output.data()));
+  }
+}
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/TensorUtils.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/Elementwise.h>
+#include <cker/operation/Exp.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/Quantize.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Tanh.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef CKER_X86_SIMD
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+std::vector<float> RandomFloats(int size, float min, float max, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(min, max);
+  std::vector<float> values(size);
+  for (auto &v : values)
+    v = dist(gen);
+  return values;
+}
+
+std::vector<int8_t> RandomInt8s(int size, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-128, 127);
+  std::vector<int8_t> values(size);
+  for (auto &v : values)
+    v = static_cast<int8_t>(dist(gen));
+  return values;
+}
+
+// Sizes that exercise the vector body, the scalar tail and both of them
+const std::vector<int> kSizes = {1, 7, 8, 15, 16, 17, 33, 100, 1027};
+
+} // namespace
+
+TEST(CKer_X86, MatrixBatchVectorMultiplyAccumulate_Int8)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  const int m_rows = 5;
+  const int n_batch = 3;
+  for (const int m_cols : kSizes)
+  {
+    const auto matrix = RandomInt8s(m_rows * m_cols, m_cols);
+    const auto vectors = RandomInt8s(n_batch * m_cols, m_cols + 1);
+    const std::vector<float> scaling_factors = {0.5f, 0.125f, 3.0f};
+
+    std::vector<float> expected(m_rows * n_batch, 1.0f);
+    PortableMatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols, vectors.data(),
+                                                scaling_factors.data(), n_batch, expected.data(),
+                                                1);
+
+    std::vector<float> avx2(m_rows * n_batch, 1.0f);
+    x86::MatrixBatchVectorMultiplyAccumulateAvx2(matrix.data(), m_rows, m_cols, vectors.data(),
+                                                 scaling_factors.data(), n_batch, avx2.data(), 1);
+    EXPECT_EQ(avx2, expected) << "m_cols " << m_cols;
+
+    if (x86::HasAvx512())
+    {
+      std::vector<float> avx512(m_rows * n_batch, 1.0f);
+      x86::MatrixBatchVectorMultiplyAccumulateAvx512(matrix.data(), m_rows, m_cols,
+                                                     vectors.data(), scaling_factors.data(),
+                                                     n_batch, avx512.data(), 1);
+      EXPECT_EQ(avx512, expected) << "m_cols " << m_cols;
+    }
+
+    std::vector<float> dispatched(m_rows * n_batch, 1.0f);
+    MatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols, vectors.data(),
+                                        scaling_factors.data(), n_batch, dispatched.data(), 1);
+    EXPECT_EQ(dispatched, expected) << "m_cols " << m_cols;
+  }
+}
+
+TEST(CKer_X86, MatrixBatchVectorMultiplyAccumulate_Float)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  const int m_rows = 4;
+  const int n_batch = 2;
+  for (const int m_cols : kSizes)
+  {
+    const auto matrix = RandomFloats(m_rows * m_cols, -1.f, 1.f, m_cols);
+    const auto vectors = RandomFloats(n_batch * m_cols, -1.f, 1.f, m_cols + 1);
+
+    std::vector<float> expected(m_rows * n_batch, 0.5f);
+    PortableMatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols, vectors.data(),
+                                                n_batch, expected.data(), 1);
+    std::vector<float> output(m_rows * n_batch, 0.5f);
+    X86MatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols, vectors.data(), n_batch,
+                                           output.data(), 1);
+
+    // Only the summation order differs
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-6f * m_cols) << "m_cols " << m_cols;
+  }
+}
+
+TEST(CKer_X86, SymmetricQuantizeFloats)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  for (const int size : kSizes)
+  {
+    auto values = RandomFloats(size, -3.f, 2.f, size);
+    // Values that land exactly on .5 after scaling must round away from zero
+    values[0] = 127.f;
+    if (size > 2)
+    {
+      values[1] = 0.5f;
+      values[2] = -1.5f;
+    }
+
+    std::vector<int8_t> expected(size);
+    float expected_min, expected_max, expected_scale;
+    PortableSymmetricQuantizeFloats(values.data(), size, expected.data(), &expected_min,
+                                    &expected_max, &expected_scale);
+
+    std::vector<int8_t> output(size);
+    float min, max, scale;
+    X86SymmetricQuantizeFloats(values.data(), size, output.data(), &min, &max, &scale);
+
+    EXPECT_EQ(output, expected) << "size " << size;
+    EXPECT_EQ(min, expected_min);
+    EXPECT_EQ(max, expected_max);
+    EXPECT_EQ(scale, expected_scale);
+  }
+}
+
+TEST(CKer_X86, VectorUtils)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  for (const int size : kSizes)
+  {
+    std::vector<float> zeros(size, 0.f);
+    EXPECT_TRUE(X86IsZeroVector(zeros.data(), size));
+    zeros[size - 1] = 1e-30f;
+    EXPECT_FALSE(X86IsZeroVector(zeros.data(), size));
+
+    const auto values = RandomFloats(size, -4.f, 4.f, size);
+    std::vector<float> expected(size), output(size);
+    PortableSub1Vector(values.data(), size, expected.data());
+    X86Sub1Vector(values.data(), size, output.data());
+    EXPECT_EQ(output, expected);
+
+    expected = values;
+    output = values;
+    PortableCwiseClipping(expected.data(), size, 2.5f);
+    X86CwiseClipping(output.data(), size, 2.5f);
+    EXPECT_EQ(output, expected);
+  }
+}
+
+TEST(CKer_X86, Quantize)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  const float scale = 0.25f;
+  for (const int size : kSizes)
+  {
+    auto input = RandomFloats(size, -100.f, 100.f, size);
+    // Exact halves and out-of-range values
+    input[0] = 0.125f;
+    if (size > 3)
+    {
+      input[1] = -0.375f;
+      input[2] = 1e6f;
+      input[3] = -1e6f;
+    }
+    const Shape shape{size};
+
+    std::vector<int8_t> out_s8(size);
+    Quantize(shape, input.data(), shape, out_s8.data(), scale, -3);
+    std::vector<uint8_t> out_u8(size);
+    Quantize(shape, input.data(), shape, out_u8.data(), scale, 128);
+    std::vector<int16_t> out_s16(size);
+    Quantize(shape, input.data(), shape, out_s16.data(), scale, 0);
+
+    for (int i = 0; i < size; ++i)
+    {
+      const int32_t rounded = static_cast<int32_t>(
+        std::max(-1e9f, std::min(1e9f, std::round(input[i] / scale))));
+      EXPECT_EQ(out_s8[i], std::min(127, std::max(-128, rounded - 3))) << "index " << i;
+      EXPECT_EQ(out_u8[i], std::min(255, std::max(0, rounded + 128))) << "index " << i;
+      EXPECT_EQ(out_s16[i], std::min(32767, std::max(-32768, rounded))) << "index " << i;
+    }
+  }
+}
+
+TEST(CKer_X86, Dequantize)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  const float scale = 0.37f;
+  for (const int size : kSizes)
+  {
+    const auto s8 = RandomInt8s(size, size);
+    std::vector<uint8_t> u8(size);
+    std::vector<int16_t> s16(size);
+    for (int i = 0; i < size; ++i)
+    {
+      u8[i] = static_cast<uint8_t>(s8[i]);
+      s16[i] = static_cast<int16_t>(s8[i] * 200);
+    }
+    const Shape shape{size};
+
+    std::vector<float> out_s8(size), out_u8(size), out_s16(size);
+    Dequantize(shape, s8.data(), shape, out_s8.data(), scale, 5);
+    Dequantize(shape, u8.data(), shape, out_u8.data(), scale, 128);
+    Dequantize(shape, s16.data(), shape, out_s16.data(), scale, -7);
+
+    for (int i = 0; i < size; ++i)
+    {
+      EXPECT_EQ(out_s8[i], scale * (s8[i] - 5));
+      EXPECT_EQ(out_u8[i], scale * (u8[i] - 128));
+      EXPECT_EQ(out_s16[i], scale * (s16[i] + 7));
+    }
+  }
+}
+
+TEST(CKer_X86, BinaryArithmeticOp)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  BinaryArithmeticOpParam param;
+  param.float_activation_min = -10.f;
+  param.float_activation_max = 10.f;
+  auto clamp = [&](float v) {
+    return std::min(param.float_activation_max, std::max(param.float_activation_min, v));
+  };
+
+  for (const int size : kSizes)
+  {
+    const auto input1 = RandomFloats(size, -8.f, 8.f, size);
+    const auto input2 = RandomFloats(size, 0.5f, 4.f, size + 1);
+    const Shape shape{size};
+    std::vector<float> add(size), sub(size), mul(size), div(size);
+
+    BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(param, shape, input1.data(), shape,
+                                                    input2.data(), shape, add.data());
+    BinaryArithmeticOp<BinaryArithmeticOpType::SUB>(param, shape, input1.data(), shape,
+                                                    input2.data(), shape, sub.data());
+    BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(param, shape, input1.data(), shape,
+                                                    input2.data(), shape, mul.data());
+    BinaryArithmeticOp<BinaryArithmeticOpType::DIV>(param, shape, input1.data(), shape,
+                                                    input2.data(), shape, div.data());
+
+    for (int i = 0; i < size; ++i)
+    {
+      EXPECT_EQ(add[i], clamp(input1[i] + input2[i]));
+      EXPECT_EQ(sub[i], clamp(input1[i] - input2[i]));
+      EXPECT_EQ(mul[i], clamp(input1[i] * input2[i]));
+      EXPECT_EQ(div[i], clamp(input1[i] / input2[i]));
+    }
+  }
+}
+
+TEST(CKer_X86, BroadcastBinaryArithmeticOp)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  // {2, 3, 37} op {1, 1, 37} and {1, 1, 1} op {2, 3, 37}
+  const Shape shape{2, 3, 37};
+  const Shape row_shape{1, 1, 37};
+  const Shape scalar_shape{1, 1, 1};
+  const auto input = RandomFloats(shape.FlatSize(), -8.f, 8.f, 1);
+  const auto row = RandomFloats(row_shape.FlatSize(), -8.f, 8.f, 2);
+  const float scalar = 1.75f;
+
+  BinaryArithmeticOpParam param;
+  param.float_activation_min = 0.f;
+  param.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> output(shape.FlatSize());
+  ProcessBroadcastShapes(shape, row_shape, &param);
+  BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::SUB>(
+    param, shape, input.data(), row_shape, row.data(), shape, output.data());
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_EQ(output[i], std::max(0.f, input[i] - row[i % 37]));
+
+  ProcessBroadcastShapes(scalar_shape, shape, &param);
+  BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::MUL>(
+    param, scalar_shape, &scalar, shape, input.data(), shape, output.data());
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_EQ(output[i], std::max(0.f, scalar * input[i]));
+}
+
+TEST(CKer_X86, UnaryElementwise)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  for (const int size : kSizes)
+  {
+    const auto input = RandomFloats(size, 0.01f, 50.f, size);
+    const Shape shape{size};
+    std::vector<float> sqrt_out(size), rsqrt_out(size), square_out(size), floor_out(size);
+    Sqrt(shape, input.data(), shape, sqrt_out.data());
+    Rsqrt(shape, input.data(), shape, rsqrt_out.data());
+    Square(shape, input.data(), shape, square_out.data());
+    Floor(shape, input.data(), shape, floor_out.data());
+    for (int i = 0; i < size; ++i)
+    {
+      EXPECT_EQ(sqrt_out[i], std::sqrt(input[i]));
+      EXPECT_EQ(rsqrt_out[i], 1.f / std::sqrt(input[i]));
+      EXPECT_EQ(square_out[i], input[i] * input[i]);
+      EXPECT_EQ(floor_out[i], std::floor(input[i]));
+    }
+  }
+}
+
+TEST(CKer_X86, Exp)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  for (const int size : kSizes)
+  {
+    const auto input = RandomFloats(size, -87.f, 88.f, size);
+    const Shape shape{size};
+    std::vector<float> output(size);
+    Exp(shape, input.data(), shape, output.data());
+    for (int i = 0; i < size; ++i)
+    {
+      const float expected = std::exp(input[i]);
+      EXPECT_NEAR(output[i], expected, 2e-7f * expected) << "input " << input[i];
+    }
+  }
+
+  // Saturation and NaN follow std::exp
+  const std::vector<float> special = {-1000.f, -104.f, 0.f, 89.f, 1000.f, NAN, -INFINITY, INFINITY};
+  std::vector<float> output(special.size());
+  X86Exp(special.data(), special.size(), output.data());
+  EXPECT_EQ(output[0], 0.f);
+  EXPECT_EQ(output[1], 0.f);
+  EXPECT_EQ(output[2], 1.f);
+  EXPECT_TRUE(std::isinf(output[3]));
+  EXPECT_TRUE(std::isinf(output[4]));
+  EXPECT_TRUE(std::isnan(output[5]));
+  EXPECT_EQ(output[6], 0.f);
+  EXPECT_TRUE(std::isinf(output[7]));
+}
+
+TEST(CKer_X86, LogisticAndTanh)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  for (const int size : kSizes)
+  {
+    auto input = RandomFloats(size, -12.f, 12.f, size);
+    input[0] = 1e-5f;
+    const Shape shape{size};
+    std::vector<float> logistic(size), tanh(size);
+    Logistic(shape, input.data(), shape, logistic.data());
+    Tanh(shape, input.data(), shape, tanh.data());
+    for (int i = 0; i < size; ++i)
+    {
+      EXPECT_NEAR(logistic[i], 1.f / (1.f + std::exp(-input[i])), 1e-6f) << "input " << input[i];
+      EXPECT_NEAR(tanh[i], std::tanh(input[i]), 1e-6f) << "input " << input[i];
+    }
+  }
+}
+
+TEST(CKer_X86, Softmax)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP() << "AVX2 is not supported";
+
+  for (const int depth : kSizes)
+  {
+    const int batch = 3;
+    const auto input = RandomFloats(batch * depth, -20.f, 20.f, depth);
+    const Shape shape{batch, depth};
+    SoftmaxParams params;
+    params.beta = 0.8;
+
+    std::vector<float> expected(batch * depth), output(batch * depth);
+    reference::Softmax(params, shape, input.data(), shape, expected.data());
+    Softmax(params, shape, input.data(), shape, output.data());
+    for (int i = 0; i < batch * depth; ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-6f) << "depth " << depth;
+
+    Softmax(input.data(), depth, batch, 0.8f, output.data());
+    for (int i = 0; i < batch * depth; ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-6f) << "depth " << depth;
+  }
+}
+
+#endif // CKER_X86_SIMD
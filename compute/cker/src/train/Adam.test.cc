@@ -151,6 +151,61 @@ TEST(CKer_Optimizer, AdamSteps1e5)
   }
 }
 
+TEST(CKer_Optimizer, AdamWeightDecay)
+{
+  // Larger than a block to cover the block-wise update
+  const int size = 2500;
+  const float lr = 0.001f;
+  const float beta1 = 0.9f;
+  const float beta2 = 0.999f;
+  const float epsilon = 1e-07f;
+  const float weight_decay = 0.01f;
+
+  for (bool nesterov : {false, true})
+  {
+    std::vector<float> trainable(size);
+    std::vector<float> gradient(size);
+    for (int i = 0; i < size; ++i)
+    {
+      trainable[i] = static_cast<float>(i % 17) * 0.1f - 0.8f;
+      gradient[i] = static_cast<float>(i % 13) * 0.05f - 0.3f;
+    }
+    std::vector<float> m(size, 0.f);
+    std::vector<float> v(size, 0.f);
+    std::vector<float> expected = trainable;
+    std::vector<float> expected_m = m;
+    std::vector<float> expected_v = v;
+
+    float beta1_power = 1.f;
+    float beta2_power = 1.f;
+    for (int step = 0; step < 3; ++step)
+    {
+      beta1_power *= beta1;
+      beta2_power *= beta2;
+      const float alpha = lr * std::sqrt(1.f - beta2_power) / (1.f - beta1_power);
+
+      for (int i = 0; i < size; ++i)
+      {
+        const float g = gradient[i] + weight_decay * expected[i];
+        expected_m[i] += (g - expected_m[i]) * (1.f - beta1);
+        expected_v[i] += (g * g - expected_v[i]) * (1.f - beta2);
+        const float step_m = nesterov ? g * (1.f - beta1) + beta1 * expected_m[i] : expected_m[i];
+        expected[i] -= step_m * alpha / (std::sqrt(expected_v[i]) + epsilon);
+      }
+
+      nnfw::cker::train::Adam(size, trainable.data(), gradient.data(), m.data(), v.data(), alpha,
+                              beta1, beta2, epsilon, weight_decay, nesterov);
+
+      for (int i = 0; i < size; ++i)
+      {
+        EXPECT_NEAR(trainable[i], expected[i], 1e-5f);
+        EXPECT_NEAR(m[i], expected_m[i], 1e-5f);
+        EXPECT_NEAR(v[i], expected_v[i], 1e-5f);
+      }
+    }
+  }
+}
+
 TEST(CKer_Optimizer, neg_AdamUnmatchedGradientShape)
 {
   // Unmatched shape
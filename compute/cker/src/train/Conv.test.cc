@@ -65,6 +65,58 @@ public:
       EXPECT_NEAR(gradient[i], expected[i], 1e-4f);
   }
 
+  static void verifyOHWIGradExpected(const nnfw::cker::ConvParams &params,
+                                     const nnfw::cker::Shape &incoming_shape,
+                                     const T *incoming_data, const nnfw::cker::Shape &input_shape,
+                                     const T *input_data, const nnfw::cker::Shape &filter_shape,
+                                     const T *filter_data, int padding_bottom, int padding_right)
+  {
+    // filter_shape is HWIO, gradients of OHWI filter should be same after transposing
+    const int height = filter_shape.Dims(0);
+    const int width = filter_shape.Dims(1);
+    const int in_depth = filter_shape.Dims(2);
+    const int out_depth = filter_shape.Dims(3);
+    const nnfw::cker::Shape ohwi_shape{out_depth, height, width, in_depth};
+
+    std::vector<T> ohwi_filter(filter_shape.FlatSize());
+    for (int h = 0; h < height; ++h)
+      for (int w = 0; w < width; ++w)
+        for (int i = 0; i < in_depth; ++i)
+          for (int o = 0; o < out_depth; ++o)
+            ohwi_filter[Offset(ohwi_shape, o, h, w, i)] =
+              filter_data[Offset(filter_shape, h, w, i, o)];
+
+    std::vector<T> filter_grad(filter_shape.FlatSize(), static_cast<T>(0));
+    std::vector<T> ohwi_filter_grad(filter_shape.FlatSize(), static_cast<T>(0));
+    nnfw::cker::train::ConvFilterGrad(params, incoming_shape, incoming_data, input_shape,
+                                      input_data, padding_bottom, padding_right, filter_shape,
+                                      filter_grad.data());
+    nnfw::cker::train::ConvFilterGrad(params, incoming_shape, incoming_data, input_shape,
+                                      input_data, padding_bottom, padding_right, ohwi_shape,
+                                      ohwi_filter_grad.data(),
+                                      nnfw::cker::train::ConvFilterLayout::kOHWI);
+
+    for (int h = 0; h < height; ++h)
+      for (int w = 0; w < width; ++w)
+        for (int i = 0; i < in_depth; ++i)
+          for (int o = 0; o < out_depth; ++o)
+            EXPECT_NEAR(ohwi_filter_grad[Offset(ohwi_shape, o, h, w, i)],
+                        filter_grad[Offset(filter_shape, h, w, i, o)], 1e-4f);
+
+    std::vector<T> input_grad(input_shape.FlatSize(), static_cast<T>(0));
+    std::vector<T> ohwi_input_grad(input_shape.FlatSize(), static_cast<T>(0));
+    nnfw::cker::train::ConvInputGrad(params, incoming_shape, incoming_data, filter_shape,
+                                     filter_data, padding_bottom, padding_right, input_shape,
+                                     input_grad.data());
+    nnfw::cker::train::ConvInputGrad(params, incoming_shape, incoming_data, ohwi_shape,
+                                     ohwi_filter.data(), padding_bottom, padding_right, input_shape,
+                                     ohwi_input_grad.data(),
+                                     nnfw::cker::train::ConvFilterLayout::kOHWI);
+
+    for (size_t i = 0; i < input_grad.size(); ++i)
+      EXPECT_NEAR(ohwi_input_grad[i], input_grad[i], 1e-4f);
+  }
+
 private:
   static void calculateFilterGradExpected(const nnfw::cker::ConvParams &params,
                                           const nnfw::cker::Shape &incoming_shape,
@@ -389,6 +441,71 @@ TEST(CKer_Operation, ConvGrad)
   }
 }
 
+TEST(CKer_Operation, ConvGradOHWI)
+{
+  // pad top 1, pad left 1, pad bottom 2, pad right 2, stride 2
+  {
+    nnfw::cker::ConvParams params;
+    params.padding_type = nnfw::cker::PaddingType::kNone;
+    params.padding_values.width = 1;
+    params.padding_values.height = 1;
+    params.stride_width = 2;
+    params.stride_height = 2;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+
+    nnfw::cker::Shape incoming_shape{1, 3, 3, 3}; // n, h, w, c
+    std::vector<float> incoming = {-0.1, 0.2, -0.3, 0.4, 0.5,  -0.6, -0.7, 0.8,  0.9,
+                                   -1.0, 1.1, -1.2, 1.3, -1.4, 1.5,  -1.6, 1.7,  -1.8,
+                                   -1.9, 2.0, -2.1, 2.2, 2.3,  -2.4, 2.5,  -2.6, -2.7};
+    nnfw::cker::Shape filter_shape{2, 2, 2, 3}; // h, w, i, o
+    std::vector<float> filter = {-1,  2,  -3,  4,  5,  -6,  -7,  8,  9,   -10, -11, 12,
+                                 -13, 14, -15, 16, 17, -18, -19, 20, -21, 22,  23,  -24};
+    nnfw::cker::Shape input_shape{1, 3, 3, 2}; // n, h, w, c
+    std::vector<float> input = {-1,  2,  -3,  4,  5,   -6, -7,  8,   -9,
+                                -10, 11, -12, 13, -14, 15, -16, -17, 18};
+
+    const auto padding_bottom = 2;
+    const auto padding_right = 2;
+
+    ConvVerifier<float>::verifyOHWIGradExpected(params, incoming_shape, incoming.data(),
+                                                input_shape, input.data(), filter_shape,
+                                                filter.data(), padding_bottom, padding_right);
+  }
+
+  // same padding, stride 1, non-square filter
+  {
+    nnfw::cker::ConvParams params;
+    params.padding_type = nnfw::cker::PaddingType::kSame;
+    params.padding_values.width = 0;
+    params.padding_values.height = 1;
+    params.stride_width = 1;
+    params.stride_height = 1;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+
+    nnfw::cker::Shape incoming_shape{2, 3, 3, 2}; // n, h, w, c
+    std::vector<float> incoming(incoming_shape.FlatSize());
+    for (size_t i = 0; i < incoming.size(); ++i)
+      incoming[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+    nnfw::cker::Shape filter_shape{3, 1, 4, 2}; // h, w, i, o
+    std::vector<float> filter(filter_shape.FlatSize());
+    for (size_t i = 0; i < filter.size(); ++i)
+      filter[i] = static_cast<float>(i % 5) - 2.0f;
+    nnfw::cker::Shape input_shape{2, 3, 3, 4}; // n, h, w, c
+    std::vector<float> input(input_shape.FlatSize());
+    for (size_t i = 0; i < input.size(); ++i)
+      input[i] = static_cast<float>(i % 11) * 0.5f - 2.5f;
+
+    const auto padding_bottom = 1;
+    const auto padding_right = 0;
+
+    ConvVerifier<float>::verifyOHWIGradExpected(params, incoming_shape, incoming.data(),
+                                                input_shape, input.data(), filter_shape,
+                                                filter.data(), padding_bottom, padding_right);
+  }
+}
+
 TEST(CKer_Operation, neg_ConvGradUnsupportedDilation)
 {
   // Unsupported dilation
@@ -86,6 +86,49 @@ TEST(CKer_Optimizer, SGDSimple)
   }
 }
 
+TEST(CKer_Optimizer, SGDMomentumWeightDecay)
+{
+  // Larger than a block to cover the block-wise update
+  const int size = 2500;
+  const float lr = 0.01f;
+  const float momentum = 0.9f;
+  const float weight_decay = 0.01f;
+
+  for (bool nesterov : {false, true})
+  {
+    std::vector<float> trainable(size);
+    std::vector<float> gradient(size);
+    for (int i = 0; i < size; ++i)
+    {
+      trainable[i] = static_cast<float>(i % 17) * 0.1f - 0.8f;
+      gradient[i] = static_cast<float>(i % 13) * 0.05f - 0.3f;
+    }
+    std::vector<float> velocity(size, 0.f);
+    std::vector<float> expected = trainable;
+    std::vector<float> expected_velocity = velocity;
+
+    for (int step = 0; step < 3; ++step)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        const float g = gradient[i] + weight_decay * expected[i];
+        expected_velocity[i] = momentum * expected_velocity[i] + g;
+        expected[i] -=
+          lr * (nesterov ? g + momentum * expected_velocity[i] : expected_velocity[i]);
+      }
+
+      nnfw::cker::train::GradientDescent(size, trainable.data(), gradient.data(),
+                                         velocity.data(), lr, momentum, weight_decay, nesterov);
+
+      for (int i = 0; i < size; ++i)
+      {
+        EXPECT_NEAR(trainable[i], expected[i], 1e-5f);
+        EXPECT_NEAR(velocity[i], expected_velocity[i], 1e-5f);
+      }
+    }
+  }
+}
+
 TEST(CKer_Optimizer, neg_SGDUnmatchedGradientShape)
 {
   // Unmatched shape
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/train/operation/Stash.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+std::vector<float> MakeActivations(int size)
+{
+  std::vector<float> values(size);
+  for (int i = 0; i < size; ++i)
+    values[i] = std::sin(static_cast<float>(i)) * static_cast<float>(i % 100);
+  return values;
+}
+
+} // namespace
+
+TEST(CKer_Operation, StashFp16)
+{
+  const auto input = MakeActivations(100000);
+  const Shape shape{static_cast<int>(input.size())};
+  std::vector<Float16> stash(input.size());
+  std::vector<float> output(input.size());
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+  train::Stash(shape, input.data(), stash.data(), &ctx);
+  train::Unstash(shape, stash.data(), output.data(), &ctx);
+
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    EXPECT_EQ(stash[i].bits, Fp32ToFp16(input[i]).bits);
+    // fp16 keeps 11 significant bits
+    EXPECT_NEAR(output[i], input[i], std::abs(input[i]) * 1e-3f);
+  }
+}
+
+TEST(CKer_Operation, StashFp16Saturate)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> input{1e5f, -1e6f, 65504.f, 65520.f, inf, -inf, 1.5f};
+  const Shape shape{static_cast<int>(input.size())};
+  std::vector<Float16> stash(input.size());
+  std::vector<float> output(input.size());
+
+  train::Stash(shape, input.data(), stash.data());
+  train::Unstash(shape, stash.data(), output.data());
+
+  const std::vector<float> expected{65504.f, -65504.f, 65504.f, 65504.f, 65504.f, -65504.f, 1.5f};
+  EXPECT_EQ(output, expected);
+
+  const std::vector<float> nan_input{std::numeric_limits<float>::quiet_NaN()};
+  train::Stash(Shape{1}, nan_input.data(), stash.data());
+  train::Unstash(Shape{1}, stash.data(), output.data());
+  EXPECT_TRUE(std::isnan(output[0]));
+}
+
+TEST(CKer_Operation, StashBf16)
+{
+  const auto input = MakeActivations(100000);
+  const Shape shape{static_cast<int>(input.size())};
+  std::vector<BFloat16> stash(input.size());
+  std::vector<float> output(input.size());
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+  train::Stash(shape, input.data(), stash.data(), &ctx);
+  train::Unstash(shape, stash.data(), output.data(), &ctx);
+
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    // bf16 keeps 8 significant bits
+    EXPECT_NEAR(output[i], input[i], std::abs(input[i]) * 4e-3f);
+  }
+}
+
+TEST(CKer_Operation, Bf16Rounding)
+{
+  // Ties round to even
+  EXPECT_EQ(Fp32ToBf16(1.00390625f).bits, 0x3f80);
+  EXPECT_EQ(Fp32ToBf16(1.01171875f).bits, 0x3f82);
+  // Above the tie rounds up
+  EXPECT_EQ(Fp32ToBf16(1.0040f).bits, 0x3f81);
+  EXPECT_EQ(Bf16ToFp32(Fp32ToBf16(-2.5f)), -2.5f);
+  EXPECT_TRUE(std::isinf(Bf16ToFp32(Fp32ToBf16(std::numeric_limits<float>::infinity()))));
+  EXPECT_TRUE(std::isnan(Bf16ToFp32(Fp32ToBf16(std::numeric_limits<float>::quiet_NaN()))));
+  // Large values stay in range, unlike fp16
+  EXPECT_NEAR(Bf16ToFp32(Fp32ToBf16(1e30f)), 1e30f, 1e28f);
+}
+
+TEST(CKer_Operation, neg_Bf16NanNotInf)
+{
+  // A nan whose payload is only in the lower half must not become inf
+  uint32_t bits = 0x7f800001;
+  float nan;
+  std::memcpy(&nan, &bits, sizeof(nan));
+  EXPECT_TRUE(std::isnan(Bf16ToFp32(Fp32ToBf16(nan))));
+}
@@ -3205,10 +3205,14 @@ void ggml_numa_init(enum ggml_numa_strategy numa_flag) {
 #endif
 }
 
+#endif // [FIX] end
+
 bool ggml_is_numa(void) {
     return g_state.numa.n_nodes > 1;
 }
 
+#if 0 // [FIX] disable
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void ggml_print_object(const struct ggml_object * obj) {
@@ -3339,6 +3343,8 @@ bool ggml_is_3d(const struct ggml_tensor * tensor) {
     return tensor->ne[3] == 1;
 }
 
+#endif // [FIX] end
+
 int ggml_n_dims(const struct ggml_tensor * tensor) {
     for (int i = GGML_MAX_DIMS - 1; i >= 1; --i) {
         if (tensor->ne[i] > 1) {
@@ -3348,6 +3354,8 @@ int ggml_n_dims(const struct ggml_tensor * tensor) {
     return 1;
 }
 
+#if 0 // [FIX] disable
+
 static inline bool ggml_can_mul_mat(const struct ggml_tensor * t0, const struct ggml_tensor * t1) {
     static_assert(GGML_MAX_DIMS == 4, "GGML_MAX_DIMS is not 4 - update this function");
 
@@ -3410,6 +3418,8 @@ GGML_CALL bool ggml_is_transposed(const struct ggml_tensor * tensor) {
     return tensor->nb[0] > tensor->nb[1];
 }
 
+#endif // [FIX] end
+
 static bool ggml_is_contiguous_n(const struct ggml_tensor * tensor, int n) {
     size_t next_nb = ggml_type_size(tensor->type);
     if (tensor->ne[0] != ggml_blck_size(tensor->type) && tensor->nb[0] != next_nb) {
@@ -3440,6 +3450,7 @@ GGML_CALL bool ggml_is_contiguous_0(const struct ggml_tensor * tensor) {
     return ggml_is_contiguous_n(tensor, 0);
 }
 
+#if 0 // [FIX] disable
 GGML_CALL bool ggml_is_contiguous_1(const struct ggml_tensor * tensor) {
     return ggml_is_contiguous_n(tensor, 1);
 }
@@ -12252,6 +12263,8 @@ static void ggml_compute_forward_group_norm(
     }
 }
 
+#endif // [FIX] end
+
 // ggml_compute_forward_mul_mat
 
 static void ggml_compute_forward_mul_mat_one_chunk(
@@ -12560,6 +12573,8 @@ UseGgmlGemm2:;
     }
 }
 
+#if 0 // [FIX] disable
+
 // ggml_compute_forward_mul_mat_id
 
 static void ggml_compute_forward_mul_mat_id(
@@ -16898,10 +16913,12 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_group_norm(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_MUL_MAT:
             {
                 ggml_compute_forward_mul_mat(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_MUL_MAT_ID:
             {
                 ggml_compute_forward_mul_mat_id(params, tensor);
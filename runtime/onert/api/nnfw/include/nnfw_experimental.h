@@ -117,25 +117,29 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
 /**
- * @brief Prepare session to be ready for inference
+ * @brief Prepare session to be ready for pipelined inference
  *
- * This phase may finalize model compilation, scheduling, and additional settings.
+ * Each model of multi-model nnpackage runs on its own stage thread, and requests flow through
+ * the stages along the edges of nnpackage. Partition the model into nnpackage in advance
+ * (ex. by circle-partitioner). Number of requests in flight can be set by PIPELINE_CAPACITY
+ * configuration or {@link nnfw_set_config} (default: number of models + 1).
  *
- * @deprecated Deprecated since 1.22.1
+ * {@link nnfw_run} and {@link nnfw_run_async} are not allowed on the session prepared by this.
  *
- * @param session the session to be prepared
+ * @param session       the session to be prepared
+ * @param map_file_path not supported, must be NULL
  * @return NNFW_STATUS_NO_ERROR if successful
  */
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path = nullptr);
 
 /**
- * @brief     Set input buffer
+ * @brief     Push input buffers as a new request of pipeline
  *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p inputs given to this
- * function can be reused for many inferences. \p lengths must be greater or equal than the operand
- * requires. if you give empty \p inputs to this function, then this function will join all threads.
- *
- * @deprecated Deprecated since 1.22.1
+ * This function must be called after {@link nnfw_prepare_pipeline}. Input data is copied, so
+ * \p inputs given to this function can be reused right after it returns. \p lengths must be
+ * greater or equal than the operand requires. This function blocks while the pipeline is full,
+ * so pop outputs from another thread or in between. If you give empty \p inputs to this function,
+ * then this function will wait for all pushed requests to finish and join all threads.
  *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
@@ -148,18 +152,18 @@ NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_pa
 NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths);
 
 /**
- * @brief       Get last outputs of partitioned model in session
- *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p outputs given to this
- * function must be cleared for memory management.
+ * @brief       Get outputs of the oldest request of pipeline
  *
- * @deprecated Deprecated since 1.22.1
+ * This function must be called after {@link nnfw_prepare_pipeline}, and blocks until outputs of
+ * the oldest request are ready. Each buffer in \p outputs is allocated by {@code new uint8_t[]}
+ * and owned by user, so it must be released by {@code delete[]}.
  *
  * @param[in]   session Session from last outputs is to be extracted
  * @param[out]  outputs Raw buffer for outputs, it must be \p std::vector<void *> type pointer for
  * multiple output model
  *
- * @return      @c NNFW_STATUS_NO_ERROR if successful
+ * @return      @c NNFW_STATUS_NO_ERROR if successful,
+ *              @c NNFW_STATUS_ERROR if the request failed or pipeline is finished
  */
 NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs);
 
@@ -205,6 +209,16 @@ typedef enum
   NNFW_TRAIN_OPTIMIZER_ADAM = 2,
 } NNFW_TRAIN_OPTIMIZER;
 
+typedef enum
+{
+  /** Activations are kept in fp32 */
+  NNFW_TRAIN_ACTIVATION_STASH_NONE = 0,
+  /** Activations are kept in fp16 from forwarding to backwarding */
+  NNFW_TRAIN_ACTIVATION_STASH_FP16 = 1,
+  /** Activations are kept in bf16 from forwarding to backwarding */
+  NNFW_TRAIN_ACTIVATION_STASH_BF16 = 2,
+} NNFW_TRAIN_ACTIVATION_STASH;
+
 typedef struct nnfw_loss_info
 {
   NNFW_TRAIN_LOSS loss;
@@ -249,6 +263,27 @@ typedef struct nnfw_train_info
    *  The special values are collected in NNFW_TRAIN_NUM_OF_TRAINABLE_OPS_SPECIAL_VALUES enum.
    */
   int32_t num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_NONE;
+
+  /** Memory budget in bytes for activations kept from forwarding to backwarding.
+   *  If the activations do not fit in it, only some of them are kept as checkpoints and the others
+   *  are recomputed from the checkpoints during backwarding. "0" means no limit.
+   */
+  uint64_t memory_budget = 0;
+
+  /** Momentum of SGD optimizer. "0" means plain SGD. It is ignored by other optimizers. */
+  float momentum = 0.0f;
+
+  /** Whether SGD optimizer with momentum uses Nesterov momentum */
+  bool nesterov = false;
+
+  /** L2 penalty added to the gradients of weights before the optimizer update. "0" means none. */
+  float weight_decay = 0.0f;
+
+  /** 16-bit type of activations kept from forwarding to backwarding.
+   *  Computation, weights and gradients stay in fp32. It can also be set by nnfw_set_config with
+   *  "TRAIN_ACTIVATION_STASH" key and "fp16", "bf16" or "" value.
+   */
+  NNFW_TRAIN_ACTIVATION_STASH activation_stash = NNFW_TRAIN_ACTIVATION_STASH_NONE;
 } nnfw_train_info;
 
 /**
@@ -638,6 +673,178 @@ NNFW_STATUS nnfw_set_execute_config(nnfw_session *session, const NNFW_RUN_CONFIG
  */
 NNFW_STATUS nnfw_reset_execute_config(nnfw_session *session);
 
+/**
+ *  Incremental decoding APIs
+ *
+ * Autoregressive models (ex. transformer decoder with KV cache) take the cache of previous steps
+ * as input and produce the updated cache as output. Cache tensor APIs let the session keep such
+ * input/output pair resident between runs instead of copying it through user buffers.
+ * 1. nnfw_prepare
+ * 2. nnfw_set_cache_tensor for each cache input/output pair
+ * 3. nnfw_set_input, nnfw_set_output for other inputs & outputs
+ * 4. nnfw_run for each step
+ * 5. nnfw_reset_cache_tensors to start new sequence
+ */
+
+//////////////////////////////////////////////
+// APIs for incremental decoding
+//////////////////////////////////////////////
+
+/**
+ * @brief     Bind model input and output as persistent cache tensor pair
+ *
+ * Session reserves buffers for the cache up to the size of {@code max_info} and binds them to
+ * the input and output. After each {@link nnfw_run}, output of the step becomes input of the next
+ * step without copy, and input shape follows output shape of the step. So user must not set
+ * buffer for the input and output by {@link nnfw_set_input} and {@link nnfw_set_output}.
+ *
+ * Cache is zero-initialized with current input shape. Use {@link nnfw_set_input_tensorinfo}
+ * before this function to set initial shape of the cache.
+ *
+ * A cache that grows each step changes the input shape, so shapes of the model are inferred again
+ * on every run and intermediate tensors depending on the cache become dynamic. Set config
+ * RESERVE_DYNAMIC_TENSORS to "1" by {@link nnfw_set_config} before {@link nnfw_prepare} to keep
+ * memory of dynamic tensors between runs: each tensor reuses its reserved memory while the shape
+ * fits in it, and reserved memory grows geometrically, so a growing cache reallocates only a few
+ * times up to the max shape. Models that keep a fixed-size cache (sliding window, or max-length
+ * cache updated at a position given by another input) do not need it: output shape equals input
+ * shape, so the input shape is never changed.
+ *
+ * @param[in] session       nnfw_session prepared for inference
+ * @param[in] input_index   Index of cache input
+ * @param[in] output_index  Index of updated cache output
+ * @param[in] max_info      Tensor info of the largest cache, used to reserve buffer
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_cache_tensor(nnfw_session *session, uint32_t input_index,
+                                  uint32_t output_index, const nnfw_tensorinfo *max_info);
+
+/**
+ * @brief     Reset all cache tensors to start new sequence
+ *
+ * Cache tensors are zero-filled and input shapes are restored to the shapes
+ * when {@link nnfw_set_cache_tensor} was called. Reserved buffers are reused.
+ *
+ * @param[in] session nnfw_session to reset cache tensors
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_cache_tensors(nnfw_session *session);
+
+/*
+ *  Concurrent execution APIs
+ *
+ * Execution contexts let multiple threads run one model concurrently without loading the model
+ * for each thread. A context is a session prepared from the model of another session: constant
+ * tensors (weights) are shared, and each context has its own kernels and activation memory.
+ * 1. nnfw_set_config(session, "EXECUTION_CONTEXT_ENABLE", "1") and nnfw_prepare for a session
+ * 2. nnfw_create_execution_context for each thread
+ * 3. nnfw_set_input, nnfw_set_output and nnfw_run on the context in each thread
+ * 4. nnfw_close_session for each context, and then for the session
+ */
+
+//////////////////////////////////////////////
+// APIs for concurrent execution
+//////////////////////////////////////////////
+
+/**
+ * @brief     Create execution context which shares weights of prepared session
+ *
+ * Created context is a session in prepared state with the same model and compile options as
+ * {@code session}, and it is used by any inference API like {@link nnfw_run}. Each context can
+ * run concurrently with other contexts and the session. Input shape changes of {@code session}
+ * after {@link nnfw_prepare} are not inherited.
+ *
+ * The model is not compiled again. Context reuses the lowering result of {@link nnfw_prepare}, and
+ * only kernels and non-constant tensors are created for it. The session keeps the lowering result
+ * only if config EXECUTION_CONTEXT_ENABLE is set to "1" by {@link nnfw_set_config} before
+ * {@link nnfw_prepare}, otherwise this function fails. This function can be called from
+ * multiple threads at once. Context cannot create another context, and it is closed by
+ * {@link nnfw_close_session} independently of {@code session}.
+ *
+ * @param[in]  session nnfw_session prepared for inference of single model
+ * @param[out] context Created execution context
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_execution_context(nnfw_session *session, nnfw_session **context);
+
+/*
+ *  Dynamic batching APIs
+ *
+ * Dynamic batching coalesces concurrent requests of small batch into one execution to make
+ * better use of SIMD and GEMM kernels. Requests are collected until max batch size is reached or
+ * the oldest request has waited for the window, and their inputs are concatenated along the first
+ * dimension. Outputs are split along the first dimension and copied back to each request.
+ * 1. nnfw_load_model_from_file or other model loading API
+ * 2. nnfw_prepare_batching (instead of nnfw_prepare)
+ * 3. nnfw_run_batched from multiple threads
+ * 4. nnfw_get_batching_stats to check latency and throughput
+ */
+
+//////////////////////////////////////////////
+// APIs for dynamic batching
+//////////////////////////////////////////////
+
+/**
+ * @brief Counters of dynamic batching
+ *
+ * Average batch size is request_count / batch_count, average latency is
+ * latency_us / request_count and throughput is request_count / elapsed_us.
+ */
+typedef struct nnfw_batching_stats
+{
+  /** Number of finished requests */
+  uint64_t request_count;
+  /** Number of batched executions */
+  uint64_t batch_count;
+  /** Sum of time (microseconds) requests waited to be batched */
+  uint64_t queue_us;
+  /** Sum of time (microseconds) from submit to finish of requests */
+  uint64_t latency_us;
+  /** Sum of time (microseconds) spent by batched executions */
+  uint64_t execute_us;
+  /** Time (microseconds) since {@link nnfw_prepare_batching} */
+  uint64_t elapsed_us;
+} nnfw_batching_stats;
+
+/**
+ * @brief     Prepare session to run requests by dynamic batching
+ *
+ * This function compiles the model like {@link nnfw_prepare} and starts batching thread.
+ * Every input and output of the model must have batch as its first dimension, and the model must
+ * support dynamic shape of batched inputs. Input shapes set before this function are the shapes
+ * of a request. {@link nnfw_run} and {@link nnfw_run_async} are not allowed on the session.
+ *
+ * @param[in] session        nnfw_session with loaded model
+ * @param[in] max_batch_size Max number of requests in a batch
+ * @param[in] window_us      Max time (microseconds) the oldest request waits for other requests
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_prepare_batching(nnfw_session *session, uint32_t max_batch_size,
+                                  uint32_t window_us);
+
+/**
+ * @brief     Run a request as a part of batch
+ *
+ * This function can be called from multiple threads, and blocks until outputs of the request are
+ * filled. Size of each buffer is the size of tensor reported by {@link nnfw_input_tensorinfo} and
+ * {@link nnfw_output_tensorinfo}, and input data type is the model's data type.
+ *
+ * @param[in] session nnfw_session prepared by {@link nnfw_prepare_batching}
+ * @param[in] inputs  Array of input buffers, one for each model input
+ * @param[in] outputs Array of output buffers, one for each model output
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_batched(nnfw_session *session, const void **inputs, void **outputs);
+
+/**
+ * @brief      Get counters of dynamic batching
+ *
+ * @param[in]  session nnfw_session prepared by {@link nnfw_prepare_batching}
+ * @param[out] stats   Counters since {@link nnfw_prepare_batching}
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_batching_stats(nnfw_session *session, nnfw_batching_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -364,19 +364,22 @@ NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *b
   return session->set_backends_per_operation(backend_settings);
 }
 
-NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *, const char *)
+NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path)
 {
-  return nnfw_session::deprecated("nnfw_prepare_pipeline: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_pipeline(map_file_path);
 }
 
-NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *, void *, void *)
+NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths)
 {
-  return nnfw_session::deprecated("nnfw_push_pipeline_input: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->push_pipeline_input(inputs, lengths);
 }
 
-NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *, void *)
+NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
 {
-  return nnfw_session::deprecated("nnfw_pop_pipeline_output: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->pop_pipeline_output(outputs);
 }
 
 NNFW_STATUS nnfw_set_workspace(nnfw_session *session, const char *dir)
@@ -535,3 +538,47 @@ NNFW_STATUS nnfw_reset_execute_config(nnfw_session *session)
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->reset_execute_config();
 }
+
+// Incremental decoding
+
+NNFW_STATUS nnfw_set_cache_tensor(nnfw_session *session, uint32_t input_index,
+                                  uint32_t output_index, const nnfw_tensorinfo *max_info)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_cache_tensor(input_index, output_index, max_info);
+}
+
+NNFW_STATUS nnfw_reset_cache_tensors(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_cache_tensors();
+}
+
+// Concurrent execution
+
+NNFW_STATUS nnfw_create_execution_context(nnfw_session *session, nnfw_session **context)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->create_execution_context(context);
+}
+
+// Dynamic batching
+
+NNFW_STATUS nnfw_prepare_batching(nnfw_session *session, uint32_t max_batch_size,
+                                  uint32_t window_us)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_batching(max_batch_size, window_us);
+}
+
+NNFW_STATUS nnfw_run_batched(nnfw_session *session, const void **inputs, void **outputs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_batched(inputs, outputs);
+}
+
+NNFW_STATUS nnfw_get_batching_stats(nnfw_session *session, nnfw_batching_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_batching_stats(stats);
+}
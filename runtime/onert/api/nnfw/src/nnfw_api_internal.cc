@@ -16,11 +16,14 @@
 
 #include "nnfw_api_internal.h"
 #include "CustomKernelRegistry.h"
+#include "compiler/Compiler.h"
 #include "compiler/CompilerFactory.h"
 #include "util/ConfigSource.h"
 #include "util/Exceptions.h"
 #include "util/logging.h"
+#include "exec/BatchingExecution.h"
 #include "exec/Execution.h"
+#include "exec/PipelineExecution.h"
 #include "loader/CircleLoader.h"
 #include "loader/ModelLoader.h"
 #include "loader/TFLiteLoader.h"
@@ -36,6 +39,7 @@
 #include "odc/QuantizeManager.h"
 #include "odc/CodegenManager.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -500,9 +504,24 @@ NNFW_STATUS nnfw_session::run()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_pipeline)
+  {
+    std::cerr << "Error during nnfw_session::run : "
+              << "session is prepared for pipeline, use push/pop pipeline API" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (_batching)
+  {
+    std::cerr << "Error during nnfw_session::run : "
+              << "session is prepared for batching, use nnfw_run_batched" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   try
   {
     _execution->execute();
+    rotateCacheTensors();
   }
   catch (const onert::InsufficientBufferSizeException &e)
   {
@@ -529,6 +548,20 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_pipeline)
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "session is prepared for pipeline, use push/pop pipeline API" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (_batching)
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "session is prepared for batching, use nnfw_run_batched" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   _execution->startExecute();
 
   _state = State::RUNNING;
@@ -546,6 +579,16 @@ NNFW_STATUS nnfw_session::await()
 
   _execution->waitFinish();
 
+  try
+  {
+    rotateCacheTensors();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   _state = State::FINISHED_RUN;
   return NNFW_STATUS_NO_ERROR;
 }
@@ -923,6 +966,18 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     _coptions->executor = value;
   }
+  else if (skey == config::PARALLEL_NUM_WORKERS)
+  {
+    _coptions->parallel_num_workers = toInt(value);
+  }
+  else if (skey == config::PIPELINE_CAPACITY)
+  {
+    _coptions->pipeline_capacity = toInt(value);
+  }
+  else if (skey == config::EXECUTION_CONTEXT_ENABLE)
+  {
+    _coptions->execution_context_enable = toBool(value);
+  }
   else if (skey == config::OP_BACKEND_ALLOPS)
   {
     _coptions->manual_scheduler_options.backend_for_all = value;
@@ -935,6 +990,36 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     _coptions->he_profiling_mode = toBool(value);
   }
+  else if (skey == config::MEMORY_AWARE_LINEARIZE)
+  {
+    _coptions->memory_aware_linearize = toBool(value);
+  }
+  else if (skey == config::RESERVE_DYNAMIC_TENSORS)
+  {
+    _coptions->reserve_dynamic_tensors = toBool(value);
+  }
+  else if (skey == config::TRAIN_NUM_REPLICAS)
+  {
+    _coptions->train_num_replicas = toInt(value);
+  }
+  else if (skey == config::TRAIN_FLAT_OPTIMIZER)
+  {
+    _coptions->train_flat_optimizer = toBool(value);
+  }
+  else if (skey == config::TRAIN_ACTIVATION_STASH)
+  {
+    // after model loaded, it ensures that _train_info is not nullptr
+    assert(_train_info != nullptr);
+    try
+    {
+      _train_info->setActivationStash(onert::ir::train::toActivationStash(value));
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Error during nnfw_session::set_config : " << e.what() << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -1158,6 +1243,244 @@ NNFW_STATUS nnfw_session::set_backends_per_operation(const char *backend_setting
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::create_execution_context(nnfw_session **context)
+{
+  if (context == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  // Session state is not checked because the session may be running on another thread.
+  // _compiler_artifact is set only by prepare.
+  if (_compiler_artifact == nullptr || _compiler_artifact->_lowered_subgs.empty())
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : "
+              << "create_execution_context should be run after prepare of single model for "
+              << "inference with EXECUTION_CONTEXT_ENABLE config" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    // Executors are created from the lowering result of prepare without compiling again. Constant
+    // data is shared, so only kernels and non-constant tensors are created for the context.
+    auto new_context = std::unique_ptr<nnfw_session>(new nnfw_session());
+    new_context->_kernel_registry = _kernel_registry;
+    new_context->_coptions = std::make_unique<onert::compiler::CompilerOptions>(*_coptions);
+    new_context->_model_path = _model_path;
+    new_context->_compiler_artifact = onert::compiler::Compiler::createExecutors(
+      *_compiler_artifact, new_context->_coptions.get());
+    new_context->_execution =
+      std::make_unique<onert::exec::Execution>(new_context->_compiler_artifact->_executors);
+    new_context->_state = State::PREPARED;
+    *context = new_context.release();
+  }
+  catch (const std::bad_alloc &e)
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : " << e.what()
+              << std::endl;
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : " << e.what()
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::prepare_batching(uint32_t max_batch_size, uint32_t window_us)
+{
+  if (max_batch_size == 0)
+  {
+    std::cerr << "Error during nnfw_session::prepare_batching : "
+              << "max_batch_size must be positive" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  auto status = prepare();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  try
+  {
+    _batching = std::make_unique<onert::exec::BatchingExecution>(
+      _compiler_artifact->_executors, max_batch_size, std::chrono::microseconds{window_us});
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_batching : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::run_batched(const void **inputs, void **outputs)
+{
+  if (!_batching)
+  {
+    std::cerr << "Error during nnfw_session::run_batched : "
+              << "run_batched should be run after prepare_batching" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto input_count = _compiler_artifact->_executors->inputSize();
+  const auto output_count = _compiler_artifact->_executors->outputSize();
+  if ((input_count > 0 && inputs == nullptr) || (output_count > 0 && outputs == nullptr))
+  {
+    std::cerr << "Error during nnfw_session::run_batched : inputs or outputs is null"
+              << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    std::vector<const void *> input_buffers{inputs, inputs + input_count};
+    std::vector<void *> output_buffers{outputs, outputs + output_count};
+    _batching->run(input_buffers, output_buffers);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_batched : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_batching_stats(nnfw_batching_stats *stats)
+{
+  if (stats == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!_batching)
+  {
+    std::cerr << "Error during nnfw_session::get_batching_stats : "
+              << "get_batching_stats should be run after prepare_batching" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto batching_stats = _batching->stats();
+  stats->request_count = batching_stats.request_count;
+  stats->batch_count = batching_stats.batch_count;
+  stats->queue_us = batching_stats.queue_us;
+  stats->latency_us = batching_stats.latency_us;
+  stats->execute_us = batching_stats.execute_us;
+  stats->elapsed_us = batching_stats.elapsed_us;
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
+{
+  if (map_file_path != nullptr)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : "
+              << "partition map is not supported, use multi-model nnpackage" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  auto status = prepare();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  try
+  {
+    const auto capacity = _coptions->pipeline_capacity;
+    _pipeline = std::make_unique<onert::exec::PipelineExecution>(
+      _compiler_artifact->_executors, static_cast<uint32_t>(std::max(capacity, 0)));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::push_pipeline_input(void *inputs, void *lengths)
+{
+  if (!_pipeline)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : "
+              << "push_pipeline_input should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  auto input_buffers = reinterpret_cast<std::vector<void *> *>(inputs);
+  auto input_lengths = reinterpret_cast<std::vector<uint32_t> *>(lengths);
+
+  try
+  {
+    // Empty inputs mean end of requests
+    if (input_buffers == nullptr || input_buffers->empty())
+    {
+      _pipeline->finish();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    if (input_lengths == nullptr)
+    {
+      std::cerr << "Error during nnfw_session::push_pipeline_input : lengths is null"
+                << std::endl;
+      return NNFW_STATUS_UNEXPECTED_NULL;
+    }
+
+    std::vector<const void *> buffers{input_buffers->begin(), input_buffers->end()};
+    std::vector<size_t> sizes{input_lengths->begin(), input_lengths->end()};
+    _pipeline->push(buffers, sizes);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::pop_pipeline_output(void *outputs)
+{
+  if (!_pipeline)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+              << "pop_pipeline_output should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  auto output_buffers = reinterpret_cast<std::vector<void *> *>(outputs);
+  if (output_buffers == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : outputs is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    std::vector<std::unique_ptr<uint8_t[]>> buffers;
+    if (!_pipeline->pop(buffers))
+    {
+      std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+                << "pipeline is finished and no output remains" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
+    // Ownership of buffers is passed to user
+    output_buffers->clear();
+    for (auto &buffer : buffers)
+      output_buffers->emplace_back(buffer.release());
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::train_get_traininfo(nnfw_train_info *info)
 {
   if (isStateInitialized())
@@ -1221,6 +1544,21 @@ NNFW_STATUS nnfw_session::train_get_traininfo(nnfw_train_info *info)
     }
   };
 
+  auto convertActivationStash =
+    [](const onert::ir::train::ActivationStash &stash) -> NNFW_TRAIN_ACTIVATION_STASH {
+    switch (stash)
+    {
+      case onert::ir::train::ActivationStash::None:
+        return NNFW_TRAIN_ACTIVATION_STASH_NONE;
+      case onert::ir::train::ActivationStash::FLOAT16:
+        return NNFW_TRAIN_ACTIVATION_STASH_FP16;
+      case onert::ir::train::ActivationStash::BFLOAT16:
+        return NNFW_TRAIN_ACTIVATION_STASH_BF16;
+      default:
+        throw std::runtime_error{"fail to convert from ir::train::ActivationStash"};
+    }
+  };
+
   const auto &loss = _train_info->lossInfo();
   const auto &optim = _train_info->optimizerInfo();
 
@@ -1231,6 +1569,11 @@ NNFW_STATUS nnfw_session::train_get_traininfo(nnfw_train_info *info)
     info->loss_info.loss = convertLossCode(loss.loss_code);
     info->loss_info.reduction_type = convertLossReduction(loss.reduction_type);
     info->opt = convertOptimizerCode(optim.optim_code);
+    info->memory_budget = _train_info->memoryBudget();
+    info->momentum = optim.momentum;
+    info->nesterov = optim.nesterov;
+    info->weight_decay = optim.weight_decay;
+    info->activation_stash = convertActivationStash(_train_info->activationStash());
 
     if (_train_info->getTrainableOps().size() > 0)
     {
@@ -1320,6 +1663,25 @@ NNFW_STATUS nnfw_session::train_set_traininfo(const nnfw_train_info *info)
       throw std::runtime_error("not supported optimizer type");
   };
 
+  auto convertActivationStash = [](const int &type) {
+    if (type == NNFW_TRAIN_ACTIVATION_STASH_NONE)
+      return onert::ir::train::ActivationStash::None;
+    else if (type == NNFW_TRAIN_ACTIVATION_STASH_FP16)
+      return onert::ir::train::ActivationStash::FLOAT16;
+    else if (type == NNFW_TRAIN_ACTIVATION_STASH_BF16)
+      return onert::ir::train::ActivationStash::BFLOAT16;
+    else
+      throw std::runtime_error("not supported activation stash type");
+  };
+
+  if (info->momentum < 0.f || info->weight_decay < 0.f)
+  {
+    std::cerr << "Error during nnfw_session::train_set_traininfo: momentum and weight_decay must "
+                 "be non-negative"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   try
   {
     onert::ir::train::LossInfo loss_info;
@@ -1329,10 +1691,15 @@ NNFW_STATUS nnfw_session::train_set_traininfo(const nnfw_train_info *info)
     onert::ir::train::OptimizerInfo opt_info;
     opt_info.learning_rate = info->learning_rate;
     opt_info.optim_code = convertOptType(info->opt);
+    opt_info.momentum = info->momentum;
+    opt_info.nesterov = info->nesterov;
+    opt_info.weight_decay = info->weight_decay;
 
     _train_info->setBatchSize(info->batch_size);
     _train_info->setLossInfo(loss_info);
     _train_info->setOptimizerInfo(opt_info);
+    _train_info->setMemoryBudget(info->memory_budget);
+    _train_info->setActivationStash(convertActivationStash(info->activation_stash));
 
     if (info->num_of_trainable_ops < -1)
     {
@@ -2053,3 +2420,150 @@ NNFW_STATUS nnfw_session::reset_execute_config()
 
   return NNFW_STATUS_NO_ERROR;
 }
+
+NNFW_STATUS nnfw_session::set_cache_tensor(uint32_t input_index, uint32_t output_index,
+                                           const nnfw_tensorinfo *max_info)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::set_cache_tensor : "
+              << "set_cache_tensor should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (max_info == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::set_cache_tensor : tensorinfo is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (input_index >= getInputSize() || output_index >= getOutputSize())
+  {
+    std::cerr << "Error during nnfw_session::set_cache_tensor : index is out of range"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  for (const auto &cache : _cache_tensors)
+  {
+    if (cache.input_index == input_index || cache.output_index == output_index)
+    {
+      std::cerr << "Error during nnfw_session::set_cache_tensor : already bound as cache tensor"
+                << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+  }
+
+  if (max_info->rank <= 0 || max_info->rank > NNFW_MAX_RANK)
+  {
+    std::cerr << "Error during nnfw_session::set_cache_tensor : unsupported rank "
+              << max_info->rank << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    const auto input_io = onert::ir::IOIndex{input_index};
+    const auto output_io = onert::ir::IOIndex{output_index};
+    const auto input_dtype = _compiler_artifact->_executors->inputInfo(input_io).typeInfo().type();
+    const auto output_dtype =
+      _compiler_artifact->_executors->outputInfo(output_io).typeInfo().type();
+    if (datatype_to_nnfw_dtype(input_dtype) != max_info->dtype ||
+        datatype_to_nnfw_dtype(output_dtype) != max_info->dtype)
+    {
+      std::cerr << "Error during nnfw_session::set_cache_tensor : data type mismatch"
+                << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
+    const auto initial_shape = _execution->getInputShape(input_io);
+    const auto max_size = getBufSize(max_info);
+    const auto initial_size = static_cast<uint64_t>(initial_shape.num_elements()) *
+                              onert::ir::sizeOfDataType(input_dtype);
+    if (initial_size > max_size)
+    {
+      std::cerr << "Error during nnfw_session::set_cache_tensor : "
+                << "current input is larger than max_info" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
+    CacheTensor cache;
+    cache.input_index = input_index;
+    cache.output_index = output_index;
+    cache.initial_shape = initial_shape;
+    // Reserve whole buffers up front so that each step does not reallocate
+    cache.buffers[0].resize(max_size, 0);
+    cache.buffers[1].resize(max_size, 0);
+    cache.input_buffer = 0;
+    _cache_tensors.emplace_back(std::move(cache));
+
+    bindCacheTensors();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::set_cache_tensor : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_cache_tensors()
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::reset_cache_tensors : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    for (auto &cache : _cache_tensors)
+    {
+      std::fill(cache.buffers[0].begin(), cache.buffers[0].end(), 0);
+      std::fill(cache.buffers[1].begin(), cache.buffers[1].end(), 0);
+      cache.input_buffer = 0;
+      _execution->changeInputShape(onert::ir::IOIndex{cache.input_index}, cache.initial_shape);
+    }
+
+    bindCacheTensors();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::reset_cache_tensors : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void nnfw_session::bindCacheTensors()
+{
+  for (auto &cache : _cache_tensors)
+  {
+    auto &input_buffer = cache.buffers[cache.input_buffer];
+    auto &output_buffer = cache.buffers[cache.input_buffer ^ 1];
+    _execution->setInput(onert::ir::IOIndex{cache.input_index}, input_buffer.data(),
+                         input_buffer.size());
+    _execution->setOutput(onert::ir::IOIndex{cache.output_index}, output_buffer.data(),
+                          output_buffer.size());
+  }
+}
+
+void nnfw_session::rotateCacheTensors()
+{
+  if (_cache_tensors.empty())
+    return;
+
+  for (auto &cache : _cache_tensors)
+  {
+    // Updated cache becomes input of next step
+    // Input shape is changed only if it differs, so fixed-size cache does not trigger
+    // dynamic shape inference
+    const auto output_shape = _execution->getOutputShape(onert::ir::IOIndex{cache.output_index});
+    _execution->changeInputShape(onert::ir::IOIndex{cache.input_index}, output_shape);
+    cache.input_buffer ^= 1;
+  }
+
+  bindCacheTensors();
+}
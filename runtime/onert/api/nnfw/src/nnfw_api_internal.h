@@ -20,6 +20,7 @@
 #include "nnfw.h"
 #include "nnfw_experimental.h"
 
+#include <ir/Shape.h>
 #include <util/TracingCtx.h>
 
 #include <string>
@@ -37,6 +38,8 @@ namespace exec
 {
 class Execution;
 struct ExecutionOptions;
+class PipelineExecution;
+class BatchingExecution;
 } // namespace exec
 namespace ir
 {
@@ -170,6 +173,10 @@ public:
    */
   NNFW_STATUS set_backends_per_operation(const char *backend_settings);
 
+  NNFW_STATUS prepare_pipeline(const char *map_file_path);
+  NNFW_STATUS push_pipeline_input(void *inputs, void *lengths);
+  NNFW_STATUS pop_pipeline_output(void *outputs);
+
   NNFW_STATUS train_get_traininfo(nnfw_train_info *info);
   NNFW_STATUS train_set_traininfo(const nnfw_train_info *info);
   NNFW_STATUS train_prepare();
@@ -199,6 +206,16 @@ public:
   NNFW_STATUS set_execute_config(const NNFW_RUN_CONFIG key, const char *value);
   NNFW_STATUS reset_execute_config();
 
+  NNFW_STATUS set_cache_tensor(uint32_t input_index, uint32_t output_index,
+                               const nnfw_tensorinfo *max_info);
+  NNFW_STATUS reset_cache_tensors();
+
+  NNFW_STATUS create_execution_context(nnfw_session **context);
+
+  NNFW_STATUS prepare_batching(uint32_t max_batch_size, uint32_t window_us);
+  NNFW_STATUS run_batched(const void **inputs, void **outputs);
+  NNFW_STATUS get_batching_stats(nnfw_batching_stats *stats);
+
 private:
   const onert::ir::IGraph *primary_subgraph();
   uint32_t getInputSize();
@@ -215,12 +232,33 @@ private:
   bool isStateFinishedTraining();
   bool isStatePreparedOrFinishedTraining();
 
+  void bindCacheTensors();
+  void rotateCacheTensors();
+
+private:
+  /**
+   * @brief Persistent cache tensor pair kept resident between runs
+   *
+   * Two reserved buffers are used in turn: one is bound to input (cache of previous steps)
+   * and the other is bound to output (updated cache). They are swapped after each run.
+   */
+  struct CacheTensor
+  {
+    uint32_t input_index;
+    uint32_t output_index;
+    onert::ir::Shape initial_shape;
+    std::vector<uint8_t> buffers[2];
+    uint32_t input_buffer; //< Index of buffer bound to input
+  };
+
 private:
   State _state{State::INITIALIZED};
   std::shared_ptr<onert::ir::NNPkg> _nnpkg;
   std::unique_ptr<onert::compiler::CompilerOptions> _coptions;
   std::shared_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
   std::unique_ptr<onert::exec::Execution> _execution;
+  std::unique_ptr<onert::exec::PipelineExecution> _pipeline;
+  std::unique_ptr<onert::exec::BatchingExecution> _batching;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
   std::vector<std::thread> _threads;
   std::unique_ptr<onert::ir::train::TrainingInfo> _train_info;
@@ -236,6 +274,7 @@ private:
   //     const uint8 *buf;
   //   }
   std::string _model_path;
+  std::vector<CacheTensor> _cache_tensors;
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
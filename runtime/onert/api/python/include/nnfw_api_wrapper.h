@@ -19,6 +19,9 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
+#include <memory>
+#include <vector>
+
 namespace py = pybind11;
 
 /**
@@ -113,6 +116,15 @@ class NNFW_SESSION
 {
 private:
   nnfw_session *session;
+  // Buffers bound by set_input/set_output. Holding buffer_info keeps the buffer object alive and
+  // its memory exported (not resizable) while the runtime refers to it.
+  std::vector<std::unique_ptr<py::buffer_info>> bound_inputs;
+  std::vector<std::unique_ptr<py::buffer_info>> bound_outputs;
+  // Buffer objects bound by set_output, which become bases of views from get_output
+  std::vector<py::object> bound_output_objects;
+  // Buffers owned by session for outputs not bound by set_output. Each view from get_output
+  // shares the block, so a block replaced by larger one is freed only after its last view.
+  std::vector<std::shared_ptr<std::vector<uint8_t>>> owned_outputs;
 
 public:
   NNFW_SESSION(const char *package_file_path, const char *backends);
@@ -124,33 +136,24 @@ public:
   void run_async();
   void wait();
   /**
-   * @brief   process input array according to data type of numpy array sent by Python
-   *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
+   * @brief   Bind memory of buffer-protocol object (ex. contiguous numpy array) to input
+   *          without copy if its data type is the same as the input of model.
+   * @note    Other objects (ex. list, float64 array) are converted to a new array, which session
+   *          keeps while it is bound.
+   */
+  void set_input(uint32_t index, const py::object &buffer);
+  /**
+   * @brief   Bind memory of writable buffer-protocol object to output without copy.
+   *          Data type of buffer must be the same as the output of model.
    */
-  template <typename T> void set_input(uint32_t index, py::array_t<T> &buffer)
-  {
-    nnfw_tensorinfo tensor_info;
-    nnfw_input_tensorinfo(this->session, index, &tensor_info);
-    NNFW_TYPE type = tensor_info.dtype;
-    uint32_t input_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * input_elements;
-
-    ensure_status(nnfw_set_input(session, index, type, buffer.request().ptr, length));
-  }
+  void set_output(uint32_t index, const py::buffer &buffer);
   /**
-   * @brief   process output array according to data type of numpy array sent by Python
-   *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
+   * @brief   Get numpy view over output buffer with current output shape
+   * @note    Output buffer not bound by set_output is owned by session, and it is overwritten by
+   *          next run. If the output grows, session moves to a new buffer and the view keeps
+   *          the old one with the previous result.
    */
-  template <typename T> void set_output(uint32_t index, py::array_t<T> &buffer)
-  {
-    nnfw_tensorinfo tensor_info;
-    nnfw_output_tensorinfo(this->session, index, &tensor_info);
-    NNFW_TYPE type = tensor_info.dtype;
-    uint32_t output_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * output_elements;
-
-    ensure_status(nnfw_set_output(session, index, type, buffer.request().ptr, length));
-  }
+  py::array get_output(uint32_t index);
   uint32_t input_size();
   uint32_t output_size();
   // process the input layout by receiving a string from Python instead of NNFW_LAYOUT
@@ -159,4 +162,8 @@ public:
   void set_output_layout(uint32_t index, const char *layout);
   tensorinfo input_tensorinfo(uint32_t index);
   tensorinfo output_tensorinfo(uint32_t index);
+
+private:
+  py::buffer_info request_buffer(const py::buffer &buffer, NNFW_TYPE type, bool writable);
+  void bind_owned_outputs();
 };
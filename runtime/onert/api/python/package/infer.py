@@ -23,11 +23,14 @@ class session(libnnfw_api_pybind.nnfw_session):
 
     def set_inputs(self, size, inputs_array=[]):
         """Set inputs for each index"""
+        self.inputs = []
         for i in range(size):
             input_tensorinfo = self.input_tensorinfo(i)
 
             if len(inputs_array) > i:
-                input_array = np.array(inputs_array[i], dtype=input_tensorinfo.dtype)
+                # No copy if given array is already contiguous and of input's dtype
+                input_array = np.ascontiguousarray(inputs_array[i],
+                                                   dtype=input_tensorinfo.dtype)
             else:
                 print(
                     f"model's input size is {size} but given inputs_array size is {len(inputs_array)}.\n{i}-th index input is replaced by an array filled with 0."
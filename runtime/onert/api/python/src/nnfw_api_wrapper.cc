@@ -17,6 +17,8 @@
 #include "nnfw_api_wrapper.h"
 
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 void ensure_status(NNFW_STATUS status)
 {
@@ -155,6 +157,25 @@ void set_dims(tensorinfo &tensor_info, const py::list &array)
   }
 }
 
+namespace
+{
+
+py::dtype get_dtype(NNFW_TYPE type) { return py::dtype::from_args(py::str(getStringType(type))); }
+
+bool is_c_contiguous(const py::buffer_info &info)
+{
+  py::ssize_t stride = info.itemsize;
+  for (py::ssize_t i = info.ndim - 1; i >= 0; --i)
+  {
+    if (info.shape[i] != 1 && info.strides[i] != stride)
+      return false;
+    stride *= info.shape[i];
+  }
+  return true;
+}
+
+} // namespace
+
 NNFW_SESSION::NNFW_SESSION(const char *package_file_path, const char *backends)
 {
   this->session = nullptr;
@@ -162,6 +183,10 @@ NNFW_SESSION::NNFW_SESSION(const char *package_file_path, const char *backends)
   ensure_status(nnfw_load_model_from_file(this->session, package_file_path));
   ensure_status(nnfw_set_available_backends(this->session, backends));
   ensure_status(nnfw_prepare(this->session));
+  bound_inputs.resize(input_size());
+  bound_outputs.resize(output_size());
+  bound_output_objects.resize(output_size());
+  owned_outputs.resize(output_size());
 }
 NNFW_SESSION::~NNFW_SESSION()
 {
@@ -187,8 +212,91 @@ void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor
   }
   ensure_status(nnfw_set_input_tensorinfo(session, index, &ti));
 }
-void NNFW_SESSION::run() { ensure_status(nnfw_run(session)); }
-void NNFW_SESSION::run_async() { ensure_status(nnfw_run_async(session)); }
+void NNFW_SESSION::run()
+{
+  bind_owned_outputs();
+  ensure_status(nnfw_run(session));
+}
+void NNFW_SESSION::run_async()
+{
+  bind_owned_outputs();
+  ensure_status(nnfw_run_async(session));
+}
+py::buffer_info NNFW_SESSION::request_buffer(const py::buffer &buffer, NNFW_TYPE type,
+                                             bool writable)
+{
+  py::buffer_info info = buffer.request(writable);
+  const std::string expected = getStringType(type);
+  const auto actual = py::str(py::dtype(info).attr("name")).cast<std::string>();
+  if (actual != expected)
+    throw std::invalid_argument("buffer dtype must be " + expected + ", but " + actual);
+  if (!is_c_contiguous(info))
+    throw std::invalid_argument("buffer must be C-contiguous");
+  return info;
+}
+void NNFW_SESSION::set_input(uint32_t index, const py::object &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_input_tensorinfo(session, index, &tensor_info));
+  // Lists and arrays of other dtype or layout are converted to a new array as before. The array is
+  // kept by buffer_info below. Buffers that already match are bound without copy.
+  const py::buffer array = py::module_::import("numpy").attr("ascontiguousarray")(
+    buffer, get_dtype(tensor_info.dtype));
+  auto info = std::make_unique<py::buffer_info>(request_buffer(array, tensor_info.dtype, false));
+  const size_t length = info->size * info->itemsize;
+
+  ensure_status(nnfw_set_input(session, index, tensor_info.dtype, info->ptr, length));
+  bound_inputs.at(index) = std::move(info);
+}
+void NNFW_SESSION::set_output(uint32_t index, const py::buffer &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_output_tensorinfo(session, index, &tensor_info));
+  auto info = std::make_unique<py::buffer_info>(request_buffer(buffer, tensor_info.dtype, true));
+  const size_t length = info->size * info->itemsize;
+
+  ensure_status(nnfw_set_output(session, index, tensor_info.dtype, info->ptr, length));
+  bound_outputs.at(index) = std::move(info);
+  bound_output_objects.at(index) = buffer;
+}
+void NNFW_SESSION::bind_owned_outputs()
+{
+  for (uint32_t index = 0; index < owned_outputs.size(); ++index)
+  {
+    if (bound_outputs[index])
+      continue;
+
+    nnfw_tensorinfo tensor_info;
+    ensure_status(nnfw_output_tensorinfo(session, index, &tensor_info));
+    const size_t length = num_elems(&tensor_info) * get_dtype(tensor_info.dtype).itemsize();
+    // Keep the buffer unless it grows, so that views from get_output see the next results.
+    // Never resize it in place because views may still refer to it.
+    auto &buffer = owned_outputs[index];
+    if (!buffer || buffer->size() < length)
+      buffer = std::make_shared<std::vector<uint8_t>>(length);
+    ensure_status(
+      nnfw_set_output(session, index, tensor_info.dtype, buffer->data(), buffer->size()));
+  }
+}
+py::array NNFW_SESSION::get_output(uint32_t index)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_output_tensorinfo(session, index, &tensor_info));
+  const auto dtype = get_dtype(tensor_info.dtype);
+  std::vector<py::ssize_t> shape(tensor_info.dims, tensor_info.dims + tensor_info.rank);
+
+  // The base of view owns the buffer, so that the buffer outlives the view
+  if (bound_outputs.at(index))
+    return py::array(dtype, shape, bound_outputs[index]->ptr, bound_output_objects[index]);
+
+  const auto &buffer = owned_outputs.at(index);
+  if (!buffer || buffer->size() < num_elems(&tensor_info) * dtype.itemsize())
+    throw std::runtime_error("output " + std::to_string(index) + " is not ready, run first");
+
+  using Block = std::shared_ptr<std::vector<uint8_t>>;
+  py::capsule base(new Block(buffer), [](void *p) { delete static_cast<Block *>(p); });
+  return py::array(dtype, shape, buffer->data(), base);
+}
 void NNFW_SESSION::wait() { ensure_status(nnfw_await(session)); }
 uint32_t NNFW_SESSION::input_size()
 {
@@ -51,146 +51,27 @@ PYBIND11_MODULE(libnnfw_api_pybind, m)
     .def("run", &NNFW_SESSION::run, "Run inference")
     .def("run_async", &NNFW_SESSION::run_async, "Run inference asynchronously")
     .def("wait", &NNFW_SESSION::wait, "Wait for asynchronous run to finish")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
-        session.set_input<float>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
-        session.set_input<int>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
-        session.set_input<uint8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
-        session.set_input<bool>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
-        session.set_input<int64_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
-        session.set_input<int8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
-        session.set_input<int16_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
-        session.set_output<float>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
-        session.set_output<int>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
-        session.set_output<uint8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
-        session.set_output<bool>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
-        session.set_output<int64_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
-        session.set_output<int8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
-        session.set_output<int16_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+    .def("set_input", &NNFW_SESSION::set_input, py::arg("index"), py::arg("buffer"),
+         "Set input buffer. The buffer is referred to until it is replaced.\n"
+         "C-contiguous buffer of input's dtype is bound without copy, and others (ex. list, "
+         "float64 array) are converted to a new array.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of input to be set (0-indexed)\n"
+         "\tbuffer (numpy): Array-like object for input")
+    .def("set_output", &NNFW_SESSION::set_output, py::arg("index"), py::arg("buffer"),
+         "Set output buffer without copy. The buffer is referred to until it is replaced.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of output to be set (0-indexed)\n"
+         "\tbuffer (numpy): Writable C-contiguous buffer of output's dtype (buffer protocol "
+         "object)")
+    .def("get_output", &NNFW_SESSION::get_output, py::arg("index"),
+         "Get numpy view over output buffer without copy\n"
+         "Output not set by set_output is written to a buffer owned by session, and the view is "
+         "overwritten by next run. If output size grows, the view keeps the previous result.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of output (0-indexed)\n"
+         "Returns:\n"
+         "\tnumpy.ndarray: View over output buffer with current output shape")
     .def("input_size", &NNFW_SESSION::input_size,
          "Get the number of inputs defined in loaded model\n"
          "Returns:\n"
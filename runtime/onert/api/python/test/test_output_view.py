@@ -0,0 +1,119 @@
+# Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Tests of buffers bound to session and views from get_output
+
+Usage: PYTHONPATH=<install>/lib python3 -m unittest discover -s <install>/test/python
+       or 'onert-test python-test' in installed test package
+"""
+
+import gc
+import os
+import tempfile
+import unittest
+
+import numpy as np
+
+try:
+    from onert.native import libnnfw_api_pybind
+except ImportError:
+    import libnnfw_api_pybind
+
+# Circle model of 'out = in + in' with float32 input and output of shape [1, 4]
+ADD_CIRCLE = bytes.fromhex(
+    "0800000043495230beffffff03000000280000001c0000001000000004000000"
+    "0100000008010000000000000000000001000000240000000100000008000000"
+    "040006000400000000000e001800040008000c00100014000e00000038000000"
+    "2c000000200000001400000004000000040000006d61696e0000000001000000"
+    "3000000001000000010000000100000000000000020000007000000040000000"
+    "00000e001400000008000c00070010000e0000000000000b1400000008000000"
+    "180000000100000001000000020000000000000000000000b0ffffffe0ffffff"
+    "1000000004000000030000006f7574000200000001000000040000000c000c00"
+    "04000000000008000c000000100000000400000002000000696e000002000000"
+    "01000000040000000400040004000000")
+
+
+class OutputViewTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.model_dir = tempfile.TemporaryDirectory()
+        cls.model_path = os.path.join(cls.model_dir.name, "add.circle")
+        with open(cls.model_path, "wb") as f:
+            f.write(ADD_CIRCLE)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.model_dir.cleanup()
+
+    def new_session(self):
+        return libnnfw_api_pybind.nnfw_session(self.model_path, "cpu")
+
+    def test_owned_output_view(self):
+        sess = self.new_session()
+        sess.set_input(0, np.full(4, 1, dtype=np.float32))
+        sess.run()
+        view = sess.get_output(0)
+        np.testing.assert_array_equal(view, [[2, 2, 2, 2]])
+
+        # The view refers to the buffer which the next run writes to
+        sess.set_input(0, np.full(4, 2, dtype=np.float32))
+        sess.run()
+        np.testing.assert_array_equal(view, [[4, 4, 4, 4]])
+
+        # The view keeps its buffer alive after session is gone
+        del sess
+        gc.collect()
+        np.testing.assert_array_equal(view, [[4, 4, 4, 4]])
+
+    def test_bound_output_view(self):
+        sess = self.new_session()
+        output = np.zeros(4, dtype=np.float32)
+        sess.set_output(0, output)
+
+        sess.set_input(0, np.array([1, 2, 3, 4], dtype=np.float32))
+        sess.run()
+        view = sess.get_output(0)
+        self.assertTrue(np.shares_memory(view, output))
+        np.testing.assert_array_equal(output, [2, 4, 6, 8])
+
+        # The view keeps the bound buffer alive after it is replaced and dropped
+        sess.set_output(0, np.zeros_like(output))
+        del output
+        gc.collect()
+        np.testing.assert_array_equal(view, [[2, 4, 6, 8]])
+
+    def test_input_conversion(self):
+        # Lists and float64 arrays are converted to float32 input
+        sess = self.new_session()
+        sess.set_input(0, [1, 2, 3, 4])
+        sess.run()
+        np.testing.assert_array_equal(sess.get_output(0), [[2, 4, 6, 8]])
+
+        sess.set_input(0, np.array([0.5, 1.5, 2.5, 3.5], dtype=np.float64))
+        sess.run()
+        np.testing.assert_array_equal(sess.get_output(0), [[1, 3, 5, 7]])
+
+        # Non-contiguous array is copied to a contiguous one
+        sess.set_input(0, np.arange(8, dtype=np.float32)[::2])
+        sess.run()
+        np.testing.assert_array_equal(sess.get_output(0), [[0, 4, 8, 12]])
+
+    def test_neg_output_dtype(self):
+        # Output is written to the bound buffer, so it is never converted
+        sess = self.new_session()
+        with self.assertRaises(ValueError):
+            sess.set_output(0, np.zeros(4, dtype=np.float64))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -65,8 +65,7 @@ public:
       this->tensor_builder->registerTensorInfo(ind, backend_info);
     });
 
-    // TODO Get compiler options from compiler, and use it rather than getting it from Env
-    if (util::getConfigString(util::config::EXECUTOR) == "Linear")
+    if (this->data().is_linear_executor)
     {
       this->planTensors();
     }
@@ -97,6 +97,8 @@ namespace acl_common
       return ::arm_compute::DataType::S64;
     case ir::DataType::QUANT_INT16_ASYMM:
       return ::arm_compute::DataType::QASYMM16;
+    case ir::DataType::QUANT_INT16_SYMM:
+      return ::arm_compute::DataType::QSYMM16;
     case ir::DataType::QUANT_INT8_SYMM_PER_CHANNEL:
       return ::arm_compute::DataType::QSYMM8_PER_CHANNEL;
     default:
@@ -31,7 +31,50 @@ namespace backend
 namespace cpu
 {
 
-ITensorRegistry *BackendContext::genTensors() { return basic::genTensors(*this); }
+ITensorRegistry *BackendContext::genTensors()
+{
+  registerViewAliases();
+  return basic::genTensors(*this);
+}
+
+void BackendContext::registerViewAliases()
+{
+  const ir::Graph &graph = *_data.graph;
+
+  // Output of view-only operation shares the buffer of its input, so that the kernel does not
+  // copy the input and the arena does not have another live buffer for the output.
+  for (auto &&op_ind : _data.op_order)
+  {
+    const auto &op = graph.operations().at(op_ind);
+    const auto opcode = op.opcode();
+    if (opcode != ir::OpCode::Reshape && opcode != ir::OpCode::Squeeze &&
+        opcode != ir::OpCode::ExpandDims)
+      continue;
+
+    const auto input_index = op.getInputs().at(0);
+    const auto output_index = op.getOutputs().at(0);
+    if (!input_index.valid() || !output_index.valid() || input_index == output_index)
+      continue;
+
+    const auto &input = graph.operands().at(input_index);
+    const auto &output = graph.operands().at(output_index);
+    auto is_planned = [&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+      return !external_operands().contains(ind) && !graph.getInputs().contains(ind) &&
+             !graph.getOutputs().contains(ind) && !operand.isConstant() &&
+             !operand.info().isVariable() && !operand.info().isDynamic();
+    };
+    if (!is_planned(input_index, input) || !is_planned(output_index, output))
+      continue;
+
+    if (input.getUses().size() != 1 || input.typeInfo() != output.typeInfo() ||
+        input.info().total_size() != output.info().total_size())
+      continue;
+
+    VERBOSE(BackendContext) << "Alias " << output_index << " to " << input_index << " ("
+                            << op.name() << ")" << std::endl;
+    tensor_builder->registerAlias(output_index, input_index);
+  }
+}
 
 FunctionMap BackendContext::genKernels()
 {
@@ -46,6 +46,9 @@ public:
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
 
+private:
+  void registerViewAliases();
+
 public:
   // TODO Make it private
   std::shared_ptr<TensorBuilder> tensor_builder;
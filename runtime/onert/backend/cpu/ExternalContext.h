@@ -18,9 +18,11 @@
 #define __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/PerThread.h>
 #include <ruy/context.h>
 #include <ggml.h>
 
+#include <atomic>
 #include <memory>
 
 namespace onert
@@ -36,7 +38,7 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(new ruy::Context)
+  ExternalContext()
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::NUM_THREADS));
   }
@@ -45,9 +47,13 @@ public:
   {
     const int target_num_threads =
       max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads.store(target_num_threads, std::memory_order_relaxed);
+    _ruy_contexts.forEach(
+      [&](ruy::Context *ruy_context) { ruy_context->set_max_num_threads(target_num_threads); });
   }
 
+  int maxNumThreads() const { return _max_num_threads.load(std::memory_order_relaxed); }
+
   void initGgmlContext()
   {
     if (_ggml_context == nullptr)
@@ -55,10 +61,25 @@ public:
         ggml_init({.mem_size = 0, .mem_buffer = nullptr, .no_alloc = true}), &ggml_free);
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  /**
+   * @brief Get the ruy context of the calling thread
+   *
+   * A ruy context must not be used by several threads at once, and ParallelExecutor or
+   * execution contexts may run kernels of one backend on several threads. So each thread gets
+   * its own context, which is created on its first call and found without lock after that.
+   */
+  ruy::Context *ruy_context() const
+  {
+    return _ruy_contexts.get([&]() {
+      auto ruy_context = std::make_unique<ruy::Context>();
+      ruy_context->set_max_num_threads(maxNumThreads());
+      return ruy_context;
+    });
+  }
 
 private:
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  std::atomic<int> _max_num_threads{kDefaultNumThreadpoolThreads};
+  util::PerThread<ruy::Context> _ruy_contexts;
   std::unique_ptr<ggml_context, decltype(&ggml_free)> _ggml_context{nullptr, &ggml_free};
 };
 
@@ -49,6 +49,8 @@
 #include "ops/ReshapeLayer.h"
 #include "ops/ResizeBilinearLayer.h"
 #include "ops/ReverseLayer.h"
+#include "ops/RmsNormLayer.h"
+#include "ops/RoPELayer.h"
 #include "ops/SelectLayer.h"
 #include "ops/ShapeLayer.h"
 #include "ops/SliceLayer.h"
@@ -314,7 +316,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor, is_cacheable_weights);
+                  activation, ofm_tensor, is_cacheable_weights, _external_context);
 
     _return_fn = std::move(fn);
     return;
@@ -333,7 +335,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -390,7 +392,7 @@ void KernelGenerator::visit(const ir::operation::Concat &node)
 
   auto fn = std::make_unique<ops::ConcatLayer>();
 
-  fn->configure(input_tensors, axis, output_tensor);
+  fn->configure(input_tensors, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -512,7 +514,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -532,7 +534,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -800,7 +802,7 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -820,7 +822,7 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
 
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -829,7 +831,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -952,7 +955,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -965,11 +968,12 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
     }
   }
 
@@ -993,6 +997,49 @@ void KernelGenerator::visit(const ir::operation::Reverse &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::RmsNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::RmsNorm::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::RmsNorm::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::RmsNorm::BETA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+  const auto epsilon = node.param().epsilon;
+
+  auto fn = std::make_unique<ops::RmsNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, epsilon, output_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RoPE &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::RoPE::INPUT)};
+  const auto sin_index{node.getInputs().at(ir::operation::RoPE::SIN_TABLE)};
+  const auto cos_index{node.getInputs().at(ir::operation::RoPE::COS_TABLE)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto sin_tensor = _tensor_reg->getPortableTensor(sin_index);
+  auto cos_tensor = _tensor_reg->getPortableTensor(cos_index);
+  const auto mode = node.param().mode == ir::operation::RoPE::RoPEMode::GPT_J
+                      ? nnfw::cker::RoPEMode::kGptJ
+                      : nnfw::cker::RoPEMode::kGptNeox;
+
+  auto fn = std::make_unique<ops::RoPELayer>();
+
+  fn->configure(input_tensor, sin_tensor, cos_tensor, mode, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::ArgMinMax &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1211,7 +1258,7 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
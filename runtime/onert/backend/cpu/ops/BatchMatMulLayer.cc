@@ -16,6 +16,8 @@
 
 #include "BatchMatMulLayer.h"
 
+#include "GGMLHelper.h"
+
 #include <cker/operation/BatchMatMul.h>
 
 namespace onert
@@ -29,7 +31,7 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-    _kernel(new nnfw::cker::BatchMatMul())
+    _output_multiplier(0), _output_shift(0), _kernel(new nnfw::cker::BatchMatMul())
 {
   // DO NOTHING
 }
@@ -47,11 +49,77 @@ void BatchMatMulLayer::batchMatMulFloat32()
 
   batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
   batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, getBuffer<float>(_rhs), _adj_x,
-                     _adj_y, output_shape, getBuffer<float>(_output));
+                     _adj_y, output_shape, getBuffer<float>(_output),
+                     _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::batchMatMulFloat16()
+{
+  nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
+  nnfw::cker::Shape lhs_shape = getShape(_lhs);
+  nnfw::cker::Shape rhs_shape = getShape(_rhs);
+  nnfw::cker::Shape output_shape = getShape(_output);
+
+  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
+  batchmatmul_kernel(lhs_shape, getBuffer<nnfw::cker::Float16>(_lhs), rhs_shape,
+                     getBuffer<nnfw::cker::Float16>(_rhs), _adj_x, _adj_y, output_shape,
+                     getBuffer<nnfw::cker::Float16>(_output), _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::batchMatMulQuant8()
+{
+  nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
+  nnfw::cker::Shape lhs_shape = getShape(_lhs);
+  nnfw::cker::Shape rhs_shape = getShape(_rhs);
+  nnfw::cker::Shape output_shape = getShape(_output);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_lhs->data_zero_point();
+  op_params.weights_offset = -_rhs->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = std::numeric_limits<int8_t>::min();
+  op_params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+
+  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
+  batchmatmul_kernel(op_params, lhs_shape, getBuffer<int8_t>(_lhs), rhs_shape,
+                     getBuffer<int8_t>(_rhs), _adj_x, _adj_y, output_shape,
+                     getBuffer<int8_t>(_output), _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::batchMatMulGGMLWeight()
+{
+  // Supporting condition
+  // LHS: FLOAT32, [..., M, K], not adjointed
+  // RHS: GGML block quantized (Q4_0, Q8_0) constant, [..., N, K], adjointed
+  //      batch dimensions of LHS should be multiple of RHS's (broadcasting RHS only)
+  // Output: FLOAT32, [..., M, N]
+  if (_adj_x || !_adj_y)
+    throw std::runtime_error{"BatchMatMul: GGML weights requires adj_x = false, adj_y = true"};
+
+  // ggml's mul_mat computes dst[b][m][n] = sum_k(src0[b'][n][k] * src1[b][m][k]),
+  // broadcasting src0 over batch dimensions
+  auto rhs = getGGMLTensor(_rhs);
+  auto lhs = getGGMLTensor(_lhs);
+  auto output = getGGMLTensor(_output);
+  for (int i = 2; i < GGML_MAX_DIMS; ++i)
+  {
+    if (output.ne[i] != lhs.ne[i] || lhs.ne[i] % rhs.ne[i] != 0)
+      throw std::runtime_error{"BatchMatMul: GGML weights cannot be broadcasted to lhs"};
+  }
+  {
+    output.op = GGML_OP_MUL_MAT;
+    output.src[0] = &rhs;
+    output.src[1] = &lhs;
+  }
+
+  computeGGMLNode(&output, _external_context->maxNumThreads(), _ggml_work_buf);
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -62,6 +130,19 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _external_context = external_context;
+
+  if (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+      _rhs->data_type() == OperandType::QUANT_GGML_Q8_0)
+    _external_context->initGgmlContext();
+
+  if (_output->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Scales do not change over runs, so quantize the output multiplier once
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_lhs, _rhs, nullptr, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+  }
 }
 
 void BatchMatMulLayer::run()
@@ -70,6 +151,25 @@ void BatchMatMulLayer::run()
   {
     batchMatMulFloat32();
   }
+  else if ((_lhs->data_type() == OperandType::FLOAT16) &&
+           (_rhs->data_type() == OperandType::FLOAT16) &&
+           (_output->data_type() == OperandType::FLOAT16))
+  {
+    batchMatMulFloat16();
+  }
+  else if ((_lhs->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+           (_rhs->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+           (_output->data_type() == OperandType::QUANT_INT8_ASYMM))
+  {
+    batchMatMulQuant8();
+  }
+  else if ((_lhs->data_type() == OperandType::FLOAT32) &&
+           (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+            _rhs->data_type() == OperandType::QUANT_GGML_Q8_0) &&
+           (_output->data_type() == OperandType::FLOAT32))
+  {
+    batchMatMulGGMLWeight();
+  }
   else
   {
     throw std::runtime_error{"BatchMatMul: unsupported data type"};
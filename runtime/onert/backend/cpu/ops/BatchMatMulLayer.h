@@ -19,9 +19,12 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -47,9 +50,12 @@ public:
 
 public:
   void batchMatMulFloat32();
+  void batchMatMulFloat16();
+  void batchMatMulQuant8();
+  void batchMatMulGGMLWeight();
 
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -61,7 +67,13 @@ private:
   bool _adj_x;
   bool _adj_y;
 
+  int32_t _output_multiplier;
+  int _output_shift;
+
   std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
+
+  std::vector<uint8_t> _ggml_work_buf; // work buffer for ggml kernel, reused over runs
 };
 
 } // namespace ops
@@ -37,10 +37,13 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
   nnfw::cker::Shape _output_shape;
   nnfw::cker::BinaryArithmeticOpParam _op_params;
   bool _need_broadcast;
+  const ExternalContext *_external_context;
 
   Eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-       nnfw::cker::BinaryArithmeticOpParam op_params)
-    : _op_params(std::move(op_params)), _need_broadcast(false)
+       nnfw::cker::BinaryArithmeticOpParam op_params,
+       const ExternalContext *external_context)
+    : _op_params(std::move(op_params)), _need_broadcast(false),
+      _external_context(external_context)
   {
     if (!output->is_dynamic())
       updateCache(lhs, rhs, output);
@@ -68,13 +71,15 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     auto output_buffer = getBuffer<T>(output);
     if (_need_broadcast)
     {
-      nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+      nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type, T>(
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        _external_context->ruy_context());
     }
     else
     {
-      nnfw::cker::BinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+      nnfw::cker::BinaryArithmeticOp<arithmetic_type, T>(
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        _external_context->ruy_context());
     }
   }
 };
@@ -83,7 +88,8 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
-                      nnfw::cker::BinaryArithmeticOpParam &op_params)
+                      nnfw::cker::BinaryArithmeticOpParam &op_params,
+                      const ExternalContext *external_context)
 {
   switch (lhs->data_type())
   {
@@ -93,7 +99,18 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.float_activation_max = output_activation_max;
       op_params.float_activation_min = output_activation_min;
-      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params, external_context);
+      break;
+    }
+    case OperandType::FLOAT16:
+    {
+      // fp16 operands are computed in fp32, so the float activation range applies
+      float output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
+      op_params.float_activation_max = output_activation_max;
+      op_params.float_activation_min = output_activation_min;
+      return Eval<arithmetic_type, nnfw::cker::Float16>(lhs, rhs, output, op_params,
+                                                        external_context);
       break;
     }
     case OperandType::INT32:
@@ -102,7 +119,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.quantized_activation_max = output_activation_max;
       op_params.quantized_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params, external_context);
       break;
     }
     case OperandType::INT64:
@@ -111,7 +128,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.int64_activation_max = output_activation_max;
       op_params.int64_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int64_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int64_t>(lhs, rhs, output, op_params, external_context);
       break;
     }
     case OperandType::BOOL8:
@@ -122,7 +139,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       int32_t output_activation_min = 0, output_activation_max = 0;
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       static_assert(sizeof(bool) == 1, "cpu backend supports bool type which is 1 byte");
-      return Eval<arithmetic_type, bool>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, bool>(lhs, rhs, output, op_params, external_context);
       break;
     }
     default:
@@ -130,9 +147,10 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
   }
 }
 
+// int16 operands use a left_shift of 15 instead of 20 so the shifted values still fit in int32
 void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
                              IPortableTensor *output, ir::Activation activation,
-                             nnfw::cker::BinaryArithmeticOpParam *params)
+                             nnfw::cker::BinaryArithmeticOpParam *params, int left_shift = 20)
 {
   int32_t output_activation_min, output_activation_max;
   CalculateActivationRangeQuantized(activation, output, &output_activation_min,
@@ -141,7 +159,7 @@ void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *
   op_params.quantized_activation_max = output_activation_max;
   op_params.quantized_activation_min = output_activation_min;
   // Parameters for scaled quantized computation
-  op_params.left_shift = 20;
+  op_params.left_shift = left_shift;
   // Zero-points of input and output tensors
   op_params.input1_offset = -lhs->data_zero_point();
   op_params.input2_offset = -rhs->data_zero_point();
@@ -185,7 +203,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -194,6 +213,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   _lhs = lhs;
   _rhs = rhs;
   _output = output;
+  _external_context = external_context;
 
   nnfw::cker::BinaryArithmeticOpParam op_params;
   switch (arithmetic_type)
@@ -202,20 +222,25 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
+      }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params, 15);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int16_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
       }
-
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context.get());
       }
       break;
     case ArithmeticType::kSub:
@@ -223,21 +248,27 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
+      }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params, 15);
+        op_params.input2_multiplier *= -1;
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int16_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
       }
-
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::SUB>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context.get());
       }
       break;
     case ArithmeticType::kMul:
@@ -245,27 +276,34 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
+      }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        nnfw::cker::BinaryArithmeticOpParam op_params;
+        setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int16_t>(
+          _lhs, _rhs, _output, op_params, _external_context.get());
       }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context.get());
       }
       break;
     case ArithmeticType::kDiv:
-      if (_lhs->data_type() == OperandType::FLOAT32)
+      if (_lhs->data_type() == OperandType::FLOAT32 || _lhs->data_type() == OperandType::FLOAT16)
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context.get());
       }
       else
       {
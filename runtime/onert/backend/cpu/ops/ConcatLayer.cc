@@ -29,7 +29,7 @@ namespace cpu
 namespace ops
 {
 
-ConcatLayer::ConcatLayer() : _inputs(), _output(nullptr), _axis(0)
+ConcatLayer::ConcatLayer() : _inputs(), _output(nullptr), _axis(0), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -61,7 +61,8 @@ template <typename T> void ConcatLayer::concatenationGeneral()
   }
 
   nnfw::cker::Concatenation<T>(op_params, inputDimsPtr.data(), inputDataPtrs.data(),
-                               getShape(_output), getBuffer<T>(_output));
+                               getShape(_output), getBuffer<T>(_output),
+                               _external_context->ruy_context());
 }
 void ConcatLayer::concatenationQuant8()
 {
@@ -104,7 +105,8 @@ void ConcatLayer::concatenationQuant8()
 }
 
 void ConcatLayer::configure(const std::vector<const IPortableTensor *> &inputs, int32_t axis,
-                            IPortableTensor *output)
+                            IPortableTensor *output,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(inputs.size() > 0);
   assert(output != nullptr);
@@ -112,6 +114,7 @@ void ConcatLayer::configure(const std::vector<const IPortableTensor *> &inputs,
   _inputs = inputs;
   _axis = axis;
   _output = output;
+  _external_context = external_context;
 }
 
 void ConcatLayer::run()
@@ -35,8 +35,8 @@ ConvolutionLayer::ConvolutionLayer()
     _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
     _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
     _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-    _conv_kernel(new nnfw::cker::Conv()), _prepare(false), _is_cachable_weights(false),
-    _is_hybrid(false)
+    _conv_kernel(new nnfw::cker::Conv()), _external_context(nullptr), _prepare(false),
+    _is_cachable_weights(false), _is_hybrid(false)
 {
   // DO NOTHING
 }
@@ -65,6 +65,29 @@ void ConvolutionLayer::convFloat32()
          getBuffer<float>(_output));
 }
 
+void ConvolutionLayer::convFloat16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<nnfw::cker::Float16>(_input), getShape(_kernel),
+         getBuffer<nnfw::cker::Float16>(_kernel), getShape(_bias),
+         getBuffer<nnfw::cker::Float16>(_bias), getShape(_output),
+         getBuffer<nnfw::cker::Float16>(_output), _external_context->ruy_context());
+}
+
 void ConvolutionLayer::convQ8uPerTensor()
 {
   int32_t output_activation_min = 0;
@@ -202,7 +225,8 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
                                  const ir::Activation activation, IPortableTensor *output,
-                                 bool is_cachable_weights)
+                                 bool is_cachable_weights,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -219,6 +243,7 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _activation = activation;
   _output = output;
   _is_cachable_weights = is_cachable_weights;
+  _external_context = external_context;
   _is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
                _kernel->data_type() == OperandType::QUANT_INT8_SYMM;
 }
@@ -263,6 +288,10 @@ void ConvolutionLayer::run()
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     const bool per_channel_quantized = _kernel->data_scales().size() > 1;
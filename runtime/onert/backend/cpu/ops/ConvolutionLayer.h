@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <functional>
@@ -56,12 +57,14 @@ public:
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t dilationWidthFactor,
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
-                 IPortableTensor *output, bool is_cachable_weights);
+                 IPortableTensor *output, bool is_cachable_weights,
+                 const std::shared_ptr<ExternalContext> &external_context);
   void prepare() override;
   void run() override;
 
 private:
   void convFloat32();
+  void convFloat16();
   void convQ8uPerTensor();
   void convQ8uPerChannel();
   void convQ8i();
@@ -89,6 +92,8 @@ protected:
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
   std::unique_ptr<nnfw::cker::ConvHybridTempArena> _hybrid_arena;
 
+  std::shared_ptr<ExternalContext> _external_context;
+
   bool _prepare;
   bool _is_cachable_weights;
   bool _is_hybrid;
@@ -100,6 +100,29 @@ void DepthwiseConvolutionLayer::convFloat32()
   }
 }
 
+void DepthwiseConvolutionLayer::convFloat16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidth;
+  op_params.dilation_height_factor = _dilationHeight;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConv(
+    op_params, getShape(_input), getBuffer<nnfw::cker::Float16>(_input), getShape(_kernel),
+    getBuffer<nnfw::cker::Float16>(_kernel), getShape(_bias),
+    _bias ? getBuffer<nnfw::cker::Float16>(_bias) : nullptr, getShape(_output),
+    getBuffer<nnfw::cker::Float16>(_output), _external_context->ruy_context());
+}
+
 void DepthwiseConvolutionLayer::convQ8uPerTensor()
 {
   int32_t output_activation_min = 0;
@@ -349,6 +372,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     const bool per_channel_quantized = _kernel->data_scales().size() > 1;
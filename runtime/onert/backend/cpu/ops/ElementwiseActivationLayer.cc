@@ -84,6 +84,46 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
   }
 }
 
+void ElementwiseActivationLayer::PopulateLookupTableInt16(const ElementwiseActivationType op_type)
+{
+  std::function<double(double)> func;
+  if (op_type == ElementwiseActivationType::kTanh)
+  {
+    func = [](double x) { return std::tanh(x); };
+  }
+  else if (op_type == ElementwiseActivationType::kLogistic)
+  {
+    func = [](double x) { return 1.0 / (1.0 + std::exp(-x)); };
+  }
+  else
+  {
+    throw std::runtime_error("ElementwiseActivationLayer : unsupported activation type");
+  }
+
+  // The table maps the whole int16 input range to quantized output, which is Q0.15 of
+  // func(x) / (output_scale * 32768)
+  const double input_scale = _input->data_scale();
+  const double output_scale = _output->data_scale();
+  const double table_scale = output_scale * 32768.0;
+  _table_int16.resize(nnfw::cker::kInt16LUTSize);
+  nnfw::cker::PopulateInt16LookupTable([&](double x) { return func(x) / table_scale; },
+                                       -32768.0 * input_scale, 32768.0 * input_scale,
+                                       _table_int16.data());
+}
+
+void ElementwiseActivationLayer::EvalUsingLookupTableInt16(const IPortableTensor *input,
+                                                           IPortableTensor *output)
+{
+  const int size = MatchingFlatSize(getShape(input), getShape(output));
+  const int16_t *input_data = getBuffer<int16_t>(input);
+  int16_t *output_data = getBuffer<int16_t>(output);
+
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = nnfw::cker::LookupInt16Table(input_data[i], _table_int16.data());
+  }
+}
+
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta,
                                            ElementwiseActivationType op_type)
@@ -120,6 +160,12 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
                                getBuffer<float>(output));
         };
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        PopulateLookupTableInt16(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTableInt16, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else
       {
         throw std::runtime_error{"ElementwiseActivationLayer(Logistic): unsupported data type"};
@@ -167,6 +213,12 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
                            getBuffer<float>(output));
         };
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        PopulateLookupTableInt16(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTableInt16, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else
       {
         throw std::runtime_error{"ElementwiseActivationLayer(Tanh): unsupported data type"};
@@ -181,6 +233,22 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
                                 getBuffer<float>(output));
         };
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        nnfw::cker::LeakyReluParams params{alpha};
+        params.input_offset = _input->data_zero_point();
+        params.output_offset = _output->data_zero_point();
+        const double input_scale = _input->data_scale();
+        const double output_scale = _output->data_scale();
+        QuantizeMultiplier(input_scale * alpha / output_scale, &params.output_multiplier_alpha,
+                           &params.output_shift_alpha);
+        QuantizeMultiplier(input_scale / output_scale, &params.output_multiplier_identity,
+                           &params.output_shift_identity);
+        _kernel = [params](const IPortableTensor *input, IPortableTensor *output) {
+          nnfw::cker::QuantizeLeakyRelu(params, getShape(input), getBuffer<int16_t>(input),
+                                        getShape(output), getBuffer<int16_t>(output));
+        };
+      }
       else
       {
         throw std::runtime_error{"ElementwiseActivationLayer(LeakyReLU): unsupported data type"};
@@ -21,6 +21,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -54,10 +56,15 @@ public:
 
   void EvalUsingLookupTable(const IPortableTensor *input, IPortableTensor *output);
 
+  void PopulateLookupTableInt16(const ElementwiseActivationType op_type);
+
+  void EvalUsingLookupTableInt16(const IPortableTensor *input, IPortableTensor *output);
+
 protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   uint8_t _table[256];
+  std::vector<int16_t> _table_int16;
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
 };
 
@@ -18,6 +18,7 @@
 
 #include "OperationUtils.h"
 
+#include <cker/Fp16.h>
 #include <cker/operation/Dequantize.h>
 #include <cker/operation/Elementwise.h>
 #include <cker/operation/Erf.h>
@@ -76,6 +77,20 @@ void castPtr(const FromT *in, DataPtr out, int num_elements, ir::DataType data_t
   }
 }
 
+// Cast between FLOAT32 and FLOAT16, which have no C++ arithmetic type for castPtr
+void castFloat16(const IPortableTensor *input, IPortableTensor *output, int num_elements)
+{
+  if (input->data_type() == ir::DataType::FLOAT16 && output->data_type() == ir::DataType::FLOAT32)
+    nnfw::cker::ConvertFp16ToFp32(getBuffer<nnfw::cker::Float16>(input), getBuffer<float>(output),
+                                  num_elements);
+  else if (input->data_type() == ir::DataType::FLOAT32 &&
+           output->data_type() == ir::DataType::FLOAT16)
+    nnfw::cker::ConvertFp32ToFp16(getBuffer<float>(input),
+                                  getBuffer<nnfw::cker::Float16>(output), num_elements);
+  else
+    throw std::runtime_error("Cast: FLOAT16 is supported only with FLOAT32");
+}
+
 void cast(const IPortableTensor *input, IPortableTensor *output)
 {
   auto input_buf = input->buffer();
@@ -87,6 +102,12 @@ void cast(const IPortableTensor *input, IPortableTensor *output)
   auto output_shape = getShape(output);
   const auto num_elements = MatchingFlatSize(input_shape, output_shape);
 
+  if (input->data_type() == ir::DataType::FLOAT16 || output->data_type() == ir::DataType::FLOAT16)
+  {
+    castFloat16(input, output, num_elements);
+    return;
+  }
+
   switch (input->data_type())
   {
     case ir::DataType::FLOAT32:
@@ -125,6 +146,13 @@ void dequantizeInt8(const IPortableTensor *input, IPortableTensor *output)
                          getBuffer<float>(output), input->data_scale(), input->data_zero_point());
 }
 
+// FLOAT16 weights of fp16 quantized models are dequantized to FLOAT32
+void dequantizeFloat16(const IPortableTensor *input, IPortableTensor *output)
+{
+  nnfw::cker::ConvertFp16ToFp32(getBuffer<nnfw::cker::Float16>(input), getBuffer<float>(output),
+                                MatchingFlatSize(getShape(input), getShape(output)));
+}
+
 void dequantizeUint8(const IPortableTensor *input, IPortableTensor *output)
 {
   nnfw::cker::Dequantize(getShape(input), getBuffer<uint8_t>(input), getShape(output),
@@ -229,6 +257,13 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
       }
       break;
     case ElementwiseUnaryType::kCast:
+      if ((input->data_type() == OperandType::FLOAT16 &&
+           output->data_type() != OperandType::FLOAT32) ||
+          (output->data_type() == OperandType::FLOAT16 &&
+           input->data_type() != OperandType::FLOAT32))
+      {
+        throw std::runtime_error{"Cast: FLOAT16 is supported only with FLOAT32"};
+      }
       _kernel = cast;
       break;
     case ElementwiseUnaryType::kCos:
@@ -251,6 +286,10 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
       {
         _kernel = dequantizeInt8;
       }
+      else if (input->data_type() == OperandType::FLOAT16)
+      {
+        _kernel = dequantizeFloat16;
+      }
       else
       {
         throw std::runtime_error{"Dequantize: Unsupported data type"};
@@ -38,6 +38,10 @@ void ExpandDimsLayer::configure(const IPortableTensor *input, IPortableTensor *o
 
 void ExpandDimsLayer::run()
 {
+  // Output shares the buffer of input if it is planned as alias of input
+  if (_output->buffer() == _input->buffer())
+    return;
+
   size_t count = _input->total_size();
   memcpy(_output->buffer(), _input->buffer(), count);
 }
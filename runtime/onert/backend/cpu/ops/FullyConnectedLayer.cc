@@ -16,6 +16,7 @@
 
 #include "FullyConnectedLayer.h"
 
+#include "GGMLHelper.h"
 #include "../Tensor.h"
 #include <cker/operation/FullyConnected.h>
 #include <cker/TensorUtils.h>
@@ -30,10 +31,29 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Reshape float ggml tensor into [rows, cols] (ne[1] = rows, ne[0] = cols)
+void reshapeGGMLTensor2D(struct ggml_tensor &tensor, int64_t rows, int64_t cols)
+{
+  assert(tensor.type == GGML_TYPE_F32);
+  tensor.ne[0] = cols;
+  tensor.ne[1] = rows;
+  tensor.ne[2] = 1;
+  tensor.ne[3] = 1;
+  tensor.nb[1] = tensor.nb[0] * cols;
+  tensor.nb[2] = tensor.nb[1] * rows;
+  tensor.nb[3] = tensor.nb[2];
+}
+
+} // namespace
+
 FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
-    _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false)
+    _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false),
+    _output_multiplier(0), _output_shift(0)
 {
   // DO NOTHING
 }
@@ -60,6 +80,24 @@ void FullyConnectedLayer::fullyConnectedFloat32()
                              getBuffer<float>(_output));
 }
 
+void FullyConnectedLayer::fullyConnectedFloat16()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  float output_activation_min = 0;
+  float output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  op_params.activation = convertActivationType(_activation);
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnected(
+    op_params, getShape(_input), getBuffer<nnfw::cker::Float16>(_input), getShape(_weights),
+    getBuffer<nnfw::cker::Float16>(_weights), getShape(_bias),
+    _bias ? getBuffer<nnfw::cker::Float16>(_bias) : nullptr, getShape(_output),
+    getBuffer<nnfw::cker::Float16>(_output), *_temp_arena, _external_context->ruy_context());
+}
+
 // executionMutex is used to protect concurrent access of non-threadsafe resources
 // like gemmlowp::GemmContext.
 void FullyConnectedLayer::fullyConnectedQuant8()
@@ -89,6 +127,69 @@ void FullyConnectedLayer::fullyConnectedQuant8()
                              getBuffer<uint8_t>(_output));
 }
 
+// Symmetric int16 activations with int8 (int16x8) or symmetric int16 weights
+void FullyConnectedLayer::fullyConnectedQuant16()
+{
+  if (!_per_channel_output_multiplier.empty())
+  {
+    fullyConnectedQuant16PerChannel();
+    return;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = 0;
+  op_params.weights_offset = -_weights->data_zero_point();
+  op_params.output_offset = 0;
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  if (_weights->data_type() == OperandType::QUANT_INT16_SYMM)
+    nnfw::cker::FullyConnected(op_params, getShape(_input), getBuffer<int16_t>(_input),
+                               getShape(_weights), getBuffer<int16_t>(_weights), getShape(_bias),
+                               _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+                               getBuffer<int16_t>(_output));
+  else
+    nnfw::cker::FullyConnected(op_params, getShape(_input), getBuffer<int16_t>(_input),
+                               getShape(_weights), getBuffer<int8_t>(_weights), getShape(_bias),
+                               _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+                               getBuffer<int16_t>(_output));
+}
+
+void FullyConnectedLayer::fullyConnectedQuant16PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = 0;
+  op_params.weights_offset = 0;
+  op_params.output_offset = 0;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  const int32_t *multiplier = _per_channel_output_multiplier.data();
+  const int *shift = _per_channel_output_shift.data();
+  if (_weights->data_type() == OperandType::QUANT_INT16_SYMM)
+    nnfw::cker::FullyConnectedPerChannel(
+      op_params, multiplier, shift, getShape(_input), getBuffer<int16_t>(_input),
+      getShape(_weights), getBuffer<int16_t>(_weights), getShape(_bias),
+      _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output), getBuffer<int16_t>(_output));
+  else
+    nnfw::cker::FullyConnectedPerChannel(
+      op_params, multiplier, shift, getShape(_input), getBuffer<int16_t>(_input),
+      getShape(_weights), getBuffer<int8_t>(_weights), getShape(_bias),
+      _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output), getBuffer<int16_t>(_output));
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -195,6 +296,54 @@ void FullyConnectedLayer::fullyConnected16x1Float32()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedGGMLWeight()
+{
+  // Supporting condition
+  // Input: FLOAT32, flattened into [batch_size, input_size]
+  // Weights: GGML block quantized (Q4_0, Q8_0), [num_units, input_size]
+  // Output: FLOAT32, [batch_size, num_units]
+  auto weights = getGGMLTensor(_weights);
+  const int64_t input_size = weights.ne[0];
+  const int64_t num_units = weights.ne[1];
+  const int64_t batch_size = getShape(_input).FlatSize() / input_size;
+
+  // ggml's mul_mat computes dst[m][n] = sum_k(src0[n][k] * src1[m][k]), which is
+  // the same as FullyConnected with src0 as weights and src1 as input
+  auto input = getGGMLTensor(_input);
+  auto output = getGGMLTensor(_output);
+  reshapeGGMLTensor2D(input, batch_size, input_size);
+  reshapeGGMLTensor2D(output, batch_size, num_units);
+  {
+    output.op = GGML_OP_MUL_MAT;
+    output.src[0] = &weights;
+    output.src[1] = &input;
+  }
+
+  computeGGMLNode(&output, _external_context->maxNumThreads(), _ggml_work_buf);
+
+  // bias and fused activation
+  if (_bias == nullptr && _activation == ir::Activation::NONE)
+    return;
+
+  float output_activation_min = 0;
+  float output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  const int output_size = getShape(_output).FlatSize();
+  float *output_data = getBuffer<float>(_output);
+  if (_bias)
+  {
+    nnfw::cker::BiasAndClamp(output_activation_min, output_activation_max, num_units,
+                             getBuffer<float>(_bias), output_size, output_data);
+  }
+  else
+  {
+    for (int i = 0; i < output_size; ++i)
+      output_data[i] =
+        std::min(std::max(output_data[i], output_activation_min), output_activation_max);
+  }
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
@@ -217,6 +366,51 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   }
 #endif
   _external_context = external_context;
+
+  if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    if (_weights->data_type() != OperandType::QUANT_INT8_ASYMM &&
+        _weights->data_type() != OperandType::QUANT_INT8_SYMM &&
+        _weights->data_type() != OperandType::QUANT_INT16_SYMM)
+      throw std::runtime_error{"FullyConnected: int16 input requires int8 or int16 weights"};
+    if (_bias && _bias->data_type() != OperandType::INT64)
+      throw std::runtime_error{"FullyConnected: int16 input requires int64 bias"};
+
+    // Per-channel weights are quantized along output channels (the first dimension), and their
+    // zero points are all 0
+    if (_weights->data_scales().size() > 1)
+    {
+      const int num_units = getShape(_weights).Dims(0);
+      if (_weights->data_scales().size() != static_cast<size_t>(num_units))
+        throw std::runtime_error{"FullyConnected: weights scales must be given per output channel"};
+      for (const auto zero_point : _weights->data_zero_points())
+        if (zero_point != 0)
+          throw std::runtime_error{"FullyConnected: per-channel weights must be symmetric"};
+      GetQuantizedConvolutionMultipliersAndShifts(
+        _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+        _weights->data_scales().size(), num_units, _per_channel_output_multiplier,
+        _per_channel_output_shift);
+    }
+    else
+    {
+      // Scales do not change over runs, so quantize the output multiplier once
+      double real_multiplier = 0.0;
+      GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
+      QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+    }
+  }
+
+  if (_weights->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+      _weights->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    if (_input->data_type() != OperandType::FLOAT32 ||
+        _output->data_type() != OperandType::FLOAT32)
+      throw std::runtime_error{"FullyConnected: GGML weights requires float input and output"};
+    if (_bias && _bias->data_type() != OperandType::FLOAT32)
+      throw std::runtime_error{"FullyConnected: GGML weights requires float bias"};
+
+    _external_context->initGgmlContext();
+  }
 }
 
 void FullyConnectedLayer::run()
@@ -229,14 +423,27 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (_weights->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+           _weights->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    fullyConnectedGGMLWeight();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    fullyConnectedFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    fullyConnectedQuant16();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -245,7 +452,8 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  if (_bias && _bias->is_constant() && _bias->data_type() != OperandType::FLOAT16 &&
+      _bias->data_type() != OperandType::INT64)
   {
     const int bias_size = getShape(_bias).FlatSize();
     if (nnfw::cker::IsZeroVector(getBuffer<float>(_bias), bias_size))
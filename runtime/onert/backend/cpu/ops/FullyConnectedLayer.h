@@ -23,6 +23,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -49,14 +51,22 @@ public:
 public:
   void fullyConnectedFloat32();
 
+  void fullyConnectedFloat16();
+
   void fullyConnectedQuant8();
 
+  void fullyConnectedQuant16();
+
+  void fullyConnectedQuant16PerChannel();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
 
   void fullyConnected16x1Float32();
 
+  void fullyConnectedGGMLWeight();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
@@ -80,6 +90,15 @@ protected:
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
 
+  std::vector<uint8_t> _ggml_work_buf; // work buffer for ggml kernel, reused over runs
+
+  // Output multiplier and shift of int16 input with per-tensor quantized weights
+  int32_t _output_multiplier;
+  int _output_shift;
+  // Output multipliers and shifts of int16 input with per-channel quantized weights
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
   bool _is_weights_freed = false;     // is weights freed?
@@ -16,6 +16,8 @@
 
 #include "GGMLHelper.h"
 
+#include <cstring>
+
 namespace onert
 {
 namespace backend
@@ -46,7 +48,7 @@ ggml_type getGGMLType(ir::DataType type)
 
 struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
 {
-  struct ggml_tensor res;
+  struct ggml_tensor res = {};
 
   res.type = getGGMLType(tensor->data_type());
   const auto rank = tensor->getShape().rank();
@@ -70,6 +72,29 @@ struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
   return res;
 }
 
+void computeGGMLNode(struct ggml_tensor *node, int num_threads, std::vector<uint8_t> &work_buf)
+{
+  auto *nodes = node;
+
+  // create graph
+  struct ggml_cgraph graph;
+  {
+    memset(&graph, 0, sizeof(graph));
+    graph.n_nodes = 1;
+    graph.nodes = &nodes;
+  }
+
+  // get cplan
+  auto cplan = ggml_graph_plan(&graph, num_threads);
+  if (work_buf.size() < cplan.work_size)
+    work_buf.resize(cplan.work_size);
+  cplan.work_data = work_buf.data();
+
+  // compute
+  if (ggml_graph_compute(&graph, &cplan) != GGML_STATUS_SUCCESS)
+    throw std::runtime_error("GGML: failed to compute graph");
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
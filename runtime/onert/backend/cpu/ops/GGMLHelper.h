@@ -21,6 +21,8 @@
 
 #include <ggml.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -32,6 +34,10 @@ namespace ops
 
 struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor);
 
+// Compute single ggml node whose sources are already connected.
+// work_buf is grown on demand and can be reused over runs to avoid reallocation.
+void computeGGMLNode(struct ggml_tensor *node, int num_threads, std::vector<uint8_t> &work_buf);
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
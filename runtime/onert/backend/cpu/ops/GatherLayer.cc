@@ -57,7 +57,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _ctx->ruy_context());
       break;
     }
     case OperandType::INT64:
@@ -66,7 +67,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _ctx->ruy_context());
       break;
     }
     default:
@@ -102,25 +104,8 @@ void GatherLayer::runByGGMLQuantInputType()
     output.src[0] = &input;
     output.src[1] = &indices;
   }
-  auto *nodes = &output;
-
-  // create graph
-  struct ggml_cgraph graph;
-  {
-    memset(&graph, 0, sizeof(graph));
-    graph.n_nodes = 1;
-    graph.nodes = &nodes;
-  }
-
-  // get cplan
-  auto cplan = ggml_graph_plan(&graph, _ctx->ruy_context()->max_num_threads());
-  cplan.work_data = (uint8_t *)(malloc(cplan.work_size));
-
-  // compute
-  ggml_graph_compute(&graph, &cplan);
-
-  // free
-  free(cplan.work_data);
+  std::vector<uint8_t> work_buf;
+  computeGGMLNode(&output, _ctx->maxNumThreads(), work_buf);
 }
 
 void GatherLayer::run()
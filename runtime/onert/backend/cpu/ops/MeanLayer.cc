@@ -29,7 +29,9 @@ namespace cpu
 namespace ops
 {
 
-MeanLayer::MeanLayer() : _input(nullptr), _axes(nullptr), _output(nullptr), _keep_dims(false)
+MeanLayer::MeanLayer()
+  : _input(nullptr), _axes(nullptr), _output(nullptr), _keep_dims(false),
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -45,12 +47,12 @@ void MeanLayer::MeanFloat32()
   if (axis_is_1_and_2)
   {
     nnfw::cker::MeanAxis1And2(inputShape, getBuffer<float>(_input), getShape(_output),
-                              getBuffer<float>(_output));
+                              getBuffer<float>(_output), _external_context->ruy_context());
   }
   else
   {
     nnfw::cker::Mean(inputShape, getBuffer<float>(_input), getShape(_output),
-                     getBuffer<float>(_output), axisVec);
+                     getBuffer<float>(_output), axisVec, _external_context->ruy_context());
   }
 }
 
@@ -61,16 +63,26 @@ void MeanLayer::MeanQuant8()
                           _output->data_scale(), _output->data_zero_point(), getReducerAxes(_axes));
 }
 
+void MeanLayer::MeanQuant16()
+{
+  nnfw::cker::MeanQ8Asymm(getShape(_input), getBuffer<int16_t>(_input), _input->data_scale(),
+                          _input->data_zero_point(), getShape(_output), getBuffer<int16_t>(_output),
+                          _output->data_scale(), _output->data_zero_point(), getReducerAxes(_axes));
+}
+
 void MeanLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                          IPortableTensor *output, bool keep_dims)
+                          IPortableTensor *output, bool keep_dims,
+                          const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _keep_dims = keep_dims;
+  _external_context = external_context;
 
   if (_input->data_type() != OperandType::FLOAT32 &&
-      _input->data_type() != OperandType::QUANT_UINT8_ASYMM)
+      _input->data_type() != OperandType::QUANT_UINT8_ASYMM &&
+      _input->data_type() != OperandType::QUANT_INT16_SYMM)
     throw std::runtime_error{"Mean: unsupported data type"};
 }
 
@@ -84,6 +96,10 @@ void MeanLayer::run()
   {
     MeanQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    MeanQuant16();
+  }
   else
   {
     throw std::runtime_error{"Mean: unsupported data type"};
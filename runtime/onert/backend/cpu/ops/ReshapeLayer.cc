@@ -32,6 +32,10 @@ ReshapeLayer::ReshapeLayer() : _input(nullptr), _shape(nullptr), _output(nullptr
 
 void ReshapeLayer::reshapeGeneric()
 {
+  // Output shares the buffer of input if it is planned as alias of input
+  if (_output->buffer() == _input->buffer())
+    return;
+
   size_t count = _input->total_size();
   memcpy(_output->buffer(), _input->buffer(), count);
 }
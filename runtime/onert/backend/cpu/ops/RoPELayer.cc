@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RoPELayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/RoPE.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void RoPELayer::configure(const IPortableTensor *input, const IPortableTensor *sin_table,
+                          const IPortableTensor *cos_table, nnfw::cker::RoPEMode mode,
+                          IPortableTensor *output,
+                          const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(sin_table != nullptr);
+  assert(cos_table != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _sin = sin_table;
+  _cos = cos_table;
+  _output = output;
+  _mode = mode;
+  _external_context = external_context;
+}
+
+void RoPELayer::run()
+{
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+    {
+      nnfw::cker::RoPEParams param;
+      param.mode = _mode;
+      nnfw::cker::RoPE(param, getShape(_input), getBuffer<float>(_input), getShape(_sin),
+                       getBuffer<float>(_sin), getShape(_cos), getBuffer<float>(_cos),
+                       getShape(_output), getBuffer<float>(_output),
+                       _external_context->ruy_context());
+      break;
+    }
+    default:
+      throw std::runtime_error{"RoPE: Unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -20,6 +20,8 @@
 
 #include <cker/operation/SoftMax.h>
 
+#include <cmath>
+
 namespace onert
 {
 namespace backend
@@ -29,7 +31,9 @@ namespace cpu
 namespace ops
 {
 
-SoftMaxLayer::SoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0)
+SoftMaxLayer::SoftMaxLayer()
+  : _input(nullptr), _output(nullptr), _external_context(nullptr), _beta(0.0),
+    _input_multiplier(0), _input_left_shift(0), _output_multiplier(0), _output_shift(0)
 {
   // DO NOTHING
 }
@@ -39,7 +43,8 @@ void SoftMaxLayer::softmaxFloat32()
   if (getNumberOfDimensions(_input) == 1)
   {
     uint32_t input_size = getNumberOfElements(_input);
-    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, 1, _beta, getBuffer<float>(_output));
+    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, 1, _beta, getBuffer<float>(_output),
+                        _external_context->ruy_context());
   }
   else if (getNumberOfDimensions(_input) == 2)
   {
@@ -49,14 +54,14 @@ void SoftMaxLayer::softmaxFloat32()
 
     uint32_t input_size = getNumberOfElements(_input) / batch_size;
     nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), _external_context->ruy_context());
   }
   else if (getNumberOfDimensions(_input) == 4)
   {
     nnfw::cker::SoftmaxParams op_params;
     op_params.beta = _beta;
     nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), _external_context->ruy_context());
   }
   else
   {
@@ -67,6 +72,16 @@ void SoftMaxLayer::softmaxFloat32()
   }
 }
 
+void SoftMaxLayer::softmaxFloat16()
+{
+  // Softmax is applied along the last dimension for any rank
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.beta = _beta;
+  nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<nnfw::cker::Float16>(_input),
+                      getShape(_output), getBuffer<nnfw::cker::Float16>(_output),
+                      _external_context->ruy_context());
+}
+
 template <typename T> void SoftMaxLayer::softmaxQuant8()
 {
   nnfw::cker::SoftmaxParams op_params;
@@ -85,11 +100,26 @@ template <typename T> void SoftMaxLayer::softmaxQuant8()
 #endif
 }
 
+void SoftMaxLayer::softmaxQuant16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.input_multiplier = _input_multiplier;
+  op_params.input_left_shift = _input_left_shift;
+  op_params.exp_lut = _exp_lut.data();
+  op_params.one_over_one_plus_x_lut = _one_over_one_plus_x_lut.data();
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_output),
+                      getBuffer<int16_t>(_output));
+}
+
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
-                             IPortableTensor *output)
+                             IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
+  _external_context = external_context;
   _beta = beta;
 
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
@@ -104,6 +134,27 @@ void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
     nnfw::cker::PopulateSoftmaxLookupTable(_table, _input->data_scale(), _beta);
 #endif
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    // exp() only sees non-positive differences, and exp(-10) is negligible in the sum
+    _exp_lut.resize(nnfw::cker::kInt16LUTSize);
+    _one_over_one_plus_x_lut.resize(nnfw::cker::kInt16LUTSize);
+    nnfw::cker::PopulateInt16LookupTable([](double x) { return std::exp(x); }, -10.0, 0.0,
+                                         _exp_lut.data());
+    nnfw::cker::PopulateInt16LookupTable([](double x) { return 1.0 / (1.0 + x); }, 0.0, 1.0,
+                                         _one_over_one_plus_x_lut.data());
+    // Input differences are rescaled so that [-65535, 0] corresponds to [-10.0, 0.0]
+    const double input_scale_beta_rescale = _input->data_scale() * _beta / (10.0 / 65535.0);
+    int input_left_shift = 0;
+    QuantizeMultiplier(input_scale_beta_rescale, &_input_multiplier, &input_left_shift);
+    _input_left_shift = input_left_shift;
+
+    // Output scale is given by the model, e.g. 1/32767 by circle-quantizer or 1/32768 by tflite
+    if (_output->data_zero_point() != 0 || _output->data_scale() <= 0.f)
+      throw std::runtime_error{"SoftMax: int16 output must be symmetric with positive scale"};
+    QuantizeMultiplier((1.0 / 32768.0) / _output->data_scale(), &_output_multiplier,
+                       &_output_shift);
+  }
 }
 
 void SoftMaxLayer::run()
@@ -113,12 +164,18 @@ void SoftMaxLayer::run()
     case OperandType::FLOAT32:
       softmaxFloat32();
       break;
+    case OperandType::FLOAT16:
+      softmaxFloat16();
+      break;
     case OperandType::QUANT_UINT8_ASYMM:
       softmaxQuant8<uint8_t>();
       break;
     case OperandType::QUANT_INT8_ASYMM:
       softmaxQuant8<int8_t>();
       break;
+    case OperandType::QUANT_INT16_SYMM:
+      softmaxQuant16();
+      break;
     default:
       throw std::runtime_error{"SoftMax: unsupported data type"};
   }
@@ -18,9 +18,12 @@
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -38,15 +41,21 @@ public:
 public:
   void softmaxFloat32();
 
+  void softmaxFloat16();
+
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void softmaxQuant16();
+
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 
 private:
   float _beta;
@@ -54,6 +63,14 @@ private:
   float _table[256];
   uint8_t _uint8_table1[256];
   uint8_t _uint8_table2[256];
+
+  // int16 only
+  std::vector<int16_t> _exp_lut;
+  std::vector<int16_t> _one_over_one_plus_x_lut;
+  int32_t _input_multiplier;
+  int32_t _input_left_shift;
+  int32_t _output_multiplier;
+  int _output_shift;
 };
 
 } // namespace ops
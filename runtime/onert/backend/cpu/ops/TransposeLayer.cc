@@ -30,7 +30,8 @@ namespace cpu
 namespace ops
 {
 
-TransposeLayer::TransposeLayer() : _input(nullptr), _perm(nullptr), _output(nullptr)
+TransposeLayer::TransposeLayer()
+  : _input(nullptr), _perm(nullptr), _output(nullptr), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -59,7 +60,7 @@ template <typename T> void TransposeLayer::transpose()
   }
 
   nnfw::cker::Transpose(param, getShape(_input), getBuffer<T>(_input), getShape(_output),
-                        getBuffer<T>(_output));
+                        getBuffer<T>(_output), _external_context->ruy_context());
 }
 
 void TransposeLayer::transposeQuant8()
@@ -78,11 +79,13 @@ void TransposeLayer::transposeQuant8()
 }
 
 void TransposeLayer::configure(const IPortableTensor *input, const IPortableTensor *perm,
-                               IPortableTensor *output)
+                               IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _perm = perm;
   _output = output;
+  _external_context = external_context;
 }
 
 void TransposeLayer::run()
@@ -43,9 +43,10 @@ public:
   {
     auto custom_kernel_builder = data.custom_kernel_builder;
     auto &graph = *data.graph;
+    const bool reserve_dynamic_tensors = data.reserve_dynamic_tensors;
     auto context = std::make_unique<BackendContext>(this, std::move(data));
     auto tr = std::make_shared<basic::TensorRegistry>();
-    auto tb = std::make_shared<TensorBuilder>(tr);
+    auto tb = std::make_shared<TensorBuilder>(tr, reserve_dynamic_tensors);
     context->tensor_registry = tr;
     context->tensor_builder = tb;
     context->kernel_gen = std::make_shared<KernelGenerator>(graph, tb, tr, custom_kernel_builder,
@@ -18,8 +18,10 @@
 #define __ONERT_BACKEND_RUY_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/PerThread.h>
 #include <ruy/context.h>
 
+#include <atomic>
 #include <memory>
 
 namespace onert
@@ -35,7 +37,7 @@ private:
   static const int kDefaultNumThreadpoolThreads = 4;
 
 public:
-  ExternalContext() : _ruy_context(new ::ruy::Context)
+  ExternalContext()
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::NUM_THREADS));
   }
@@ -44,13 +46,31 @@ public:
   {
     const int target_num_threads =
       max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads.store(target_num_threads, std::memory_order_relaxed);
+    _ruy_contexts.forEach(
+      [&](::ruy::Context *ruy_context) { ruy_context->set_max_num_threads(target_num_threads); });
   }
 
-  ::ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  int maxNumThreads() const { return _max_num_threads.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Get the ruy context of the calling thread
+   *
+   * A ruy context must not be used by several threads at once, so each thread that runs kernels
+   * of this backend gets its own context.
+   */
+  ::ruy::Context *ruy_context() const
+  {
+    return _ruy_contexts.get([&]() {
+      auto ruy_context = std::make_unique<::ruy::Context>();
+      ruy_context->set_max_num_threads(maxNumThreads());
+      return ruy_context;
+    });
+  }
 
 private:
-  const std::unique_ptr<::ruy::Context> _ruy_context;
+  std::atomic<int> _max_num_threads{kDefaultNumThreadpoolThreads};
+  util::PerThread<::ruy::Context> _ruy_contexts;
 };
 
 } // namespace ruy
@@ -24,6 +24,7 @@
 
 #include <backend/Backend.h>
 #include <backend/train/ITrainableBackend.h>
+#include <util/ConfigSource.h>
 
 #include <memory>
 
@@ -54,13 +55,24 @@ public:
     const auto &tgraph = *tdata.tgraph;
     auto optimizer = createOptimizer(tdata.optim_info);
     auto tr = std::make_shared<TensorRegistry>();
-    auto tb = std::make_shared<TensorBuilder>(tr, optimizer.get());
+    const bool recompute = !tdata.recompute_segments.empty();
+    const bool flat_optimizer = tdata.flat_optimizer;
+    // TRAIN_ACTIVATION_STASH applies to the training info without activation stash type
+    auto activation_stash = tdata.activation_stash;
+    if (activation_stash == ir::train::ActivationStash::None)
+      activation_stash = ir::train::toActivationStash(
+        util::getConfigString(util::config::TRAIN_ACTIVATION_STASH));
+    // Stashed activations are released after forwarding and claimed again like recomputed ones
+    const auto stash_type = ops::toStashType(activation_stash);
+    const bool reclaim = recompute || stash_type.has_value();
+    auto tb = std::make_shared<TensorBuilder>(tr, optimizer.get(), reclaim, flat_optimizer,
+                                              tdata.shared_trainables);
     auto tdata_ptr = std::make_unique<backend::train::TrainableContextData>(std::move(tdata));
     auto context = std::make_unique<train::BackendContext>(this, std::move(tdata_ptr), tr, tb,
-                                                           std::move(optimizer));
+                                                           std::move(optimizer), stash_type);
 
     context->kernel_gen = std::make_shared<train::KernelGenerator>(
-      tgraph, tr, context->external_context(), context->optimizer());
+      tgraph, tr, context->external_context(), context->optimizer(), flat_optimizer);
     return context;
   }
 
@@ -20,10 +20,12 @@
 #include "TensorPlanner.h"
 #include "KernelGenerator.h"
 #include "ops/BackPropInitializer.h"
+#include "ops/StashLayer.h"
 
 #include <backend/basic/train/TrainableBackendContextHelpers.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace onert
@@ -134,6 +136,53 @@ getDisposableBackPropTensorList(const ir::train::TrainableGraph &tgraph,
 
   return ret;
 }
+
+ir::OperandIndexMap<StashPoint> getStashPoints(const ir::train::TrainableGraph &tgraph,
+                                               const util::Set<ir::OperandIndex> &external_operands,
+                                               const TensorBuilder &tensor_builder)
+{
+  ir::OperandIndexMap<StashPoint> ret;
+
+  const auto border = tgraph.essentialBackwardOrder();
+  if (border.empty())
+    return ret;
+
+  ir::OperationIndexMap<uint32_t> forward_pos;
+  const auto forward_order = tgraph.topolSortOperations();
+  for (uint32_t pos = 0; pos < forward_order.size(); ++pos)
+    forward_pos[forward_order[pos]] = pos;
+
+  const auto &training_usedefs = tgraph.trainingUseDefs();
+  tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (external_operands.contains(index) || !tensor_builder.isRegistered(index) ||
+        operand.isConstant() || operand.typeInfo().type() != ir::DataType::FLOAT32 ||
+        tgraph.getOutputs().contains(index) || !operand.getDef().valid())
+      return;
+
+    // Stash after the last use in forwarding
+    auto stash_op = operand.getDef();
+    for (const auto &use : operand.getUses())
+    {
+      if (forward_pos.at(use) > forward_pos.at(stash_op))
+        stash_op = use;
+    }
+
+    // Unstash before the first use in backwarding
+    const auto &uses =
+      training_usedefs.at(ir::train::TrainingOperandIndex{index, true}).getTrainingUses();
+    const auto it = std::find_if(border.begin(), border.end(), [&](const ir::OperationIndex &op) {
+      return uses.find(ir::train::TrainingOperationIndex{op, false}) != uses.end();
+    });
+
+    // Activations used by the first backwarding operation, e.g. by the loss, are needed right away
+    if (it == border.end() || it == border.begin())
+      return;
+
+    ret.emplace(index, StashPoint{stash_op, *it});
+  });
+
+  return ret;
+}
 } // namespace
 
 FunctionMap BackendContext::gen()
@@ -151,6 +200,9 @@ FunctionMap BackendContext::gen()
     [&](const ir::OperandIndex &ind, const ir::Operand &operand) {
       if (external_operands().contains(ind) || !operand.isConstant())
         return;
+      // The owner of shared trainable tensors has already filled them
+      if (_tdata->shared_trainables.count(ind) > 0)
+        return;
 
       auto tensor = tensor_registry()->getNativeITensor(ind);
       assert(tensor != nullptr);
@@ -196,7 +248,27 @@ void BackendContext::planForwardTensors()
   });
 
   const auto ctx_data = data();
-  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
+  if (_stash_type.has_value())
+  {
+    // NOTE Recomputed segments read activations in backwarding before they would be unstashed
+    if (!ctx_data->recompute_segments.empty())
+    {
+      VERBOSE(BackendContext) << "Activations are not stashed with recomputation" << std::endl;
+    }
+    else
+    {
+      _stash_points = getStashPoints(tgraph, external_operands(), *_tensor_builder);
+      for (const auto &[index, stash_point] : _stash_points)
+      {
+        UNUSED_RELEASE(stash_point);
+        _stashed_tensors.add(index);
+        _tensor_builder->registerStashedTensor(index);
+      }
+    }
+  }
+
+  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands,
+                               ctx_data->recompute_segments, _stashed_tensors};
   tensor_planner.planTrainableTensors(_tensor_builder.get());
   tensor_planner.planNonConstTensors(_tensor_builder.get());
 }
@@ -231,7 +303,8 @@ void BackendContext::planBackwardTensors()
 
   // Plan tensors only in backwarding to reduce peak memory usage
   const auto ctx_data = data();
-  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
+  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands,
+                               ctx_data->recompute_segments, _stashed_tensors};
   tensor_planner.planGradientTensors(tensor_builder.get());
   tensor_planner.planBackPropTensors(tensor_builder.get());
   tensor_planner.planDisposableBackPropTensors(tensor_builder.get());
@@ -252,6 +325,40 @@ FunctionMap BackendContext::generateFunctionMap()
   auto tensor_reg = nnfw::misc::polymorphic_downcast<TensorRegistry *>(_tensor_registry.get());
   AddBackPropInitializers(tgraph, *tensor_reg, ret);
 
+  // Keep activations in a 16-bit type while their fp32 memory is reused by other tensors
+  for (const auto &[index, stash_point] : _stash_points)
+  {
+    auto tensor = tensor_reg->getNonConstTensor(index);
+    assert(tensor != nullptr);
+    auto *stash = _tensor_builder->getStashBuffer(index);
+
+    auto stash_fn = std::make_unique<ops::StashLayer>();
+    stash_fn->configure(tensor, stash, _stash_type.value(), _external_context);
+    ret.at(stash_point.stash_op)->append(std::move(stash_fn));
+
+    // The function added latest is executed first in a sequence during backwarding.
+    auto unstash_fn = std::make_unique<ops::UnstashLayer>();
+    unstash_fn->configure(stash, tensor, _stash_type.value(), _external_context);
+    ret.at(stash_point.unstash_op)->append(std::move(unstash_fn));
+  }
+
+  // NOTE In flat optimizer mode, all trainable tensors are updated at once after their gradients
+  //      are computed, that is, with the last operation updating weights during backwarding
+  auto flat_applier = kernel_gen->releaseFlatGradientApplier();
+  if (flat_applier)
+  {
+    const auto backward_order = tgraph.essentialBackwardOrder();
+    for (auto it = backward_order.rbegin(); it != backward_order.rend(); ++it)
+    {
+      const auto &op = tgraph.operation(*it);
+      if (ret.find(*it) != ret.end() && op.isRequiredForBackward() && op.isWeightsUpdateEnabled())
+      {
+        ret.at(*it)->append(std::move(flat_applier));
+        break;
+      }
+    }
+  }
+
   return ret;
 }
 
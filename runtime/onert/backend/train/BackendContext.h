@@ -22,6 +22,11 @@
 #include "ExternalContext.h"
 #include "KernelGenerator.h"
 #include "TensorBuilder.h"
+#include "ops/StashLayer.h"
+
+#include <ir/OperandIndexMap.h>
+
+#include <optional>
 
 namespace onert
 {
@@ -46,6 +51,15 @@ public:
   backend::FunctionMap genKernels() override { return backend::FunctionMap{}; }
 };
 
+// Operations around which an activation is kept in a 16-bit type
+struct StashPoint
+{
+  // Stash the activation after forwarding this operation
+  ir::OperationIndex stash_op;
+  // Unstash the activation before backwarding this operation
+  ir::OperationIndex unstash_op;
+};
+
 // TODO Unify TensorBuilder
 // TODO Unify TensorRegistry
 class BackendContext : public onert::backend::train::TrainableBackendContext
@@ -55,10 +69,11 @@ public:
                  std::shared_ptr<backend::train::ITensorRegistry> tensor_registry = nullptr,
                  std::shared_ptr<TensorBuilder> tensor_builder = nullptr,
                  std::unique_ptr<exec::train::optimizer::Optimizer> optimizer = nullptr,
+                 std::optional<ops::StashType> stash_type = std::nullopt,
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::train::TrainableBackendContext(backend, std::move(tdata), tensor_registry),
       kernel_gen{kernel_gen}, _external_context(new ExternalContext),
-      _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)}
+      _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)}, _stash_type{stash_type}
   {
   }
   BackendContext(const BackendContext &) = delete;
@@ -97,6 +112,12 @@ private:
 
 private:
   std::unique_ptr<exec::train::optimizer::Optimizer> _optimizer;
+
+private:
+  // Type to keep activations in between forwarding and backwarding, or none to keep them in fp32
+  std::optional<ops::StashType> _stash_type;
+  ir::OperandIndexMap<StashPoint> _stash_points;
+  util::Set<ir::OperandIndex> _stashed_tensors;
 };
 
 } // namespace train
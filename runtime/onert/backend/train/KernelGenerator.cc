@@ -145,10 +145,18 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
 KernelGenerator::KernelGenerator(const ir::train::TrainableGraph &tgraph,
                                  const std::shared_ptr<TensorRegistry> &tensor_reg,
                                  const std::shared_ptr<ExternalContext> &external_context,
-                                 const exec::train::optimizer::Optimizer *optimizer)
+                                 const exec::train::optimizer::Optimizer *optimizer,
+                                 bool flat_optimizer)
   : backend::train::KernelGeneratorBase{tgraph}, _tensor_reg{tensor_reg},
-    _external_context(external_context), _optimizer{optimizer}, _update_funcs{}, _node_to_idx{}
+    _external_context(external_context), _optimizer{optimizer}, _update_funcs{}, _flat_applier{},
+    _node_to_idx{}
 {
+  if (flat_optimizer)
+  {
+    _flat_applier = std::make_unique<ops::FlatGradientApplier>();
+    _flat_applier->configure(_optimizer);
+  }
+
   tgraph.operations().iterate(
     [&](const onert::ir::OperationIndex &idx, const onert::ir::IOperation &op) {
       assert(_node_to_idx.find(&op) == _node_to_idx.end());
@@ -173,7 +181,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
 
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
   fn->configure(lhs_tensor, rhs_tensor, output_tensor, activation,
-                static_cast<cpu::ops::ArithmeticType>(arithmetic_type));
+                static_cast<cpu::ops::ArithmeticType>(arithmetic_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -224,7 +232,7 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
   fn->configure(in_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left, padding.right,
                 padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, out_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _external_context);
 
   auto ker_grad_tensor = _tensor_reg->getGradientTensor(ker_index);
   auto bias_grad_tensor = _tensor_reg->getGradientTensor(bias_index);
@@ -235,14 +243,13 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
     auto out_back_prop_tensor = getBackPropOut(out_index);
     auto in_back_prop_tensor = getBackPropIn(node, in_index);
 
-    fn->configureBackward(ker_tensor, in_back_prop_tensor, ker_grad_tensor, bias_grad_tensor,
+    fn->configureBackward(in_back_prop_tensor, ker_grad_tensor, bias_grad_tensor,
                           out_back_prop_tensor, activation);
 
     // Generate GradientApplier
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+      appendGradientApplier(node, bias_grad_tensor, bias_tensor);
+    appendGradientApplier(node, ker_grad_tensor, ker_tensor);
   }
 
   _return_fn = std::move(fn);
@@ -296,9 +303,8 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
 
     // Generate GradientApplier
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+      appendGradientApplier(node, bias_grad_tensor, bias_tensor);
+    appendGradientApplier(node, ker_grad_tensor, ker_tensor);
   }
 
   _return_fn = std::move(fn);
@@ -378,10 +384,8 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
 
     // Generate GradientAppliers
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(
-      generateGradientApplier(_optimizer, weights_grad_tensor, weights_tensor));
+      appendGradientApplier(node, bias_grad_tensor, bias_tensor);
+    appendGradientApplier(node, weights_grad_tensor, weights_tensor);
   }
 
   _return_fn = std::move(fn);
@@ -534,7 +538,7 @@ void KernelGenerator::visit(const ir::train::operation::Reduce &node)
   if (node.param().reduce_type == ir::operation::Reduce::ReduceType::MEAN)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
     if (node.isRequiredForBackward())
     {
       auto back_prop_output_tensor = getBackPropOut(output_index);
@@ -594,7 +598,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -605,6 +609,26 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
   _return_fn = std::move(fn);
 }
 
+std::unique_ptr<exec::train::IGradientApplier> KernelGenerator::releaseFlatGradientApplier()
+{
+  return std::move(_flat_applier);
+}
+
+void KernelGenerator::appendGradientApplier(const ir::train::ITrainableOperation &node,
+                                            const IPortableTensor *gradient,
+                                            ITrainableTensor *trainable)
+{
+  if (!_flat_applier)
+  {
+    _update_funcs.emplace_back(generateGradientApplier(_optimizer, gradient, trainable));
+    return;
+  }
+
+  // Frozen weights must not be touched by the single sweep over all trainable tensors
+  if (node.isWeightsUpdateEnabled())
+    _flat_applier->addTarget(gradient, trainable);
+}
+
 IPortableTensor *KernelGenerator::getBackPropIn(const ir::IOperation &node,
                                                 const ir::OperandIndex &operand_index)
 {
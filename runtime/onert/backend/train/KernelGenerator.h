@@ -21,6 +21,7 @@
 #include "backend/basic/TensorRegistry.h"
 #include "TensorBuilder.h"
 #include "Tensor.h"
+#include "ops/FlatGradientApplier.h"
 
 #include <backend/train/KernelGeneratorBase.h>
 #include <exec/train/IGradientApplier.h>
@@ -42,10 +43,17 @@ public:
   KernelGenerator(const ir::train::TrainableGraph &tgraph,
                   const std::shared_ptr<TensorRegistry> &tensor_reg,
                   const std::shared_ptr<ExternalContext> &external_context,
-                  const exec::train::optimizer::Optimizer *optimizer);
+                  const exec::train::optimizer::Optimizer *optimizer, bool flat_optimizer = false);
 
   std::unique_ptr<exec::train::TrainableFnSequence> generate(ir::OperationIndex op_ind) override;
 
+  /**
+   * @brief Release the applier that updates all trainable tensors at once in flat optimizer mode
+   *
+   * @return The applier to be run after backwarding all operations, or nullptr if not flat mode
+   */
+  std::unique_ptr<exec::train::IGradientApplier> releaseFlatGradientApplier();
+
   void visit(const ir::train::operation::BinaryArithmetic &) override;
   void visit(const ir::train::operation::Conv2D &) override;
   void visit(const ir::train::operation::DepthwiseConv2D &) override;
@@ -61,12 +69,15 @@ public:
 private:
   IPortableTensor *getBackPropIn(const ir::IOperation &node, const ir::OperandIndex &operand_index);
   IPortableTensor *getBackPropOut(const ir::OperandIndex &index);
+  void appendGradientApplier(const ir::train::ITrainableOperation &node,
+                             const IPortableTensor *gradient, ITrainableTensor *trainable);
 
 private:
   std::shared_ptr<TensorRegistry> _tensor_reg;
   const std::shared_ptr<ExternalContext> _external_context;
   const exec::train::optimizer::Optimizer *_optimizer;
   std::vector<std::unique_ptr<exec::train::IGradientApplier>> _update_funcs;
+  std::unique_ptr<ops::FlatGradientApplier> _flat_applier;
   std::unordered_map<const ir::IOperation *, ir::OperationIndex> _node_to_idx;
 };
 
@@ -29,19 +29,34 @@ namespace backend
 namespace train
 {
 
-TrainableMemoryManager::TrainableMemoryManager(uint32_t optim_vars_count)
-  : _optim_vars_count{optim_vars_count}
+TrainableMemoryManager::TrainableMemoryManager(uint32_t optim_vars_count, bool flat_gradients,
+                                               bool shared_weights)
+  : _optim_vars_count{optim_vars_count}, _flat_gradients{flat_gradients},
+    _shared_weights{shared_weights}
 {
   // DO NOTHING
 }
 
 void TrainableMemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
-  assert(_mem_alloc->base());
+  const bool huge_page = util::getConfigBool(util::config::USE_HUGE_PAGE);
+  if (!_shared_weights)
+  {
+    // The optimizer also sweeps the padding between flat gradients, so keep it zero
+    _mem_alloc =
+      std::make_shared<basic::Allocator>(_mem_planner->capacity(), _flat_gradients, huge_page);
+    assert(_mem_alloc->base());
+  }
 
-  const auto vars_capacity = _mem_planner->capacity() * _optim_vars_count;
-  _var_mem_alloc = std::make_shared<basic::Allocator>(vars_capacity);
+  // Optimizer variables must start from zero
+  if (_optim_vars_count > 0)
+  {
+    const auto vars_capacity = _mem_planner->capacity() * _optim_vars_count;
+    _var_mem_alloc = std::make_shared<basic::Allocator>(vars_capacity, true, huge_page);
+  }
+
+  if (_flat_gradients)
+    _grad_mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity(), true, huge_page);
 }
 
 uint8_t *TrainableMemoryManager::getOptVarBuffer(const ir::OperandIndex &ind,
@@ -53,6 +68,14 @@ uint8_t *TrainableMemoryManager::getOptVarBuffer(const ir::OperandIndex &ind,
   return _var_mem_alloc->base() + var_offset + mem_blk.offset;
 }
 
+uint8_t *TrainableMemoryManager::getGradientBuffer(const ir::OperandIndex &ind) const
+{
+  assert(_flat_gradients);
+  assert(_mem_planner->memory_plans().find(ind) != _mem_planner->memory_plans().end());
+  const auto &mem_blk = _mem_planner->memory_plans().at(ind);
+  return _grad_mem_alloc->base() + mem_blk.offset;
+}
+
 DisposableMemoryManager::DisposableMemoryManager() : _mem_planner{createMemoryPlanner()}
 {
   // DO NOTHING
@@ -70,7 +93,7 @@ DisposableMemoryManager::createMemoryPlanner(const std::string planner_id)
   return MemoryPlannerFactory<DisposableTensorIndex>::get().create(planner_id);
 }
 
-void DisposableMemoryManager::claimPlan(const DisposableTensorIndex &ind, uint32_t size)
+void DisposableMemoryManager::claimPlan(const DisposableTensorIndex &ind, size_t size)
 {
   _mem_planner->claim(ind, size);
 }
@@ -119,7 +142,7 @@ uint8_t *LayerScopeMemoryManager::getBuffer(const LayerScopeTensorIndex &ind) co
 
 void LayerScopeMemoryManager::deallocate(void) { _mem_alloc->release(); }
 
-void LayerScopeMemoryManager::claimPlan(const LayerScopeTensorIndex &ind, uint32_t size)
+void LayerScopeMemoryManager::claimPlan(const LayerScopeTensorIndex &ind, size_t size)
 {
   _mem_planner->claim(ind, size);
 }
@@ -34,15 +34,26 @@ using MemoryManager = backend::basic::MemoryManager;
 class TrainableMemoryManager : public MemoryManager
 {
 public:
-  TrainableMemoryManager(uint32_t optimizer_vars_count);
+  /**
+   * @param flat_gradients Whether gradients are allocated in a buffer that mirrors the layout of
+   *                       trainable tensors, so that the optimizer can sweep all of them at once
+   * @param shared_weights Whether trainable tensors use buffers of another executor, so that their
+   *                       buffer is not allocated here
+   */
+  TrainableMemoryManager(uint32_t optimizer_vars_count, bool flat_gradients = false,
+                         bool shared_weights = false);
   virtual ~TrainableMemoryManager() = default;
 
   void allocate(void);
   uint8_t *getOptVarBuffer(const ir::OperandIndex &ind, uint32_t pos_var) const;
+  uint8_t *getGradientBuffer(const ir::OperandIndex &ind) const;
 
 private:
   std::shared_ptr<basic::Allocator> _var_mem_alloc;
+  std::shared_ptr<basic::Allocator> _grad_mem_alloc;
   uint32_t _optim_vars_count;
+  bool _flat_gradients;
+  bool _shared_weights;
 };
 
 class DisposableMemoryManager
@@ -54,7 +65,7 @@ public:
   uint8_t *getBuffer(const DisposableTensorIndex &ind) const;
   void deallocate(void) { _mem_alloc->release(); }
 
-  void claimPlan(const DisposableTensorIndex &ind, uint32_t size);
+  void claimPlan(const DisposableTensorIndex &ind, size_t size);
   void releasePlan(const DisposableTensorIndex &ind);
 
   std::shared_ptr<basic::Allocator> getMemAlloc() { return _mem_alloc; }
@@ -77,7 +88,7 @@ public:
   uint8_t *getBuffer(const LayerScopeTensorIndex &ind) const;
   void deallocate(void);
 
-  void claimPlan(const LayerScopeTensorIndex &ind, uint32_t size);
+  void claimPlan(const LayerScopeTensorIndex &ind, size_t size);
   void releasePlan(const LayerScopeTensorIndex &ind);
 
 private:
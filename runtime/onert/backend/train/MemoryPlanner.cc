@@ -62,7 +62,7 @@ template <typename Index> void BumpPlanner<Index>::release(const Index &ind)
 template <typename Index> void FirstFitPlanner<Index>::claim(const Index &ind, size_t size)
 {
   // Find the right position for claiming
-  uint32_t next_offset = 0;
+  size_t next_offset = 0;
   for (const auto &[claimed_base_offset, claimed_index] : _claim_table)
   {
     auto claimed_size = _mem_plans[claimed_index].size;
@@ -97,8 +97,8 @@ template <typename Index> void FirstFitPlanner<Index>::release(const Index &ind)
   {
     if (it->second == ind)
     {
-      uint32_t offset = it->first;
-      uint32_t size = _mem_plans[ind].size;
+      size_t offset = it->first;
+      size_t size = _mem_plans[ind].size;
 
       _claim_table.erase(it);
 
@@ -154,11 +154,11 @@ template <typename Index> void WICPlanner<Index>::buildMemoryPlans()
   {
     VERBOSE(WIC_PLANNER) << "build_plan(" << ind << "): [" << size << "sz]" << std::endl;
 
-    uint32_t next_offset = 0;
+    size_t next_offset = 0;
     if (_interference_graph.count(ind))
     {
       // Find interfered memory plans and sort them by offset
-      std::multimap<uint32_t, uint32_t> interfered_plans;
+      std::multimap<size_t, size_t> interfered_plans;
       for (const auto &interference : _interference_graph[ind])
       {
         if (_mem_plans.count(interference))
@@ -62,7 +62,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override { return _capacity; }
+  size_t capacity() override { return _capacity; }
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -70,7 +70,7 @@ public:
   MemoryPlans &memory_plans() override { return _mem_plans; }
 
 private:
-  uint32_t _capacity = 0;
+  size_t _capacity = 0;
   MemoryPlans _mem_plans;
 };
 
@@ -98,7 +98,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override { return _capacity; }
+  size_t capacity() override { return _capacity; }
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -106,10 +106,10 @@ public:
   MemoryPlans &memory_plans() override { return _mem_plans; }
 
 private:
-  uint32_t _capacity = 0;
+  size_t _capacity = 0;
   MemoryPlans _mem_plans;
-  // Use std::map because claim() assumes that _claim_table is sorted by uint32_t(base_offset)
-  std::map<uint32_t, Index> _claim_table;
+  // Use std::map because claim() assumes that _claim_table is sorted by size_t(base_offset)
+  std::map<size_t, Index> _claim_table;
 };
 
 /**
@@ -138,7 +138,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override
+  size_t capacity() override
   {
     if (!_initialized)
       buildMemoryPlans();
@@ -154,12 +154,12 @@ private:
   void buildMemoryPlans();
 
   bool _initialized;
-  uint32_t _capacity;
+  size_t _capacity;
   MemoryPlans _mem_plans;
   std::unordered_set<Index> _live_indices;
   std::unordered_map<Index, std::vector<Index>> _interference_graph;
   // Sort tensors by descending order of size
-  std::multimap<uint32_t, Index, std::greater<uint32_t>> _indices;
+  std::multimap<size_t, Index, std::greater<size_t>> _indices;
 };
 
 } // namespace train
@@ -50,7 +50,7 @@ public:
   }
 
   // Claim plan and verify newly added plan, call ASSERT_* on failure
-  void claim(uint32_t first_idx, uint32_t second_idx, size_t size, uint32_t expected_offset)
+  void claim(uint32_t first_idx, uint32_t second_idx, size_t size, size_t expected_offset)
   {
     auto index = to_index<Index>(first_idx, second_idx);
     _planner.claim(index, size);
@@ -66,15 +66,14 @@ public:
   }
 
   // Verify capacity, call ASSERT_* on failure
-  void capacity(uint32_t expected_capacity)
+  void capacity(size_t expected_capacity)
   {
     auto actual_capacity = _planner.capacity();
     ASSERT_EQ(actual_capacity, expected_capacity);
   }
 
   // Verify memory_plans's size and offset, calls ASSERT_* on failure
-  void verify(uint32_t first_idx, uint32_t second_idx, size_t expected_size,
-              uint32_t expected_offset)
+  void verify(uint32_t first_idx, uint32_t second_idx, size_t expected_size, size_t expected_offset)
   {
     auto index = to_index<Index>(first_idx, second_idx);
     auto mem_blk = _planner.memory_plans()[index];
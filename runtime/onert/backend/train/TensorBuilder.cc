@@ -26,10 +26,15 @@ namespace train
 {
 
 TensorBuilder::TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg,
-                             const exec::train::optimizer::Optimizer *optimizer)
-  : _tensor_reg{tensor_reg}, _tensor_mgr{new TensorManager(tensor_reg, optimizer->getVarCount())},
-    _optimizer{optimizer}
-{
+                             const exec::train::optimizer::Optimizer *optimizer, bool recompute,
+                             bool flat_gradients,
+                             const ir::OperandIndexMap<uint8_t *> &shared_trainables)
+  : _tensor_reg{tensor_reg}, _optimizer{optimizer},
+    // Only the owner of trainable tensors updates them
+    _optim_vars_count{shared_trainables.empty() ? optimizer->getVarCount() : 0}
+{
+  _tensor_mgr = std::make_unique<TensorManager>(tensor_reg, _optim_vars_count, recompute,
+                                                flat_gradients, shared_trainables);
   /* empty */
 }
 
@@ -70,7 +75,7 @@ void TensorBuilder::registerBackwardTensorInfo(const ir::OperandIndex &index,
     _tensor_reg->setGradientTensor(index, std::move(tensor));
 
     // Initialize tensors for gradient variables
-    for (uint32_t i = 0; i < _optimizer->getVarCount(); ++i)
+    for (uint32_t i = 0; i < _optim_vars_count; ++i)
     {
       auto tensor = std::make_unique<Tensor>(info);
       _tensor_reg->getTrainableTensor(index)->appendOptVar(std::move(tensor));
@@ -95,6 +100,19 @@ void TensorBuilder::registerDisposableBackwardTensorInfo(const DisposableTensorI
   _disposable_backprops.add(index);
 }
 
+void TensorBuilder::registerStashedTensor(const ir::OperandIndex &index)
+{
+  assert(isRegistered(index) && !_as_constants[index]);
+
+  const auto &info = _tensor_info_map.at(index);
+  _tensor_mgr->claimStashPlan(index, info.shape().num_elements() * sizeof(uint16_t));
+}
+
+uint8_t *TensorBuilder::getStashBuffer(const ir::OperandIndex &index) const
+{
+  return _tensor_mgr->getStashBuffer(index);
+}
+
 void TensorBuilder::notifyFirstUse(const ir::OperandIndex &index)
 {
   // TODO Support momory plan
@@ -174,6 +192,7 @@ void TensorBuilder::allocate(void)
 {
   _tensor_mgr->allocateNonConstTensors();
   _tensor_mgr->allocateTrainableTensors();
+  _tensor_mgr->allocateStashBuffers();
 }
 
 void TensorBuilder::allocateBackward(void)
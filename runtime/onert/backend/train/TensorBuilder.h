@@ -35,8 +35,14 @@ namespace train
 class TensorBuilder
 {
 public:
+  /**
+   * @param shared_trainables Buffers of trainable tensors owned by another executor. If given,
+   *                          trainable tensors use them and have no optimizer variables.
+   */
   TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg,
-                const exec::train::optimizer::Optimizer *optimizer);
+                const exec::train::optimizer::Optimizer *optimizer, bool recompute = false,
+                bool flat_gradients = false,
+                const ir::OperandIndexMap<uint8_t *> &shared_trainables = {});
 
   /**
    * @brief     Register tensor information to allocate on train backend
@@ -55,6 +61,14 @@ public:
   void registerDisposableBackwardTensorInfo(const DisposableTensorIndex &index,
                                             const ir::OperandInfo &info);
 
+  /**
+   * @brief     Register a non-constant tensor to be kept in a 16-bit type between forwarding and
+   *            backwarding
+   * @param[in] ind    Operand index
+   */
+  void registerStashedTensor(const ir::OperandIndex &ind);
+  uint8_t *getStashBuffer(const ir::OperandIndex &ind) const;
+
   // TODO Support memory plan of all tensors
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
@@ -78,6 +92,7 @@ private:
   ir::OperandIndexMap<bool> _as_constants;
   util::Set<DisposableTensorIndex> _disposable_backprops;
   const exec::train::optimizer::Optimizer *_optimizer;
+  const uint32_t _optim_vars_count;
 };
 
 } // namespace train
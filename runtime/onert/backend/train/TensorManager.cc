@@ -53,12 +53,17 @@ namespace backend
 namespace train
 {
 
-TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_t optim_vars_count)
-  : _nonconst_mgr{new MemoryManager()},
-    _trainable_mgr{new TrainableMemoryManager(optim_vars_count)},
+TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_t optim_vars_count,
+                             bool recompute, bool flat_gradients,
+                             const ir::OperandIndexMap<uint8_t *> &shared_trainables)
+  : _nonconst_mgr{recompute ? new MemoryManager("Interval") : new MemoryManager()},
+    _trainable_mgr{
+      new TrainableMemoryManager(optim_vars_count, flat_gradients, !shared_trainables.empty())},
     _back_prop_mgr{new MemoryManager()}, _gradient_mgr{new MemoryManager()},
     // TODO Find a suitable planner of disposable tensors to reduce peak memory usage
-    _disposable_back_prop_mgr{new DisposableMemoryManager()}, _tensors{reg}
+    _disposable_back_prop_mgr{new DisposableMemoryManager()}, _stash_mgr{new MemoryManager("Bump")},
+    _tensors{reg},
+    _flat_gradients{flat_gradients}, _shared_trainables{shared_trainables}
 {
   // DO NOTHING
 }
@@ -67,10 +72,26 @@ void TensorManager::allocateNonConstTensors()
 {
   allocateMemory(_nonconst_mgr.get(), _tensors->nonconst_tensors(),
                  std::string{"               TENSOR "});
+  VERBOSE(TensorManager) << "Planned memory of non-constant tensors: " << _nonconst_mgr->capacity()
+                         << " bytes" << std::endl;
 }
 
 void TensorManager::allocateTrainableTensors()
 {
+  if (!_shared_trainables.empty())
+  {
+    // The plan of trainable tensors is still needed to lay out flat gradients
+    _trainable_mgr->allocate();
+    for (const auto &[index, trainable_tensor] : _tensors->trainable_tensors())
+    {
+      auto *buffer = _shared_trainables.at(index);
+      trainable_tensor->setBuffer(buffer);
+      VERBOSE(TensorManager) << std::string{"SHARED TRAINABLE TENSOR "} << index << " : "
+                             << static_cast<void *>(buffer) << std::endl;
+    }
+    return;
+  }
+
   allocateMemory(_trainable_mgr.get(), _tensors->trainable_tensors(),
                  std::string{"     TRAINABLE TENSOR "});
 
@@ -96,8 +117,21 @@ void TensorManager::allocateBackPropTensors()
 
 void TensorManager::allocateGradientTensors()
 {
-  allocateMemory(_gradient_mgr.get(), _tensors->gradient_tensors(),
-                 std::string{"     GRADIENT TENSOR "});
+  if (!_flat_gradients)
+  {
+    allocateMemory(_gradient_mgr.get(), _tensors->gradient_tensors(),
+                   std::string{"     GRADIENT TENSOR "});
+    return;
+  }
+
+  // Gradients have been allocated when calling allocate() of TrainableMemoryManager
+  for (const auto &[index, gradient_tensor] : _tensors->gradient_tensors())
+  {
+    auto *buffer = _trainable_mgr->getGradientBuffer(index);
+    gradient_tensor->setBuffer(buffer);
+    VERBOSE(TensorManager) << std::string{"     GRADIENT TENSOR "} << index << " : "
+                           << static_cast<void *>(buffer) << std::endl;
+  }
 }
 
 void TensorManager::allocateDisposableBackPropTensors()
@@ -106,6 +140,13 @@ void TensorManager::allocateDisposableBackPropTensors()
                  std::string{"DISPOSABLE BACK_PROP TENSOR "});
 }
 
+void TensorManager::allocateStashBuffers()
+{
+  _stash_mgr->allocate();
+  VERBOSE(TensorManager) << "Planned memory of stashed activations: " << _stash_mgr->capacity()
+                         << " bytes" << std::endl;
+}
+
 void TensorManager::claimNonConstPlan(const ir::OperandIndex &index)
 {
   auto tensor = _tensors->getNonConstTensor(index);
@@ -159,6 +200,9 @@ void TensorManager::claimGradientPlan(const ir::OperandIndex &index)
   auto tensor = _tensors->getGradientTensor(index);
   assert(tensor && !tensor->is_dynamic());
 
+  if (_flat_gradients)
+    return;
+
   auto size = alignedSize(tensor->total_size(), _align);
   _gradient_mgr->claimPlan(index, size);
 }
@@ -167,6 +211,9 @@ void TensorManager::releaseGradientPlan(const ir::OperandIndex &index)
 {
   assert(_tensors->getGradientTensor(index) && !_tensors->getGradientTensor(index)->is_dynamic());
 
+  if (_flat_gradients)
+    return;
+
   _gradient_mgr->releasePlan(index);
 }
 
@@ -187,6 +234,17 @@ void TensorManager::releaseDisposableBackPropPlan(const DisposableTensorIndex &i
   _disposable_back_prop_mgr->releasePlan(index);
 }
 
+void TensorManager::claimStashPlan(const ir::OperandIndex &index, size_t size)
+{
+  // Stashed activations are alive together when forwarding turns into backwarding
+  _stash_mgr->claimPlan(index, alignedSize(size, _align));
+}
+
+uint8_t *TensorManager::getStashBuffer(const ir::OperandIndex &index) const
+{
+  return _stash_mgr->getBuffer(index);
+}
+
 } // namespace train
 } // namespace backend
 } // namespace onert
@@ -41,7 +41,17 @@ public:
   static constexpr uint64_t _align = 16;
 
 public:
-  TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_t optim_vars_count);
+  /**
+   * @param recompute Whether non-constant tensors are recomputed or unstashed in backwarding. Such
+   *                  tensors are claimed again after release, which only IntervalPlanner supports.
+   * @param flat_gradients Whether gradient tensors mirror the layout of trainable tensors instead
+   *                       of being planned per operation
+   * @param shared_trainables Buffers of trainable tensors owned by another executor, which are
+   *                          set to trainable tensors instead of allocating them
+   */
+  TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_t optim_vars_count,
+                bool recompute = false, bool flat_gradients = false,
+                const ir::OperandIndexMap<uint8_t *> &shared_trainables = {});
   virtual ~TensorManager() = default;
 
   void allocateNonConstTensors();
@@ -49,6 +59,7 @@ public:
   void allocateBackPropTensors();
   void allocateGradientTensors();
   void allocateDisposableBackPropTensors();
+  void allocateStashBuffers();
   // TODO Add member functions to deallocate tensors
 
   void claimNonConstPlan(const ir::OperandIndex &ind);
@@ -61,6 +72,8 @@ public:
   void releaseGradientPlan(const ir::OperandIndex &ind);
   void claimDisposableBackPropPlan(const DisposableTensorIndex &ind);
   void releaseDisposableBackPropPlan(const DisposableTensorIndex &ind);
+  void claimStashPlan(const ir::OperandIndex &ind, size_t size);
+  uint8_t *getStashBuffer(const ir::OperandIndex &ind) const;
   // TODO Add member functions related to LayerScopeMemoryManager
 
 private:
@@ -69,9 +82,13 @@ private:
   std::unique_ptr<MemoryManager> _back_prop_mgr;
   std::unique_ptr<MemoryManager> _gradient_mgr;
   std::unique_ptr<DisposableMemoryManager> _disposable_back_prop_mgr;
+  // Activations kept in a 16-bit type between forwarding and backwarding
+  std::unique_ptr<MemoryManager> _stash_mgr;
   // TODO: enable _layer_scope_mgr
   // std::unique_ptr<LayerScopeMemoryManager> _layer_scope_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
+  const bool _flat_gradients;
+  const ir::OperandIndexMap<uint8_t *> _shared_trainables;
 };
 
 } // namespace train
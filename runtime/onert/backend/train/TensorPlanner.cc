@@ -16,8 +16,13 @@
 
 #include "TensorPlanner.h"
 
+#include <ir/OperationIndexMap.h>
 #include <util/logging.h>
 
+#include <algorithm>
+#include <map>
+#include <tuple>
+
 namespace onert
 {
 namespace backend
@@ -26,8 +31,11 @@ namespace train
 {
 
 TensorPlanner::TensorPlanner(const ir::train::TrainableGraph &tgraph,
-                             const util::Set<ir::OperandIndex> &external_operands)
-  : _tgraph{tgraph}, _external_operands{external_operands}
+                             const util::Set<ir::OperandIndex> &external_operands,
+                             const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+                             const util::Set<ir::OperandIndex> &stashed_tensors)
+  : _tgraph{tgraph}, _external_operands{external_operands}, _recompute_segments{recompute_segments},
+    _stashed_tensors{stashed_tensors}
 {
   // DO NOTHING
   // TODO Remove the following lines
@@ -37,6 +45,12 @@ TensorPlanner::TensorPlanner(const ir::train::TrainableGraph &tgraph,
 
 void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
 {
+  if (!_recompute_segments.empty() || !_stashed_tensors.empty())
+  {
+    planReclaimedNonConstTensors(tensor_builder);
+    return;
+  }
+
   VERBOSE(BackendContext) << "Start planning non-constant tensors" << std::endl;
 
   const auto &training_usedefs = _tgraph.trainingUseDefs();
@@ -210,6 +224,192 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   VERBOSE(BackendContext) << "Finish planning non-constant tensors" << std::endl;
 }
 
+void TensorPlanner::planReclaimedNonConstTensors(TensorBuilder *tensor_builder)
+{
+  VERBOSE(BackendContext) << "Start planning non-constant tensors with recomputation or stashing"
+                          << std::endl;
+
+  const auto &training_usedefs = _tgraph.trainingUseDefs();
+
+  auto is_planned = [&](const ir::OperandIndex &index) {
+    return !_external_operands.contains(index) && tensor_builder->isRegistered(index) &&
+           !_tgraph.operands().at(index).isConstant();
+  };
+
+  ir::OperationIndexMap<uint32_t> segment_of;
+  for (uint32_t k = 0; k < _recompute_segments.size(); ++k)
+  {
+    for (const auto &op_index : _recompute_segments[k])
+    {
+      if (_tgraph.operations().exist(op_index))
+        segment_of[op_index] = k;
+    }
+  }
+
+  // Tensors defined and used only in a recomputed segment are released after forwarding and
+  // defined again by the recomputation. The others are checkpoints and kept as usual.
+  util::Set<ir::OperandIndex> recomputed_tensors;
+  _tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (!is_planned(index))
+      return;
+    const auto def = operand.getDef();
+    if (!def.valid() || segment_of.find(def) == segment_of.end())
+      return;
+    if (operand.getUses().size() == 0 || _tgraph.getOutputs().contains(index))
+      return;
+    for (const auto &use : operand.getUses())
+    {
+      const auto it = segment_of.find(use);
+      if (it == segment_of.end() || it->second != segment_of.at(def))
+        return;
+    }
+    recomputed_tensors.add(index);
+  });
+
+  // Lifetimes of each tensor as [first, last] steps. A recomputed tensor has two lifetimes, one
+  // in forwarding and the other from its recomputation, which share the same memory. So does a
+  // stashed tensor, whose second lifetime starts when it is unstashed in backwarding.
+  std::map<ir::OperandIndex, std::vector<std::pair<uint32_t, uint32_t>>> lifetimes;
+  uint32_t step = 0;
+  auto touch = [&](const ir::OperandIndex &index, bool redefined) {
+    auto &intervals = lifetimes[index];
+    if (intervals.empty() || redefined)
+      intervals.emplace_back(step, step);
+    else
+      intervals.back().second = step;
+  };
+  auto forward = [&](const ir::OperationIndex &op_index, bool recompute) {
+    ++step;
+    const auto &op = _tgraph.operations().at(op_index);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (is_planned(input))
+        touch(input, false);
+    }
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (is_planned(output))
+        touch(output, recompute && recomputed_tensors.contains(output));
+    }
+  };
+
+  // Tensors without def or use last from the beginning or until the end like planNonConstTensors()
+  for (const auto &[operand_index, operand_usedefs] : training_usedefs)
+  {
+    if (operand_index.is_forward() && is_planned(operand_index.index()) &&
+        operand_usedefs.getTrainingDefs().size() == 0)
+      touch(operand_index.index(), false);
+  }
+
+  for (const auto &op_index : _tgraph.topolSortOperations())
+    forward(op_index, false);
+
+  // Recompute a segment right before its first backwarding operation as TrainableExecutor does
+  std::vector<bool> recomputed(_recompute_segments.size(), false);
+  util::Set<ir::OperandIndex> unstashed;
+  for (const auto &op_index : _tgraph.essentialBackwardOrder())
+  {
+    const auto &op = _tgraph.operation(op_index);
+    const auto it = segment_of.find(op_index);
+    if (op.isRequiredForBackward() && it != segment_of.end() && !recomputed[it->second])
+    {
+      recomputed[it->second] = true;
+      for (const auto &seg_op_index : _recompute_segments[it->second])
+      {
+        if (_tgraph.operations().exist(seg_op_index))
+          forward(seg_op_index, true);
+      }
+    }
+
+    ++step;
+    const auto training_op_index = ir::train::TrainingOperationIndex{op_index, false};
+    auto op_inputs = op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+    auto op_outputs = op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+    for (const auto &index : (op_inputs + op_outputs) | ir::Remove::DUPLICATED)
+    {
+      if (!is_planned(index))
+        continue;
+      const auto &uses =
+        training_usedefs.at(ir::train::TrainingOperandIndex{index, true}).getTrainingUses();
+      if (uses.find(training_op_index) == uses.end())
+        continue;
+
+      const bool unstash = _stashed_tensors.contains(index) && !unstashed.contains(index);
+      if (unstash)
+        unstashed.add(index);
+      touch(index, unstash);
+    }
+  }
+
+  ++step;
+  for (const auto &[operand_index, operand_usedefs] : training_usedefs)
+  {
+    if (operand_index.is_forward() && is_planned(operand_index.index()) &&
+        operand_usedefs.getTrainingUses().size() == 0)
+      touch(operand_index.index(), false);
+  }
+
+  // Claim before release at the same step because they are used by the same operation
+  std::vector<std::tuple<uint32_t, bool, ir::OperandIndex>> events;
+  for (const auto &[index, intervals] : lifetimes)
+  {
+    for (const auto &[first, last] : intervals)
+    {
+      events.emplace_back(first, false, index);
+      events.emplace_back(last, true, index);
+    }
+  }
+  std::sort(events.begin(), events.end());
+
+  // Report the peak of live tensors with and without releasing them in the middle
+  auto peak = [&](bool with_recompute) {
+    std::vector<std::pair<uint32_t, int64_t>> deltas;
+    for (const auto &[index, intervals] : lifetimes)
+    {
+      const int64_t size = _tgraph.operands().at(index).info().total_size();
+      if (with_recompute)
+      {
+        for (const auto &[first, last] : intervals)
+        {
+          deltas.emplace_back(2 * first, size);
+          deltas.emplace_back(2 * last + 1, -size);
+        }
+      }
+      else
+      {
+        deltas.emplace_back(2 * intervals.front().first, size);
+        deltas.emplace_back(2 * intervals.back().second + 1, -size);
+      }
+    }
+    std::sort(deltas.begin(), deltas.end());
+    int64_t live = 0;
+    int64_t max_live = 0;
+    for (const auto &delta : deltas)
+    {
+      live += delta.second;
+      max_live = std::max(max_live, live);
+    }
+    return max_live;
+  };
+  VERBOSE(BackendContext) << "Peak of non-constant tensors: " << peak(false)
+                          << " bytes without recomputation or stashing, " << peak(true)
+                          << " bytes with " << _recompute_segments.size()
+                          << " recomputed segment(s) and " << _stashed_tensors.size()
+                          << " stashed tensor(s)" << std::endl;
+
+  for (const auto &[event_step, is_release, index] : events)
+  {
+    UNUSED_RELEASE(event_step);
+    if (is_release)
+      tensor_builder->notifyLastUse(index);
+    else
+      tensor_builder->notifyFirstUse(index);
+  }
+
+  VERBOSE(BackendContext) << "Finish planning non-constant tensors with recomputation or stashing"
+                          << std::endl;
+}
+
 void TensorPlanner::planTrainableTensors(TensorBuilder *tensor_builder)
 {
   VERBOSE(BackendContext) << "Start planning constant tensors" << std::endl;
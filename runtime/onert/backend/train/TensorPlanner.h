@@ -33,7 +33,9 @@ class TensorPlanner
 {
 public:
   TensorPlanner(const ir::train::TrainableGraph &tgraph,
-                const util::Set<ir::OperandIndex> &external_operands);
+                const util::Set<ir::OperandIndex> &external_operands,
+                const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+                const util::Set<ir::OperandIndex> &stashed_tensors);
   TensorPlanner(const TensorPlanner &) = delete;
   TensorPlanner(TensorPlanner &&) = delete;
   TensorPlanner &operator=(const TensorPlanner &) = delete;
@@ -47,12 +49,15 @@ public:
   void planDisposableBackPropTensors(TensorBuilder *tensor_builder);
 
 private:
+  void planReclaimedNonConstTensors(TensorBuilder *tensor_builder);
   ir::OperandIndexSequence getOutgoingBackPropSeq(const ir::OperationIndex &op_index,
                                                   const TensorBuilder *tensor_builder);
 
 private:
   const ir::train::TrainableGraph &_tgraph;
   const util::Set<ir::OperandIndex> &_external_operands;
+  const std::vector<std::vector<ir::OperationIndex>> &_recompute_segments;
+  const util::Set<ir::OperandIndex> &_stashed_tensors;
 };
 
 } // namespace train
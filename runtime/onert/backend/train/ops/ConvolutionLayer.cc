@@ -19,34 +19,11 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/Conv.h>
-#include <cker/operation/Transpose.h>
 #include <cker/train/operation/Conv.h>
 #include <cker/train/operation/ReLU.h>
 
 #include <cker/operation/TransposeConv.h>
 
-namespace
-{
-
-using namespace onert;
-
-template <typename Tensor>
-std::unique_ptr<Tensor> createTransposedWeights(const backend::IPortableTensor *origin_weights)
-{
-  const auto &origin_shape = origin_weights->getShape();
-  assert(origin_shape.rank() == 4);
-
-  auto transposed_info = origin_weights->get_info();
-  // OHWI to HWIO
-  auto transposed_shape =
-    ir::Shape{origin_shape.dim(1), origin_shape.dim(2), origin_shape.dim(3), origin_shape.dim(0)};
-  transposed_info.shape(transposed_shape);
-
-  return std::make_unique<Tensor>(transposed_info);
-}
-
-} // namespace
-
 namespace onert
 {
 namespace backend
@@ -58,15 +35,14 @@ namespace ops
 
 ConvolutionLayer::ConvolutionLayer()
   : cpu::ops::ConvolutionLayer(), _grad_weights{nullptr}, _grad_bias{nullptr},
-    _back_prop_input{nullptr}, _back_prop_output{nullptr}, _transposed_weights{nullptr}
+    _back_prop_input{nullptr}, _back_prop_output{nullptr}
 {
   // DO NOTHING
 }
 
 ConvolutionLayer::~ConvolutionLayer() = default;
 
-void ConvolutionLayer::configureBackward(const IPortableTensor *weights,
-                                         IPortableTensor *back_prop_input,
+void ConvolutionLayer::configureBackward(IPortableTensor *back_prop_input,
                                          IPortableTensor *grad_weights, IPortableTensor *grad_bias,
                                          const IPortableTensor *back_prop_output,
                                          const ir::Activation activation)
@@ -79,19 +55,10 @@ void ConvolutionLayer::configureBackward(const IPortableTensor *weights,
   if (_dilationHeightFactor != 1 || _dilationWidthFactor != 1)
     throw std::runtime_error("train ConvolutionLayer: Unsupported dilation yet");
 
-  // TODO Optimize transposed tensors
-  _transposed_weights = createTransposedWeights<Tensor>(weights);
-  _transposed_weights->setBuffer(
-    std::make_shared<basic::Allocator>(_transposed_weights->total_size()));
-
   _conv_back_prop_output = std::make_unique<BackPropTensor>(back_prop_output->get_info());
   _conv_back_prop_output->setBuffer(
     std::make_shared<basic::Allocator>(_conv_back_prop_output->total_size()));
 
-  _transposed_grad_weights = createTransposedWeights<GradientTensor>(weights);
-  _transposed_grad_weights->setBuffer(
-    std::make_shared<basic::Allocator>(_transposed_grad_weights->total_size()));
-
   if (activation != ir::Activation::NONE)
   {
     _act_back_prop_output = std::make_unique<BackPropTensor>(_back_prop_output->get_info());
@@ -143,43 +110,22 @@ void ConvolutionLayer::backwardFloat32()
   conv_train_params.dilation_width_factor = _dilationWidthFactor;
   conv_train_params.dilation_height_factor = _dilationHeightFactor;
 
-  // Transpose weights from OHWI to HWIO
-  auto transposed_weights = _transposed_weights.get();
-  assert(transposed_weights->getShape().rank() == 4);
-  nnfw::cker::TransposeParams transpose_param;
-  transpose_param.perm_count = transposed_weights->getShape().rank();
-  transpose_param.perm[0] = 1;
-  transpose_param.perm[1] = 2;
-  transpose_param.perm[2] = 3;
-  transpose_param.perm[3] = 0;
-  nnfw::cker::Transpose(transpose_param, getShape(_kernel), getBuffer<float>(_kernel),
-                        getShape(transposed_weights), getBuffer<float>(transposed_weights));
+  // Weights and their gradient are used in OHWI as they are, without transposing to HWIO
+  assert(_kernel->getShape().rank() == 4);
+  assert(_grad_weights->getShape().rank() == 4);
+  constexpr auto filter_layout = nnfw::cker::train::ConvFilterLayout::kOHWI;
 
   // Calculate gradient for input
   nnfw::cker::train::ConvInputGrad(
-    conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act),
-    getShape(transposed_weights), getBuffer<float>(transposed_weights), _paddingBottom,
-    _paddingRight, getShape(_back_prop_input), getBuffer<float>(_back_prop_input));
+    conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_kernel),
+    getBuffer<float>(_kernel), _paddingBottom, _paddingRight, getShape(_back_prop_input),
+    getBuffer<float>(_back_prop_input), filter_layout);
 
   // Calculate gradient for weights
-  auto transposed_grad_weights = _transposed_grad_weights.get();
-  assert(_grad_weights->getShape().rank() == 4);
-  assert(transposed_grad_weights->getShape().rank() == 4);
   nnfw::cker::train::ConvFilterGrad(
     conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_input),
-    getBuffer<float>(_input), _paddingBottom, _paddingRight, getShape(transposed_grad_weights),
-    getBuffer<float>(transposed_grad_weights));
-
-  // Transpose weights'gradient from HWIO to OHWI
-  nnfw::cker::TransposeParams transpose_grad_param;
-  transpose_grad_param.perm_count = transposed_grad_weights->getShape().rank();
-  transpose_grad_param.perm[0] = 3;
-  transpose_grad_param.perm[1] = 0;
-  transpose_grad_param.perm[2] = 1;
-  transpose_grad_param.perm[3] = 2;
-  nnfw::cker::Transpose(transpose_grad_param, getShape(transposed_grad_weights),
-                        getBuffer<float>(transposed_grad_weights), getShape(_grad_weights),
-                        getBuffer<float>(_grad_weights));
+    getBuffer<float>(_input), _paddingBottom, _paddingRight, getShape(_grad_weights),
+    getBuffer<float>(_grad_weights), filter_layout);
 
   // Calculate gradient for bias
   if (_bias)
@@ -38,9 +38,9 @@ public:
   ConvolutionLayer();
   ~ConvolutionLayer();
 
-  void configureBackward(const IPortableTensor *weights, IPortableTensor *back_prop_input,
-                         IPortableTensor *grad_weights, IPortableTensor *grad_bias,
-                         const IPortableTensor *back_prop_output, const ir::Activation activation);
+  void configureBackward(IPortableTensor *back_prop_input, IPortableTensor *grad_weights,
+                         IPortableTensor *grad_bias, const IPortableTensor *back_prop_output,
+                         const ir::Activation activation);
   void forward(bool training) override;
   void backward() override;
 
@@ -54,10 +54,8 @@ private:
   const IPortableTensor *_back_prop_output;
 
   // TODO Consider if these tensors should be built in TensorBuilder
-  std::unique_ptr<Tensor> _transposed_weights;
   std::unique_ptr<BackPropTensor> _conv_back_prop_output;
   std::unique_ptr<BackPropTensor> _act_back_prop_output;
-  std::unique_ptr<GradientTensor> _transposed_grad_weights;
 };
 
 } // namespace ops
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FlatGradientApplier.h"
+
+#include "../TensorManager.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+FlatGradientApplier::FlatGradientApplier() : _optimizer{nullptr}, _targets{}, _ranges{}
+{
+  // DO NOTHING
+}
+
+void FlatGradientApplier::configure(const exec::train::optimizer::Optimizer *optimizer)
+{
+  _optimizer = optimizer;
+}
+
+void FlatGradientApplier::addTarget(const IPortableTensor *gradient, ITrainableTensor *trainable)
+{
+  assert(gradient != nullptr && trainable != nullptr);
+  assert(_ranges.empty());
+
+  if (trainable->data_type() != ir::DataType::FLOAT32 ||
+      gradient->data_type() != ir::DataType::FLOAT32)
+    throw std::runtime_error("FlatGradientApplier: Not supported data type");
+
+  _targets.emplace_back(Target{gradient, trainable});
+}
+
+void FlatGradientApplier::buildRanges()
+{
+  // NOTE Buffers are not known until tensors are allocated, so ranges are built lazily
+  std::sort(_targets.begin(), _targets.end(), [](const Target &lhs, const Target &rhs) {
+    return lhs.trainable->buffer() < rhs.trainable->buffer();
+  });
+
+  const auto var_count = _optimizer->getVarCount();
+  size_t first = 0;
+  while (first < _targets.size())
+  {
+    const auto &head = _targets.at(first);
+    uint8_t *begin = head.trainable->buffer();
+    uint8_t *end = begin + head.trainable->total_size();
+
+    // Merge trainable tensors separated only by alignment padding
+    size_t last = first + 1;
+    for (; last < _targets.size(); ++last)
+    {
+      uint8_t *next = _targets.at(last).trainable->buffer();
+      if (next < end || next - end >= static_cast<ptrdiff_t>(TensorManager::_align))
+        break;
+      end = next + _targets.at(last).trainable->total_size();
+    }
+
+    // Gradients and optimizer variables must be laid out the same as trainable tensors
+    const auto head_vars = head.trainable->optVars();
+    for (size_t i = first; i < last; ++i)
+    {
+      const auto &target = _targets.at(i);
+      const auto offset = target.trainable->buffer() - begin;
+      if (target.gradient->buffer() != head.gradient->buffer() + offset)
+        throw std::runtime_error("FlatGradientApplier: Gradients are not flat");
+
+      const auto opt_vars = target.trainable->optVars();
+      for (uint32_t pos = 0; pos < var_count; ++pos)
+      {
+        if (opt_vars.at(pos)->buffer() != head_vars.at(pos)->buffer() + offset)
+          throw std::runtime_error("FlatGradientApplier: Optimizer variables are not flat");
+      }
+    }
+
+    const auto num_elements = static_cast<int32_t>((end - begin) / sizeof(float));
+    const auto info = ir::OperandInfo::createStaticInfo(ir::Shape{num_elements},
+                                                        ir::TypeInfo{ir::DataType::FLOAT32});
+    Range range;
+    range.gradient = std::make_unique<GradientTensor>(info);
+    range.gradient->setBuffer(head.gradient->buffer());
+    range.trainable = std::make_unique<TrainableTensor>(info);
+    range.trainable->setBuffer(begin);
+    for (uint32_t pos = 0; pos < var_count; ++pos)
+    {
+      range.trainable->appendOptVar(std::make_unique<Tensor>(info));
+      range.trainable->setOptVarBuffer(head_vars.at(pos)->buffer(), pos);
+    }
+    _ranges.emplace_back(std::move(range));
+
+    first = last;
+  }
+}
+
+void FlatGradientApplier::applyGradient(uint32_t training_step)
+{
+  if (_ranges.empty())
+    buildRanges();
+
+  for (auto &&range : _ranges)
+  {
+    _optimizer->applyGradient(
+      std::forward_as_tuple(*range.gradient, *range.trainable, training_step));
+  }
+}
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_FLAT_GRADIENT_APPLIER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_FLAT_GRADIENT_APPLIER_H__
+
+#include "../Tensor.h"
+
+#include <exec/train/IGradientApplier.h>
+#include <exec/train/optimizer/Optimizer.h>
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+/**
+ * @brief Apply gradients of many trainable tensors with as few optimizer calls as possible
+ *
+ * Trainable tensors that are adjacent in memory, together with their gradients and optimizer
+ * variables laid out the same way, are merged into one flat range and updated in one sweep.
+ */
+class FlatGradientApplier : public ::onert::exec::train::IGradientApplier
+{
+public:
+  FlatGradientApplier();
+  ~FlatGradientApplier() = default;
+
+  void configure(const exec::train::optimizer::Optimizer *optimizer);
+  void addTarget(const IPortableTensor *gradient, ITrainableTensor *trainable);
+  void applyGradient(uint32_t training_step) override;
+
+private:
+  void buildRanges();
+
+private:
+  struct Target
+  {
+    const IPortableTensor *gradient;
+    ITrainableTensor *trainable;
+  };
+
+  struct Range
+  {
+    std::unique_ptr<GradientTensor> gradient;
+    std::unique_ptr<TrainableTensor> trainable;
+  };
+
+  const exec::train::optimizer::Optimizer *_optimizer;
+  std::vector<Target> _targets;
+  std::vector<Range> _ranges;
+};
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_FLAT_GRADIENT_APPLIER_H__
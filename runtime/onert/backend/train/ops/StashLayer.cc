@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StashLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/train/operation/Stash.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+std::optional<StashType> toStashType(ir::train::ActivationStash stash)
+{
+  switch (stash)
+  {
+    case ir::train::ActivationStash::None:
+      return std::nullopt;
+    case ir::train::ActivationStash::FLOAT16:
+      return StashType::FLOAT16;
+    case ir::train::ActivationStash::BFLOAT16:
+      return StashType::BFLOAT16;
+    default:
+      throw std::runtime_error("Invalid activation stash type");
+  }
+}
+
+StashLayer::StashLayer()
+  : _tensor{nullptr}, _stash{nullptr}, _type{StashType::FLOAT16}, _external_context{nullptr}
+{
+  // DO NOTHING
+}
+
+void StashLayer::configure(const IPortableTensor *tensor, uint8_t *stash, StashType type,
+                           const std::shared_ptr<ExternalContext> &external_context)
+{
+  if (tensor->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error("StashLayer: Unsupported data type");
+
+  _tensor = tensor;
+  _stash = stash;
+  _type = type;
+  _external_context = external_context;
+}
+
+void StashLayer::forward(bool training)
+{
+  // Nothing will be backwarded
+  if (!training)
+    return;
+
+  auto ruy_context = _external_context->ruy_context();
+  switch (_type)
+  {
+    case StashType::FLOAT16:
+      nnfw::cker::train::Stash(getShape(_tensor), getBuffer<float>(_tensor),
+                               reinterpret_cast<nnfw::cker::Float16 *>(_stash), ruy_context);
+      break;
+    case StashType::BFLOAT16:
+      nnfw::cker::train::Stash(getShape(_tensor), getBuffer<float>(_tensor),
+                               reinterpret_cast<nnfw::cker::BFloat16 *>(_stash), ruy_context);
+      break;
+    default:
+      throw std::runtime_error("StashLayer: Unsupported stash type");
+  }
+}
+
+void StashLayer::backward()
+{
+  // DO NOTHING
+}
+
+UnstashLayer::UnstashLayer()
+  : _stash{nullptr}, _tensor{nullptr}, _type{StashType::FLOAT16}, _external_context{nullptr}
+{
+  // DO NOTHING
+}
+
+void UnstashLayer::configure(const uint8_t *stash, IPortableTensor *tensor, StashType type,
+                             const std::shared_ptr<ExternalContext> &external_context)
+{
+  if (tensor->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error("UnstashLayer: Unsupported data type");
+
+  _stash = stash;
+  _tensor = tensor;
+  _type = type;
+  _external_context = external_context;
+}
+
+void UnstashLayer::forward(bool)
+{
+  // DO NOTHING
+}
+
+void UnstashLayer::backward()
+{
+  auto ruy_context = _external_context->ruy_context();
+  switch (_type)
+  {
+    case StashType::FLOAT16:
+      nnfw::cker::train::Unstash(getShape(_tensor),
+                                 reinterpret_cast<const nnfw::cker::Float16 *>(_stash),
+                                 getBuffer<float>(_tensor), ruy_context);
+      break;
+    case StashType::BFLOAT16:
+      nnfw::cker::train::Unstash(getShape(_tensor),
+                                 reinterpret_cast<const nnfw::cker::BFloat16 *>(_stash),
+                                 getBuffer<float>(_tensor), ruy_context);
+      break;
+    default:
+      throw std::runtime_error("UnstashLayer: Unsupported stash type");
+  }
+}
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
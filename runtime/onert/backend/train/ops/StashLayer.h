@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_STASH_LAYER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_STASH_LAYER_H__
+
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+#include <exec/train/ITrainableFunction.h>
+#include <ir/train/ActivationStash.h>
+
+#include <optional>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+// 16-bit types to keep fp32 activations in between forwarding and backwarding
+enum class StashType
+{
+  FLOAT16,
+  BFLOAT16,
+};
+
+/**
+ * @brief Get the stash layer type of the activation stash type
+ *
+ * @param stash The activation stash type of training
+ * @return The stash type, or std::nullopt if activations are kept in fp32
+ */
+std::optional<StashType> toStashType(ir::train::ActivationStash stash);
+
+/**
+ * @brief Store a fp32 activation in a 16-bit type after its last use in forwarding
+ *
+ * The fp32 memory of the activation can then be reused until UnstashLayer restores it.
+ */
+class StashLayer : public ::onert::exec::train::ITrainableFunction
+{
+public:
+  StashLayer();
+
+public:
+  void configure(const IPortableTensor *tensor, uint8_t *stash, StashType type,
+                 const std::shared_ptr<ExternalContext> &external_context);
+  void forward(bool training) override;
+  void backward() override;
+
+private:
+  const IPortableTensor *_tensor;
+  uint8_t *_stash;
+  StashType _type;
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+/**
+ * @brief Restore a stashed activation to fp32 before its first use in backwarding
+ */
+class UnstashLayer : public ::onert::exec::train::ITrainableFunction
+{
+public:
+  UnstashLayer();
+
+public:
+  void configure(const uint8_t *stash, IPortableTensor *tensor, StashType type,
+                 const std::shared_ptr<ExternalContext> &external_context);
+  void forward(bool training) override;
+  void backward() override;
+
+private:
+  const uint8_t *_stash;
+  IPortableTensor *_tensor;
+  StashType _type;
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_STASH_LAYER_H__
@@ -48,8 +48,6 @@ void Adam::applyGradient(const UpdateFactors &factors) const
   // Get the variable for exponential moving average of the squared_gradient
   auto v_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(1));
 
-  const auto beta1_power = std::pow(_props.beta1, training_step + 1);
-  const auto beta2_power = std::pow(_props.beta2, training_step + 1);
   // TODO Support nesterov
   const bool use_nesterov = false;
 
@@ -58,15 +56,20 @@ void Adam::applyGradient(const UpdateFactors &factors) const
     throw std::runtime_error("Adam: Invalid gradient tensor");
   }
 
+  if (trainable_tensor.getShape() != m_tensor->getShape() ||
+      trainable_tensor.getShape() != v_tensor->getShape())
+  {
+    throw std::runtime_error("Adam: Invalid optimizer variable");
+  }
+
   switch (grad_tensor.data_type())
   {
     case ir::DataType::FLOAT32:
       nnfw::cker::train::Adam(
-        ops::getShape(&trainable_tensor), ops::getBuffer<float>(&trainable_tensor),
-        ops::getShape(&grad_tensor), ops::getBuffer<float>(&grad_tensor), ops::getShape(m_tensor),
-        ops::getBuffer<float>(m_tensor), ops::getShape(v_tensor), ops::getBuffer<float>(v_tensor),
-        beta1_power, beta2_power, _learning_rate, _props.beta1, _props.beta2, _props.epsilon,
-        use_nesterov);
+        ops::getShape(&trainable_tensor).FlatSize(), ops::getBuffer<float>(&trainable_tensor),
+        ops::getBuffer<float>(&grad_tensor), ops::getBuffer<float>(m_tensor),
+        ops::getBuffer<float>(v_tensor), getLearningRate(training_step), _props.beta1,
+        _props.beta2, _props.epsilon, _props.weight_decay, use_nesterov);
       break;
     default:
       throw std::runtime_error("Adam: Not supported data type");
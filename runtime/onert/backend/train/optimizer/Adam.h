@@ -46,6 +46,7 @@ public:
     double beta1{0.9};
     double beta2{0.999};
     double epsilon{1e-07};
+    double weight_decay{0.0};
   };
 
 public:
@@ -32,14 +32,19 @@ namespace train
 std::unique_ptr<exec::train::optimizer::Optimizer>
 createOptimizer(const ir::train::OptimizerInfo &optim_info)
 {
-  // TODO Set properties of optimizer
   if (optim_info.optim_code == ir::train::OptimizerCode::SGD)
   {
-    return std::make_unique<optimizer::SGD>(optim_info.learning_rate);
+    optimizer::SGD::Property props;
+    props.momentum = optim_info.momentum;
+    props.nesterov = optim_info.nesterov;
+    props.weight_decay = optim_info.weight_decay;
+    return std::make_unique<optimizer::SGD>(props, optim_info.learning_rate);
   }
   else if (optim_info.optim_code == ir::train::OptimizerCode::Adam)
   {
-    return std::make_unique<optimizer::Adam>(optim_info.learning_rate);
+    optimizer::Adam::Property props;
+    props.weight_decay = optim_info.weight_decay;
+    return std::make_unique<optimizer::Adam>(props, optim_info.learning_rate);
   }
   else
     throw std::runtime_error("Invalid optimizer type, " +
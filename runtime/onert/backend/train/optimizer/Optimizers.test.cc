@@ -342,6 +342,12 @@ TEST(Optimizer, SGDVarCount)
   backend::train::optimizer::SGD sgd{};
 
   EXPECT_EQ(sgd.getVarCount(), 0);
+
+  backend::train::optimizer::SGD::Property props;
+  props.momentum = 0.9;
+  backend::train::optimizer::SGD sgd_momentum{props};
+
+  EXPECT_EQ(sgd_momentum.getVarCount(), 1);
 }
 
 TEST(Optimizer, neg_SGDUnmatchedGradientShape)
@@ -367,6 +373,35 @@ TEST(Optimizer, neg_SGDUnmatchedGradientShape)
   }
 }
 
+TEST(Optimizer, neg_SGDUnmatchedVelocityShape)
+{
+  // Unmatched shape
+  {
+    const auto shape = ir::Shape{1, 3, 3};
+    const auto type_info = ir::TypeInfo{ir::DataType::FLOAT32};
+    MockUpTrainableTensor trainable{shape, type_info};
+    MockUpTensor gradient{shape, type_info};
+    MockUpTensor velocity{ir::Shape{2, 2, 2}, type_info};
+
+    std::vector<float> trainable_data = {-1, 2, -3, 4, 5, -6, -7, 8, 9};
+    std::vector<float> gradient_data = {-1, 2, -3, 4, 5, -6, 7, 8, 9};
+    std::vector<float> velocity_data = {0, 0, 0, 0, 0, 0, 0, 0};
+
+    trainable.setData(trainable_data);
+    gradient.setData(gradient_data);
+    velocity.setData(velocity_data);
+
+    trainable.appendOptVar(&velocity);
+
+    backend::train::optimizer::SGD::Property props;
+    props.momentum = 0.9;
+    backend::train::optimizer::SGD sgd{props};
+    backend::train::optimizer::SGD::UpdateFactors factors{gradient, trainable, 0};
+
+    EXPECT_ANY_THROW(sgd.applyGradient(factors));
+  }
+}
+
 TEST(Optimizer, neg_SGDUnsupportedType)
 {
   // Unsupported type
@@ -582,6 +617,17 @@ TEST(Optimizer, CreateOptimizer)
     EXPECT_EQ(sgd->name(), std::string{"SGD"});
   }
 
+  // SGD with momentum
+  {
+    ir::train::OptimizerInfo optim_info;
+    optim_info.optim_code = ir::train::OptimizerCode::SGD;
+    optim_info.learning_rate = 0.001f;
+    optim_info.momentum = 0.9f;
+    auto sgd = backend::train::createOptimizer(optim_info);
+    EXPECT_EQ(sgd->getVarCount(), 1);
+    EXPECT_EQ(sgd->name(), std::string{"SGD"});
+  }
+
   // Adam
   {
     ir::train::OptimizerInfo optim_info;
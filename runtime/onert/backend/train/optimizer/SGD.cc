@@ -19,6 +19,7 @@
 #include "../ops/OperationUtils.h"
 
 #include <cker/train/optimizer/SGD.h>
+#include <misc/polymorphic_downcast.h>
 
 namespace onert
 {
@@ -31,7 +32,7 @@ namespace optimizer
 
 double SGD::getLearningRate(uint32_t) const
 {
-  // TODO Use iteration, momentum, and nesterov
+  // TODO Use iteration
   return _learning_rate;
 }
 
@@ -45,13 +46,28 @@ void SGD::applyGradient(const UpdateFactors &factors) const
     throw std::runtime_error("SGD: Invalid gradient tensor");
   }
 
+  // Get the variable for velocity if momentum is used
+  IPortableTensor *velocity_tensor = nullptr;
+  const auto opt_vars = trainable_tensor.optVars();
+  assert(opt_vars.size() == getVarCount());
+  if (!opt_vars.empty())
+  {
+    velocity_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(0));
+    if (trainable_tensor.getShape() != velocity_tensor->getShape())
+    {
+      throw std::runtime_error("SGD: Invalid optimizer variable");
+    }
+  }
+
   const auto lr = getLearningRate(training_step);
   switch (grad_tensor.data_type())
   {
     case ir::DataType::FLOAT32:
       nnfw::cker::train::GradientDescent(
-        ops::getShape(&trainable_tensor), ops::getBuffer<float>(&trainable_tensor),
-        ops::getShape(&grad_tensor), ops::getBuffer<float>(&grad_tensor), lr);
+        ops::getShape(&trainable_tensor).FlatSize(), ops::getBuffer<float>(&trainable_tensor),
+        ops::getBuffer<float>(&grad_tensor),
+        velocity_tensor ? ops::getBuffer<float>(velocity_tensor) : nullptr, lr, _props.momentum,
+        _props.weight_decay, _props.nesterov);
       break;
     default:
       throw std::runtime_error("SGD: Not supported data type");
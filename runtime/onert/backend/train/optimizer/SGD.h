@@ -42,6 +42,7 @@ public:
   {
     double momentum{0.0};
     bool nesterov{false};
+    double weight_decay{0.0};
   };
 
 public:
@@ -71,7 +72,7 @@ public:
    *s
    * @return The number of optimizer variables
    */
-  virtual uint32_t getVarCount() const override { return 0; };
+  virtual uint32_t getVarCount() const override { return _props.momentum != 0.0 ? 1 : 0; };
 
   /**
    * @brief Apply gradient to a trainable tensor
@@ -46,6 +46,8 @@ struct ContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Whether dynamic tensors keep their memory to reuse it for smaller shapes */
+  bool reserve_dynamic_tensors = false;
 };
 
 class BackendContext
@@ -22,6 +22,8 @@
 #ifndef __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace onert
@@ -33,11 +35,25 @@ namespace basic
 
 /**
  * @brief Class to allocate memory
+ *
+ * The buffer is aligned to a cache line. When huge pages are requested and the buffer is large
+ * enough, it is aligned to the huge page size and advised to be backed by transparent huge pages.
  */
 class Allocator
 {
 public:
-  Allocator(uint32_t capacity);
+  static constexpr size_t kCacheLineSize = 64;
+  static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+public:
+  /**
+   * @brief Construct a new Allocator object
+   * @param[in] capacity  Size of the buffer in bytes
+   * @param[in] zero_fill Whether to fill the buffer with zeros. Arenas whose contents are always
+   *                      written before being read may skip it to avoid touching every page.
+   * @param[in] huge_page Whether to back the buffer with huge pages if possible
+   */
+  Allocator(size_t capacity, bool zero_fill = true, bool huge_page = false);
   /**
    * @brief Get memory base pointer
    * @return base pointer
@@ -46,7 +62,12 @@ public:
   void release() { _base.reset(); }
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  struct Deleter
+  {
+    void operator()(uint8_t *ptr) const;
+  };
+
+  std::unique_ptr<uint8_t[], Deleter> _base;
 };
 
 } // namespace basic
@@ -188,15 +188,15 @@ template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContex
     tensor_builder->registerTensorInfo(ind, obj.info());
   });
 
-  // TODO Get compiler options from compiler, and use it rather than getting it from Env
-  if (util::getConfigString(util::config::EXECUTOR) == "Linear")
+  if (ctx.data().is_linear_executor)
   {
     basic::planTensors(ctx);
   }
   else
   {
     // For the executors that does not have fixed linear execution order:
-    // To make tensors never be deallocated, this is a workaround to use static memory planner
+    // To make tensors never be deallocated, this is a workaround to use static memory planner.
+    // Operations of a backend may run at once on several workers, so no buffer is reused.
     graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &) {
       if (tensor_builder->isRegistered(ind))
         tensor_builder->notifyFirstUse(ind);
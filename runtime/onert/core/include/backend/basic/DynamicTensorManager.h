@@ -41,7 +41,7 @@ namespace basic
 class DynamicTensorManager
 {
 public:
-  DynamicTensorManager(const std::shared_ptr<TensorRegistry> &reg);
+  DynamicTensorManager(const std::shared_ptr<TensorRegistry> &reg, bool reserve = false);
 
   virtual ~DynamicTensorManager() = default;
 
@@ -33,7 +33,7 @@ namespace basic
  */
 struct Block
 {
-  uint32_t offset;
+  size_t offset;
   size_t size;
 };
 
@@ -59,7 +59,7 @@ template <typename Index> struct IMemoryPlanner
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  virtual uint32_t capacity() = 0;
+  virtual size_t capacity() = 0;
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -42,8 +42,9 @@ public:
   uint8_t *getBuffer(const ir::OperandIndex &ind) const;
   void deallocate(void) { _mem_alloc->release(); }
 
-  void claimPlan(const ir::OperandIndex &ind, uint32_t size);
+  void claimPlan(const ir::OperandIndex &ind, size_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  size_t capacity() { return _mem_planner->capacity(); }
 
 private:
   IMemoryPlanner<ir::OperandIndex> *createMemoryPlanner();
@@ -58,15 +59,36 @@ protected:
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  /**
+   * @brief Construct a new DynamicMemoryManager object
+   * @param reserve If true, memory of a tensor is kept on deallocate(const ITensor *) and reused
+   *                by the next allocation of the tensor which fits in it, so that a tensor whose
+   *                shape changes every run is not reallocated each time. The reserved memory is
+   *                freed by deallocate(void).
+   */
+  DynamicMemoryManager(bool reserve = false) : _reserve{reserve} {}
   virtual ~DynamicMemoryManager() = default;
 
-  std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
+  std::shared_ptr<Allocator> allocate(const ITensor *tensor, size_t capacity);
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
+  /**
+   * @brief Get the size of memory reserved for a tensor, 0 if nothing is reserved
+   */
+  size_t reservedCapacity(const ITensor *tensor) const;
+
+private:
+  struct Reservation
+  {
+    std::shared_ptr<Allocator> alloc;
+    size_t capacity = 0;
+  };
+
 private:
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  const bool _reserve;
+  std::unordered_map<const ITensor *, Reservation> _reservations;
 };
 
 } // namespace basic
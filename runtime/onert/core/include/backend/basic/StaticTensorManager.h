@@ -47,16 +47,36 @@ public:
 
   void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info, bool as_const);
 
-  void claimPlan(const ir::OperandIndex &ind, uint32_t size);
+  void claimPlan(const ir::OperandIndex &ind, size_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
+  /**
+   * @brief Make non-constant tensor share the buffer of another tensor
+   *
+   * The buffer is claimed by whichever tensor of the group is claimed first, and released when
+   * all tensors of the group are released. So the lifetime of the buffer covers all of them.
+   *
+   * @param[in] alias  Tensor which does not have its own buffer
+   * @param[in] source Tensor whose buffer is shared. It can be alias of another tensor.
+   * @note  The tensors must have the same size, and nobody may write the buffer while the alias
+   *        is alive except the producer of the source.
+   */
+  void aliasPlan(const ir::OperandIndex &alias, const ir::OperandIndex &source);
+
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
+private:
+  ir::OperandIndex aliasRoot(const ir::OperandIndex &ind) const;
+
 private:
   std::unique_ptr<MemoryManager> _nonconst_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
   DynamicTensorManager *_dynamic_tensor_manager;
+  // Source of each alias tensor
+  ir::OperandIndexMap<ir::OperandIndex> _alias_sources;
+  // Number of claimed tensors sharing the buffer of each root tensor
+  ir::OperandIndexMap<uint32_t> _alias_refs;
 };
 
 } // namespace basic
@@ -37,8 +37,10 @@ namespace basic
 class TensorBuilder
 {
 public:
-  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg);
-  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg, const std::string planner_id);
+  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg,
+                bool reserve_dynamic_tensors = false);
+  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg, const std::string planner_id,
+                bool reserve_dynamic_tensors = false);
 
   /**
    * @brief     Register tensor information to allocate on CPU backend
@@ -50,6 +52,13 @@ public:
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
 
+  /**
+   * @brief     Make a static tensor share the buffer of another static tensor of the same size
+   * @param[in] alias  Tensor which does not have its own buffer
+   * @param[in] source Tensor whose buffer is shared
+   */
+  void registerAlias(const ir::OperandIndex &alias, const ir::OperandIndex &source);
+
   bool isRegistered(const ir::OperandIndex &) const;
 
   void allocate(void);
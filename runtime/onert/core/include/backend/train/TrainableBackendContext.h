@@ -22,6 +22,7 @@
 #include "backend/train/ITrainableBackend.h"
 #include "exec/train/TrainableFnSequence.h"
 #include "ir/OperandIndexMap.h"
+#include "ir/train/ActivationStash.h"
 #include "ir/train/OptimizerInfo.h"
 #include "ir/train/TrainableGraph.h"
 #include "util/Set.h"
@@ -52,6 +53,14 @@ struct TrainableContextData
   bool is_linear_executor;
   /* Optimizer information */
   ir::train::OptimizerInfo optim_info;
+  /* Whether the optimizer updates all trainable tensors in one flat buffer */
+  bool flat_optimizer = false;
+  /* Forward segments whose activations are recomputed during backwarding, in forward order */
+  std::vector<std::vector<onert::ir::OperationIndex>> recompute_segments;
+  /* 16-bit type of activations kept for backwarding */
+  ir::train::ActivationStash activation_stash = ir::train::ActivationStash::None;
+  /* Buffers of trainable tensors owned by another executor, which are used instead of allocating */
+  ir::OperandIndexMap<uint8_t *> shared_trainables;
 };
 
 class TrainableBackendContext
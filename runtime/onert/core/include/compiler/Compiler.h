@@ -64,6 +64,19 @@ public:
    */
   std::shared_ptr<CompilerArtifact> compile(void);
 
+  /**
+   * @brief   Create new executors from lowering result of compiled artifact
+   *
+   * Passes, lowering and shape inference are not run again. Only backend tensors and kernels are
+   * created, and constant data is shared with executors of @c artifact.
+   *
+   * @param[in] artifact  Artifact returned by compile()
+   * @param[in] copts     Compiler options used to compile @c artifact
+   * @return  std::shared_ptr<CompilerArtifact> New executors without lowering result
+   */
+  static std::shared_ptr<CompilerArtifact> createExecutors(const CompilerArtifact &artifact,
+                                                           CompilerOptions *copts);
+
 private:
   std::shared_ptr<ir::Model> _model;
   CompilerOptions *_options;
@@ -67,13 +67,20 @@ struct CompilerOptions
   std::vector<std::string> backend_list;
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
-  int graph_dump_level; //< Graph dump level, values between 0 and 2 are valid
-  std::string executor; //< Executor name to use
+  int graph_dump_level;     //< Graph dump level, values between 0 and 2 are valid
+  std::string executor;     //< Executor name to use
+  int parallel_num_workers; //< Number of worker threads per backend for Parallel executor
+  int pipeline_capacity;    //< Number of requests in flight for pipelined inference
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
-  bool he_scheduler;         //< HEScheduler if true, ManualScheduler otherwise
-  bool he_profiling_mode;    //< Whether HEScheduler profiling mode ON/OFF
-  bool fp16_enable;          //< Whether fp16 mode ON/OFF
-  std::string workspace_dir; //< Workspace directory path
+  bool he_scheduler;             //< HEScheduler if true, ManualScheduler otherwise
+  bool he_profiling_mode;        //< Whether HEScheduler profiling mode ON/OFF
+  bool fp16_enable;              //< Whether fp16 mode ON/OFF
+  bool execution_context_enable; //< Whether to keep lowering result for execution contexts
+  bool memory_aware_linearize;   //< Whether to linearize operations to reduce peak memory
+  bool reserve_dynamic_tensors;  //< Whether dynamic tensors keep their memory for smaller shapes
+  int train_num_replicas;        //< Number of data-parallel replicas of a trainable graph
+  bool train_flat_optimizer;     //< Whether to update all trainable tensors in one optimizer step
+  std::string workspace_dir;     //< Workspace directory path
 };
 
 } // namespace compiler
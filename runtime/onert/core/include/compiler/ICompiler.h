@@ -25,11 +25,26 @@
 #include "exec/IExecutors.h"
 #include "util/TracingCtx.h"
 
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+namespace custom
+{
+class IKernelBuilder;
+} // namespace custom
+} // namespace backend
+} // namespace onert
+
 namespace onert
 {
 namespace compiler
 {
 
+class LoweredGraph;
+
 struct CompilerArtifact
 {
   CompilerArtifact(void) = delete;
@@ -39,6 +54,11 @@ struct CompilerArtifact
 
   std::shared_ptr<exec::IExecutors> _executors;
   std::unique_ptr<const util::TracingCtx> _tracing_ctx;
+  // Lowering result to create executors again by Compiler::createExecutors.
+  // Set only by Compiler, which compiles single model for inference with
+  // CompilerOptions::execution_context_enable.
+  std::unordered_map<ir::SubgraphIndex, std::shared_ptr<const LoweredGraph>> _lowered_subgs;
+  std::shared_ptr<backend::custom::IKernelBuilder> _custom_kernel_builder;
 };
 
 class ICompiler
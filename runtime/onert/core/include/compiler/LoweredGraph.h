@@ -37,6 +37,11 @@ class LoweredGraph : public ILoweredGraph
 {
 public:
   LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options);
+  /**
+   * @brief Copy lowered graph to create executors again without lowering
+   * @note  Constant data of operands is shared with @c lowered_graph
+   */
+  LoweredGraph(const LoweredGraph &lowered_graph);
 
   ir::Graph &graph() override { return _graph; }
   const ir::Graph &graph() const override { return _graph; }
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_BATCHING_EXECUTION_H__
+#define __ONERT_EXEC_BATCHING_EXECUTION_H__
+
+#include "exec/Execution.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to coalesce concurrent requests into one batched execution
+ *
+ * Callers submit requests of the compiled input shape. A worker thread collects requests until
+ * max batch size is reached or the oldest request has waited for the window, concatenates inputs
+ * along the first dimension, runs once with changed input shapes (dynamic shape inference), and
+ * scatters outputs back to the callers.
+ *
+ * @note Every input and output must have batch as its first dimension.
+ */
+class BatchingExecution
+{
+public:
+  /**
+   * @brief Counters of batched execution
+   */
+  struct Stats
+  {
+    uint64_t request_count = 0; //< Number of finished requests
+    uint64_t batch_count = 0;   //< Number of batched executions
+    uint64_t queue_us = 0;      //< Sum of time requests waited to be batched
+    uint64_t latency_us = 0;    //< Sum of time from submit to finish of requests
+    uint64_t execute_us = 0;    //< Sum of time spent by batched executions
+    uint64_t elapsed_us = 0;    //< Time since batching started
+  };
+
+public:
+  /**
+   * @brief     Construct batching front end and start worker thread
+   * @param[in] executors      Compiled executors
+   * @param[in] max_batch_size Max number of requests in a batch
+   * @param[in] window         Max time the oldest request waits for other requests
+   */
+  BatchingExecution(const std::shared_ptr<IExecutors> &executors, uint32_t max_batch_size,
+                    std::chrono::microseconds window);
+  ~BatchingExecution();
+
+public:
+  BatchingExecution(const BatchingExecution &) = delete;
+  BatchingExecution &operator=(const BatchingExecution &) = delete;
+
+public:
+  uint32_t maxBatchSize() const { return _max_batch_size; }
+
+  /**
+   * @brief     Run a request as a part of batch
+   * @param[in] inputs  Input buffers of a request, each holds data of the compiled input shape
+   * @param[in] outputs Output buffers of a request, each can hold data of the compiled output shape
+   * @note      Blocks until outputs are filled. Rethrows exception raised while running the batch.
+   */
+  void run(const std::vector<const void *> &inputs, const std::vector<void *> &outputs);
+
+  Stats stats() const;
+
+private:
+  struct Request;
+
+  void runWorker();
+  void runBatch(const std::vector<Request *> &batch);
+
+private:
+  Execution _execution;
+  const uint32_t _max_batch_size;
+  const std::chrono::microseconds _window;
+  // Shape and size of a request
+  std::vector<ir::Shape> _input_shapes;
+  std::vector<size_t> _input_sizes;
+  std::vector<ir::Shape> _output_shapes;
+  std::vector<size_t> _output_sizes;
+  // Buffers for batched inputs and outputs, used only by worker
+  std::vector<std::vector<uint8_t>> _input_buffers;
+  std::vector<std::vector<uint8_t>> _output_buffers;
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::condition_variable _done_cv;
+  std::deque<Request *> _queue;
+  bool _stopped;
+  Stats _stats;
+  const std::chrono::steady_clock::time_point _start;
+  std::thread _worker;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_BATCHING_EXECUTION_H__
@@ -80,6 +80,8 @@ public:
   void visit(const ir::operation::Reshape &op) override;
   void visit(const ir::operation::ResizeBilinear &op) override;
   void visit(const ir::operation::Reverse &op) override;
+  void visit(const ir::operation::RmsNorm &op) override;
+  void visit(const ir::operation::RoPE &op) override;
   void visit(const ir::operation::Select &op) override;
   void visit(const ir::operation::Shape &op) override;
   void visit(const ir::operation::Slice &op) override;
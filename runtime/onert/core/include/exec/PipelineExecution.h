@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_PIPELINE_EXECUTION_H__
+#define __ONERT_EXEC_PIPELINE_EXECUTION_H__
+
+#include "exec/IExecutors.h"
+#include "ExecutionContext.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+template <typename T> class BoundedQueue;
+
+/**
+ * @brief Class to run models of NN package as pipeline stages
+ *
+ * Each model of the package runs on its own stage thread. Requests flow through the stages
+ * along model edges, so steady-state throughput approaches the slowest stage instead of
+ * the sum of all stages. Buffers of a request (package inputs, edge tensors and package outputs)
+ * are kept in a frame, and the number of frames in flight is bounded by capacity.
+ *
+ * @note Only static shape is supported.
+ */
+class PipelineExecution
+{
+public:
+  /**
+   * @brief     Construct pipeline and start stage threads
+   * @param[in] executors Compiled executors of NN package
+   * @param[in] capacity  Max number of requests in flight, 0 means number of stages + 1
+   */
+  PipelineExecution(const std::shared_ptr<IExecutors> &executors, uint32_t capacity = 0);
+  ~PipelineExecution();
+
+public:
+  PipelineExecution(const PipelineExecution &) = delete;
+  PipelineExecution &operator=(const PipelineExecution &) = delete;
+
+public:
+  uint32_t stageCount() const { return static_cast<uint32_t>(_stages.size()); }
+  uint32_t capacity() const { return static_cast<uint32_t>(_frames.size()); }
+
+  /**
+   * @brief     Push a request to the pipeline
+   * @param[in] inputs  Buffers of package inputs, copied into a frame
+   * @param[in] lengths Length of each input buffer in bytes
+   * @note      Blocks while all frames are in flight. Pop outputs to release frames.
+   */
+  void push(const std::vector<const void *> &inputs, const std::vector<size_t> &lengths);
+
+  /**
+   * @brief      Pop outputs of the oldest request
+   * @param[out] outputs Buffers of package outputs, ownership is passed to caller
+   * @return     false if pipeline is finished and no request remains
+   * @note       Rethrows exception raised while running the request
+   */
+  bool pop(std::vector<std::unique_ptr<uint8_t[]>> &outputs);
+
+  /**
+   * @brief Stop receiving requests and wait for all stage threads to finish
+   * @note  Outputs of pushed requests still can be popped after finish
+   */
+  void finish();
+
+private:
+  struct Frame;
+  struct Stage;
+
+  void runStage(Stage &stage);
+  void arrive(Frame *frame, uint32_t stage_index);
+  void closeFrom(uint32_t stage_index);
+
+private:
+  std::shared_ptr<IExecutors> _executors;
+  ExecutionOptions _options;
+  std::vector<std::unique_ptr<Stage>> _stages;
+  // Stage indices which receive pushed requests
+  std::vector<uint32_t> _source_stages;
+  // Size of each buffer in a frame
+  std::vector<size_t> _slot_sizes;
+  std::vector<uint32_t> _input_slots;
+  std::vector<uint32_t> _output_slots;
+  // Number of stages that sink (output queue) waits for
+  uint32_t _sink_pred_count;
+  std::atomic<uint32_t> _sink_live_preds;
+  std::vector<std::unique_ptr<Frame>> _frames;
+  std::unique_ptr<BoundedQueue<Frame *>> _free_frames;
+  std::unique_ptr<BoundedQueue<Frame *>> _output_frames;
+  std::mutex _push_mutex;
+  bool _finished;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PIPELINE_EXECUTION_H__
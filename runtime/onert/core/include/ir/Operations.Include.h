@@ -67,7 +67,9 @@
 #include "ir/operation/ResizeBilinear.h"
 #include "ir/operation/ResizeNearestNeighbor.h"
 #include "ir/operation/Reverse.h"
+#include "ir/operation/RmsNorm.h"
 #include "ir/operation/RNN.h"
+#include "ir/operation/RoPE.h"
 #include "ir/operation/Select.h"
 #include "ir/operation/Shape.h"
 #include "ir/operation/Slice.h"
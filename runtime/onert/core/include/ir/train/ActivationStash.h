@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_TRAIN_ACTIVATION_STASH_H__
+#define __ONERT_IR_TRAIN_ACTIVATION_STASH_H__
+
+#include <string>
+
+namespace onert
+{
+namespace ir
+{
+namespace train
+{
+
+/**
+ * @brief 16-bit type of activations kept from forwarding to backwarding
+ *
+ * Only stashed activations are narrowed. Computation, weights and gradients stay in fp32, so this
+ * is not mixed-precision training.
+ */
+enum class ActivationStash
+{
+  None,    //< Keep activations in fp32
+  FLOAT16, //< Keep activations in fp16 between forwarding and backwarding
+  BFLOAT16 //< Keep activations in bf16 between forwarding and backwarding
+};
+
+/**
+ * @brief Convert the activation stash type to the name
+ *
+ * @param stash The activation stash type
+ * @return The name of the activation stash type, "" for None
+ */
+std::string toString(ActivationStash stash);
+
+/**
+ * @brief Convert the name, "fp16", "bf16" or "", to the activation stash type
+ *
+ * @param name The name of the activation stash type
+ * @return The activation stash type
+ */
+ActivationStash toActivationStash(const std::string &name);
+
+} // namespace train
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_TRAIN_ACTIVATION_STASH_H__
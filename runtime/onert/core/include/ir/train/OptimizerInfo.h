@@ -30,9 +30,16 @@ struct OptimizerInfo
 {
   OptimizerCode optim_code;
   float learning_rate;
+  float momentum;     // Used by SGD only
+  bool nesterov;      // Used by SGD with momentum only
+  float weight_decay; // L2 penalty added to the gradient
   // TODO Add properties
 
-  OptimizerInfo() : optim_code{OptimizerCode::Undefined}, learning_rate{0.0f} {}
+  OptimizerInfo()
+    : optim_code{OptimizerCode::Undefined}, learning_rate{0.0f}, momentum{0.0f}, nesterov{false},
+      weight_decay{0.0f}
+  {
+  }
 };
 
 } // namespace train
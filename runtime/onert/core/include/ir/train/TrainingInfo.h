@@ -19,6 +19,7 @@
 #define __ONERT_IR_TRAIN_TRAINING_INFO_H__
 
 #include "ir/Index.h"
+#include "ir/train/ActivationStash.h"
 #include "ir/train/OptimizerCode.h"
 #include "ir/train/OptimizerInfo.h"
 #include "ir/train/LossInfo.h"
@@ -37,7 +38,7 @@ class TrainingInfo final
 public:
   TrainingInfo()
     : _version{0}, _loss_info(), _optimizer_info(), _batch_size(0), _training_step{0},
-      _trainable_ops{}
+      _trainable_ops{}, _memory_budget{0}, _activation_stash{ActivationStash::None}
   {
   }
   TrainingInfo(const TrainingInfo &) = default;
@@ -53,6 +54,8 @@ public:
   uint32_t batchSize() const { return _batch_size; }
   const uint32_t &trainingStep() const { return _training_step; }
   const std::set<OperationIndex> &getTrainableOps() const { return _trainable_ops; }
+  uint64_t memoryBudget() const { return _memory_budget; }
+  ActivationStash activationStash() const { return _activation_stash; }
 
   // setter
   void setVersion(const uint32_t version) { _version = version; }
@@ -64,6 +67,11 @@ public:
   {
     _trainable_ops = trainable_ops;
   }
+  void setMemoryBudget(const uint64_t memory_budget) { _memory_budget = memory_budget; }
+  void setActivationStash(const ActivationStash activation_stash)
+  {
+    _activation_stash = activation_stash;
+  }
 
   bool isValid() const;
 
@@ -74,6 +82,10 @@ private:
   uint32_t _batch_size;
   uint32_t _training_step;
   std::set<OperationIndex> _trainable_ops;
+  // Bytes for activations kept for backwarding. 0 means no limit(no recomputation).
+  uint64_t _memory_budget;
+  // 16-bit type of activations kept for backwarding
+  ActivationStash _activation_stash;
 };
 
 } // namespace train
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file     PerThread.h
+ * @brief    This file contains onert::util::PerThread class
+ */
+
+#ifndef __ONERT_UTIL_PER_THREAD_H__
+#define __ONERT_UTIL_PER_THREAD_H__
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Objects of one owner, one per thread which asks for it
+ *
+ * get() looks the object of the calling thread up in a thread_local cache, so it does not take a
+ * lock after its first call on the thread. The objects are owned by PerThread and freed with it.
+ * When a thread exits, its object is removed from every PerThread still alive, so objects do not
+ * pile up for threads which ran once.
+ *
+ * @tparam T  Type of the objects
+ */
+template <typename T> class PerThread
+{
+private:
+  struct Objects
+  {
+    std::mutex mutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<T>> objects;
+  };
+
+  // Objects of the calling thread, which are removed from their owners when the thread exits
+  struct ThreadCache
+  {
+    struct Entry
+    {
+      const Objects *key;
+      std::weak_ptr<Objects> owner;
+      T *object;
+    };
+    std::vector<Entry> entries;
+
+    ~ThreadCache()
+    {
+      for (auto &&entry : entries)
+      {
+        if (auto owner = entry.owner.lock())
+        {
+          std::lock_guard<std::mutex> lock{owner->mutex};
+          owner->objects.erase(std::this_thread::get_id());
+        }
+      }
+    }
+  };
+
+public:
+  PerThread() : _objects{std::make_shared<Objects>()} {}
+  PerThread(const PerThread &) = delete;
+  PerThread &operator=(const PerThread &) = delete;
+
+public:
+  /**
+   * @brief Get the object of the calling thread
+   * @param create  Function which returns a new object, called under the lock of this
+   *                on the first call of the thread
+   */
+  template <typename Create> T *get(Create &&create) const
+  {
+    thread_local ThreadCache cache;
+
+    // An expired entry may have the same key as a new owner at the reused address
+    for (const auto &entry : cache.entries)
+      if (entry.key == _objects.get() && !entry.owner.expired())
+        return entry.object;
+
+    // Forget objects of owners destroyed already
+    cache.entries.erase(std::remove_if(cache.entries.begin(), cache.entries.end(),
+                                       [](const auto &entry) { return entry.owner.expired(); }),
+                        cache.entries.end());
+
+    std::lock_guard<std::mutex> lock{_objects->mutex};
+    auto &object = _objects->objects[std::this_thread::get_id()];
+    if (object == nullptr)
+      object = create();
+    cache.entries.push_back({_objects.get(), _objects, object.get()});
+    return object.get();
+  }
+
+  /**
+   * @brief Call a function for every object created already, under the lock of this
+   *
+   * As get() creates objects under the same lock, a setting applied by both this and the create
+   * function of get() reaches every object.
+   */
+  template <typename Fn> void forEach(Fn &&fn)
+  {
+    std::lock_guard<std::mutex> lock{_objects->mutex};
+    for (auto &&[thread_id, object] : _objects->objects)
+      fn(object.get());
+  }
+
+  /**
+   * @brief Number of objects alive
+   */
+  size_t size() const
+  {
+    std::lock_guard<std::mutex> lock{_objects->mutex};
+    return _objects->objects.size();
+  }
+
+private:
+  std::shared_ptr<Objects> _objects;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PER_THREAD_H__
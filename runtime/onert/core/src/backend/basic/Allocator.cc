@@ -18,6 +18,12 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+
 namespace onert
 {
 namespace backend
@@ -25,11 +31,30 @@ namespace backend
 namespace basic
 {
 
-Allocator::Allocator(uint32_t capacity)
+void Allocator::Deleter::operator()(uint8_t *ptr) const { std::free(ptr); }
+
+Allocator::Allocator(size_t capacity, bool zero_fill, bool huge_page)
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
+  const bool use_huge_page = huge_page && capacity >= kHugePageSize;
+  const size_t alignment = use_huge_page ? kHugePageSize : kCacheLineSize;
+  // Keep at least one aligned unit so that base() is valid even for an empty plan
+  const size_t size = std::max<size_t>((capacity + alignment - 1) / alignment, 1) * alignment;
+
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, alignment, size) != 0)
+    throw std::bad_alloc{};
+  _base.reset(static_cast<uint8_t *>(ptr));
+
+#ifdef MADV_HUGEPAGE
+  if (use_huge_page && madvise(ptr, size, MADV_HUGEPAGE) != 0)
+    VERBOSE(ALLOC) << "madvise(MADV_HUGEPAGE) failed, fall back to normal pages" << std::endl;
+#endif
+
+  if (zero_fill)
+    std::memset(ptr, 0, size);
 
-  VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
+  VERBOSE(ALLOC) << "allocation capacity: " << capacity << " (aligned to " << alignment << ")"
+                 << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
 }
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/BackendContextHelpers.h"
+#include "backend/basic/TensorBuilder.h"
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace onert;
+using namespace onert::backend;
+
+namespace
+{
+
+class MockBackendContext : public BackendContext
+{
+public:
+  MockBackendContext(ContextData &&data)
+    : BackendContext(nullptr, std::move(data)),
+      tensor_builder{std::make_shared<basic::TensorBuilder>(_tensor_reg, "FirstFit")}
+  {
+    tensor_registry = _tensor_reg;
+  }
+
+  ITensorRegistry *genTensors() override { return basic::genTensors(*this); }
+  FunctionMap genKernels() override { return {}; }
+
+  uint8_t *buffer(const ir::OperandIndex &ind) const
+  {
+    return _tensor_reg->getNativeTensor(ind)->buffer();
+  }
+
+private:
+  std::shared_ptr<basic::TensorRegistry> _tensor_reg = std::make_shared<basic::TensorRegistry>();
+
+public:
+  std::shared_ptr<basic::TensorBuilder> tensor_builder;
+};
+
+// #0 -> [ Add ] -> #1 -> [ Add ] -> #2 -> [ Add ] -> #3 -> [ Add ] -> #4
+ContextData genAddChain(bool is_linear_executor)
+{
+  ContextData data;
+  data.graph = std::make_unique<ir::Graph>();
+  auto &graph = *data.graph;
+
+  const ir::Shape shape{1, 16};
+  const ir::TypeInfo type{ir::DataType::FLOAT32};
+  std::vector<ir::OperandIndex> operands;
+  for (int i = 0; i < 5; ++i)
+    operands.push_back(graph.addOperand(shape, type));
+
+  ir::operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = ir::Activation::NONE;
+  for (int i = 0; i < 4; ++i)
+  {
+    const auto input = operands[i];
+    const auto output = operands[i + 1];
+    data.op_order.push_back(graph.addOperation(
+      std::make_unique<ir::operation::BinaryArithmetic>(ir::OperandIndexSequence{input, input},
+                                                        ir::OperandIndexSequence{output}, param)));
+  }
+  graph.addInput(operands.front());
+  graph.addOutput(operands.back());
+
+  // Inputs and outputs of the graph are planned by another backend
+  data.external_operands.add(operands.front());
+  data.external_operands.add(operands.back());
+  data.is_linear_executor = is_linear_executor;
+  return data;
+}
+
+} // namespace
+
+TEST(BackendContextHelpers, genTensors_linear_executor_reuses_buffers)
+{
+  MockBackendContext ctx{genAddChain(true)};
+  ctx.genTensors();
+
+  // #1 is released after its last use, before #3 is defined
+  ASSERT_NE(ctx.buffer(ir::OperandIndex{1}), nullptr);
+  EXPECT_EQ(ctx.buffer(ir::OperandIndex{3}), ctx.buffer(ir::OperandIndex{1}));
+  EXPECT_NE(ctx.buffer(ir::OperandIndex{2}), ctx.buffer(ir::OperandIndex{1}));
+}
+
+TEST(BackendContextHelpers, genTensors_non_linear_executor_keeps_buffers_apart)
+{
+  // Workers of a non-linear executor may run operations of a backend at once in any order, so
+  // every tensor is alive during the whole execution
+  MockBackendContext ctx{genAddChain(false)};
+  ctx.genTensors();
+
+  std::set<uint8_t *> buffers;
+  for (uint32_t i = 1; i <= 3; ++i)
+  {
+    auto buffer = ctx.buffer(ir::OperandIndex{i});
+    ASSERT_NE(buffer, nullptr);
+    buffers.insert(buffer);
+  }
+  EXPECT_EQ(buffers.size(), 3);
+}
@@ -26,8 +26,9 @@ namespace backend
 namespace basic
 {
 
-DynamicTensorManager::DynamicTensorManager(const std::shared_ptr<TensorRegistry> &reg)
-  : _dynamic_mem_mgr{new DynamicMemoryManager()}, _tensors{reg}
+DynamicTensorManager::DynamicTensorManager(const std::shared_ptr<TensorRegistry> &reg,
+                                           bool reserve)
+  : _dynamic_mem_mgr{new DynamicMemoryManager(reserve)}, _tensors{reg}
 {
   // DO NOTHING
 }
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/DynamicTensorManager.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+namespace
+{
+
+ir::OperandInfo dynamicFloatInfo(int32_t size)
+{
+  auto info = ir::OperandInfo::createStaticInfo(ir::Shape{1, size},
+                                                ir::TypeInfo{ir::DataType::FLOAT32});
+  info.setDynamic();
+  return info;
+}
+
+} // namespace
+
+TEST(DynamicTensorManager, reserve_reuses_memory)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+  DynamicTensorManager manager{reg, true};
+  const ir::OperandIndex ind{0};
+  manager.buildTensor(ind, dynamicFloatInfo(4));
+  auto tensor = reg->getNativeTensor(ind);
+  const auto mem_mgr = manager.dynamic_mem_mgr();
+
+  // Run with the largest shape first
+  ASSERT_TRUE(tensor->applyShape(ir::Shape{1, 8}));
+  const auto buffer = tensor->buffer();
+  ASSERT_NE(buffer, nullptr);
+  tensor->deallocBuffer();
+  ASSERT_EQ(mem_mgr->reservedCapacity(tensor), 8 * sizeof(float));
+
+  // Smaller shapes reuse the reserved memory
+  for (int32_t size = 1; size <= 8; ++size)
+  {
+    ASSERT_TRUE(tensor->applyShape(ir::Shape{1, size}));
+    ASSERT_EQ(tensor->buffer(), buffer);
+    tensor->deallocBuffer();
+  }
+  ASSERT_EQ(mem_mgr->reservedCapacity(tensor), 8 * sizeof(float));
+
+  mem_mgr->deallocate();
+  ASSERT_EQ(mem_mgr->reservedCapacity(tensor), 0);
+}
+
+TEST(DynamicTensorManager, reserve_grows_geometrically)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+  DynamicTensorManager manager{reg, true};
+  const ir::OperandIndex ind{0};
+  manager.buildTensor(ind, dynamicFloatInfo(1));
+  auto tensor = reg->getNativeTensor(ind);
+  const auto mem_mgr = manager.dynamic_mem_mgr();
+
+  // A cache growing by one step every run
+  int num_allocs = 0;
+  size_t capacity = 0;
+  for (int32_t size = 1; size <= 64; ++size)
+  {
+    ASSERT_TRUE(tensor->applyShape(ir::Shape{1, size}));
+    tensor->deallocBuffer();
+    if (mem_mgr->reservedCapacity(tensor) != capacity)
+    {
+      capacity = mem_mgr->reservedCapacity(tensor);
+      ++num_allocs;
+    }
+  }
+  ASSERT_EQ(capacity, 64 * sizeof(float));
+  ASSERT_EQ(num_allocs, 7);
+}
+
+TEST(DynamicTensorManager, neg_no_reserve)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+  DynamicTensorManager manager{reg};
+  const ir::OperandIndex ind{0};
+  manager.buildTensor(ind, dynamicFloatInfo(4));
+  auto tensor = reg->getNativeTensor(ind);
+
+  ASSERT_TRUE(tensor->applyShape(ir::Shape{1, 8}));
+  ASSERT_NE(tensor->buffer(), nullptr);
+  tensor->deallocBuffer();
+  ASSERT_EQ(manager.dynamic_mem_mgr()->reservedCapacity(tensor), 0);
+}
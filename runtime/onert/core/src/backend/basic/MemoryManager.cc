@@ -16,6 +16,7 @@
 
 #include <backend/basic/MemoryManager.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include "MemoryPlannerFactory.h"
@@ -52,7 +53,7 @@ MemoryManager::createMemoryPlanner(const std::string planner_id)
   return basic::MemoryPlannerFactory::get().create(planner_id);
 }
 
-void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
+void MemoryManager::claimPlan(const ir::OperandIndex &ind, size_t size)
 {
   _mem_planner->claim(ind, size);
 }
@@ -61,7 +62,9 @@ void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->rel
 
 void MemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
+  // Every tensor in the arena is written before being read, so skip zero-filling
+  _mem_alloc = std::make_shared<basic::Allocator>(
+    _mem_planner->capacity(), false, util::getConfigBool(util::config::USE_HUGE_PAGE));
   assert(_mem_alloc->base());
 }
 
@@ -73,13 +76,27 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
 }
 
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
-                                                                 uint32_t capacity)
+                                                                 size_t capacity)
 {
   auto find = _mem_alloc_map.find(tensor);
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
+  if (!_reserve)
+  {
+    _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity, false);
+    return _mem_alloc_map[tensor];
+  }
+
+  auto &reservation = _reservations[tensor];
+  if (reservation.capacity < capacity)
+  {
+    // Grow at least twice so that a tensor growing every run, e.g. a cache of previous steps, is
+    // reallocated only a logarithmic number of times
+    reservation.capacity = std::max(capacity, reservation.capacity * 2);
+    reservation.alloc = std::make_shared<basic::Allocator>(reservation.capacity, false);
+  }
+  _mem_alloc_map[tensor] = reservation.alloc;
   return _mem_alloc_map[tensor];
 }
 
@@ -89,7 +106,9 @@ void DynamicMemoryManager::deallocate(const ITensor *tensor)
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  find->second->release();    // explicitly erase memory
+  // Explicitly erase memory unless it is reserved for the next allocation of the tensor
+  if (!_reserve)
+    find->second->release();
   _mem_alloc_map.erase(find); // remove tensor and alloc
 }
 
@@ -101,7 +120,20 @@ void DynamicMemoryManager::deallocate(void)
     mem_alloc.second->release();
   }
 
+  for (auto &&reservation : _reservations)
+  {
+    if (reservation.second.alloc)
+      reservation.second.alloc->release();
+  }
+
   _mem_alloc_map.clear();
+  _reservations.clear();
+}
+
+size_t DynamicMemoryManager::reservedCapacity(const ITensor *tensor) const
+{
+  auto find = _reservations.find(tensor);
+  return find == _reservations.end() ? 0 : find->second.capacity;
 }
 
 } // namespace basic
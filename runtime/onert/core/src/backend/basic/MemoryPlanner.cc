@@ -16,7 +16,10 @@
 
 #include "MemoryPlanner.h"
 #include "util/logging.h"
+
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 namespace onert
 {
@@ -25,6 +28,131 @@ namespace backend
 namespace basic
 {
 
+namespace
+{
+
+using Interval = IntervalPlanner::Interval;
+
+bool overlaps(const Interval &a, const Interval &b) { return a.first < b.last && b.first < a.last; }
+
+/*
+ * Assign offsets to intervals visited in the given order. Each interval is placed at the smallest
+ * gap between already placed and overlapping intervals that fits it (best-fit), or on top of them
+ * if there is no such gap. All intervals of an operand claimed more than once are placed together
+ * at one offset. Returns the capacity of the plan.
+ */
+size_t assignOffsets(const std::vector<Interval> &intervals, const std::vector<size_t> &order,
+                     std::vector<size_t> &offsets)
+{
+  constexpr size_t kUnassigned = std::numeric_limits<size_t>::max();
+  offsets.assign(intervals.size(), kUnassigned);
+  std::vector<size_t> assigned;
+  assigned.reserve(intervals.size());
+
+  ir::OperandIndexMap<std::vector<size_t>> operand_intervals;
+  for (size_t i = 0; i < intervals.size(); ++i)
+    operand_intervals[intervals[i].index].emplace_back(i);
+
+  size_t capacity = 0;
+  std::vector<std::pair<size_t, size_t>> conflicts; // (offset, size) of overlapping intervals
+  for (const auto i : order)
+  {
+    if (offsets[i] != kUnassigned)
+      continue;
+
+    const auto &cur = intervals[i];
+    const auto &siblings = operand_intervals.at(cur.index);
+
+    conflicts.clear();
+    for (const auto j : assigned)
+    {
+      if (std::any_of(siblings.begin(), siblings.end(),
+                      [&](size_t s) { return overlaps(intervals[s], intervals[j]); }))
+        conflicts.emplace_back(offsets[j], intervals[j].size);
+    }
+    std::sort(conflicts.begin(), conflicts.end());
+
+    size_t best_offset = kUnassigned;
+    size_t best_gap = kUnassigned;
+    size_t prev_end = 0;
+    for (const auto &[offset, size] : conflicts)
+    {
+      if (offset > prev_end)
+      {
+        const size_t gap = offset - prev_end;
+        if (gap >= cur.size && gap < best_gap)
+        {
+          best_gap = gap;
+          best_offset = prev_end;
+        }
+      }
+      prev_end = std::max(prev_end, offset + size);
+    }
+    if (best_offset == kUnassigned)
+      best_offset = prev_end;
+
+    for (const auto s : siblings)
+    {
+      offsets[s] = best_offset;
+      assigned.emplace_back(s);
+    }
+    capacity = std::max(capacity, best_offset + cur.size);
+  }
+  return capacity;
+}
+
+// Visit intervals by descending size
+std::vector<size_t> orderBySize(const std::vector<Interval> &intervals)
+{
+  std::vector<size_t> order(intervals.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return intervals[a].size > intervals[b].size;
+  });
+  return order;
+}
+
+// Visit steps by descending breadth(sum of live sizes), and intervals live at each step by
+// descending size. Breadth only grows at claims, so only the steps of claims are considered.
+std::vector<size_t> orderByBreadth(const std::vector<Interval> &intervals)
+{
+  std::vector<std::pair<uint32_t, size_t>> steps; // (step, breadth)
+  steps.reserve(intervals.size());
+  for (const auto &interval : intervals)
+  {
+    size_t breadth = 0;
+    for (const auto &other : intervals)
+    {
+      if (other.first <= interval.first && interval.first < other.last)
+        breadth += other.size;
+    }
+    steps.emplace_back(interval.first, breadth);
+  }
+  std::stable_sort(steps.begin(), steps.end(),
+                   [](const auto &a, const auto &b) { return a.second > b.second; });
+
+  const auto by_size = orderBySize(intervals);
+  std::vector<bool> visited(intervals.size(), false);
+  std::vector<size_t> order;
+  order.reserve(intervals.size());
+  for (const auto &[t, breadth] : steps)
+  {
+    for (const auto i : by_size)
+    {
+      if (!visited[i] && intervals[i].first <= t && t < intervals[i].last)
+      {
+        visited[i] = true;
+        order.emplace_back(i);
+      }
+    }
+  }
+  assert(order.size() == intervals.size());
+  return order;
+}
+
+} // namespace
+
 void BumpPlanner::claim(const ir::OperandIndex &ind, size_t size)
 {
   Block blk{_capacity, size};
@@ -57,7 +185,7 @@ void BumpPlanner::release(const ir::OperandIndex &ind)
 void FirstFitPlanner::claim(const ir::OperandIndex &ind, size_t size)
 {
   // Find the right position for claiming
-  uint32_t next_offset = 0;
+  size_t next_offset = 0;
   for (const auto &[claimed_base_offset, claimed_operand_idx] : _claim_table)
   {
     auto claimed_size = _mem_plans[claimed_operand_idx].size;
@@ -90,9 +218,9 @@ void FirstFitPlanner::release(const ir::OperandIndex &ind)
   {
     if (it->second == ind)
     {
-      uint32_t offset = it->first;
+      size_t offset = it->first;
       uint32_t index = ind.value();
-      uint32_t size = _mem_plans[ind].size;
+      size_t size = _mem_plans[ind].size;
 
       _claim_table.erase(it);
 
@@ -146,11 +274,11 @@ void WICPlanner::buildMemoryPlans()
   {
     VERBOSE(WIC_PLANNER) << "build_plan(" << ind << "): [" << size << "sz]" << std::endl;
 
-    uint32_t next_offset = 0;
+    size_t next_offset = 0;
     if (_interference_graph.count(ind))
     {
       // Find interfered memory plans and sort them by offset
-      std::multimap<uint32_t, uint32_t> interfered_plans;
+      std::multimap<size_t, size_t> interfered_plans;
       for (const auto &interference : _interference_graph[ind])
       {
         if (_mem_plans.count(interference))
@@ -198,6 +326,66 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+void IntervalPlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  assert(_live_intervals.find(ind) == _live_intervals.end());
+  _live_intervals[ind] = _intervals.size();
+  _intervals.push_back({ind, size, _step++, std::numeric_limits<uint32_t>::max()});
+
+  _live_size += size;
+  _lower_bound = std::max(_lower_bound, _live_size);
+
+  VERBOSE(INTERVAL_PLANNER) << "claim(" << ind << "): [" << size << "sz]" << std::endl;
+}
+
+void IntervalPlanner::release(const ir::OperandIndex &ind)
+{
+  auto it = _live_intervals.find(ind);
+  if (it == _live_intervals.end())
+    return;
+
+  auto &interval = _intervals[it->second];
+  interval.last = _step++;
+  _live_size -= interval.size;
+  _live_intervals.erase(it);
+
+  VERBOSE(INTERVAL_PLANNER) << "release(" << ind << ")" << std::endl;
+}
+
+void IntervalPlanner::buildMemoryPlans()
+{
+  std::vector<size_t> breadth_offsets;
+  const auto breadth_capacity =
+    assignOffsets(_intervals, orderByBreadth(_intervals), breadth_offsets);
+  std::vector<size_t> size_offsets;
+  const auto size_capacity = assignOffsets(_intervals, orderBySize(_intervals), size_offsets);
+
+  const bool use_breadth = breadth_capacity <= size_capacity;
+  const auto &offsets = use_breadth ? breadth_offsets : size_offsets;
+  _capacity = use_breadth ? breadth_capacity : size_capacity;
+
+  for (size_t i = 0; i < _intervals.size(); ++i)
+  {
+    const auto &interval = _intervals[i];
+    _mem_plans[interval.index] = {offsets[i], interval.size};
+    VERBOSE(INTERVAL_PLANNER) << "alloc(" << interval.index << "): [+" << offsets[i] << ", "
+                              << interval.size << "sz]" << std::endl;
+  }
+  VERBOSE(INTERVAL_PLANNER) << "capacity: " << _capacity << " (lower bound: " << _lower_bound
+                            << ", by " << (use_breadth ? "breadth" : "size") << ")" << std::endl;
+
+  _initialized = true;
+  _intervals.clear();
+  _live_intervals.clear();
+}
+
+IntervalPlanner::MemoryPlans &IntervalPlanner::memory_plans()
+{
+  if (!_initialized)
+    buildMemoryPlans();
+  return _mem_plans;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -59,7 +59,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override { return _capacity; }
+  size_t capacity() override { return _capacity; }
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -67,7 +67,7 @@ public:
   MemoryPlans &memory_plans() override { return _mem_plans; }
 
 private:
-  uint32_t _capacity = 0;
+  size_t _capacity = 0;
   MemoryPlans _mem_plans;
 };
 
@@ -92,7 +92,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override { return _capacity; }
+  size_t capacity() override { return _capacity; }
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -100,10 +100,10 @@ public:
   MemoryPlans &memory_plans() override { return _mem_plans; }
 
 private:
-  uint32_t _capacity = 0;
+  size_t _capacity = 0;
   MemoryPlans _mem_plans;
-  // Use std::map because claim() assumes that _claim_table is sorted by uint32_t(base_offset)
-  std::map<uint32_t, ir::OperandIndex> _claim_table;
+  // Use std::map because claim() assumes that _claim_table is sorted by size_t(base_offset)
+  std::map<size_t, ir::OperandIndex> _claim_table;
 };
 
 /**
@@ -129,7 +129,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override
+  size_t capacity() override
   {
     if (!_initialized)
       buildMemoryPlans();
@@ -145,12 +145,83 @@ private:
   void buildMemoryPlans();
 
   bool _initialized;
-  uint32_t _capacity;
+  size_t _capacity;
   MemoryPlans _mem_plans;
   std::unordered_set<ir::OperandIndex> _live_operands;
   ir::OperandIndexMap<std::vector<ir::OperandIndex>> _interference_graph;
   // Sort operands by descending order of size
-  std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
+  std::multimap<size_t, ir::OperandIndex, std::greater<size_t>> _operands;
+};
+
+/**
+ * @brief Class to plan memory offline with the whole lifetime of every operand
+ *
+ * claim() and release() only record the lifetime interval of each operand. Offsets are assigned
+ * after all intervals are known, by both greedy-by-breadth and greedy-by-size orders with best-fit
+ * gap selection, and the plan with the smaller capacity is kept.
+ *
+ * An operand may be claimed again after it is released, e.g. when it is recomputed. All the
+ * intervals of such an operand share one block.
+ *
+ * Planning takes O(n^2 log n) time for n intervals, as each interval is checked against all the
+ * placed ones and its conflicts are sorted. It runs once at compile time, but may take long for
+ * graphs with tens of thousands of operands, where FirstFitPlanner or WICPlanner is cheaper.
+ */
+class IntervalPlanner : public IMemoryPlanner<ir::OperandIndex>
+{
+public:
+  /**
+   * @brief Claim memory for operand, which opens its lifetime interval
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand, which closes its lifetime interval
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  size_t capacity() override
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _capacity;
+  }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+  /**
+   * @brief Get the lower bound of capacity, which is the largest sum of sizes live at once
+   * @return The lower bound of capacity
+   */
+  size_t lower_bound() const { return _lower_bound; }
+
+public:
+  struct Interval
+  {
+    ir::OperandIndex index;
+    size_t size;
+    uint32_t first; // Step of claim
+    uint32_t last;  // Step of release (exclusive)
+  };
+
+private:
+  void buildMemoryPlans();
+
+  bool _initialized = false;
+  size_t _capacity = 0;
+  size_t _lower_bound = 0;
+  size_t _live_size = 0;
+  uint32_t _step = 0;
+  MemoryPlans _mem_plans;
+  std::vector<Interval> _intervals;
+  ir::OperandIndexMap<size_t> _live_intervals;
 };
 
 } // namespace basic
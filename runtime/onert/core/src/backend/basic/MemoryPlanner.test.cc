@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "MemoryPlanner.h"
 #include "ir/Index.h"
 
@@ -25,11 +27,27 @@ TEST(Allocator, allocate_test)
   ASSERT_NE(allocator.base(), nullptr);
 }
 
+TEST(Allocator, alignment_test)
+{
+  using ::onert::backend::basic::Allocator;
+
+  Allocator empty(0, false);
+  ASSERT_NE(empty.base(), nullptr);
+
+  Allocator zeroed(100);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(zeroed.base()) % Allocator::kCacheLineSize, 0);
+  for (int i = 0; i < 100; ++i)
+    ASSERT_EQ(zeroed.base()[i], 0);
+
+  Allocator huge(Allocator::kHugePageSize, false, true);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(huge.base()) % Allocator::kHugePageSize, 0);
+}
+
 TEST(BumpPlanner, claim_test)
 {
   ::onert::backend::basic::BumpPlanner planner;
 
-  auto claim = [&planner](uint32_t index, size_t size, uint32_t expected_offset) {
+  auto claim = [&planner](uint32_t index, size_t size, size_t expected_offset) {
     onert::ir::OperandIndex mem_idx(index);
     planner.claim(mem_idx, size);
     auto mem_blk = planner.memory_plans()[mem_idx];
@@ -46,7 +64,7 @@ TEST(FirstFitPlanner, claim_release_test)
 {
   ::onert::backend::basic::FirstFitPlanner planner;
 
-  auto claim = [&planner](uint32_t index, size_t size, uint32_t expected_offset) {
+  auto claim = [&planner](uint32_t index, size_t size, size_t expected_offset) {
     onert::ir::OperandIndex mem_idx(index);
     planner.claim(mem_idx, size);
     auto mem_blk = planner.memory_plans()[mem_idx];
@@ -140,14 +158,14 @@ TEST(WICPlanner, claim_release_test)
     planner.release(mem_idx);
   };
 
-  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+  auto verify = [&planner](uint32_t index, size_t size, size_t expected_offset) {
     onert::ir::OperandIndex mem_idx(index);
     auto mem_blk = planner.memory_plans()[mem_idx];
     ASSERT_EQ(mem_blk.offset, expected_offset);
     ASSERT_EQ(mem_blk.size, size);
   };
 
-  auto capacity = [&planner](uint32_t expected_capacity) {
+  auto capacity = [&planner](size_t expected_capacity) {
     auto actual_capacity = planner.capacity();
     ASSERT_EQ(actual_capacity, expected_capacity);
   };
@@ -191,3 +209,223 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(WICPlanner, capacity_over_4gb_test)
+{
+  ::onert::backend::basic::WICPlanner planner;
+
+  const size_t large = static_cast<size_t>(3) << 30;
+  planner.claim(onert::ir::OperandIndex{0}, large);
+  planner.claim(onert::ir::OperandIndex{1}, large);
+  planner.release(onert::ir::OperandIndex{0});
+  planner.release(onert::ir::OperandIndex{1});
+
+  ASSERT_EQ(planner.memory_plans()[onert::ir::OperandIndex{1}].offset, large);
+  ASSERT_EQ(planner.capacity(), 2 * large);
+}
+
+namespace
+{
+
+struct PlanEvent
+{
+  bool is_claim;
+  uint32_t index;
+  size_t size;
+};
+
+// Generate claim/release events like a linearized graph, where each operation claims its output
+// and releases operands whose last use has passed
+std::vector<PlanEvent> generateEvents(uint32_t num_operands, uint32_t seed)
+{
+  std::vector<PlanEvent> events;
+  std::vector<std::pair<uint32_t, uint32_t>> lives; // (release step, index)
+  for (uint32_t i = 0; i < num_operands; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    const size_t size = 64 * (1 + (seed >> 16) % 64);
+    const uint32_t lifetime = 1 + (seed >> 8) % 6;
+    events.push_back({true, i, size});
+    lives.emplace_back(i + lifetime, i);
+
+    for (auto it = lives.begin(); it != lives.end();)
+    {
+      if (it->first <= i)
+      {
+        events.push_back({false, it->second, 0});
+        it = lives.erase(it);
+      }
+      else
+        ++it;
+    }
+  }
+  for (const auto &live : lives)
+    events.push_back({false, live.second, 0});
+  return events;
+}
+
+// Replay events on the planner and verify that overlapping operands do not share memory
+// Returns the lower bound of capacity, the largest sum of sizes live at once
+size_t replayAndVerify(::onert::backend::basic::IMemoryPlanner<onert::ir::OperandIndex> &planner,
+                       const std::vector<PlanEvent> &events)
+{
+  std::vector<std::pair<uint32_t, uint32_t>> intervals;
+  size_t live = 0;
+  size_t lower_bound = 0;
+  std::map<uint32_t, size_t> sizes;
+  for (uint32_t step = 0; step < events.size(); ++step)
+  {
+    const auto &event = events[step];
+    onert::ir::OperandIndex ind{event.index};
+    if (event.is_claim)
+    {
+      planner.claim(ind, event.size);
+      intervals.emplace_back(step, events.size());
+      sizes[event.index] = event.size;
+      live += event.size;
+      lower_bound = std::max(lower_bound, live);
+    }
+    else
+    {
+      planner.release(ind);
+      intervals[event.index].second = step;
+      live -= sizes[event.index];
+    }
+  }
+
+  auto &plans = planner.memory_plans();
+  for (uint32_t a = 0; a < intervals.size(); ++a)
+  {
+    const auto &blk_a = plans[onert::ir::OperandIndex{a}];
+    EXPECT_LE(blk_a.offset + blk_a.size, planner.capacity());
+    for (uint32_t b = a + 1; b < intervals.size(); ++b)
+    {
+      if (intervals[a].first < intervals[b].second && intervals[b].first < intervals[a].second)
+      {
+        const auto &blk_b = plans[onert::ir::OperandIndex{b}];
+        EXPECT_TRUE(blk_a.offset + blk_a.size <= blk_b.offset ||
+                    blk_b.offset + blk_b.size <= blk_a.offset);
+      }
+    }
+  }
+  return lower_bound;
+}
+
+} // namespace
+
+TEST(IntervalPlanner, claim_release_test)
+{
+  ::onert::backend::basic::IntervalPlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, size_t size, size_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  // Same sequence with WICPlanner.claim_release_test
+  claim(0, 20);
+  claim(1, 5);
+  release(0);
+  claim(2, 10);
+  release(1);
+  claim(3, 10);
+  release(2);
+  claim(4, 10);
+  release(3);
+  claim(5, 20);
+  release(4);
+  claim(6, 20);
+  release(5);
+  release(7);
+
+  verify(0, 20, 0);
+  verify(1, 5, 20);
+  verify(2, 10, 0);
+  verify(3, 10, 10);
+  verify(4, 10, 20);
+  verify(5, 20, 0);
+  verify(6, 20, 20);
+
+  ASSERT_EQ(planner.lower_bound(), 40);
+  ASSERT_EQ(planner.capacity(), 40);
+}
+
+TEST(IntervalPlanner, reclaim_test)
+{
+  ::onert::backend::basic::IntervalPlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, size_t size, size_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  // 0 and 1 are claimed again like recomputed operands, and 2 lives between their intervals
+  claim(0, 20);
+  claim(1, 10);
+  release(0);
+  release(1);
+  claim(2, 30);
+  release(2);
+  claim(1, 10);
+  claim(0, 20);
+  release(1);
+  release(0);
+
+  verify(2, 30, 0);
+  verify(0, 20, 0);
+  verify(1, 10, 20);
+
+  ASSERT_EQ(planner.lower_bound(), 30);
+  ASSERT_EQ(planner.capacity(), 30);
+}
+
+TEST(IntervalPlanner, compare_peak_with_lower_bound_test)
+{
+  using namespace ::onert::backend::basic;
+
+  for (uint32_t seed = 1; seed <= 4; ++seed)
+  {
+    const auto events = generateEvents(200, seed);
+
+    FirstFitPlanner first_fit;
+    WICPlanner wic;
+    IntervalPlanner interval;
+    const auto lower_bound = replayAndVerify(first_fit, events);
+    replayAndVerify(wic, events);
+    replayAndVerify(interval, events);
+
+    ASSERT_EQ(interval.lower_bound(), lower_bound);
+    ASSERT_GE(interval.capacity(), lower_bound);
+    ASSERT_LE(interval.capacity(), wic.capacity());
+
+    const auto prefix = "seed" + std::to_string(seed) + "_";
+    ::testing::Test::RecordProperty(prefix + "lower_bound", std::to_string(lower_bound));
+    ::testing::Test::RecordProperty(prefix + "first_fit", std::to_string(first_fit.capacity()));
+    ::testing::Test::RecordProperty(prefix + "wic", std::to_string(wic.capacity()));
+    ::testing::Test::RecordProperty(prefix + "interval", std::to_string(interval.capacity()));
+  }
+}
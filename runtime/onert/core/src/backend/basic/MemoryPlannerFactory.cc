@@ -45,6 +45,10 @@ IMemoryPlanner<ir::OperandIndex> *MemoryPlannerFactory::create(const std::string
   {
     return new WICPlanner;
   }
+  else if (key == "Interval")
+  {
+    return new IntervalPlanner;
+  }
   return new FirstFitPlanner; // Default Planner
 }
 
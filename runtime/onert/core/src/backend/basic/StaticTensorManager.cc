@@ -20,6 +20,8 @@
 #include "backend/basic/Tensor.h"
 #include <util/logging.h>
 
+#include <cstring>
+
 namespace onert
 {
 namespace backend
@@ -48,17 +50,33 @@ void StaticTensorManager::allocateNonconsts(void)
 {
   _nonconst_mgr->allocate();
 
+  size_t alias_count = 0;
+  size_t alias_bytes = 0;
   for (auto &&[ind, tensor] : _tensors->native_tensors())
   {
     if (!_as_constants[ind] && !tensor->is_dynamic())
     {
-      auto *buffer = _nonconst_mgr->getBuffer(ind);
+      auto *buffer = _nonconst_mgr->getBuffer(aliasRoot(ind));
       tensor->setBuffer(buffer);
 
+      // The arena is not zero-filled, but variable tensors are expected to start from zero
+      if (tensor->get_info().isVariable())
+        std::memset(buffer, 0, tensor->total_size());
+
       VERBOSE(CPU_StaticTensorManager)
         << "TENSOR " << ind << " : " << static_cast<void *>(buffer) << std::endl;
+
+      if (_alias_sources.find(ind) != _alias_sources.end())
+      {
+        alias_count++;
+        alias_bytes += tensor->total_size();
+      }
     }
   }
+
+  if (alias_count > 0)
+    VERBOSE(CPU_StaticTensorManager) << alias_count << " tensors share buffers, " << alias_bytes
+                                     << " bytes are not allocated separately" << std::endl;
 }
 
 void StaticTensorManager::deallocateNonconsts(void) { _nonconst_mgr->deallocate(); }
@@ -81,15 +99,23 @@ void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
   _as_constants[ind] = as_const;
 }
 
-void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
+void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, size_t size)
 {
   assert(_tensors->getNativeTensor(ind));
 
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
-  if (!_as_constants[ind])
-    _nonconst_mgr->claimPlan(ind, size);
+  if (_as_constants[ind])
+    return;
+
+  // Only the first claimed tensor of alias group claims the buffer
+  const auto root = aliasRoot(ind);
+  auto refs = _alias_refs.find(root);
+  if (refs != _alias_refs.end() && refs->second++ > 0)
+    return;
+
+  _nonconst_mgr->claimPlan(root, size);
 }
 
 void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
@@ -99,8 +125,39 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
-  if (!_as_constants[ind])
-    _nonconst_mgr->releasePlan(ind);
+  if (_as_constants[ind])
+    return;
+
+  // The buffer of alias group is released by the last released tensor
+  const auto root = aliasRoot(ind);
+  auto refs = _alias_refs.find(root);
+  if (refs != _alias_refs.end())
+  {
+    assert(refs->second > 0);
+    if (--refs->second > 0)
+      return;
+  }
+
+  _nonconst_mgr->releasePlan(root);
+}
+
+void StaticTensorManager::aliasPlan(const ir::OperandIndex &alias, const ir::OperandIndex &source)
+{
+  assert(alias != source);
+  assert(_alias_sources.find(alias) == _alias_sources.end());
+  assert(_alias_refs.find(alias) == _alias_refs.end());
+
+  _alias_sources[alias] = source;
+  _alias_refs.emplace(aliasRoot(source), 0);
+}
+
+ir::OperandIndex StaticTensorManager::aliasRoot(const ir::OperandIndex &ind) const
+{
+  auto root = ind;
+  for (auto it = _alias_sources.find(root); it != _alias_sources.end();
+       it = _alias_sources.find(root))
+    root = it->second;
+  return root;
 }
 
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
@@ -27,16 +27,19 @@ namespace backend
 namespace basic
 {
 
-TensorBuilder::TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg)
-  : _tensor_reg{tensor_reg}, _dynamic_tensor_mgr{new DynamicTensorManager(_tensor_reg)},
+TensorBuilder::TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg,
+                             bool reserve_dynamic_tensors)
+  : _tensor_reg{tensor_reg},
+    _dynamic_tensor_mgr{new DynamicTensorManager(_tensor_reg, reserve_dynamic_tensors)},
     _static_tensor_mgr{new StaticTensorManager(_tensor_reg, _dynamic_tensor_mgr.get())}
 {
   /* empty */
 }
 
 TensorBuilder::TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg,
-                             const std::string planner_id)
-  : _tensor_reg{tensor_reg}, _dynamic_tensor_mgr{new DynamicTensorManager(_tensor_reg)},
+                             const std::string planner_id, bool reserve_dynamic_tensors)
+  : _tensor_reg{tensor_reg},
+    _dynamic_tensor_mgr{new DynamicTensorManager(_tensor_reg, reserve_dynamic_tensors)},
     _static_tensor_mgr{new StaticTensorManager(_tensor_reg, planner_id, _dynamic_tensor_mgr.get())}
 {
   /* empty */
@@ -76,6 +79,11 @@ void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
   }
 }
 
+void TensorBuilder::registerAlias(const ir::OperandIndex &alias, const ir::OperandIndex &source)
+{
+  _static_tensor_mgr->aliasPlan(alias, source);
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 {
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/TensorBuilder.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+namespace
+{
+
+ir::OperandInfo floatInfo(int32_t size)
+{
+  return ir::OperandInfo::createStaticInfo(ir::Shape{size},
+                                           ir::TypeInfo{ir::DataType::FLOAT32});
+}
+
+} // namespace
+
+TEST(TensorBuilder, alias_shares_buffer)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+  TensorBuilder builder{reg, "FirstFit"};
+
+  // #1 = reshape(#0), #2 = op(#1)
+  const ir::OperandIndex source{0}, alias{1}, other{2};
+  builder.registerAlias(alias, source);
+  builder.registerTensorInfo(source, floatInfo(4));
+  builder.registerTensorInfo(alias, floatInfo(4));
+  builder.registerTensorInfo(other, floatInfo(4));
+
+  builder.notifyFirstUse(source);
+  builder.notifyFirstUse(alias);
+  builder.notifyLastUse(source);
+  // Buffer of source is still alive because of alias
+  builder.notifyFirstUse(other);
+  builder.notifyLastUse(alias);
+  builder.notifyLastUse(other);
+  builder.allocate();
+
+  const auto source_buffer = reg->getNativeTensor(source)->buffer();
+  ASSERT_NE(source_buffer, nullptr);
+  EXPECT_EQ(reg->getNativeTensor(alias)->buffer(), source_buffer);
+  EXPECT_NE(reg->getNativeTensor(other)->buffer(), source_buffer);
+}
+
+TEST(TensorBuilder, alias_chain_reuses_released_buffer)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+  TensorBuilder builder{reg, "FirstFit"};
+
+  // #1 = reshape(#0), #2 = squeeze(#1), #3 = op(#2)
+  const ir::OperandIndex source{0}, alias1{1}, alias2{2}, other{3};
+  builder.registerAlias(alias1, source);
+  builder.registerAlias(alias2, alias1);
+  for (uint32_t i = 0; i < 4; ++i)
+    builder.registerTensorInfo(ir::OperandIndex{i}, floatInfo(4));
+
+  builder.notifyFirstUse(source);
+  builder.notifyFirstUse(alias1);
+  builder.notifyLastUse(source);
+  builder.notifyFirstUse(alias2);
+  builder.notifyLastUse(alias1);
+  builder.notifyLastUse(alias2);
+  // Buffer of the alias group is released, so it can be reused
+  builder.notifyFirstUse(other);
+  builder.notifyLastUse(other);
+  builder.allocate();
+
+  const auto source_buffer = reg->getNativeTensor(source)->buffer();
+  EXPECT_EQ(reg->getNativeTensor(alias1)->buffer(), source_buffer);
+  EXPECT_EQ(reg->getNativeTensor(alias2)->buffer(), source_buffer);
+  EXPECT_EQ(reg->getNativeTensor(other)->buffer(), source_buffer);
+}
@@ -18,12 +18,14 @@
 #define __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/PerThread.h>
 
 #include <ruy/context.h>
 #include <ruy/context_get_ctx.h>
 #include <ruy/ctx.h>
 #include <ruy/tune.h>
 
+#include <atomic>
 #include <memory>
 
 namespace onert
@@ -40,27 +42,44 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(std::make_unique<ruy::Context>())
+  ExternalContext()
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::NUM_THREADS));
-    initPerThreadState();
   }
 
   void setMaxNumThreads(int max_num_threads)
   {
     const int target_num_threads =
       max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads.store(target_num_threads, std::memory_order_relaxed);
+    _ruy_contexts.forEach([&](ruy::Context *ruy_context) {
+      ruy_context->set_max_num_threads(target_num_threads);
+      initPerThreadState(ruy_context);
+    });
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  /**
+   * @brief Get the ruy context of the calling thread
+   *
+   * A ruy context must not be used by several threads at once, so each thread that runs kernels
+   * of this backend gets its own context.
+   */
+  ruy::Context *ruy_context() const
+  {
+    return _ruy_contexts.get([&]() {
+      auto ruy_context = std::make_unique<ruy::Context>();
+      ruy_context->set_max_num_threads(_max_num_threads.load(std::memory_order_relaxed));
+      initPerThreadState(ruy_context.get());
+      return ruy_context;
+    });
+  }
 
 private:
-  void initPerThreadState()
+  static void initPerThreadState(ruy::Context *ruy_context)
   {
     // Initialize per-thread state.
-    const int thread_count = _ruy_context->max_num_threads();
-    auto ctx = ruy::get_ctx(_ruy_context.get());
+    const int thread_count = ruy_context->max_num_threads();
+    auto ctx = ruy::get_ctx(ruy_context);
     ctx->EnsureThreadSpecificResources(thread_count);
     for (int i = 0; i < thread_count; i++)
     {
@@ -69,7 +88,8 @@ private:
   }
 
 private:
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  std::atomic<int> _max_num_threads{kDefaultNumThreadpoolThreads};
+  util::PerThread<ruy::Context> _ruy_contexts;
 };
 
 } // namespace builtin
@@ -38,6 +38,40 @@ namespace onert
 namespace compiler
 {
 
+namespace
+{
+
+std::shared_ptr<exec::SingleModelExecutors> generateExecutors(
+  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> &lowered_subgs,
+  const util::TracingCtx *tracing_ctx, const CompilerOptions *options,
+  const std::shared_ptr<backend::custom::IKernelBuilder> &custom_kernel_builder)
+{
+  auto executors = std::make_shared<exec::SingleModelExecutors>();
+  for (auto &&[subg_index, lowered_subg] : lowered_subgs)
+  {
+    auto const model_index = ir::ModelIndex{0};
+    auto const indexed_ranks = lowered_subg->indexed_ranks();
+
+    ir::OperationDumper dumper("Executor generation of Subgraph " +
+                               std::to_string(subg_index.value()));
+    lowered_subg->graph().operations().iterate(
+      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
+
+    ExecutorFactoryArgs args;
+    args.tracing_ctx = tracing_ctx;
+    args.options = options;
+    args.model_index = model_index;
+    args.custom_kernel_builder = custom_kernel_builder;
+    auto executor = std::unique_ptr<exec::IExecutor>{
+      ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
+    executor->setIndexedRanks(indexed_ranks);
+    executors->emplace(model_index, subg_index, std::move(executor));
+  }
+  return executors;
+}
+
+} // namespace
+
 Compiler::Compiler(const std::shared_ptr<ir::Model> &model, CompilerOptions *copts)
   : _model{model}, _options{copts}
 {
@@ -156,31 +190,52 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
   /*************************************************************
    *  Backend independent analysis & optimization phase finished
    *************************************************************/
-  auto executors = std::make_shared<exec::SingleModelExecutors>();
-  for (auto &&[subg_index, lowered_subg] : lowered_subgs)
+  // Keep lowering result to create executors again for execution contexts. Executor generation
+  // takes lowered graphs, so copy them before that. Sessions without execution contexts do not
+  // pay for the copies.
+  std::unordered_map<ir::SubgraphIndex, std::shared_ptr<const LoweredGraph>> kept_subgs;
+  if (_options->execution_context_enable)
   {
-    auto const model_index = ir::ModelIndex{0};
-    auto const indexed_ranks = lowered_subg->indexed_ranks();
-
-    ir::OperationDumper dumper("Executor generation of Subgraph " +
-                               std::to_string(subg_index.value()));
-    lowered_subg->graph().operations().iterate(
-      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
-
-    ExecutorFactoryArgs args;
-    args.tracing_ctx = tracing_ctx.get();
-    args.options = _options;
-    args.model_index = model_index;
-    args.custom_kernel_builder = custom_kernel_builder;
-    auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
-    executor->setIndexedRanks(indexed_ranks);
-    executors->emplace(model_index, subg_index, std::move(executor));
+    for (const auto &[subg_index, lowered_subg] : lowered_subgs)
+      kept_subgs.emplace(subg_index, std::make_shared<const LoweredGraph>(*lowered_subg));
   }
 
+  auto executors =
+    generateExecutors(lowered_subgs, tracing_ctx.get(), _options, custom_kernel_builder);
+
   /********************************
    * Code generation phase finished
    ********************************/
+  auto artifact = std::make_shared<CompilerArtifact>(executors, std::move(tracing_ctx));
+  if (_options->execution_context_enable)
+  {
+    artifact->_lowered_subgs = std::move(kept_subgs);
+    artifact->_custom_kernel_builder = custom_kernel_builder;
+  }
+  return artifact;
+}
+
+std::shared_ptr<CompilerArtifact> Compiler::createExecutors(const CompilerArtifact &artifact,
+                                                            CompilerOptions *copts)
+{
+  if (!copts)
+    throw std::runtime_error{"Empty compile option"};
+
+  if (artifact._lowered_subgs.empty())
+    throw std::runtime_error{"Compiler: artifact has no lowering result to create executors. "
+                             "Compile with execution_context_enable option."};
+
+  // Each call works on its own copy of lowered graphs, so it can run on multiple threads
+  auto tracing_ctx = std::make_unique<util::TracingCtx>();
+  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
+  for (const auto &[subg_index, lowered_subg] : artifact._lowered_subgs)
+  {
+    lowered_subgs[subg_index] = std::make_unique<compiler::LoweredGraph>(*lowered_subg);
+    tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
+  }
+
+  auto executors =
+    generateExecutors(lowered_subgs, tracing_ctx.get(), copts, artifact._custom_kernel_builder);
   return std::make_shared<CompilerArtifact>(executors, std::move(tracing_ctx));
 }
 
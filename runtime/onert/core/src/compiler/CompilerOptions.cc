@@ -80,9 +80,16 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
   o->backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   o->graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   o->executor = util::getConfigString(util::config::EXECUTOR);
+  o->parallel_num_workers = util::getConfigInt(util::config::PARALLEL_NUM_WORKERS);
+  o->pipeline_capacity = util::getConfigInt(util::config::PIPELINE_CAPACITY);
+  o->execution_context_enable = util::getConfigBool(util::config::EXECUTION_CONTEXT_ENABLE);
   o->he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   o->he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   o->fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  o->memory_aware_linearize = util::getConfigBool(util::config::MEMORY_AWARE_LINEARIZE);
+  o->reserve_dynamic_tensors = util::getConfigBool(util::config::RESERVE_DYNAMIC_TENSORS);
+  o->train_num_replicas = util::getConfigInt(util::config::TRAIN_NUM_REPLICAS);
+  o->train_flat_optimizer = util::getConfigBool(util::config::TRAIN_FLAT_OPTIMIZER);
   o->workspace_dir = util::getConfigString(util::config::WORKSPACE_DIR);
   {
     // Backend for all
@@ -133,13 +140,20 @@ void CompilerOptions::verboseOptions()
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
+  VERBOSE(Compiler) << "parallel_num_workers     : " << parallel_num_workers << std::endl;
+  VERBOSE(Compiler) << "pipeline_capacity        : " << pipeline_capacity << std::endl;
+  VERBOSE(Compiler) << "execution_context_enable : " << execution_context_enable << std::endl;
   VERBOSE(Compiler) << "manual backend_for_all   : " << manual_scheduler_options.backend_for_all
                     << std::endl;
   VERBOSE(Compiler) << "manual_scheduler_options : "
                     << getOpBackends(manual_scheduler_options.opcode_to_backend) << std::endl;
   VERBOSE(Compiler) << "he_scheduler             : " << he_scheduler << std::endl;
   VERBOSE(Compiler) << "he_profiling_mode        : " << he_profiling_mode << std::endl;
-  VERBOSE(Compiler) << "fp16_enable              : " << fp16_enable << std::endl
+  VERBOSE(Compiler) << "fp16_enable              : " << fp16_enable << std::endl;
+  VERBOSE(Compiler) << "memory_aware_linearize   : " << memory_aware_linearize << std::endl;
+  VERBOSE(Compiler) << "reserve_dynamic_tensors  : " << reserve_dynamic_tensors << std::endl;
+  VERBOSE(Compiler) << "train_num_replicas       : " << train_num_replicas << std::endl;
+  VERBOSE(Compiler) << "train_flat_optimizer     : " << train_flat_optimizer << std::endl
                     << std::noboolalpha;
 }
 
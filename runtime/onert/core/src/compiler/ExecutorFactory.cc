@@ -17,6 +17,7 @@
 #include "ExecutorFactory.h"
 
 #include "Linear.h"
+#include "train/RecomputeSelector.h"
 #include "../backend/builtin/BackendContext.h"
 #include "../backend/builtin/Config.h"
 #include "../backend/builtin/UserTensor.h"
@@ -38,6 +39,7 @@
 #include <compiler/ExecutionBuilder.h>
 #include <util/TracingCtx.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 
@@ -145,6 +147,8 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 
 backend::BackendContexts
 createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
+                      bool reserve_dynamic_tensors,
+                      const std::vector<ir::OperationIndex> &whole_op_order,
                       std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder)
 {
   backend::BackendContexts contexts;
@@ -216,7 +220,6 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
     });
 
   // Create contexts
-  auto whole_op_order = lgraph.graph().topolSortOperations();
   for (auto &&[backend, data] : context_data_map)
   {
     auto graph = data.graph.get();
@@ -241,6 +244,7 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
     std::copy_if(whole_op_order.begin(), whole_op_order.end(), std::back_inserter(op_order),
                  [&](const auto &ind) { return graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
+    data.reserve_dynamic_tensors = reserve_dynamic_tensors;
     data.custom_kernel_builder = custom_kernel_builder;
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
@@ -388,8 +392,14 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto custom_kernel_builder = args.custom_kernel_builder;
   auto &graph = lowered_graph->graph();
 
+  // linearize
+  // NOTE Backends plan their tensors by this order, so it must be decided before creating contexts
+  auto order = Linear::linearize(*lowered_graph, options->memory_aware_linearize);
+  Linear::dump(*lowered_graph, order);
+
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear",
+                          options->reserve_dynamic_tensors, order, custom_kernel_builder);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -398,10 +408,6 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize
-  auto order = Linear::linearize(*lowered_graph);
-  Linear::dump(*lowered_graph, order);
-
   for (auto &&pair : backend_contexts)
   {
     pair.second->genTensors();
@@ -517,7 +523,9 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto custom_kernel_builder = args.custom_kernel_builder;
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear",
+                          options->reserve_dynamic_tensors,
+                          lowered_graph->graph().topolSortOperations(), custom_kernel_builder);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -560,8 +568,13 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
-    exec = new exec::ParallelExecutor{std::move(lowered_graph), std::move(backend_contexts),
-                                      tensor_regs, std::move(code_map), tracing_ctx};
+    const auto num_workers = static_cast<uint32_t>(std::max(options->parallel_num_workers, 1));
+    exec = new exec::ParallelExecutor{std::move(lowered_graph),
+                                      std::move(backend_contexts),
+                                      tensor_regs,
+                                      std::move(code_map),
+                                      tracing_ctx,
+                                      num_workers};
   }
   else
   {
@@ -657,10 +670,21 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     }
   });
 
+  // linearize for forwarding
+  // NOTE Backends plan their tensors by this order, so it must be decided before creating contexts
+  auto order = Linear::linearize(*lowered_graph);
+  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
+  Linear::dump(*lowered_graph, order);
+
+  // Select forward segments to be recomputed in backwarding to fit activations in memory budget
+  const auto recompute_segments =
+    train::RecomputeSelector::select(graph, order, training_info.memoryBudget());
+
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
   backend::BackendContexts base_backend_contexts =
-    createBackendContexts(*lowered_graph, true, custom_kernel_builder);
+    createBackendContexts(*lowered_graph, true, options->reserve_dynamic_tensors, order,
+                          custom_kernel_builder);
 
   // Replace BackendContext with TrainbleBackendContext
   for (auto &&pair : base_backend_contexts)
@@ -720,6 +744,10 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     tdata.custom_kernel_builder = std::move(data.custom_kernel_builder);
     tdata.is_linear_executor = data.is_linear_executor;
     tdata.optim_info = training_info.optimizerInfo();
+    tdata.flat_optimizer = options->train_flat_optimizer;
+    tdata.recompute_segments = recompute_segments;
+    tdata.activation_stash = training_info.activationStash();
+    tdata.shared_trainables = args.shared_trainables;
 
     // TODO Remove dynamic_cast
     const auto tbackend = dynamic_cast<const backend::train::ITrainableBackend *>(backend);
@@ -739,11 +767,6 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize for forwarding
-  auto order = Linear::linearize(*lowered_graph);
-  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
-  Linear::dump(*lowered_graph, order);
-
   // linearize for backwarding
   auto backward_order = lowered_graph->trainable_graph().essentialBackwardOrder();
   VERBOSE(ExecutorFactory) << "Linearize for backwarding order" << std::endl;
@@ -876,6 +899,7 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
                                                  std::move(code_map),
                                                  order,
                                                  backward_order,
+                                                 recompute_segments,
                                                  tracing_ctx,
                                                  training_info.lossInfo()};
 
@@ -41,6 +41,8 @@ struct ExecutorFactoryArgs
   const compiler::CompilerOptions *options;
   ir::ModelIndex model_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
+  // Buffers of trainable tensors owned by another executor, used only for training
+  ir::OperandIndexMap<uint8_t *> shared_trainables;
 };
 
 class ExecutorFactory
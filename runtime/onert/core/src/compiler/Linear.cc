@@ -20,17 +20,186 @@
 
 #include "util/logging.h"
 
+#include <cassert>
 #include <sstream>
+#include <unordered_map>
 
 namespace onert
 {
 namespace compiler
 {
 
-// TODO(easy) Change the LoweredGraph param to Graph
-std::vector<ir::OperationIndex> Linear::linearize(const compiler::ILoweredGraph &lowered_graph)
+namespace
+{
+
+size_t operandSize(const ir::Operand &operand)
+{
+  // Constants are not planned in the arena and dynamic operands are allocated on execution
+  if (operand.isConstant() || operand.info().isDynamic())
+    return 0;
+
+  try
+  {
+    return operand.info().total_size();
+  }
+  catch (const std::runtime_error &)
+  {
+    return 0;
+  }
+}
+
+// Count the operations using each operand
+ir::OperandIndexMap<uint32_t> countUses(const ir::Graph &graph)
 {
-  return lowered_graph.graph().topolSortOperations();
+  ir::OperandIndexMap<uint32_t> uses;
+  graph.operations().iterate([&](const ir::OperationIndex &, const ir::IOperation &op) {
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      uses[input]++;
+  });
+  return uses;
+}
+
+/*
+ * Schedule operations greedily. Among the operations whose inputs are all ready, the one that
+ * increases the live bytes the least is picked, that is, the size of its outputs minus the size of
+ * inputs it uses for the last time. Ties are broken by the topological order so that a branch
+ * keeps being visited in depth-first manner.
+ */
+std::vector<ir::OperationIndex> memoryAwareOrder(const ir::Graph &graph,
+                                                 const std::vector<ir::OperationIndex> &topol_order)
+{
+  const auto &operands = graph.operands();
+  const auto &operations = graph.operations();
+  const auto &graph_outputs = graph.getOutputs();
+
+  std::unordered_map<ir::OperationIndex, size_t> position;
+  std::unordered_map<ir::OperationIndex, uint32_t> pending_inputs;
+  std::vector<ir::OperationIndex> ready;
+  for (size_t i = 0; i < topol_order.size(); ++i)
+  {
+    const auto &ind = topol_order[i];
+    position[ind] = i;
+
+    uint32_t pending = 0;
+    const auto &op = operations.at(ind);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (operands.at(input).getDef().valid())
+        pending++;
+    }
+    pending_inputs[ind] = pending;
+    if (pending == 0)
+      ready.emplace_back(ind);
+  }
+
+  auto remaining_uses = countUses(graph);
+  std::vector<ir::OperationIndex> order;
+  order.reserve(topol_order.size());
+  while (!ready.empty())
+  {
+    auto best = ready.end();
+    int64_t best_delta = 0;
+    for (auto it = ready.begin(); it != ready.end(); ++it)
+    {
+      const auto &op = operations.at(*it);
+      int64_t delta = 0;
+      for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+        delta += operandSize(operands.at(output));
+      for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      {
+        if (remaining_uses[input] == 1 && !graph_outputs.contains(input))
+          delta -= operandSize(operands.at(input));
+      }
+
+      if (best == ready.end() || delta < best_delta ||
+          (delta == best_delta && position[*it] < position[*best]))
+      {
+        best = it;
+        best_delta = delta;
+      }
+    }
+
+    const auto ind = *best;
+    ready.erase(best);
+    order.emplace_back(ind);
+
+    const auto &op = operations.at(ind);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      remaining_uses[input]--;
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      for (const auto &use : operands.at(output).getUses())
+      {
+        if (--pending_inputs[use] == 0)
+          ready.emplace_back(use);
+      }
+    }
+  }
+
+  assert(order.size() == topol_order.size());
+  return order;
+}
+
+} // namespace
+
+std::vector<ir::OperationIndex> Linear::linearize(const compiler::ILoweredGraph &lowered_graph,
+                                                  bool memory_aware)
+{
+  return linearize(lowered_graph.graph(), memory_aware);
+}
+
+std::vector<ir::OperationIndex> Linear::linearize(const ir::Graph &graph, bool memory_aware)
+{
+  auto order = graph.topolSortOperations();
+  if (!memory_aware)
+    return order;
+
+  auto candidate = memoryAwareOrder(graph, order);
+  const auto topol_peak = peakMemory(graph, order);
+  const auto candidate_peak = peakMemory(graph, candidate);
+  VERBOSE(Linearize) << "Planned peak memory: " << topol_peak << " bytes in topological order, "
+                     << candidate_peak << " bytes in memory-aware order" << std::endl;
+
+  // Keep the topological order unless the peak memory gets lower
+  if (candidate_peak < topol_peak)
+    return candidate;
+  return order;
+}
+
+size_t Linear::peakMemory(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order)
+{
+  const auto &operands = graph.operands();
+  const auto &graph_outputs = graph.getOutputs();
+  auto remaining_uses = countUses(graph);
+
+  // Operands without definition(e.g. graph inputs) are live from the beginning
+  size_t live = 0;
+  operands.iterate([&](const ir::OperandIndex &, const ir::Operand &operand) {
+    if (!operand.getDef().valid())
+      live += operandSize(operand);
+  });
+
+  size_t peak = live;
+  for (const auto &ind : order)
+  {
+    const auto &op = graph.operations().at(ind);
+    const auto outputs = op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+    for (const auto &output : outputs)
+      live += operandSize(operands.at(output));
+    peak = std::max(peak, live);
+
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (--remaining_uses[input] == 0 && !graph_outputs.contains(input))
+        live -= operandSize(operands.at(input));
+    }
+    for (const auto &output : outputs)
+    {
+      if (remaining_uses[output] == 0 && !graph_outputs.contains(output))
+        live -= operandSize(operands.at(output));
+    }
+  }
+  return peak;
 }
 
 // TODO(easy) Change the LoweredGraph param to Graph
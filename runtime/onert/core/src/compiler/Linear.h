@@ -20,6 +20,7 @@
 #include <vector>
 #include <memory>
 
+#include "ir/Graph.h"
 #include "ir/Index.h"
 #include "compiler/ILoweredGraph.h"
 
@@ -31,9 +32,24 @@ namespace compiler
 class Linear
 {
 public:
-  static std::vector<ir::OperationIndex> linearize(const compiler::ILoweredGraph &lowered_graph);
+  /**
+   * @brief Linearize operations of the graph
+   * @param[in] lowered_graph Graph to linearize
+   * @param[in] memory_aware  Whether to order operations to reduce peak memory of operands
+   * @return Order of operations
+   */
+  static std::vector<ir::OperationIndex> linearize(const compiler::ILoweredGraph &lowered_graph,
+                                                   bool memory_aware = false);
+  static std::vector<ir::OperationIndex> linearize(const ir::Graph &graph, bool memory_aware);
   static void dump(const compiler::ILoweredGraph &lowered_graph,
                    const std::vector<ir::OperationIndex> &order);
+  /**
+   * @brief Get the peak bytes of non-constant operands live at once when running in the order
+   * @param[in] graph Graph of the operations
+   * @param[in] order Order of operations
+   * @return Peak bytes
+   */
+  static size_t peakMemory(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order);
 };
 
 } // namespace compiler
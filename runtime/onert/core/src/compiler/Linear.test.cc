@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Linear.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace onert;
+
+namespace
+{
+
+ir::OperationIndex addAdd(ir::Graph &graph, const ir::OperandIndexSequence inputs,
+                          const ir::OperandIndexSequence outputs)
+{
+  ir::operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = ir::Activation::NONE;
+  return graph.addOperation(
+    std::make_unique<ir::operation::BinaryArithmetic>(inputs, outputs, param));
+}
+
+ir::OperandIndex addOperand(ir::Graph &graph, int32_t num_elements)
+{
+  return graph.addOperand(ir::Shape{num_elements}, ir::TypeInfo{ir::DataType::FLOAT32});
+}
+
+// Check that every operation comes after the operations defining its inputs
+void verifyTopological(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order)
+{
+  ASSERT_EQ(order.size(), graph.operations().size());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    for (const auto &input : graph.operations().at(order[i]).getInputs())
+    {
+      const auto def = graph.operands().at(input).getDef();
+      if (def.valid())
+      {
+        ASSERT_LT(std::find(order.begin(), order.end(), def) - order.begin(), i);
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(Linear, memory_aware_linearize)
+{
+  // Two branches joining at the end. The short branch keeps its large output until the join,
+  // so it is better to run the long branch, which shrinks its output, first.
+  //
+  //        +--> a1(80) --> b1(1) --+
+  // x --> p                        +--> y
+  //        +--> a2(100) -----------+
+  ir::Graph graph;
+  auto x = addOperand(graph, 1);
+  auto p = addOperand(graph, 1);
+  auto a1 = addOperand(graph, 80);
+  auto b1 = addOperand(graph, 1);
+  auto a2 = addOperand(graph, 100);
+  auto y = addOperand(graph, 1);
+
+  addAdd(graph, {x, x}, {p});
+  addAdd(graph, {p, p}, {a2});
+  addAdd(graph, {p, p}, {a1});
+  addAdd(graph, {a1, a1}, {b1});
+  addAdd(graph, {b1, a2}, {y});
+  graph.addInput(x);
+  graph.addOutput(y);
+  graph.verify();
+
+  const auto topol_order = compiler::Linear::linearize(graph, false);
+  const auto order = compiler::Linear::linearize(graph, true);
+  verifyTopological(graph, topol_order);
+  verifyTopological(graph, order);
+
+  const auto topol_peak = compiler::Linear::peakMemory(graph, topol_order);
+  const auto peak = compiler::Linear::peakMemory(graph, order);
+  ::testing::Test::RecordProperty("topological_peak_bytes", std::to_string(topol_peak));
+  ::testing::Test::RecordProperty("memory_aware_peak_bytes", std::to_string(peak));
+
+  // p, b1 and a2 are live at once while running the short branch
+  ASSERT_EQ(peak, 4 * (1 + 1 + 100));
+  ASSERT_LE(peak, topol_peak);
+}
+
+TEST(Linear, memory_aware_linearize_chain)
+{
+  // A chain has only one order
+  ir::Graph graph;
+  auto x = addOperand(graph, 4);
+  auto h = addOperand(graph, 8);
+  auto y = addOperand(graph, 2);
+  addAdd(graph, {x, x}, {h});
+  addAdd(graph, {h, h}, {y});
+  graph.addInput(x);
+  graph.addOutput(y);
+  graph.verify();
+
+  const auto topol_order = compiler::Linear::linearize(graph, false);
+  const auto order = compiler::Linear::linearize(graph, true);
+  ASSERT_EQ(order, topol_order);
+  ASSERT_EQ(compiler::Linear::peakMemory(graph, order), 4 * (4 + 8));
+}
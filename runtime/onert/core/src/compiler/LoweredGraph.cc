@@ -43,6 +43,17 @@ LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &option
   lowerGraph(options);
 }
 
+LoweredGraph::LoweredGraph(const LoweredGraph &lowered_graph)
+  : _graph{lowered_graph._graph}, _indexed_ranks{lowered_graph._indexed_ranks},
+    _has_dynamic_tensor_map{lowered_graph._has_dynamic_tensor_map}
+{
+  _lower_info_map.operation = lowered_graph._lower_info_map.operation;
+  lowered_graph._lower_info_map.operand.iterate(
+    [&](const ir::OperandIndex &index, const OperandLowerInfo &operand_li) {
+      _lower_info_map.operand.set(index, std::make_unique<OperandLowerInfo>(operand_li));
+    });
+}
+
 void LoweredGraph::lowerGraph(const CompilerOptions &options)
 {
   // Build backend contexts
@@ -1005,6 +1005,58 @@ void ShapeValidator::visit(const ir::operation::Reverse &node)
   OP_REQUIRES(operands.at(output_index).shape() == operands.at(input_index).shape());
 }
 
+void ShapeValidator::visit(const ir::operation::RmsNorm &node)
+{
+  const auto &operands = _graph.operands();
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (operands.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::RmsNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::RmsNorm::Input::BETA)};
+
+  const auto &ifm_shape = operands.at(ifm_index).shape();
+  OP_REQUIRES(ifm_shape.rank() >= 1);
+  OP_REQUIRES(ifm_shape == operands.at(ofm_index).shape());
+
+  const auto channels = ifm_shape.dim(ifm_shape.rank() - 1);
+  const auto &gamma_shape = operands.at(gamma_index).shape();
+  const auto &beta_shape = operands.at(beta_index).shape();
+  // gamma and beta of [1] are broadcast to all channels
+  OP_REQUIRES(gamma_shape.rank() == 1);
+  OP_REQUIRES(gamma_shape.dim(0) == channels || gamma_shape.dim(0) == 1);
+  OP_REQUIRES(beta_shape.rank() == 1);
+  OP_REQUIRES(beta_shape.dim(0) == channels || beta_shape.dim(0) == 1);
+}
+
+void ShapeValidator::visit(const ir::operation::RoPE &node)
+{
+  const auto &operands = _graph.operands();
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (operands.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::RoPE::Input::INPUT)};
+  const auto sin_index{node.getInputs().at(ir::operation::RoPE::Input::SIN_TABLE)};
+  const auto cos_index{node.getInputs().at(ir::operation::RoPE::Input::COS_TABLE)};
+
+  // Input: [batch, num_heads, seq_len, head_size]
+  // Tables: [..., seq_len or 1, head_size]
+  const auto &ifm_shape = operands.at(ifm_index).shape();
+  OP_REQUIRES(ifm_shape.rank() == 4);
+  OP_REQUIRES(ifm_shape == operands.at(ofm_index).shape());
+
+  const auto head_size = ifm_shape.dim(3);
+  OP_REQUIRES(head_size % 2 == 0);
+
+  const auto &sin_shape = operands.at(sin_index).shape();
+  OP_REQUIRES(sin_shape == operands.at(cos_index).shape());
+  OP_REQUIRES(sin_shape.rank() >= 1 && sin_shape.dim(sin_shape.rank() - 1) == head_size);
+  const auto table_rows = sin_shape.num_elements() / head_size;
+  OP_REQUIRES(table_rows == 1 || table_rows == static_cast<uint64_t>(ifm_shape.dim(2)));
+}
+
 void ShapeValidator::visit(const ir::operation::If &)
 {
   // TODO Add to validate with subgraphs
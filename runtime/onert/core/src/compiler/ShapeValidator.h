@@ -86,6 +86,8 @@ public:
   void visit(const ir::operation::Shape &node) override;
   void visit(const ir::operation::ResizeBilinear &node) override;
   void visit(const ir::operation::Reverse &node) override;
+  void visit(const ir::operation::RmsNorm &node) override;
+  void visit(const ir::operation::RoPE &node) override;
   void visit(const ir::operation::If &node) override;
   void visit(const ir::operation::While &node) override;
   void visit(const ir::operation::SquaredDifference &node) override;
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputeSelector.h"
+
+#include "ir/OperationIndexMap.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+namespace
+{
+
+uint64_t activationSize(const ir::Operand &operand)
+{
+  // Constants are not activations and dynamic operands are not planned
+  if (operand.isConstant() || operand.info().isDynamic())
+    return 0;
+
+  return operand.info().total_size();
+}
+
+// Estimate the peak with the segment id of each operation in order. The last segment is kept.
+uint64_t estimate(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order,
+                  const std::vector<uint32_t> &segment_ids)
+{
+  assert(order.size() == segment_ids.size());
+  if (order.empty())
+    return 0;
+
+  ir::OperationIndexMap<uint32_t> segment_of;
+  for (size_t i = 0; i < order.size(); ++i)
+    segment_of[order[i]] = segment_ids[i];
+
+  const auto &graph_outputs = graph.getOutputs();
+  uint64_t checkpoints = 0;
+  std::vector<uint64_t> activations(segment_ids.back() + 1, 0);
+  for (const auto &op_index : order)
+  {
+    const auto &op = graph.operations().at(op_index);
+    const auto def_segment = segment_of.at(op_index);
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      const auto &operand = graph.operands().at(output);
+      const auto size = activationSize(operand);
+      if (size == 0)
+        continue;
+
+      bool is_checkpoint = operand.getUses().size() == 0 || graph_outputs.contains(output);
+      for (const auto &use : operand.getUses())
+      {
+        const auto it = segment_of.find(use);
+        if (it == segment_of.end() || it->second != def_segment)
+          is_checkpoint = true;
+      }
+
+      if (is_checkpoint)
+        checkpoints += size;
+      else
+        activations[def_segment] += size;
+    }
+  }
+
+  return checkpoints + *std::max_element(activations.begin(), activations.end());
+}
+
+} // namespace
+
+RecomputeSelector::Segments RecomputeSelector::select(const ir::Graph &graph,
+                                                      const std::vector<ir::OperationIndex> &order,
+                                                      uint64_t budget)
+{
+  if (budget == 0 || order.empty())
+    return Segments{};
+
+  // Bytes of activations defined by each operation
+  std::vector<uint64_t> op_sizes(order.size(), 0);
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    const auto &op = graph.operations().at(order[i]);
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      op_sizes[i] += activationSize(graph.operands().at(output));
+  }
+
+  const auto keep_all_peak = estimate(graph, order, std::vector<uint32_t>(order.size(), 0));
+  if (keep_all_peak <= budget)
+  {
+    VERBOSE(RecomputeSelector) << "Activation peak: " << keep_all_peak << " bytes without "
+                               << "recomputation fits in the budget " << budget << std::endl;
+    return Segments{};
+  }
+
+  // Candidates of the bytes limit of a segment are the bytes of prefixes of the order
+  std::vector<uint64_t> limits;
+  uint64_t prefix = 0;
+  for (size_t i = 0; i + 1 < order.size(); ++i)
+  {
+    prefix += op_sizes[i];
+    limits.emplace_back(prefix);
+  }
+  std::sort(limits.begin(), limits.end(), std::greater<uint64_t>());
+  limits.erase(std::unique(limits.begin(), limits.end()), limits.end());
+
+  // Try larger limits first until the peak fits in the budget. Fewer segments are preferred
+  // because the last segment, which is not recomputed, gets larger.
+  std::vector<uint32_t> best_ids(order.size(), 0);
+  uint64_t best_peak = keep_all_peak;
+  std::vector<uint32_t> segment_ids(order.size());
+  for (const auto limit : limits)
+  {
+    // Cut greedily before an operation that makes the segment exceed the limit
+    uint32_t segment = 0;
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      if (accumulated > 0 && accumulated + op_sizes[i] > limit)
+      {
+        ++segment;
+        accumulated = 0;
+      }
+      accumulated += op_sizes[i];
+      segment_ids[i] = segment;
+    }
+
+    const auto peak = estimate(graph, order, segment_ids);
+    if (peak < best_peak)
+    {
+      best_peak = peak;
+      best_ids = segment_ids;
+      if (best_peak <= budget)
+        break;
+    }
+  }
+
+  if (best_peak > budget)
+  {
+    VERBOSE(RecomputeSelector) << "WARNING: The budget " << budget << " cannot be met. "
+                               << "Use segments with the lowest activation peak" << std::endl;
+  }
+
+  Segments segments(best_ids.back());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    if (best_ids[i] < segments.size())
+      segments[best_ids[i]].emplace_back(order[i]);
+  }
+
+  VERBOSE(RecomputeSelector) << "Activation peak: " << keep_all_peak
+                             << " bytes without recomputation, " << best_peak << " bytes with "
+                             << segments.size() << " recomputed segment(s) (budget " << budget
+                             << ")" << std::endl;
+
+  return segments;
+}
+
+uint64_t RecomputeSelector::estimatePeak(const ir::Graph &graph,
+                                         const std::vector<ir::OperationIndex> &order,
+                                         const Segments &segments)
+{
+  std::vector<uint32_t> segment_ids(order.size(), segments.size());
+  ir::OperationIndexMap<uint32_t> segment_of;
+  for (uint32_t k = 0; k < segments.size(); ++k)
+  {
+    for (const auto &op_index : segments[k])
+      segment_of[op_index] = k;
+  }
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    const auto it = segment_of.find(order[i]);
+    if (it != segment_of.end())
+      segment_ids[i] = it->second;
+  }
+
+  return estimate(graph, order, segment_ids);
+}
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
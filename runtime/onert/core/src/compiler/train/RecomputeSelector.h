@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_TRAIN_RECOMPUTE_SELECTOR_H__
+#define __ONERT_COMPILER_TRAIN_RECOMPUTE_SELECTOR_H__
+
+#include "ir/Graph.h"
+#include "ir/Index.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+/**
+ * @brief Class to select forward segments whose activations are recomputed during backwarding
+ *
+ * The forward order is split into contiguous segments. Activations that cross a segment boundary
+ * are checkpoints and kept until backwarding. The other activations of every segment but the last
+ * are released after forwarding and recomputed from the checkpoints by forwarding the segment
+ * again right before its first backwarding operation.
+ */
+class RecomputeSelector
+{
+public:
+  using Segments = std::vector<std::vector<ir::OperationIndex>>;
+
+public:
+  /**
+   * @brief Select segments to be recomputed so that the activations fit in the memory budget
+   * @param[in] graph  Graph of the operations
+   * @param[in] order  Forward order of operations
+   * @param[in] budget Bytes for activations kept for backwarding. 0 means no limit.
+   * @return Segments to be recomputed in forward order. Empty if no recomputation is needed.
+   *         If the budget cannot be met, the segments with the lowest peak are returned.
+   */
+  static Segments select(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order,
+                         uint64_t budget);
+  /**
+   * @brief Estimate the peak bytes of activations when the segments are recomputed
+   * @param[in] graph    Graph of the operations
+   * @param[in] order    Forward order of operations
+   * @param[in] segments Segments to be recomputed, which are a prefix of @p order
+   * @return Bytes of checkpoints plus the largest activations of one segment
+   */
+  static uint64_t estimatePeak(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order,
+                               const Segments &segments);
+};
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_TRAIN_RECOMPUTE_SELECTOR_H__
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputeSelector.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+
+namespace
+{
+
+ir::OperationIndex addAdd(ir::Graph &graph, const ir::OperandIndexSequence inputs,
+                          const ir::OperandIndexSequence outputs)
+{
+  ir::operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = ir::Activation::NONE;
+  return graph.addOperation(
+    std::make_unique<ir::operation::BinaryArithmetic>(inputs, outputs, param));
+}
+
+ir::OperandIndex addOperand(ir::Graph &graph, int32_t num_elements)
+{
+  return graph.addOperand(ir::Shape{num_elements}, ir::TypeInfo{ir::DataType::FLOAT32});
+}
+
+// x --> h1 --> h2 --> ... --> h8 --> y, where every h has the same size
+std::vector<ir::OperationIndex> buildChain(ir::Graph &graph)
+{
+  auto x = addOperand(graph, 100);
+  graph.addInput(x);
+
+  std::vector<ir::OperationIndex> order;
+  auto prev = x;
+  for (int i = 0; i < 8; ++i)
+  {
+    auto h = addOperand(graph, 100);
+    order.emplace_back(addAdd(graph, {prev, prev}, {h}));
+    prev = h;
+  }
+  auto y = addOperand(graph, 1);
+  order.emplace_back(addAdd(graph, {prev, prev}, {y}));
+  graph.addOutput(y);
+  graph.verify();
+
+  return order;
+}
+
+} // namespace
+
+TEST(RecomputeSelector, no_recompute)
+{
+  ir::Graph graph;
+  const auto order = buildChain(graph);
+
+  const auto keep_all_peak = compiler::train::RecomputeSelector::estimatePeak(graph, order, {});
+  ASSERT_EQ(keep_all_peak, 4 * (8 * 100 + 1));
+
+  // No limit
+  ASSERT_TRUE(compiler::train::RecomputeSelector::select(graph, order, 0).empty());
+  // Enough budget
+  ASSERT_TRUE(compiler::train::RecomputeSelector::select(graph, order, keep_all_peak).empty());
+}
+
+TEST(RecomputeSelector, select_in_budget)
+{
+  ir::Graph graph;
+  const auto order = buildChain(graph);
+
+  const uint64_t budget = 4 * (4 * 100 + 1);
+  const auto segments = compiler::train::RecomputeSelector::select(graph, order, budget);
+  ASSERT_FALSE(segments.empty());
+
+  // Segments are a prefix of the order
+  size_t pos = 0;
+  for (const auto &segment : segments)
+  {
+    ASSERT_FALSE(segment.empty());
+    for (const auto &op_index : segment)
+      ASSERT_EQ(op_index, order[pos++]);
+  }
+  ASSERT_LT(pos, order.size());
+
+  const auto peak = compiler::train::RecomputeSelector::estimatePeak(graph, order, segments);
+  ::testing::Test::RecordProperty("activation_peak_bytes", std::to_string(peak));
+  ::testing::Test::RecordProperty("recomputed_segments", std::to_string(segments.size()));
+  ASSERT_LE(peak, budget);
+}
+
+TEST(RecomputeSelector, neg_budget_too_small)
+{
+  ir::Graph graph;
+  const auto order = buildChain(graph);
+
+  // A budget smaller than any activation cannot be met, but the peak still gets lower
+  const auto segments = compiler::train::RecomputeSelector::select(graph, order, 1);
+  ASSERT_FALSE(segments.empty());
+  ASSERT_LT(compiler::train::RecomputeSelector::estimatePeak(graph, order, segments),
+            compiler::train::RecomputeSelector::estimatePeak(graph, order, {}));
+}
@@ -27,6 +27,7 @@
 #include "../pass/UnusedOperandEliminationPass.h"
 #include "../ShapeValidator.h"
 #include "../../dumper/dot/DotDumper.h"
+#include "../../exec/train/TrainableExecutor.h"
 #include "../../exec/train/TrainableExecutors.h"
 #include "../../ir/OperationDumper.h"
 #include "../../ir/verifier/Verifier.h"
@@ -38,6 +39,93 @@
 #include <misc/polymorphic_downcast.h>
 #include <misc/string_helpers.h>
 
+#include <algorithm>
+
+namespace
+{
+
+using namespace onert;
+
+using LoweredTrainableGraphs =
+  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::train::LoweredTrainableGraph>>;
+
+/**
+ * @brief Lower trainable subgraphs, and infer and validate shapes of the lowered subgraphs
+ *
+ * @param tracing_ctx Tracing context to register the lowered subgraphs to, or nullptr
+ */
+LoweredTrainableGraphs lowerTrainableGraphs(
+  const std::unordered_map<ir::SubgraphIndex, std::shared_ptr<ir::train::TrainableGraph>>
+    &trainable_subgraphs,
+  const compiler::CompilerOptions &options, util::TracingCtx *tracing_ctx)
+{
+  LoweredTrainableGraphs lowered_subgs;
+  for (auto &&[subg_index, trainable_subg] : trainable_subgraphs)
+  {
+    // Lower: Assign backend
+    lowered_subgs[subg_index] =
+      std::make_unique<compiler::train::LoweredTrainableGraph>(*trainable_subg, options);
+    // Set tracing_ctx for copied graph
+    if (tracing_ctx)
+      tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
+  }
+
+  // Set operands' info for back propagation as default tensor info
+  for (const auto &pair : lowered_subgs)
+  {
+    auto lowered_subg = pair.second.get();
+    auto &tgraph = lowered_subg->trainable_graph();
+    tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
+      if (!obj.isConstant())
+      {
+        auto bwd_operand = std::make_unique<ir::Operand>(obj);
+        const auto gen_index = tgraph.addBackwardOperand(index, std::move(bwd_operand));
+        assert(gen_index == index);
+        UNUSED_RELEASE(gen_index);
+      }
+    });
+  }
+
+  // Shape inference.
+  {
+    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
+    // recursively
+    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::StaticShapeInferer>>
+      inferers = compiler::createStaticShapeInferers(lowered_subgs);
+
+    const auto primary_subg_idx = ir::SubgraphIndex{0};
+    inferers.at(primary_subg_idx)->infer();
+
+    for (const auto &pair_inferer : inferers)
+    {
+      const auto inferer = pair_inferer.second.get();
+      inferer->dump();
+    }
+
+    // NOTE StaticBackwardShapeInferer is allocated for each subgraph,
+    //      so it does not support models that have controlflow operations yet.
+    for (auto &&pair : lowered_subgs)
+    {
+      auto &lowered_subg = pair.second;
+      auto inferer = std::make_unique<compiler::train::StaticBackwardShapeInferer>(
+        lowered_subg.get());
+      inferer->infer();
+      inferer->dump();
+    }
+  }
+
+  // Shape validation
+  for (const auto &pair : lowered_subgs)
+  {
+    auto &lowered_subg = pair.second;
+    compiler::ShapeValidator{lowered_subg->graph()}();
+  }
+
+  return lowered_subgs;
+}
+
+} // namespace
+
 namespace onert
 {
 namespace compiler
@@ -175,6 +263,14 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
                     nnfw::misc::str("after_initializing_training_usedefs-", subg_index.value()));
   }
 
+  // Each replica trains a micro-batch of the same size
+  const auto num_replicas = _options->train_num_replicas;
+  if (num_replicas < 1 || _training_info.batchSize() % num_replicas != 0)
+    throw std::runtime_error("TrainingCompiler: batch size " +
+                             std::to_string(_training_info.batchSize()) +
+                             " is not divided into " + std::to_string(num_replicas) + " replicas");
+  const auto micro_batch_size = _training_info.batchSize() / num_replicas;
+
   // Change input shape according to batch_size
   for (auto &&pair : trainable_subgraphs)
   {
@@ -187,7 +283,7 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
       // TODO Consider batch size index
       if (new_shape.dim(0) != 1)
         throw std::runtime_error("the first dim is not 1. It is not supported yet.");
-      new_shape.dim(0) = _training_info.batchSize();
+      new_shape.dim(0) = micro_batch_size;
       input.info().shape(new_shape);
     }
   }
@@ -199,74 +295,13 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
   auto tracing_ctx = std::make_unique<util::TracingCtx>();
 
   // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::train::LoweredTrainableGraph>>
-    lowered_subgs;
-  {
-    for (auto &&[subg_index, trainable_subg] : trainable_subgraphs)
-    {
-      // Lower: Assign backend
-      lowered_subgs[subg_index] =
-        std::make_unique<compiler::train::LoweredTrainableGraph>(*trainable_subg, *_options);
-      // Set tracing_ctx for copied graph
-      tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
-    }
-  }
+  auto lowered_subgs = lowerTrainableGraphs(trainable_subgraphs, *_options, tracing_ctx.get());
 
   for (const auto &[subg_index, lowered_subg] : lowered_subgs)
   {
     dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
   }
 
-  // Set operands' info for back propagation as default tensor info
-  for (const auto &pair : lowered_subgs)
-  {
-    auto lowered_subg = pair.second.get();
-    auto &tgraph = lowered_subg->trainable_graph();
-    tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
-      if (!obj.isConstant())
-      {
-        auto bwd_operand = std::make_unique<ir::Operand>(obj);
-        const auto gen_index = tgraph.addBackwardOperand(index, std::move(bwd_operand));
-        assert(gen_index == index);
-        UNUSED_RELEASE(gen_index);
-      }
-    });
-  }
-
-  // Shape inference.
-  {
-    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
-    // recursively
-    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
-      createStaticShapeInferers(lowered_subgs);
-
-    const auto primary_subg_idx = ir::SubgraphIndex{0};
-    inferers.at(primary_subg_idx)->infer();
-
-    for (const auto &pair_inferer : inferers)
-    {
-      const auto inferer = pair_inferer.second.get();
-      inferer->dump();
-    }
-
-    // NOTE StaticBackwardShapeInferer is allocated for each subgraph,
-    //      so it does not support models that have controlflow operations yet.
-    for (auto &&pair : lowered_subgs)
-    {
-      auto &lowered_subg = pair.second;
-      auto inferer = std::make_unique<StaticBackwardShapeInferer>(lowered_subg.get());
-      inferer->infer();
-      inferer->dump();
-    }
-  }
-
-  // Shape validation
-  for (const auto &pair : lowered_subgs)
-  {
-    auto &lowered_subg = pair.second;
-    compiler::ShapeValidator{lowered_subg->graph()}();
-  }
-
   // TODO Validate shapes of the tensors for back propagation
 
   /*************************************************************
@@ -283,14 +318,49 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
     lowered_subg->graph().operations().iterate(
       [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
 
+    // Replicas share the memory budget
+    auto training_info = _training_info;
+    if (training_info.memoryBudget() > 0)
+      training_info.setMemoryBudget(
+        std::max<uint64_t>(training_info.memoryBudget() / num_replicas, 1));
+
     ExecutorFactoryArgs args;
     args.tracing_ctx = tracing_ctx.get();
     args.options = _options;
     args.model_index = model_index;
     args.custom_kernel_builder = custom_kernel_builder;
     auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_subg), executors, args, _training_info)};
+      ExecutorFactory::get().create(std::move(lowered_subg), executors, args, training_info)};
     executor->setIndexedRanks(indexed_ranks);
+
+    // Replicas are lowered from the same trainable subgraph, and they are neither traced nor
+    // registered to executors. They use the weights of this executor instead of their own.
+    if (num_replicas > 1)
+    {
+      auto replica_options = *_options;
+      replica_options.workspace_dir.clear();
+      ExecutorFactoryArgs replica_args = args;
+      replica_args.options = &replica_options;
+      nnfw::misc::polymorphic_downcast<exec::train::TrainableExecutor *>(executor.get())
+        ->iterateTrainableTensors(
+          [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *tensor) {
+            replica_args.shared_trainables.emplace(index, tensor->buffer());
+          });
+
+      std::vector<std::unique_ptr<exec::train::TrainableExecutor>> replicas;
+      for (int r = 1; r < num_replicas; ++r)
+      {
+        auto replica_subgs =
+          lowerTrainableGraphs({{subg_index, trainable_subgraphs.at(subg_index)}}, replica_options,
+                               nullptr);
+        auto replica = ExecutorFactory::get().create(std::move(replica_subgs.at(subg_index)),
+                                                     executors, replica_args, training_info);
+        replicas.emplace_back(
+          nnfw::misc::polymorphic_downcast<exec::train::TrainableExecutor *>(replica));
+      }
+      nnfw::misc::polymorphic_downcast<exec::train::TrainableExecutor *>(executor.get())
+        ->setReplicas(std::move(replicas));
+    }
     executors->emplace(model_index, subg_index, std::move(executor));
   }
 
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/BatchingExecution.h"
+
+#include "util/logging.h"
+
+#include <cstring>
+
+namespace onert
+{
+namespace exec
+{
+
+struct BatchingExecution::Request
+{
+  const std::vector<const void *> *inputs;
+  const std::vector<void *> *outputs;
+  std::chrono::steady_clock::time_point submit_time;
+  bool finished = false;
+  std::exception_ptr error = nullptr;
+};
+
+namespace
+{
+
+uint64_t elapsedMicros(std::chrono::steady_clock::time_point from,
+                       std::chrono::steady_clock::time_point to)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+} // namespace
+
+BatchingExecution::BatchingExecution(const std::shared_ptr<IExecutors> &executors,
+                                     uint32_t max_batch_size, std::chrono::microseconds window)
+  : _execution{executors}, _max_batch_size{max_batch_size}, _window{window}, _stopped{false},
+    _start{std::chrono::steady_clock::now()}
+{
+  if (max_batch_size == 0)
+    throw std::runtime_error{"Batching: max batch size must be positive"};
+
+  for (uint32_t i = 0; i < executors->inputSize(); ++i)
+  {
+    const auto &info = executors->inputInfo(ir::IOIndex{i});
+    if (info.shape().rank() == 0)
+      throw std::runtime_error{"Batching: input must have batch dimension"};
+    _input_shapes.emplace_back(info.shape());
+    _input_sizes.emplace_back(info.total_size());
+  }
+  for (uint32_t i = 0; i < executors->outputSize(); ++i)
+  {
+    const auto &info = executors->outputInfo(ir::IOIndex{i});
+    if (info.shape().rank() == 0)
+      throw std::runtime_error{"Batching: output must have batch dimension"};
+    _output_shapes.emplace_back(info.shape());
+    _output_sizes.emplace_back(info.total_size());
+  }
+  _input_buffers.resize(_input_sizes.size());
+  _output_buffers.resize(_output_sizes.size());
+
+  _worker = std::thread{&BatchingExecution::runWorker, this};
+}
+
+BatchingExecution::~BatchingExecution()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stopped = true;
+  }
+  _cv.notify_all();
+  _worker.join();
+}
+
+void BatchingExecution::run(const std::vector<const void *> &inputs,
+                            const std::vector<void *> &outputs)
+{
+  if (inputs.size() != _input_sizes.size() || outputs.size() != _output_sizes.size())
+    throw std::runtime_error{"Batching: invalid number of inputs or outputs"};
+
+  Request request;
+  request.inputs = &inputs;
+  request.outputs = &outputs;
+  request.submit_time = std::chrono::steady_clock::now();
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  if (_stopped)
+    throw std::runtime_error{"Batching: already stopped"};
+  _queue.push_back(&request);
+  _cv.notify_all();
+
+  _done_cv.wait(lock, [&] { return request.finished; });
+  if (request.error)
+    std::rethrow_exception(request.error);
+}
+
+BatchingExecution::Stats BatchingExecution::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto stats = _stats;
+  stats.elapsed_us = elapsedMicros(_start, std::chrono::steady_clock::now());
+  return stats;
+}
+
+void BatchingExecution::runWorker()
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  while (true)
+  {
+    _cv.wait(lock, [&] { return _stopped || !_queue.empty(); });
+    if (_queue.empty())
+      break;
+
+    // Wait for more requests until the oldest one has waited for the window
+    const auto deadline = _queue.front()->submit_time + _window;
+    _cv.wait_until(lock, deadline, [&] { return _stopped || _queue.size() >= _max_batch_size; });
+
+    std::vector<Request *> batch;
+    while (!_queue.empty() && batch.size() < _max_batch_size)
+    {
+      batch.emplace_back(_queue.front());
+      _queue.pop_front();
+    }
+
+    lock.unlock();
+    runBatch(batch);
+    lock.lock();
+  }
+}
+
+void BatchingExecution::runBatch(const std::vector<Request *> &batch)
+{
+  const auto start_time = std::chrono::steady_clock::now();
+  const auto batch_size = static_cast<uint32_t>(batch.size());
+  std::exception_ptr error = nullptr;
+
+  try
+  {
+    for (uint32_t i = 0; i < _input_sizes.size(); ++i)
+    {
+      const auto size = _input_sizes[i];
+      auto &buffer = _input_buffers[i];
+      buffer.resize(size * batch_size);
+      for (uint32_t r = 0; r < batch_size; ++r)
+        std::memcpy(buffer.data() + size * r, batch[r]->inputs->at(i), size);
+
+      auto shape = _input_shapes[i];
+      shape.dim(0) *= static_cast<int32_t>(batch_size);
+      _execution.setInput(ir::IOIndex{i}, shape, buffer.data(), buffer.size());
+    }
+    for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+    {
+      auto &buffer = _output_buffers[i];
+      buffer.resize(_output_sizes[i] * batch_size);
+      _execution.setOutput(ir::IOIndex{i}, buffer.data(), buffer.size());
+    }
+
+    VERBOSE(BatchingExecution) << "Run batch of " << batch_size << " requests" << std::endl;
+    _execution.execute();
+
+    for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+    {
+      const auto size = _output_sizes[i];
+      const auto shape = _execution.getOutputShape(ir::IOIndex{i});
+      if (shape.rank() == 0 ||
+          shape.dim(0) != _output_shapes[i].dim(0) * static_cast<int32_t>(batch_size) ||
+          _execution.getOutputTotalSize(ir::IOIndex{i}) != size * batch_size)
+        throw std::runtime_error{"Batching: output is not batched along the first dimension"};
+
+      const auto &buffer = _output_buffers[i];
+      for (uint32_t r = 0; r < batch_size; ++r)
+        std::memcpy(batch[r]->outputs->at(i), buffer.data() + size * r, size);
+    }
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  const auto end_time = std::chrono::steady_clock::now();
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stats.batch_count++;
+    _stats.execute_us += elapsedMicros(start_time, end_time);
+    for (auto request : batch)
+    {
+      _stats.request_count++;
+      _stats.queue_us += elapsedMicros(request->submit_time, start_time);
+      _stats.latency_us += elapsedMicros(request->submit_time, end_time);
+
+      // Request lives on the stack of caller, so it must not be touched after lock is released
+      request->error = error;
+      request->finished = true;
+    }
+  }
+  _done_cv.notify_all();
+}
+
+} // namespace exec
+} // namespace onert
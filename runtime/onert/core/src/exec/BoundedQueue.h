@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_BOUNDED_QUEUE_H__
+#define __ONERT_EXEC_BOUNDED_QUEUE_H__
+
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Blocking FIFO queue with fixed capacity
+ *
+ * @c push blocks while the queue is full, and @c pop blocks while the queue is empty.
+ * After @c close, @c push is rejected and @c pop drains remaining items then returns false.
+ */
+template <typename T> class BoundedQueue
+{
+public:
+  BoundedQueue(uint32_t capacity) : _capacity{capacity}, _closed{false} { assert(capacity > 0); }
+
+public:
+  BoundedQueue(const BoundedQueue &) = delete;
+  BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+public:
+  /**
+   * @brief Push an item, waiting for free space
+   *
+   * @return true if pushed, false if the queue is closed
+   */
+  bool push(T item)
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _not_full.wait(lock, [&] { return _closed || _items.size() < _capacity; });
+    if (_closed)
+      return false;
+    _items.emplace_back(std::move(item));
+    _not_empty.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Pop the oldest item, waiting for an item
+   *
+   * @return true if popped, false if the queue is closed and empty
+   */
+  bool pop(T &item)
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _not_empty.wait(lock, [&] { return _closed || !_items.empty(); });
+    if (_items.empty())
+      return false;
+    item = std::move(_items.front());
+    _items.pop_front();
+    _not_full.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Close the queue and wake up all waiting threads
+   */
+  void close()
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _closed = true;
+    _not_empty.notify_all();
+    _not_full.notify_all();
+  }
+
+  uint32_t capacity() const { return _capacity; }
+
+private:
+  const uint32_t _capacity;
+  std::mutex _mutex;
+  std::condition_variable _not_empty;
+  std::condition_variable _not_full;
+  std::deque<T> _items;
+  bool _closed;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_BOUNDED_QUEUE_H__
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BoundedQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(BoundedQueue, push_pop)
+{
+  BoundedQueue<int> queue{2};
+  ASSERT_TRUE(queue.push(1));
+  ASSERT_TRUE(queue.push(2));
+
+  int item = 0;
+  ASSERT_TRUE(queue.pop(item));
+  ASSERT_EQ(item, 1);
+  ASSERT_TRUE(queue.pop(item));
+  ASSERT_EQ(item, 2);
+}
+
+TEST(BoundedQueue, blocking_producer)
+{
+  BoundedQueue<int> queue{1};
+  const int count = 100;
+
+  std::thread producer{[&] {
+    for (int i = 0; i < count; ++i)
+      queue.push(i);
+    queue.close();
+  }};
+
+  int item = 0;
+  int expected = 0;
+  while (queue.pop(item))
+  {
+    ASSERT_EQ(item, expected);
+    expected++;
+  }
+  producer.join();
+  ASSERT_EQ(expected, count);
+}
+
+TEST(BoundedQueue, close_drain)
+{
+  BoundedQueue<int> queue{2};
+  ASSERT_TRUE(queue.push(1));
+  queue.close();
+
+  int item = 0;
+  ASSERT_TRUE(queue.pop(item));
+  ASSERT_EQ(item, 1);
+  ASSERT_FALSE(queue.pop(item));
+}
+
+TEST(BoundedQueue, neg_push_closed)
+{
+  BoundedQueue<int> queue{2};
+  queue.close();
+  ASSERT_FALSE(queue.push(1));
+}
+
+} // namespace
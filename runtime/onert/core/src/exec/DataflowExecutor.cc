@@ -102,19 +102,19 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
   _output_info.resize(next_job_index);
   _initial_input_info.resize(next_job_index, 0);
 
+  // Build dependencies from def-use info of operands, so that it takes linear time
+  const auto &operands = _lowered_graph->graph().operands();
   operations.iterate([&](const ir::OperationIndex &op_ind, const ir::IOperation &op) {
-    auto job_index = op_to_job[op_ind];
-    for (auto &&output : op.getOutputs())
+    auto job_index = op_to_job.at(op_ind);
+    for (auto &&output : op.getOutputs() | ir::Remove::UNDEFINED)
     {
       // Update output and input info
-      operations.iterate([&](const ir::OperationIndex &op_cur_ind, const ir::IOperation &op_cur) {
-        if (op_cur.getInputs().contains(output))
-        {
-          auto dep_index = op_to_job[op_cur_ind];
-          ++_initial_input_info[dep_index];
-          _output_info[job_index].push_back(dep_index);
-        }
-      });
+      for (const auto &use_ind : operands.at(output).getUses())
+      {
+        auto dep_index = op_to_job.at(use_ind);
+        ++_initial_input_info[dep_index];
+        _output_info[job_index].push_back(dep_index);
+      }
     }
   });
   for (const auto &[op_ind, job_ind] : op_to_job)
@@ -15,6 +15,8 @@
  */
 
 #include "exec/Execution.h"
+#include "exec/BatchingExecution.h"
+#include "exec/PipelineExecution.h"
 
 #include "compiler/Compiler.h"
 #include "compiler/CompilerFactory.h"
@@ -780,4 +782,133 @@ TEST(ExecInstance, multi_model_dequant_input_quant_output)
 
 // TODO Add an unittest multi_model_quant_input_dequant_output
 
+TEST(ExecInstance, pipeline_simple)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::PipelineExecution pipeline{executors};
+  EXPECT_EQ(pipeline.stageCount(), 1);
+
+  pipeline.push({input1_buffer, input2_buffer}, {16, 16});
+
+  std::vector<std::unique_ptr<uint8_t[]>> outputs;
+  ASSERT_TRUE(pipeline.pop(outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  auto output_buffer = reinterpret_cast<const float *>(outputs[0].get());
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+
+  pipeline.finish();
+  EXPECT_FALSE(pipeline.pop(outputs));
+}
+
+TEST(ExecInstance, pipeline_multi_model)
+{
+  auto mockup = CompiledMockUpMultiModel();
+  auto executors = mockup.artifact->_executors;
+
+  constexpr int request_count = 8;
+  onert::exec::PipelineExecution pipeline{executors, 2};
+  EXPECT_EQ(pipeline.stageCount(), 3);
+  EXPECT_EQ(pipeline.capacity(), 2);
+
+  // Push more requests than capacity from another thread
+  std::thread producer([&pipeline]() {
+    for (int k = 0; k < request_count; k++)
+    {
+      const float input1_buffer[4] = {1, 0, -1, -2};
+      const float input2_buffer[4] = {1 + 0.5f * k, -3 + 0.5f * k, 2 + 0.5f * k, -4 + 0.5f * k};
+      pipeline.push({input1_buffer, input2_buffer}, {16, 16});
+    }
+    pipeline.finish();
+  });
+
+  // Outputs are popped in order of requests
+  const float output_expected[4] = {7, -5, 1, -7};
+  std::vector<std::unique_ptr<uint8_t[]>> outputs;
+  for (int k = 0; k < request_count; k++)
+  {
+    ASSERT_TRUE(pipeline.pop(outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    auto output_buffer = reinterpret_cast<const float *>(outputs[0].get());
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_NEAR(output_buffer[i], output_expected[i] + k, 1e-3);
+    }
+  }
+  EXPECT_FALSE(pipeline.pop(outputs));
+
+  producer.join();
+}
+
+TEST(ExecInstance, neg_pipeline_input_count)
+{
+  auto mockup = CompiledMockUpMultiModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+
+  onert::exec::PipelineExecution pipeline{executors};
+  EXPECT_ANY_THROW(pipeline.push({input1_buffer}, {16}));
+  EXPECT_ANY_THROW(pipeline.push({input1_buffer, input1_buffer}, {16, 8}));
+}
+
+TEST(ExecInstance, batching_concurrent_requests)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  constexpr uint32_t request_count = 4;
+  onert::exec::BatchingExecution batching{executors, request_count,
+                                          std::chrono::milliseconds{100}};
+
+  // result = lhs + rhs1 + {3, 1, -1, 5}
+  std::vector<char> results(request_count, 0);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < request_count; t++)
+  {
+    threads.emplace_back([&, t]() {
+      const float v = static_cast<float>(t);
+      const float input1_buffer[4] = {v, v, v, v};
+      const float input2_buffer[4] = {1, -3, 2, -4};
+      float output_buffer[4] = {};
+      batching.run({input1_buffer, input2_buffer}, {output_buffer});
+      results[t] = output_buffer[0] == 4 + v && output_buffer[1] == -2 + v &&
+                   output_buffer[2] == 1 + v && output_buffer[3] == 1 + v;
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (uint32_t t = 0; t < request_count; t++)
+    EXPECT_TRUE(results[t]);
+
+  const auto stats = batching.stats();
+  EXPECT_EQ(stats.request_count, request_count);
+  EXPECT_GE(stats.batch_count, 1);
+  EXPECT_LE(stats.batch_count, request_count);
+  EXPECT_GE(stats.latency_us, stats.queue_us);
+}
+
+TEST(ExecInstance, neg_batching_input_count)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  float output_buffer[4] = {};
+
+  EXPECT_ANY_THROW(onert::exec::BatchingExecution(executors, 0, std::chrono::microseconds{0}));
+
+  onert::exec::BatchingExecution batching{executors, 2, std::chrono::microseconds{0}};
+  EXPECT_ANY_THROW(batching.run({input1_buffer}, {output_buffer}));
+}
+
 } // namespace
@@ -29,7 +29,7 @@ namespace
 {
 
 void setUserData(const onert::ir::Graph &g, const onert::ir::IOperation *op,
-                 decltype(EventCollector::Event::userData) &data)
+                 std::vector<std::pair<std::string, std::string>> &data)
 {
   // From a tensor of shape [a, b, c], this will return a string "shape(a b c)".
   // String like "[1, 2, 3]" looks better but this will be considered as a list in Json
@@ -115,7 +115,7 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, ir::SubgraphIndex,
 
 TracingObserver::TracingObserver(const std::string &workspace_dir, const ir::Graph &graph,
                                  const util::TracingCtx *tracing_ctx)
-  : _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
+  : _buffer{std::make_unique<TraceBuffer>()}, _collector{_buffer.get()}, _graph{graph},
     _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx}, _triggered{false}
 {
   // DO NOTHING
@@ -130,7 +130,7 @@ TracingObserver::~TracingObserver()
     {
       auto event_writer = EventWriter::get(_workspace_dir);
       event_writer->startToUse();
-      event_writer->readyToFlush(std::move(_recorder));
+      event_writer->readyToFlush(buildRecorder());
     }
   }
   catch (const std::exception &e)
@@ -139,6 +139,71 @@ TracingObserver::~TracingObserver()
   }
 }
 
+// Convert binary records into events with names for EventWriter
+std::unique_ptr<EventRecorder> TracingObserver::buildRecorder() const
+{
+  auto recorder = std::make_unique<EventRecorder>();
+
+  const auto dropped = _buffer->dropped();
+  if (dropped > 0)
+    VERBOSE(TracingObserver) << dropped << " oldest events were overwritten" << std::endl;
+
+  // Events whose pair was overwritten are skipped to keep begin/end matched
+  for (const auto &record : _buffer->collectPaired())
+  {
+    // Chrome tracing takes timestamps in microseconds
+    const auto ts = std::to_string(record.ts / 1000);
+
+    std::unique_ptr<DurationEvent> evt;
+    if (record.op_index == TraceRecord::kSubgraph)
+    {
+      evt = std::make_unique<SubgDurationEvent>();
+    }
+    else
+    {
+      const ir::OperationIndex op_ind{record.op_index};
+      const auto &op = _graph.operations().at(op_ind);
+      auto op_evt = std::make_unique<OpSeqDurationEvent>();
+      op_evt->backend = static_cast<const backend::Backend *>(record.backend)->config()->id();
+      op_evt->op_index = record.op_index;
+      op_evt->op_name = op.name();
+      // add shape of inputs
+      if (record.begin)
+        setUserData(_graph, &op, op_evt->args);
+      evt = std::move(op_evt);
+    }
+
+    // The following will be set by a child of EventsWriter:
+    // dur_evt.name, dur_evt.tid
+    evt->ph = record.begin ? "B" : "E";
+    evt->ts = ts;
+    evt->tracing_ctx = _tracing_ctx;
+    evt->session_index = record.session_index;
+    evt->subg_index = record.subg_index;
+    evt->args.emplace_back("session", std::to_string(record.session_index));
+    evt->args.emplace_back("subgraph", std::to_string(record.subg_index));
+    recorder->emit(std::move(evt));
+
+#ifdef DEBUG
+    CounterEvent maxrss;
+    maxrss.name = "maxrss";
+    maxrss.ph = "C";
+    maxrss.ts = ts;
+    maxrss.values["value"] = std::to_string(record.maxrss);
+    recorder->emit(maxrss);
+
+    CounterEvent minflt;
+    minflt.name = "minflt";
+    minflt.ph = "C";
+    minflt.ts = ts;
+    minflt.values["value"] = std::to_string(record.minflt);
+    recorder->emit(minflt);
+#endif
+  }
+
+  return recorder;
+}
+
 void TracingObserver::handleSubgraphBegin(ir::SubgraphIndex subg_ind)
 {
   _triggered = true;
@@ -150,23 +215,15 @@ void TracingObserver::handleSubgraphBegin(ir::SubgraphIndex subg_ind)
 void TracingObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex subg_ind,
                                      ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  const auto &op = _graph.operations().at(op_ind);
-  auto ev = EventCollector::OpSeqEvent{_tracing_ctx,     EventCollector::Edge::BEGIN,
-                                       subg_ind.value(), backend_id,
-                                       op_ind.value(),   op.name()};
-  // add shape of inputs
-  setUserData(_graph, &op, ev.userData);
-  _collector.onEvent(ev);
+  _collector.onEvent(EventCollector::OpSeqEvent{_tracing_ctx, EventCollector::Edge::BEGIN,
+                                                subg_ind.value(), backend, op_ind.value()});
 }
 
 void TracingObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_ind,
                                    ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
   _collector.onEvent(EventCollector::OpSeqEvent{_tracing_ctx, EventCollector::Edge::END,
-                                                subg_ind.value(), backend_id, op_ind.value(),
-                                                _graph.operations().at(op_ind).name()});
+                                                subg_ind.value(), backend, op_ind.value()});
 }
 
 void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
@@ -20,6 +20,7 @@
 #include "ExecTime.h"
 #include "../util/EventCollector.h"
 #include "../util/EventRecorder.h"
+#include "../util/TraceBuffer.h"
 #include "../util/EventWriter.h"
 
 #include "exec/IExecutor.h"
@@ -115,7 +116,10 @@ public:
   ObserverType type() const override { return ObserverType::TRACING; }
 
 private:
-  std::unique_ptr<EventRecorder> _recorder;
+  std::unique_ptr<EventRecorder> buildRecorder() const;
+
+private:
+  std::unique_ptr<TraceBuffer> _buffer;
   EventCollector _collector;
   const ir::Graph &_graph;
   std::string _workspace_dir;
@@ -81,6 +81,8 @@ public:
 
   void execute(const ExecutionContext &ctx) override;
 
+  const ir::ModelEdges &modelEdges() const { return *_model_edges; }
+
 private:
   void checkSupportedMultimodel() const;
   void createEdgeQuantLayers();
@@ -63,24 +63,27 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
                                    backend::BackendContexts &&backend_contexts,
                                    const compiler::TensorRegistries &tensor_regs,
                                    compiler::CodeMap &&code_map,
-                                   const util::TracingCtx *tracing_ctx)
+                                   const util::TracingCtx *tracing_ctx,
+                                   uint32_t num_workers)
   : DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
                      std::move(code_map), tracing_ctx}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
-
-void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
-{
-  bool dynamic_input_exists = hasDynamicInput();
 
-  // Init scheduler
+  // Init scheduler once and reuse its worker threads for every execution
   // TODO Consider to have distinct backend set in GraphLowerInfo
   BackendSet backends;
   for (const auto &[idx, backend] : _lowered_graph->lower_info().operation)
     backends.add(backend);
 
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  // A worker queue never holds more jobs than the graph has
+  const auto queue_capacity = static_cast<uint32_t>(_finished_jobs.size());
+  _scheduler = std::make_unique<ParallelScheduler>(backends, num_workers, queue_capacity);
+}
+
+void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
+{
+  bool dynamic_input_exists = hasDynamicInput();
 
   assert(noWaitingJobs());
 
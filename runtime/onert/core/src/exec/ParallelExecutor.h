@@ -44,11 +44,12 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param num_workers Number of worker threads for each backend
    */
   ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                    backend::BackendContexts &&backend_contexts,
                    const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                   const util::TracingCtx *tracing_ctx);
+                   const util::TracingCtx *tracing_ctx, uint32_t num_workers = 1);
 
   void executeImpl(const ExecutionObservee &subject) override;
 
@@ -26,14 +26,19 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const BackendSet &backends, uint32_t num_workers,
+                                     uint32_t queue_capacity)
 {
   assert(!backends.empty());
+  assert(num_workers >= 1);
 
   for (auto &&backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    _thread_pools[backend] = std::make_unique<ThreadPool>(num_workers, queue_capacity);
   }
+
+  VERBOSE(ParallelScheduler) << "Created " << _thread_pools.size() << " thread pool(s) with "
+                             << num_workers << " worker(s) each" << std::endl;
 }
 
 void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend)
@@ -29,15 +29,25 @@ namespace onert
 namespace exec
 {
 
+/**
+ * @brief Scheduler which runs jobs on per-backend thread pools
+ *
+ * A job assigned to a backend only runs on the workers of that backend's pool, so backend
+ * affinity is kept while workers of the same backend steal jobs from each other.
+ * Thread pools are created once and live as long as the scheduler.
+ */
 class ParallelScheduler
 {
 public:
   /**
    * @brief Constructs ParallelScheduler object
    *
-   * @param backends Backend set
+   * @param backends       Backend set
+   * @param num_workers    Number of worker threads for each backend
+   * @param queue_capacity Max number of jobs which can be queued to a worker at once
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends, uint32_t num_workers = 1,
+                    uint32_t queue_capacity = 64);
   /**
    * @brief Assign a task to the given backend
    *
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PipelineExecution.h"
+
+#include "BoundedQueue.h"
+#include "IPermuteFunction.h"
+#include "MultiModelExecutors.h"
+#include "util/Exceptions.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+using namespace onert;
+
+/**
+ * @brief Tensor wrapping a frame buffer, rebound to the frame of each request
+ */
+class FrameTensor : public backend::IPortableTensor
+{
+public:
+  FrameTensor(const ir::OperandInfo &info, ir::Layout layout)
+    : IPortableTensor{info}, _layout{layout}, _buffer{nullptr}
+  {
+  }
+
+public:
+  uint8_t *buffer() const override { return _buffer; }
+  ir::Layout layout() const { return _layout; }
+  void set_dynamic() override { _info.setDynamic(); }
+  void setShape(const ir::Shape &new_shape) override { _info.shape(new_shape); }
+  bool applyShape(const ir::Shape &new_shape) override
+  {
+    // Frame buffers are allocated with static shape, so they cannot grow
+    auto new_size = new_shape.num_elements() * ir::sizeOfDataType(data_type());
+    if (total_size() < new_size)
+      throw InsufficientBufferSizeException{"Pipeline does not support growing tensor shape"};
+    setShape(new_shape);
+    return true;
+  }
+
+  void setBuffer(uint8_t *buffer) { _buffer = buffer; }
+
+private:
+  ir::Layout _layout;
+  uint8_t *_buffer;
+};
+
+ir::ModelEdges singleModelEdges(const exec::IExecutors &executors)
+{
+  ir::ModelEdges edges;
+  for (uint32_t i = 0; i < executors.inputSize(); i++)
+    edges.pkg_inputs.emplace_back(ir::ModelIndex{0}, ir::SubgraphIndex{0}, ir::IOIndex{i});
+  for (uint32_t i = 0; i < executors.outputSize(); i++)
+    edges.pkg_outputs.emplace_back(ir::ModelIndex{0}, ir::SubgraphIndex{0}, ir::IOIndex{i});
+  return edges;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+struct PipelineExecution::Frame
+{
+  std::vector<std::unique_ptr<uint8_t[]>> buffers;
+  // Number of predecessors to wait for each stage, the last one is for sink
+  std::unique_ptr<std::atomic<uint32_t>[]> pending;
+
+  // Sibling stages of a fan-out may fail at once, so the error is guarded by a mutex
+  std::exception_ptr getError()
+  {
+    std::lock_guard<std::mutex> lock{error_mutex};
+    return error;
+  }
+  // Keep the first error of a request
+  void setError(std::exception_ptr e)
+  {
+    std::lock_guard<std::mutex> lock{error_mutex};
+    if (!error)
+      error = e;
+  }
+  void resetError()
+  {
+    std::lock_guard<std::mutex> lock{error_mutex};
+    error = nullptr;
+  }
+
+private:
+  std::mutex error_mutex;
+  std::exception_ptr error;
+};
+
+struct PipelineExecution::Stage
+{
+  Stage(uint32_t capacity) : queue{capacity} {}
+
+  IExecutor *executor = nullptr;
+  std::vector<uint32_t> input_slots;
+  std::vector<uint32_t> output_slots;
+  // Tensors given to executor, rebound to frame buffers for each request
+  std::vector<std::unique_ptr<FrameTensor>> input_tensors;
+  std::vector<std::unique_ptr<FrameTensor>> output_tensors;
+  std::vector<backend::IPortableTensor *> inputs;
+  std::vector<backend::IPortableTensor *> outputs;
+  // Type-aware quantization of edges whose `from` type differs from input type
+  // Quantized inputs use stage local buffers because they are consumed by this stage only
+  std::vector<uint32_t> quant_inputs;
+  std::vector<std::unique_ptr<FrameTensor>> quant_src_tensors;
+  std::vector<std::unique_ptr<uint8_t[]>> quant_buffers;
+  std::unique_ptr<PermuteLayer> quant_layer;
+  // Successor stage indices, stage count means sink
+  std::vector<uint32_t> successors;
+  uint32_t pred_count = 0;
+  std::atomic<uint32_t> live_preds{0};
+  BoundedQueue<Frame *> queue;
+  std::thread thread;
+};
+
+PipelineExecution::PipelineExecution(const std::shared_ptr<IExecutors> &executors,
+                                     uint32_t capacity)
+  : _executors{executors}, _sink_pred_count{0}, _sink_live_preds{0}, _finished{false}
+{
+  ExecutionOptions::fromGlobalConfig(_options);
+
+  auto multi_executors = dynamic_cast<MultiModelExecutors *>(executors.get());
+  const auto edges =
+    multi_executors != nullptr ? multi_executors->modelEdges() : singleModelEdges(*executors);
+
+  uint32_t model_count = 0;
+  auto count_model = [&](const ir::IODesc &desc) {
+    if (std::get<ir::SubgraphIndex>(desc) != ir::SubgraphIndex{0})
+      throw std::runtime_error{"Pipeline: edge of non-primary subgraph is not supported"};
+    model_count = std::max(model_count, std::get<ir::ModelIndex>(desc).value() + 1u);
+  };
+  for (const auto &desc : edges.pkg_inputs)
+    count_model(desc);
+  for (const auto &desc : edges.pkg_outputs)
+    count_model(desc);
+  for (const auto &edge : edges.edges)
+  {
+    count_model(edge.from);
+    count_model(edge.to);
+    // Keep stage graph acyclic
+    if (std::get<ir::ModelIndex>(edge.from).value() >= std::get<ir::ModelIndex>(edge.to).value())
+      throw std::runtime_error{"Pipeline: edge must go from lower model index to higher one"};
+    if (std::find(edges.pkg_outputs.begin(), edges.pkg_outputs.end(), edge.from) !=
+        edges.pkg_outputs.end())
+      throw std::runtime_error{"Pipeline: nnpkg output cannot be `from` of edge"};
+  }
+
+  if (capacity == 0)
+    capacity = model_count + 1;
+
+  // Assign frame buffer slots
+  std::map<ir::IODesc, uint32_t> output_slot_map;
+  auto add_slot = [&](size_t size) {
+    _slot_sizes.emplace_back(size);
+    return static_cast<uint32_t>(_slot_sizes.size() - 1);
+  };
+  for (const auto &desc : edges.pkg_inputs)
+  {
+    const auto executor = executors->at(std::get<ir::ModelIndex>(desc), ir::SubgraphIndex{0});
+    const auto &info = executor->inputInfo(std::get<ir::IOIndex>(desc).value());
+    _input_slots.emplace_back(add_slot(info.total_size()));
+  }
+  for (uint16_t m = 0; m < model_count; m++)
+  {
+    const auto executor = executors->at(ir::ModelIndex{m}, ir::SubgraphIndex{0});
+    for (uint32_t i = 0; i < executor->outputSize(); i++)
+    {
+      const auto desc = ir::IODesc{ir::ModelIndex{m}, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      output_slot_map[desc] = add_slot(executor->outputInfo(i).total_size());
+    }
+  }
+  for (const auto &desc : edges.pkg_outputs)
+    _output_slots.emplace_back(output_slot_map.at(desc));
+
+  // Build stages
+  for (uint16_t m = 0; m < model_count; m++)
+  {
+    auto stage = std::make_unique<Stage>(capacity);
+    const auto model_index = ir::ModelIndex{m};
+    const auto executor = executors->at(model_index, ir::SubgraphIndex{0});
+    stage->executor = executor;
+
+    bool from_source = false;
+    std::vector<uint32_t> preds;
+    std::vector<backend::ITensor *> quant_srcs;
+    std::vector<backend::ITensor *> quant_dsts;
+    for (uint32_t i = 0; i < executor->inputSize(); i++)
+    {
+      const auto desc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      const auto &info = executor->inputInfo(i);
+      auto tensor = std::make_unique<FrameTensor>(info, executor->inputLayout(i));
+
+      auto pkg_it = std::find(edges.pkg_inputs.begin(), edges.pkg_inputs.end(), desc);
+      if (pkg_it != edges.pkg_inputs.end())
+      {
+        stage->input_slots.emplace_back(_input_slots[pkg_it - edges.pkg_inputs.begin()]);
+        from_source = true;
+      }
+      else
+      {
+        auto edge_it = std::find_if(edges.edges.begin(), edges.edges.end(),
+                                    [&](const ir::ModelEdge &edge) { return edge.to == desc; });
+        if (edge_it == edges.edges.end())
+          throw std::runtime_error{"Pipeline: cannot find edge for model input"};
+
+        const auto &from = edge_it->from;
+        const auto from_slot = output_slot_map.at(from);
+        stage->input_slots.emplace_back(from_slot);
+        const auto pred = std::get<ir::ModelIndex>(from).value();
+        if (std::find(preds.begin(), preds.end(), pred) == preds.end())
+          preds.emplace_back(pred);
+
+        const auto from_executor =
+          executors->at(std::get<ir::ModelIndex>(from), ir::SubgraphIndex{0});
+        const auto from_io = std::get<ir::IOIndex>(from).value();
+        const auto &from_info = from_executor->outputInfo(from_io);
+        if (from_info.typeInfo().type() != info.typeInfo().type())
+        {
+          auto src = std::make_unique<FrameTensor>(from_info, from_executor->outputLayout(from_io));
+          stage->quant_buffers.emplace_back(std::make_unique<uint8_t[]>(info.total_size()));
+          tensor->setBuffer(stage->quant_buffers.back().get());
+          quant_srcs.emplace_back(src.get());
+          quant_dsts.emplace_back(tensor.get());
+          stage->quant_inputs.emplace_back(i);
+          stage->quant_src_tensors.emplace_back(std::move(src));
+        }
+      }
+      stage->inputs.emplace_back(tensor.get());
+      stage->input_tensors.emplace_back(std::move(tensor));
+    }
+
+    if (!quant_srcs.empty())
+    {
+      std::vector<ir::PermuteType> types(quant_srcs.size(), ir::PermuteType::COPY);
+      stage->quant_layer = std::make_unique<PermuteLayer>(quant_srcs, quant_dsts, types);
+      stage->quant_layer->prepare();
+    }
+
+    bool to_sink = false;
+    for (uint32_t i = 0; i < executor->outputSize(); i++)
+    {
+      const auto desc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      auto tensor =
+        std::make_unique<FrameTensor>(executor->outputInfo(i), executor->outputLayout(i));
+      stage->output_slots.emplace_back(output_slot_map.at(desc));
+      stage->outputs.emplace_back(tensor.get());
+      stage->output_tensors.emplace_back(std::move(tensor));
+
+      if (std::find(edges.pkg_outputs.begin(), edges.pkg_outputs.end(), desc) !=
+          edges.pkg_outputs.end())
+        to_sink = true;
+      for (const auto &edge : edges.edges)
+      {
+        if (edge.from != desc)
+          continue;
+        const auto succ = std::get<ir::ModelIndex>(edge.to).value();
+        if (std::find(stage->successors.begin(), stage->successors.end(), succ) ==
+            stage->successors.end())
+          stage->successors.emplace_back(succ);
+      }
+    }
+    // Stage without successor also should be finished before its frame is reused
+    if (to_sink || stage->successors.empty())
+    {
+      stage->successors.emplace_back(model_count);
+      _sink_pred_count++;
+    }
+
+    if (from_source || preds.empty())
+    {
+      _source_stages.emplace_back(m);
+      stage->pred_count++;
+    }
+    stage->pred_count += preds.size();
+    stage->live_preds = stage->pred_count;
+    _stages.emplace_back(std::move(stage));
+  }
+  _sink_live_preds = _sink_pred_count;
+
+  // Prepare frames
+  _free_frames = std::make_unique<BoundedQueue<Frame *>>(capacity);
+  _output_frames = std::make_unique<BoundedQueue<Frame *>>(capacity);
+  for (uint32_t i = 0; i < capacity; i++)
+  {
+    auto frame = std::make_unique<Frame>();
+    frame->buffers.resize(_slot_sizes.size());
+    frame->pending = std::make_unique<std::atomic<uint32_t>[]>(model_count + 1);
+    _free_frames->push(frame.get());
+    _frames.emplace_back(std::move(frame));
+  }
+
+  VERBOSE(PipelineExecution) << "Start pipeline with " << model_count << " stages, capacity "
+                             << capacity << std::endl;
+
+  for (auto &stage : _stages)
+  {
+    auto stage_ptr = stage.get();
+    stage->thread = std::thread([this, stage_ptr] { runStage(*stage_ptr); });
+  }
+}
+
+PipelineExecution::~PipelineExecution() { finish(); }
+
+void PipelineExecution::push(const std::vector<const void *> &inputs,
+                             const std::vector<size_t> &lengths)
+{
+  if (inputs.size() != _input_slots.size() || lengths.size() != _input_slots.size())
+    throw std::runtime_error{"Pipeline: invalid number of inputs"};
+
+  std::lock_guard<std::mutex> lock{_push_mutex};
+  if (_finished)
+    throw std::runtime_error{"Pipeline: already finished"};
+
+  Frame *frame = nullptr;
+  if (!_free_frames->pop(frame))
+    throw std::runtime_error{"Pipeline: already finished"};
+
+  // Buffers of outputs were handed over to user by pop
+  for (uint32_t slot = 0; slot < _slot_sizes.size(); slot++)
+  {
+    if (frame->buffers[slot] == nullptr)
+      frame->buffers[slot] = std::make_unique<uint8_t[]>(_slot_sizes[slot]);
+  }
+  for (uint32_t i = 0; i < inputs.size(); i++)
+  {
+    const auto slot = _input_slots[i];
+    if (lengths[i] < _slot_sizes[slot])
+    {
+      _free_frames->push(frame);
+      throw std::runtime_error{"Pipeline: too small input buffer length"};
+    }
+    std::memcpy(frame->buffers[slot].get(), inputs[i], _slot_sizes[slot]);
+  }
+
+  for (uint32_t s = 0; s < _stages.size(); s++)
+    frame->pending[s] = _stages[s]->pred_count;
+  frame->pending[_stages.size()] = _sink_pred_count;
+  frame->resetError();
+
+  for (const auto s : _source_stages)
+    arrive(frame, s);
+}
+
+bool PipelineExecution::pop(std::vector<std::unique_ptr<uint8_t[]>> &outputs)
+{
+  Frame *frame = nullptr;
+  if (!_output_frames->pop(frame))
+    return false;
+
+  auto error = frame->getError();
+  if (!error)
+  {
+    outputs.clear();
+    for (const auto slot : _output_slots)
+      outputs.emplace_back(std::move(frame->buffers[slot]));
+  }
+  _free_frames->push(frame);
+
+  if (error)
+    std::rethrow_exception(error);
+  return true;
+}
+
+void PipelineExecution::finish()
+{
+  {
+    std::lock_guard<std::mutex> lock{_push_mutex};
+    if (_finished)
+      return;
+    _finished = true;
+  }
+
+  for (const auto s : _source_stages)
+    closeFrom(s);
+
+  for (auto &stage : _stages)
+  {
+    if (stage->thread.joinable())
+      stage->thread.join();
+  }
+}
+
+void PipelineExecution::runStage(Stage &stage)
+{
+  Frame *frame = nullptr;
+  while (stage.queue.pop(frame))
+  {
+    // Skip running if any previous stage failed on this request
+    if (!frame->getError())
+    {
+      try
+      {
+        for (uint32_t i = 0; i < stage.input_tensors.size(); i++)
+          stage.input_tensors[i]->setBuffer(frame->buffers[stage.input_slots[i]].get());
+        for (uint32_t i = 0; i < stage.output_tensors.size(); i++)
+          stage.output_tensors[i]->setBuffer(frame->buffers[stage.output_slots[i]].get());
+        if (stage.quant_layer)
+        {
+          for (uint32_t q = 0; q < stage.quant_inputs.size(); q++)
+          {
+            const auto i = stage.quant_inputs[q];
+            stage.quant_src_tensors[q]->setBuffer(frame->buffers[stage.input_slots[i]].get());
+            stage.input_tensors[i]->setBuffer(stage.quant_buffers[q].get());
+          }
+          stage.quant_layer->run();
+        }
+
+        stage.executor->execute(stage.inputs, stage.outputs, _options);
+      }
+      catch (...)
+      {
+        frame->setError(std::current_exception());
+      }
+    }
+
+    for (const auto succ : stage.successors)
+      arrive(frame, succ);
+  }
+
+  // No more request comes to this stage
+  for (const auto succ : stage.successors)
+    closeFrom(succ);
+}
+
+void PipelineExecution::arrive(Frame *frame, uint32_t stage_index)
+{
+  // The last predecessor forwards the frame
+  if (frame->pending[stage_index].fetch_sub(1) != 1)
+    return;
+
+  if (stage_index == _stages.size())
+    _output_frames->push(frame);
+  else
+    _stages[stage_index]->queue.push(frame);
+}
+
+void PipelineExecution::closeFrom(uint32_t stage_index)
+{
+  if (stage_index == _stages.size())
+  {
+    if (_sink_live_preds.fetch_sub(1) == 1)
+      _output_frames->close();
+  }
+  else
+  {
+    if (_stages[stage_index]->live_preds.fetch_sub(1) == 1)
+      _stages[stage_index]->queue.close();
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -18,47 +18,158 @@
 
 #include <cassert>
 
+namespace
+{
+
+// Number of rounds an idle worker looks for jobs before it goes to sleep
+constexpr int kSpinRounds = 64;
+
+} // namespace
+
 namespace onert
 {
 namespace exec
 {
 
-ThreadPool::ThreadPool(uint32_t num_threads)
+ThreadPool::ThreadPool(uint32_t num_threads, uint32_t queue_capacity)
 {
   assert(num_threads >= 1);
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _queues.emplace_back(std::make_unique<WorkStealingQueue>(queue_capacity));
+  }
+
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back(&ThreadPool::worker, this, i);
   }
 }
 
 ThreadPool::~ThreadPool()
 {
-  if (!_threads.empty())
+  terminate();
+
+  // Release jobs which were never run
+  for (auto &&queue : _queues)
   {
-    _worker.terminate();
-    join();
+    while (auto fn = queue->pop())
+      delete fn;
   }
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn)
+{
+  assert(!_terminating.load());
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+  _num_pending.fetch_add(1);
 
-void ThreadPool::join()
-{
-  for (auto &&thread : _threads)
+  auto raw_fn = fn.release();
+  const uint32_t num_queues = _queues.size();
+  uint32_t start = _next_queue.fetch_add(1, std::memory_order_relaxed);
+  while (true)
   {
-    thread.join();
+    // Count the job before publishing it, so a worker that takes it right away never sees the
+    // counter go below zero
+    _num_queued.fetch_add(1);
+    bool pushed = false;
+    for (uint32_t i = 0; i < num_queues && !pushed; ++i)
+    {
+      pushed = _queues[(start + i) % num_queues]->push(raw_fn);
+    }
+    if (pushed)
+      break;
+
+    // Every queue is full, wait for workers to drain them
+    _num_queued.fetch_sub(1);
+    std::this_thread::yield();
+  }
+
+  if (_num_sleeping.load() > 0)
+  {
+    // Lock to make sure a worker that is about to sleep sees the new job
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+    }
+    _cv_work.notify_one();
   }
-  _threads.clear();
 }
 
+uint32_t ThreadPool::numJobsInQueue() { return _num_queued.load(); }
+
 void ThreadPool::finish()
 {
-  _worker.finish();
-  join();
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_done.wait(lock, [this] { return _num_pending.load() == 0; });
+}
+
+IFunction *ThreadPool::take(uint32_t id)
+{
+  // Own queue first, then steal from siblings
+  const uint32_t num_queues = _queues.size();
+  for (uint32_t i = 0; i < num_queues; ++i)
+  {
+    if (auto fn = _queues[(id + i) % num_queues]->pop())
+    {
+      _num_queued.fetch_sub(1);
+      return fn;
+    }
+  }
+  return nullptr;
+}
+
+void ThreadPool::worker(uint32_t id)
+{
+  int idle_rounds = 0;
+  while (true)
+  {
+    std::unique_ptr<IFunction> fn{take(id)};
+    if (fn)
+    {
+      idle_rounds = 0;
+      fn->run();
+      fn.reset();
+      if (_num_pending.fetch_sub(1) == 1)
+      {
+        {
+          std::lock_guard<std::mutex> lock{_mu};
+        }
+        _cv_done.notify_all();
+      }
+      continue;
+    }
+
+    if (_terminating.load())
+      return;
+
+    if (++idle_rounds < kSpinRounds)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // Park until a new job arrives
+    std::unique_lock<std::mutex> lock{_mu};
+    _num_sleeping.fetch_add(1);
+    _cv_work.wait(lock, [this] { return _num_queued.load() > 0 || _terminating.load(); });
+    _num_sleeping.fetch_sub(1);
+    idle_rounds = 0;
+  }
+}
+
+void ThreadPool::terminate()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _terminating.store(true);
+  }
+  _cv_work.notify_all();
+
+  for (auto &&thread : _threads)
+  {
+    thread.join();
+  }
+  _threads.clear();
 }
 
 } // namespace exec
@@ -17,26 +17,37 @@
 #ifndef __ONERT_EXEC_THREAD_POOL_H__
 #define __ONERT_EXEC_THREAD_POOL_H__
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <memory>
 #include <vector>
 
-#include "WorkQueue.h"
+#include "WorkStealingQueue.h"
 
 namespace onert
 {
 namespace exec
 {
 
+/**
+ * @brief Persistent pool of worker threads with work stealing
+ *
+ * Each worker owns a lock-free @c WorkStealingQueue. Jobs are distributed to the workers in
+ * round-robin order and an idle worker steals from its siblings before going to sleep.
+ * Worker threads live until the pool is destroyed, so @c finish() does not join them.
+ */
 class ThreadPool
 {
 public:
   /**
    * @brief Coustruct ThreadPool object
    *
-   * @param num_threads Number of threads
+   * @param num_threads    Number of threads
+   * @param queue_capacity Max number of jobs which can be queued to a worker at once
    */
-  ThreadPool(uint32_t num_threads = 1);
+  ThreadPool(uint32_t num_threads = 1, uint32_t queue_capacity = 64);
   /**
    * @brief Destroy ThreadPool object
    */
@@ -53,6 +64,12 @@ public:
    * @return Number of jobs
    */
   uint32_t numJobsInQueue();
+  /**
+   * @brief Get number of worker threads
+   *
+   * @return Number of threads
+   */
+  uint32_t numThreads() const { return _threads.size(); }
 
   /**
    * @brief Block until all jobs are finished
@@ -60,11 +77,22 @@ public:
   void finish();
 
 private:
-  void join();
+  void worker(uint32_t id);
+  IFunction *take(uint32_t id);
+  void terminate();
 
 private:
-  WorkQueue _worker;
+  std::vector<std::unique_ptr<WorkStealingQueue>> _queues;
   std::vector<std::thread> _threads;
+  std::atomic<uint32_t> _next_queue{0};
+  std::atomic<uint32_t> _num_queued{0};
+  std::atomic<uint32_t> _num_pending{0};
+  std::atomic<uint32_t> _num_sleeping{0};
+  std::atomic<bool> _terminating{false};
+  // Only for parking idle workers and waiting on finish(), never taken on the job path
+  std::mutex _mu;
+  std::condition_variable _cv_work;
+  std::condition_variable _cv_done;
 };
 
 } // namespace exec
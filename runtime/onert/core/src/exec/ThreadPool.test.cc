@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+namespace
+{
+using namespace onert::exec;
+
+class CountFunction : public IFunction
+{
+public:
+  CountFunction(std::atomic<int> &counter) : _counter{counter} {}
+  void run() override { _counter.fetch_add(1); }
+
+private:
+  std::atomic<int> &_counter;
+};
+
+TEST(WorkStealingQueue, push_pop)
+{
+  std::atomic<int> counter{0};
+  CountFunction f1{counter}, f2{counter};
+
+  WorkStealingQueue queue{2};
+  ASSERT_EQ(queue.pop(), nullptr);
+  ASSERT_TRUE(queue.push(&f1));
+  ASSERT_TRUE(queue.push(&f2));
+  ASSERT_EQ(queue.pop(), &f1);
+  ASSERT_EQ(queue.pop(), &f2);
+  ASSERT_EQ(queue.pop(), nullptr);
+}
+
+TEST(WorkStealingQueue, neg_push_full)
+{
+  std::atomic<int> counter{0};
+  CountFunction f{counter};
+
+  WorkStealingQueue queue{2};
+  ASSERT_TRUE(queue.push(&f));
+  ASSERT_TRUE(queue.push(&f));
+  ASSERT_FALSE(queue.push(&f));
+}
+
+TEST(ThreadPool, reuse_workers)
+{
+  std::atomic<int> counter{0};
+  ThreadPool pool{4, 8};
+
+  // Jobs more than the queue capacity, over several rounds on the same workers
+  for (int round = 1; round <= 3; ++round)
+  {
+    for (int i = 0; i < 100; ++i)
+      pool.enqueue(std::make_unique<CountFunction>(counter));
+    pool.finish();
+    ASSERT_EQ(counter.load(), round * 100);
+    ASSERT_EQ(pool.numJobsInQueue(), 0u);
+  }
+  ASSERT_EQ(pool.numThreads(), 4u);
+}
+
+TEST(ThreadPool, num_jobs_in_queue)
+{
+  std::atomic<int> counter{0};
+  ThreadPool pool{4, 8};
+
+  // Workers take jobs as soon as they are pushed, so the counter must never wrap around
+  for (uint32_t i = 1; i <= 1000; ++i)
+  {
+    pool.enqueue(std::make_unique<CountFunction>(counter));
+    ASSERT_LE(pool.numJobsInQueue(), i);
+  }
+  pool.finish();
+  ASSERT_EQ(counter.load(), 1000);
+  ASSERT_EQ(pool.numJobsInQueue(), 0u);
+}
+
+} // namespace
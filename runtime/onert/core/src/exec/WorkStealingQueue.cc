@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingQueue.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+WorkStealingQueue::WorkStealingQueue(uint32_t capacity)
+{
+  size_t size = 2;
+  while (size < capacity)
+    size <<= 1;
+
+  _cells = std::make_unique<Cell[]>(size);
+  _mask = size - 1;
+  for (size_t i = 0; i < size; ++i)
+  {
+    _cells[i].seq.store(i, std::memory_order_relaxed);
+    _cells[i].fn = nullptr;
+  }
+  _push_pos.store(0, std::memory_order_relaxed);
+  _pop_pos.store(0, std::memory_order_relaxed);
+}
+
+bool WorkStealingQueue::push(IFunction *fn)
+{
+  assert(fn != nullptr);
+
+  Cell *cell = nullptr;
+  size_t pos = _push_pos.load(std::memory_order_relaxed);
+  while (true)
+  {
+    cell = &_cells[pos & _mask];
+    const size_t seq = cell->seq.load(std::memory_order_acquire);
+    const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff == 0)
+    {
+      if (_push_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+    {
+      // Full
+      return false;
+    }
+    else
+    {
+      pos = _push_pos.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->fn = fn;
+  cell->seq.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+IFunction *WorkStealingQueue::pop()
+{
+  Cell *cell = nullptr;
+  size_t pos = _pop_pos.load(std::memory_order_relaxed);
+  while (true)
+  {
+    cell = &_cells[pos & _mask];
+    const size_t seq = cell->seq.load(std::memory_order_acquire);
+    const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0)
+    {
+      if (_pop_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+    {
+      // Empty
+      return nullptr;
+    }
+    else
+    {
+      pos = _pop_pos.load(std::memory_order_relaxed);
+    }
+  }
+
+  IFunction *fn = cell->fn;
+  cell->fn = nullptr;
+  cell->seq.store(pos + _mask + 1, std::memory_order_release);
+  return fn;
+}
+
+} // namespace exec
+} // namespace onert
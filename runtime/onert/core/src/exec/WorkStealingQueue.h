@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_QUEUE_H__
+#define __ONERT_EXEC_WORK_STEALING_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "exec/IFunction.h"
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Bounded lock-free job queue owned by a single worker
+ *
+ * Any thread may push or pop. The owner worker pops its own jobs and sibling workers of
+ * the same @c ThreadPool steal from it when they run out of work.
+ *
+ * @note Jobs are pushed by the executor's dispatching thread, not by the owner worker, so this
+ *       is a multi-producer/multi-consumer ring buffer rather than an owner-only Chase-Lev deque.
+ */
+class WorkStealingQueue
+{
+public:
+  /**
+   * @brief Construct WorkStealingQueue object
+   *
+   * @param capacity Max number of jobs in the queue. Rounded up to a power of two.
+   */
+  WorkStealingQueue(uint32_t capacity);
+
+public:
+  WorkStealingQueue(const WorkStealingQueue &) = delete;
+  WorkStealingQueue &operator=(const WorkStealingQueue &) = delete;
+
+public:
+  /**
+   * @brief Push a job to the queue
+   *
+   * @param fn Function to be executed(a job)
+   * @return true if pushed, false if the queue is full
+   */
+  bool push(IFunction *fn);
+  /**
+   * @brief Pop the oldest job from the queue
+   *
+   * @return The job, or nullptr if the queue is empty
+   */
+  IFunction *pop();
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> seq;
+    IFunction *fn;
+  };
+
+private:
+  std::unique_ptr<Cell[]> _cells;
+  size_t _mask;
+  // Keep producer and consumer positions on separate cache lines
+  alignas(64) std::atomic<size_t> _push_pos;
+  alignas(64) std::atomic<size_t> _pop_pos;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_QUEUE_H__
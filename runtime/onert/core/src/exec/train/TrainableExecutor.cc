@@ -21,6 +21,24 @@
 
 #include <misc/polymorphic_downcast.h>
 
+namespace
+{
+
+using namespace onert;
+
+class ReplicaJob : public exec::IFunction
+{
+public:
+  ReplicaJob(const std::function<void()> &fn) : _fn{fn} {}
+
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -34,10 +52,12 @@ TrainableExecutor::TrainableExecutor(
   const compiler::train::TensorRegistries &tensor_regs,
   compiler::train::TrainableCodeMap &&code_map,
   const std::vector<ir::OperationIndex> &forward_order,
-  const std::vector<ir::OperationIndex> &backward_order, const util::TracingCtx *tracing_ctx,
-  const ir::train::LossInfo &loss_info)
+  const std::vector<ir::OperationIndex> &backward_order,
+  const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+  const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &loss_info)
   : _code_map{std::move(code_map)}, _forward_order{std::move(forward_order)},
-    _backward_order{std::move(backward_order)}, _lowered_graph{std::move(lowered_graph)},
+    _backward_order{std::move(backward_order)}, _recompute_segments{recompute_segments},
+    _recompute_segment_of{}, _lowered_graph{std::move(lowered_graph)},
     _backend_contexts{std::move(backend_contexts)},
     _trainable_graph{_lowered_graph->trainable_graph()}, _tensor_regs{std::move(tensor_regs)},
     _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info)
@@ -54,6 +74,12 @@ TrainableExecutor::TrainableExecutor(
   };
   build_tensor_list(_trainable_graph.getInputs(), _input_tensors);
   build_tensor_list(_trainable_graph.getOutputs(), _output_tensors);
+
+  for (uint32_t i = 0; i < _recompute_segments.size(); ++i)
+  {
+    for (const auto &op_index : _recompute_segments[i])
+      _recompute_segment_of[op_index] = i;
+  }
 }
 
 void TrainableExecutor::forward(const std::vector<backend::IPortableTensor *> &inputs,
@@ -66,6 +92,13 @@ void TrainableExecutor::forward(const std::vector<backend::IPortableTensor *> &i
   std::lock_guard<std::mutex> lock(_mutex);
   _current_options = options;
 
+  if (!_replicas.empty())
+  {
+    ExecutionObservee subject(_observers, options);
+    forwardReplicas(inputs, outputs, subject, training);
+    return;
+  }
+
   assert(_input_tensors.size() == inputs.size());
   for (uint32_t i = 0; i < _input_tensors.size(); ++i)
   {
@@ -134,6 +167,58 @@ void TrainableExecutor::forwardImpl(const ExecutionObservee &subject, bool train
   }
 }
 
+void TrainableExecutor::forwardReplicas(const std::vector<backend::IPortableTensor *> &inputs,
+                                        const std::vector<backend::IPortableTensor *> &outputs,
+                                        const ExecutionObservee &subject, bool training)
+{
+  const uint32_t num_replicas = _replicas.size() + 1;
+
+  // Split inputs and outputs of the whole batch into micro-batches of the same size
+  std::vector<std::vector<backend::IPortableTensor *>> micro_inputs(num_replicas);
+  std::vector<std::vector<backend::IPortableTensor *>> micro_outputs(num_replicas);
+  _micro_batch_tensors.clear();
+  auto split = [&](backend::IPortableTensor *tensor, const backend::builtin::IOTensor *io_tensor,
+                   std::vector<std::vector<backend::IPortableTensor *>> &micro_tensors) {
+    const auto &micro_info = io_tensor->get_info();
+    const auto micro_size = micro_info.total_size();
+    if (tensor->get_info().total_size() != micro_size * num_replicas)
+      throw std::runtime_error{"TrainableExecutor: Batch is not divided into replicas"};
+    for (uint32_t r = 0; r < num_replicas; ++r)
+    {
+      // Output may not be used on training, so its buffer may be nullptr
+      auto buffer = tensor->buffer() == nullptr ? nullptr : tensor->buffer() + r * micro_size;
+      auto micro_tensor = std::make_unique<backend::builtin::UserTensor>(
+        micro_info, io_tensor->layout(), buffer, micro_size);
+      micro_tensors[r].push_back(micro_tensor.get());
+      _micro_batch_tensors.emplace_back(std::move(micro_tensor));
+    }
+  };
+  assert(_input_tensors.size() == inputs.size());
+  for (uint32_t i = 0; i < inputs.size(); ++i)
+    split(inputs[i], _input_tensors[i], micro_inputs);
+  assert(_output_tensors.size() == outputs.size());
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+    split(outputs[i], _output_tensors[i], micro_outputs);
+
+  // Replicas are not observed, and they run with the weights updated by this executor
+  ExecObservers no_observers;
+  ExecutionObservee replica_subject(no_observers, _current_options);
+  runOnReplicas([&](TrainableExecutor &exec, uint32_t r) {
+    for (uint32_t i = 0; i < exec._input_tensors.size(); ++i)
+      exec._input_tensors[i]->setTensor(micro_inputs[r][i]);
+    for (uint32_t i = 0; i < exec._output_tensors.size(); ++i)
+      exec._output_tensors[i]->setTensor(micro_outputs[r][i]);
+
+    if (r == 0)
+    {
+      exec.forwardImpl(subject, training);
+      return;
+    }
+    exec._current_options = _current_options;
+    exec.forwardImpl(replica_subject, training);
+  });
+}
+
 void TrainableExecutor::backward(const ExecutionOptions &options, uint32_t training_step)
 {
   // For thread-safe, use mutex
@@ -150,6 +235,12 @@ void TrainableExecutor::backward(const ExecutionOptions &options, uint32_t train
 
 void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t training_step)
 {
+  // Recomputed segments of this executor and the replicas
+  std::vector<std::vector<bool>> recomputed;
+  recomputed.emplace_back(_recompute_segments.size(), false);
+  for (const auto &replica : _replicas)
+    recomputed.emplace_back(replica->_recompute_segments.size(), false);
+
   if (!subject.isEmpty() && _tracing_ctx)
   {
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_trainable_graph.graph());
@@ -169,8 +260,7 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
 #endif
       subject.notifyJobBegin(this, profiling_subg_index, code.op_ind, backend);
 
-      auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+      backwardOp(index, training_step, recomputed);
 
       subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
     }
@@ -189,10 +279,178 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
 #endif
-      auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+      backwardOp(index, training_step, recomputed);
+    }
+  }
+}
+
+void TrainableExecutor::backwardOp(const ir::OperationIndex &index, uint32_t training_step,
+                                   std::vector<std::vector<bool>> &recomputed)
+{
+  const auto &code = _code_map.at(index);
+  if (_replicas.empty())
+  {
+    recompute(index, recomputed[0]);
+    code.tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+    return;
+  }
+
+  // Replicas run each operation together, since memory of gradients may be reused by the next
+  // operation. Weights are updated once with the gradients of all micro-batches.
+  runOnReplicas([&](TrainableExecutor &exec, uint32_t r) {
+    exec.recompute(index, recomputed[r]);
+    exec._code_map.at(index).tn_seq->backward(training_step, false);
+  });
+  if (code.op->isWeightsUpdateEnabled())
+  {
+    reduceGradients(index);
+    code.tn_seq->applyGradients(training_step);
+  }
+}
+
+void TrainableExecutor::recompute(const ir::OperationIndex &index, std::vector<bool> &recomputed)
+{
+  const auto it = _recompute_segment_of.find(index);
+  if (it == _recompute_segment_of.end() || recomputed[it->second])
+    return;
+
+  // Forward the segment again before its first backwarding operation to restore the activations
+  // released after forwarding. The segment's inputs are checkpoints, which are kept.
+  for (const auto &op_index : _recompute_segments[it->second])
+  {
+    const auto &code = _code_map.at(op_index);
+    code.tn_seq->forward(code.op->isRequiredForBackward());
+  }
+  recomputed[it->second] = true;
+}
+
+void TrainableExecutor::reduceGradients(const ir::OperationIndex &index)
+{
+  const auto it = _replica_gradients.find(index);
+  if (it == _replica_gradients.end())
+    return;
+
+  // Gradients of SumOverBatchSize are averaged over each micro-batch, so their mean is the one of
+  // the whole batch. Gradients of Sum are just added.
+  const uint32_t num_replicas = _replicas.size() + 1;
+  const float scale = _loss_info.reduction_type == ir::train::LossReductionType::SumOverBatchSize
+                        ? 1.f / num_replicas
+                        : 1.f;
+
+  // Each worker reduces its own slice of every gradient, adding replicas in the same order
+  runOnReplicas([&](TrainableExecutor &, uint32_t r) {
+    for (const auto &gradients : it->second)
+    {
+      const auto size = gradients[0]->total_size() / sizeof(float);
+      const auto begin = size * r / num_replicas;
+      const auto end = size * (r + 1) / num_replicas;
+      auto dst = reinterpret_cast<float *>(gradients[0]->buffer());
+      for (uint32_t src_index = 1; src_index < gradients.size(); ++src_index)
+      {
+        const auto src = reinterpret_cast<const float *>(gradients[src_index]->buffer());
+        for (auto i = begin; i < end; ++i)
+          dst[i] += src[i];
+      }
+      for (auto i = begin; i < end; ++i)
+        dst[i] *= scale;
+    }
+  });
+}
+
+void TrainableExecutor::runOnReplicas(
+  const std::function<void(TrainableExecutor &, uint32_t)> &fn)
+{
+  // This executor runs on the calling thread while workers run the replicas
+  std::vector<std::exception_ptr> errors(_replicas.size() + 1);
+  for (uint32_t r = 1; r <= _replicas.size(); ++r)
+  {
+    _replica_pool->enqueue(std::make_unique<ReplicaJob>([&, r]() {
+      try
+      {
+        fn(*_replicas[r - 1], r);
+      }
+      catch (...)
+      {
+        errors[r] = std::current_exception();
+      }
+    }));
+  }
+  try
+  {
+    fn(*this, 0);
+  }
+  catch (...)
+  {
+    errors[0] = std::current_exception();
+  }
+  _replica_pool->finish();
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+void TrainableExecutor::setReplicas(std::vector<std::unique_ptr<TrainableExecutor>> &&replicas)
+{
+  assert(_replicas.empty());
+  if (replicas.empty())
+    return;
+
+  _replicas = std::move(replicas);
+  const uint32_t num_replicas = _replicas.size() + 1;
+
+  auto batch_info = [&](const backend::builtin::IOTensor *tensor) {
+    ir::OperandInfo info = tensor->get_info();
+    auto shape = info.shape();
+    if (shape.rank() == 0)
+      throw std::runtime_error{"TrainableExecutor: Replicas need batch of inputs and outputs"};
+    shape.dim(0) *= num_replicas;
+    info.shape(shape);
+    return info;
+  };
+  for (const auto &tensor : _input_tensors)
+    _batch_input_infos.emplace_back(batch_info(tensor));
+  for (const auto &tensor : _output_tensors)
+    _batch_output_infos.emplace_back(batch_info(tensor));
+
+  for (const auto &[op_index, code] : _code_map)
+  {
+    if (!code.op->isRequiredForBackward() || !code.op->isWeightsUpdateEnabled())
+      continue;
+
+    for (const auto &input : code.op->getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      auto gradient = _tensor_regs.getGradientITensor(input);
+      if (gradient == nullptr)
+        continue;
+      if (gradient->data_type() != ir::DataType::FLOAT32)
+        throw std::runtime_error{"TrainableExecutor: Replicas only support float32 gradients"};
+
+      std::vector<backend::ITensor *> gradients{gradient};
+      for (const auto &replica : _replicas)
+      {
+        auto replica_gradient = replica->_tensor_regs.getGradientITensor(input);
+        assert(replica_gradient != nullptr);
+        gradients.emplace_back(replica_gradient);
+      }
+      _replica_gradients[op_index].emplace_back(std::move(gradients));
     }
   }
+
+  // Replicas must have been compiled with the weights of this executor
+  _tensor_regs.iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *tensor) {
+      for (const auto &replica : _replicas)
+      {
+        auto replica_tensor = replica->_tensor_regs.getITensor(index);
+        if (replica_tensor == nullptr || replica_tensor->buffer() != tensor->buffer())
+          throw std::runtime_error{"TrainableExecutor: Replicas do not share weights"};
+      }
+    });
+
+  _replica_pool = std::make_unique<ThreadPool>(_replicas.size());
 }
 
 float TrainableExecutor::getLoss(const ir::IOIndex &pred_io_ind) const
@@ -200,15 +458,25 @@ float TrainableExecutor::getLoss(const ir::IOIndex &pred_io_ind) const
   const auto &loss_ind = _trainable_graph.getLossIndex(pred_io_ind);
   if (loss_ind.undefined())
     throw std::runtime_error{"Loss " + std::to_string(loss_ind.value()) + " is not defined."};
-  backend::ITensor *tensor = _tensor_regs.getITensor(loss_ind);
+
+  // Losses of replicas are the ones of the other samples in the batch
   long double sum = 0;
-  for (uint64_t i = 0; i < tensor->getShape().num_elements(); ++i)
-  {
-    sum += reinterpret_cast<float *>(tensor->buffer())[i];
-  }
+  uint64_t num_elements = 0;
+  auto accumulate = [&](const TrainableExecutor &exec) {
+    backend::ITensor *tensor = exec._tensor_regs.getITensor(loss_ind);
+    for (uint64_t i = 0; i < tensor->getShape().num_elements(); ++i)
+    {
+      sum += reinterpret_cast<float *>(tensor->buffer())[i];
+    }
+    num_elements += tensor->getShape().num_elements();
+  };
+  accumulate(*this);
+  for (const auto &replica : _replicas)
+    accumulate(*replica);
+
   if (_loss_info.reduction_type == ir::train::LossReductionType::SumOverBatchSize)
   {
-    sum /= tensor->getShape().num_elements();
+    sum /= num_elements;
   }
   return static_cast<float>(sum);
 }
@@ -20,6 +20,8 @@
 #include "exec/IExecutor.h"
 
 #include "../ExecutionObservee.h"
+#include "../ThreadPool.h"
+#include "../../backend/builtin/UserTensor.h"
 #include "../../compiler/train/TensorRegistries.h"
 
 #include "backend/train/TrainableBackendContext.h"
@@ -44,6 +46,7 @@ public:
    * @param lowered_graph LoweredTrainableGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param recompute_segments Forward segments to be forwarded again in backwarding
    */
   TrainableExecutor(std::unique_ptr<compiler::train::LoweredTrainableGraph> lowered_graph,
                     backend::train::TrainableBackendContexts &&backend_contexts,
@@ -51,6 +54,7 @@ public:
                     compiler::train::TrainableCodeMap &&code_map,
                     const std::vector<ir::OperationIndex> &forward_order,
                     const std::vector<ir::OperationIndex> &backward_order,
+                    const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
                     const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info);
 
 public:
@@ -69,11 +73,15 @@ public:
 
   const ir::OperandInfo &inputInfo(uint32_t index) const override
   {
+    if (!_replicas.empty())
+      return _batch_input_infos[index];
     return _input_tensors[index]->get_info();
   }
 
   const ir::OperandInfo &outputInfo(uint32_t index) const override
   {
+    if (!_replicas.empty())
+      return _batch_output_infos[index];
     return _output_tensors[index]->get_info();
   }
 
@@ -89,6 +97,20 @@ public:
                const ExecutionOptions &options, bool training);
   void backward(const ExecutionOptions &options, uint32_t training_step);
 
+  /**
+   * @brief Set replicas which run on the other micro-batches of every batch in parallel
+   *
+   * Replicas must be compiled from the same graph as this executor, with the batch size divided
+   * by the number of replicas including this executor. Inputs and outputs of the whole batch are
+   * then split along the first dimension. After each operation's backwarding, gradients of the
+   * replicas are summed into the gradients of this executor, which alone updates the weights.
+   * Replicas share the weights of this executor, so they must be compiled with its trainable
+   * tensors as shared trainables.
+   *
+   * @param replicas Executors of the other micro-batches
+   */
+  void setReplicas(std::vector<std::unique_ptr<TrainableExecutor>> &&replicas);
+
   // Used only in Dataflow and Parallel Executors
   void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) final
   {
@@ -109,12 +131,22 @@ public:
 
 private:
   void forwardImpl(const ExecutionObservee &subject, bool training);
+  void forwardReplicas(const std::vector<backend::IPortableTensor *> &inputs,
+                       const std::vector<backend::IPortableTensor *> &outputs,
+                       const ExecutionObservee &subject, bool training);
   void backwardImpl(const ExecutionObservee &subject, uint32_t training_step);
+  void backwardOp(const ir::OperationIndex &index, uint32_t training_step,
+                  std::vector<std::vector<bool>> &recomputed);
+  void recompute(const ir::OperationIndex &index, std::vector<bool> &recomputed);
+  void reduceGradients(const ir::OperationIndex &index);
+  void runOnReplicas(const std::function<void(TrainableExecutor &, uint32_t)> &fn);
 
 private:
   compiler::train::TrainableCodeMap _code_map;
   std::vector<ir::OperationIndex> _forward_order;
   std::vector<ir::OperationIndex> _backward_order;
+  std::vector<std::vector<ir::OperationIndex>> _recompute_segments;
+  ir::OperationIndexMap<uint32_t> _recompute_segment_of;
   ExecObservers _observers;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   std::unique_ptr<compiler::train::LoweredTrainableGraph> _lowered_graph;
@@ -126,6 +158,15 @@ private:
   std::mutex _mutex;
   const util::TracingCtx *_tracing_ctx;
   const ir::train::LossInfo _loss_info;
+  // Replicas of the other micro-batches and the workers running them
+  std::vector<std::unique_ptr<TrainableExecutor>> _replicas;
+  std::unique_ptr<ThreadPool> _replica_pool;
+  std::vector<ir::OperandInfo> _batch_input_infos;
+  std::vector<ir::OperandInfo> _batch_output_infos;
+  // Micro-batches of inputs and outputs, which must be alive until backwarding is finished
+  std::vector<std::unique_ptr<backend::builtin::UserTensor>> _micro_batch_tensors;
+  // Gradients of each operation updating weights, [operand][this executor, replicas...]
+  ir::OperationIndexMap<std::vector<std::vector<backend::ITensor *>>> _replica_gradients;
   /**
    * It is set by execute() method only in thread-safe environment.
    * It is used for non-primary executor call on builtin backend
@@ -70,7 +70,9 @@ public:
   void visit(const operation::ResizeBilinear &) override;
   void visit(const operation::ResizeNearestNeighbor &) override;
   void visit(const operation::Reverse &) override;
+  void visit(const operation::RmsNorm &) override;
   void visit(const operation::RNN &) override;
+  void visit(const operation::RoPE &) override;
   void visit(const operation::Select &node) override;
   void visit(const operation::Shape &node) override;
   void visit(const operation::Softmax &node) override;
@@ -119,12 +119,26 @@ void OperationValidator::visit(const operation::BatchMatMul &node)
   const auto rhs_index(node.getInputs().at(operation::BatchMatMul::Input::RHS));
   const auto output_index(node.getOutputs().at(0));
 
-  // Constant lhs and rhs is not implemented yet
-  OP_REQUIRES(!isConstant(lhs_index) && !isConstant(rhs_index));
+  // Constant lhs is not implemented yet
+  OP_REQUIRES(!isConstant(lhs_index));
+
+  // Allow block quantized constant rhs (lhs: float / rhs: ggml q4_0, q8_0 / out: float)
+  const auto rhs_type = operandType(rhs_index);
+  if (rhs_type == DataType::QUANT_GGML_Q4_0 || rhs_type == DataType::QUANT_GGML_Q8_0)
+  {
+    OP_REQUIRES(isConstant(rhs_index));
+    OP_REQUIRES(isValidType(lhs_index, DataType::FLOAT32));
+    OP_REQUIRES(isValidType(output_index, DataType::FLOAT32));
+    return;
+  }
+
+  // Constant rhs is not implemented yet
+  OP_REQUIRES(!isConstant(rhs_index));
 
   // Allow hybrid quantization (lhs: float / rhs: qint8 / out: float)
-  OP_REQUIRES(isValidType(
-    lhs_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  // FLOAT16 needs the same type for lhs, rhs and output
+  OP_REQUIRES(isValidType(lhs_index, {DataType::FLOAT32, DataType::FLOAT16,
+                                      DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
   OP_REQUIRES(isSameType(lhs_index, rhs_index) ||
               ((operandType(lhs_index) == DataType::FLOAT32) &&
                (operandType(rhs_index) == DataType::QUANT_INT8_ASYMM)));
@@ -258,12 +272,14 @@ void OperationValidator::visit(const operation::ElementwiseActivation &node)
     case operation::ElementwiseActivation::Type::LEAKY_RELU:
       OP_REQUIRES(
         isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
-                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
+                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM,
+                                  DataType::QUANT_INT16_SYMM}));
       break;
     case operation::ElementwiseActivation::Type::LOGISTIC:
       OP_REQUIRES(
         isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
-                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
+                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM,
+                                  DataType::QUANT_INT16_SYMM}));
       break;
     case operation::ElementwiseActivation::Type::RELU:
       OP_REQUIRES(isValidType(
@@ -272,7 +288,8 @@ void OperationValidator::visit(const operation::ElementwiseActivation &node)
     case operation::ElementwiseActivation::Type::TANH:
       OP_REQUIRES(
         isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
-                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
+                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM,
+                                  DataType::QUANT_INT16_SYMM}));
       break;
   }
 }
@@ -302,9 +319,9 @@ void OperationValidator::visit(const operation::ElementwiseUnary &node)
   // Check if I/O types match
   if (node.param().op_type == operation::ElementwiseUnary::Type::DEQUANTIZE)
   {
-    // NNAPI allow QUANT_INT8_SYMM type input
+    // NNAPI allow QUANT_INT8_SYMM type input, and TFLite allows FLOAT16 type input
     OP_REQUIRES(isValidType(input_index, {DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_SYMM,
-                                          DataType::QUANT_INT8_ASYMM}));
+                                          DataType::QUANT_INT8_ASYMM, DataType::FLOAT16}));
     OP_REQUIRES(isValidType(output_index, DataType::FLOAT32));
   }
   else if (node.param().op_type == operation::ElementwiseUnary::Type::QUANTIZE)
@@ -363,6 +380,22 @@ void OperationValidator::visit(const operation::Fill &node)
                           {DataType::FLOAT32, DataType::INT32, DataType::INT64, DataType::BOOL8}));
 }
 
+void OperationValidator::visit(const operation::FullyConnected &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(operation::FullyConnected::Input::INPUT)};
+  const auto weight_index{node.getInputs().at(operation::FullyConnected::Input::WEIGHT)};
+
+  // Block quantized weights are supported with float input/output only
+  const auto weight_type = operandType(weight_index);
+  if (weight_type == DataType::QUANT_GGML_Q4_0 || weight_type == DataType::QUANT_GGML_Q8_0)
+  {
+    OP_REQUIRES(isConstant(weight_index));
+    OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+    OP_REQUIRES(isValidType(output_index, DataType::FLOAT32));
+  }
+}
+
 void OperationValidator::visit(const operation::Gather &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -451,6 +484,32 @@ void OperationValidator::visit(const operation::Reverse &node)
   OP_REQUIRES(isSameType(output_index, input_index));
 }
 
+void OperationValidator::visit(const operation::RmsNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(operation::RmsNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(operation::RmsNorm::Input::BETA)};
+
+  OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(input_index, gamma_index));
+  OP_REQUIRES(isSameType(input_index, beta_index));
+  OP_REQUIRES(isSameType(input_index, output_index));
+}
+
+void OperationValidator::visit(const operation::RoPE &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(operation::RoPE::Input::INPUT)};
+  const auto sin_index{node.getInputs().at(operation::RoPE::Input::SIN_TABLE)};
+  const auto cos_index{node.getInputs().at(operation::RoPE::Input::COS_TABLE)};
+
+  OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(input_index, sin_index));
+  OP_REQUIRES(isSameType(input_index, cos_index));
+  OP_REQUIRES(isSameType(input_index, output_index));
+}
+
 void OperationValidator::visit(const operation::Select &node)
 {
   const auto condition_index{node.getInputs().at(operation::Select::Input::CONDITION)};
@@ -483,8 +542,9 @@ void OperationValidator::visit(const operation::Softmax &node)
   const auto input_index{node.getInputs().at(operation::Softmax::INPUT)};
 
   OP_REQUIRES(isSameType(input_index, output_index));
-  OP_REQUIRES(isValidType(
-    output_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  OP_REQUIRES(isValidType(output_index,
+                          {DataType::FLOAT32, DataType::FLOAT16, DataType::QUANT_UINT8_ASYMM,
+                           DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_SYMM}));
 }
 
 void OperationValidator::visit(const operation::SpaceToBatchND &node)
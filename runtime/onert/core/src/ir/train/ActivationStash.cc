@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/train/ActivationStash.h"
+
+#include <stdexcept>
+#include <unordered_map>
+
+namespace onert
+{
+namespace ir
+{
+namespace train
+{
+
+std::string toString(ActivationStash stash)
+{
+  static const std::unordered_map<ActivationStash, const char *> map{
+    {ActivationStash::None, ""},
+    {ActivationStash::FLOAT16, "fp16"},
+    {ActivationStash::BFLOAT16, "bf16"}};
+  return map.at(stash);
+}
+
+ActivationStash toActivationStash(const std::string &name)
+{
+  if (name.empty())
+    return ActivationStash::None;
+  if (name == "fp16")
+    return ActivationStash::FLOAT16;
+  if (name == "bf16")
+    return ActivationStash::BFLOAT16;
+  throw std::runtime_error("Invalid activation stash type, " + name);
+}
+
+} // namespace train
+} // namespace ir
+} // namespace onert
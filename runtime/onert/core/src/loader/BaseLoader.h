@@ -24,6 +24,7 @@
 
 #include "flatbuffers/flexbuffers.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <fstream>
@@ -32,6 +33,7 @@
 #include <sys/stat.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <unordered_set>
 #include <util/logging.h>
 
 namespace onert
@@ -106,6 +108,8 @@ protected:
                        ir::OperandIndexSequence &outputs);
   // Create operations from Operator
   void loadOperation(const Operator *op, ir::Graph &subg);
+  // Restore QUANT_INT16_ASYMM of operands which no symmetric int16 operation uses
+  void restrictSymmetricInt16(ir::Graph &subg);
   // Load Strides and Paddings from options to param
   template <typename Param, typename OptionsType>
   void loadStridesAndPaddings(Param &param, const OptionsType *options);
@@ -490,9 +494,59 @@ void BaseLoader<LoaderDomain>::loadQuantization(const Tensor *tensor, ir::TypeIn
   auto details = q_params->details_as_CustomQuantization();
   if (details != nullptr)
     throw std::runtime_error("Custom Quantization is not supported");
+  // circle/tflite have a single INT16 type. Quantized int16 is symmetric, which has zero_point 0
+  // and positive scales, either one for the tensor or one for each index of quantized_dimension.
+  // restrictSymmetricInt16 keeps it only for operands of operations with symmetric int16 kernels.
+  if (typeInfo.type() == ir::DataType::QUANT_INT16_ASYMM)
+  {
+    const auto *shape = tensor->shape();
+    const auto axis = q_params->quantized_dimension();
+    const bool per_tensor = num_scales == 1;
+    const bool per_channel = shape != nullptr && axis >= 0 &&
+                             axis < static_cast<int32_t>(shape->size()) &&
+                             static_cast<int64_t>(num_scales) == shape->Get(axis);
+    const bool symmetric =
+      std::all_of(zero_points.begin(), zero_points.end(), [](int32_t zp) { return zp == 0; }) &&
+      std::all_of(scales.begin(), scales.end(), [](float scale) { return scale > 0.f; });
+    if ((per_tensor || per_channel) && symmetric)
+      typeInfo.type(ir::DataType::QUANT_INT16_SYMM);
+  }
   typeInfo.quantization(std::move(scales), std::move(zero_points));
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::restrictSymmetricInt16(ir::Graph &subg)
+{
+  // Operations which have kernels for QUANT_INT16_SYMM
+  auto has_symm_int16_kernel = [](const ir::IOperation &op) {
+    using namespace ir::operation;
+    if (const auto *arith = dynamic_cast<const BinaryArithmetic *>(&op))
+      return arith->param().arithmetic_type != BinaryArithmetic::ArithmeticType::DIV;
+    if (const auto *act = dynamic_cast<const ElementwiseActivation *>(&op))
+      return act->param().op_type == ElementwiseActivation::Type::LOGISTIC ||
+             act->param().op_type == ElementwiseActivation::Type::TANH ||
+             act->param().op_type == ElementwiseActivation::Type::LEAKY_RELU;
+    if (const auto *reduce = dynamic_cast<const Reduce *>(&op))
+      return reduce->param().reduce_type == Reduce::ReduceType::MEAN;
+    return op.opcode() == ir::OpCode::FullyConnected || op.opcode() == ir::OpCode::Softmax;
+  };
+
+  std::unordered_set<ir::OperandIndex> symm_operands;
+  subg.operations().iterate([&](const ir::OperationIndex &, const ir::IOperation &op) {
+    if (!has_symm_int16_kernel(op))
+      return;
+    for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+      symm_operands.insert(ind);
+  });
+
+  // Operands of other operations stay QUANT_INT16_ASYMM, which acl backends take as QASYMM16
+  subg.operands().iterate([&](const ir::OperandIndex &ind, ir::Operand &operand) {
+    if (operand.typeInfo().type() == ir::DataType::QUANT_INT16_SYMM &&
+        symm_operands.find(ind) == symm_operands.end())
+      operand.type(ir::DataType::QUANT_INT16_ASYMM);
+  });
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadSparsity(const Tensor *tensor, ir::TypeInfo &typeInfo)
 {
@@ -70,6 +70,8 @@ protected:
   void loadInstanceNorm(const Operator *op, ir::Graph &subg);
   void loadBCQFullyConnected(const Operator *op, ir::Graph &subg);
   void loadBCQGather(const Operator *op, ir::Graph &subg);
+  void loadRmsNorm(const Operator *op, ir::Graph &subg);
+  void loadRoPE(const Operator *op, ir::Graph &subg);
 
 public:
   using BaseLoader::BaseLoader;
@@ -126,6 +128,7 @@ private:
     {
       CircleLoader::loadOperation(op, *subg);
     }
+    restrictSymmetricInt16(*subg);
 
     subg->verify();
 
@@ -150,6 +153,12 @@ private:
       case circle::BuiltinOperator::BuiltinOperator_BCQ_GATHER:
         loadBCQGather(op, subg);
         return;
+      case circle::BuiltinOperator::BuiltinOperator_RMS_NORM:
+        loadRmsNorm(op, subg);
+        return;
+      case circle::BuiltinOperator::BuiltinOperator_ROPE:
+        loadRoPE(op, subg);
+        return;
       default:
         BaseLoader::loadOperation(op, subg);
         return;
@@ -225,6 +234,47 @@ void CircleLoader::loadBCQFullyConnected(const Operator *op, ir::Graph &subg)
   subg.addOperation(std::move(new_op));
 }
 
+void CircleLoader::loadRmsNorm(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::RmsNorm::Param param;
+  const auto *options = op->builtin_options_as_RmsNormOptions();
+  param.epsilon = options == nullptr ? 0.f : options->epsilon();
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::RmsNorm(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
+void CircleLoader::loadRoPE(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::RoPE::Param param;
+  const auto *options = op->builtin_options_as_RoPEOptions();
+  const auto mode = options == nullptr ? circle::RoPEMode_GPT_NEOX : options->mode();
+  switch (mode)
+  {
+    case circle::RoPEMode_GPT_NEOX:
+      param.mode = ir::operation::RoPE::RoPEMode::GPT_NEOX;
+      break;
+    case circle::RoPEMode_GPT_J:
+      param.mode = ir::operation::RoPE::RoPEMode::GPT_J;
+      break;
+    default:
+      throw std::runtime_error("RoPE: unsupported mode");
+  }
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::RoPE(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 } // namespace
 
 std::unique_ptr<ir::Model> loadCircleModel(const std::string &filename)
@@ -114,6 +114,7 @@ private:
     {
       loadOperation(op, *subg);
     }
+    restrictSymmetricInt16(*subg);
 
     subg->verify();
 
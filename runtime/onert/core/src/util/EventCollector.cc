@@ -26,133 +26,41 @@
 namespace
 {
 
-std::string timestamp(void)
+TraceRecord makeRecord(const EventCollector::Event &event)
 {
-  auto now = std::chrono::steady_clock::now();
-  return std::to_string(
-    std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
-}
-
-class DurationEventBuilder : public EventCollector::EventVisitor
-{
-public:
-  DurationEventBuilder(const std::string &ts) : _ts{ts} {}
-
-  std::unique_ptr<SubgDurationEvent> build(const EventCollector::SubgEvent &evt_collected,
-                                           const std::string &ph) const
-  {
-    auto dur_evt = std::make_unique<SubgDurationEvent>();
-
-    // The following will be set by a child of EventsWriter:
-    // dur_evt.name, dur_evt.tid
-    dur_evt->ph = ph;
-    dur_evt->ts = _ts;
-    dur_evt->tracing_ctx = evt_collected.tracing_ctx;
-
-    dur_evt->session_index = evt_collected.session_index;
-    dur_evt->subg_index = evt_collected.subg_index;
-
-    dur_evt->args = evt_collected.userData;
-    {
-      dur_evt->args.emplace_back("session", std::to_string(evt_collected.session_index));
-      dur_evt->args.emplace_back("subgraph", std::to_string(evt_collected.subg_index));
-    }
-
-    return dur_evt;
-  }
-
-  std::unique_ptr<OpSeqDurationEvent> build(const EventCollector::OpSeqEvent &evt_collected,
-                                            const std::string &ph) const
-  {
-    auto dur_evt = std::make_unique<OpSeqDurationEvent>();
-
-    // The following will be set by a child of EventsWriter:
-    // dur_evt.name, dur_evt.tid
-    dur_evt->ph = ph;
-    dur_evt->ts = _ts;
-    dur_evt->tracing_ctx = evt_collected.tracing_ctx;
-
-    dur_evt->session_index = evt_collected.session_index;
-    dur_evt->subg_index = evt_collected.subg_index;
-
-    dur_evt->backend = evt_collected.backend;
-    dur_evt->op_index = evt_collected.op_index;
-    dur_evt->op_name = evt_collected.op_name;
-
-    dur_evt->args = evt_collected.userData;
-    {
-      dur_evt->args.emplace_back("session", std::to_string(evt_collected.session_index));
-      dur_evt->args.emplace_back("subgraph", std::to_string(evt_collected.subg_index));
-    }
-
-    return dur_evt;
-  }
-
-private:
-  std::string _ts;
-};
+  TraceRecord record;
+  record.ts = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+  record.backend = nullptr;
+  record.session_index = event.session_index;
+  record.subg_index = event.subg_index;
+  record.op_index = TraceRecord::kSubgraph;
+  record.begin = event.edge == EventCollector::Edge::BEGIN ? 1 : 0;
 
+// TODO: Add resurece measurement(e.g. RSS)
+// when ready with low overhead in release build
 #ifdef DEBUG
-inline void emit_rusage(EventRecorder *rec, const std::string &ts)
-{
   struct rusage ru;
-
   getrusage(RUSAGE_SELF, &ru);
-  {
-    CounterEvent evt;
-
-    evt.name = "maxrss";
-    evt.ph = "C";
-    evt.ts = ts;
-    evt.values["value"] = std::to_string(ru.ru_maxrss);
-
-    rec->emit(evt);
-  }
-
-  {
-    CounterEvent evt;
-
-    evt.name = "minflt";
-    evt.ph = "C";
-    evt.ts = ts;
-    evt.values["value"] = std::to_string(ru.ru_minflt);
+  record.maxrss = static_cast<uint32_t>(ru.ru_maxrss);
+  record.minflt = static_cast<uint32_t>(ru.ru_minflt);
+#else
+  record.maxrss = 0;
+  record.minflt = 0;
+#endif
 
-    rec->emit(evt);
-  }
+  return record;
 }
-#endif
 
 } // namespace
 
-template <typename EventT> void EventCollector::onEvent(const EventT &event)
-{
-  auto ts = timestamp();
+void EventCollector::onEvent(const SubgEvent &event) { _buf->push(makeRecord(event)); }
 
-  DurationEventBuilder builder(ts);
-
-  switch (event.edge)
-  {
-    case Edge::BEGIN:
-    {
-      auto duration_evt = builder.build(event, "B");
-      _rec->emit(std::move(duration_evt));
-      break;
-    }
-    case Edge::END:
-    {
-      auto duration_evt = builder.build(event, "E");
-      _rec->emit(std::move(duration_evt));
-      break;
-    }
-  }
-
-// TODO: Add resurece measurement(e.g. RSS)
-// when ready with low overhead in release build
-#ifdef DEBUG
-  emit_rusage(_rec, ts);
-#endif
+void EventCollector::onEvent(const OpSeqEvent &event)
+{
+  auto record = makeRecord(event);
+  record.backend = event.backend;
+  record.op_index = event.op_index;
+  _buf->push(record);
 }
-
-// template instantiation
-template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event);
-template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event);
@@ -17,13 +17,11 @@
 #ifndef __ONERT_UTIL_EVENT_COLLECTOR_H__
 #define __ONERT_UTIL_EVENT_COLLECTOR_H__
 
-#include "EventRecorder.h"
+#include "TraceBuffer.h"
 
 #include "util/TracingCtx.h"
 
-#include <string>
-#include <utility>
-#include <vector>
+#include <cstdint>
 
 class EventCollector
 {
@@ -34,24 +32,6 @@ public:
     END
   };
 
-  struct SubgEvent;
-  struct OpEvent;
-
-  class EventVisitor
-  {
-  public:
-    virtual ~EventVisitor() = default;
-
-    virtual std::unique_ptr<DurationEvent> visit(const SubgEvent &, const std::string &) const
-    {
-      throw std::runtime_error("Please implement");
-    }
-    virtual std::unique_ptr<DurationEvent> visit(const OpEvent &, const std::string &) const
-    {
-      throw std::runtime_error("Please implement");
-    }
-  };
-
   struct Event
   {
     const onert::util::TracingCtx *tracing_ctx;
@@ -60,17 +40,12 @@ public:
     uint32_t session_index;
     uint32_t subg_index;
 
-    // user-defined data: pairs of (key, value)
-    std::vector<std::pair<std::string, std::string>> userData;
-
   protected:
     Event(const onert::util::TracingCtx *a_tracing_ctx, Edge a_edge, uint32_t a_subg_index)
       : tracing_ctx(a_tracing_ctx), edge(a_edge), session_index(tracing_ctx->getSessionId()),
         subg_index(a_subg_index)
     { /* empty */
     }
-
-    virtual ~Event() = default;
   };
 
   struct SubgEvent : public Event
@@ -85,31 +60,29 @@ public:
   // TODO Rename this to OperationEvent
   struct OpSeqEvent : public Event
   {
-    std::string backend;
+    // Names of backend and operation are resolved from these when records are written
+    const void *backend;
     uint32_t op_index;
-    std::string op_name;
 
     OpSeqEvent(const onert::util::TracingCtx *a_tracing_ctx, Edge a_edge, uint32_t a_subg_index,
-               const std::string a_backend, uint32_t a_op_index, const std::string a_op_name)
-      : Event(a_tracing_ctx, a_edge, a_subg_index)
-    {
-      backend.assign(a_backend);
-      op_index = a_op_index;
-      op_name.assign(a_op_name);
+               const void *a_backend, uint32_t a_op_index)
+      : Event(a_tracing_ctx, a_edge, a_subg_index), backend(a_backend), op_index(a_op_index)
+    { /* empty */
     }
   };
 
 public:
-  EventCollector(EventRecorder *rec) : _rec{rec}
+  EventCollector(TraceBuffer *buf) : _buf{buf}
   {
     // DO NOTHING
   }
 
 public:
-  template <typename EventT> void onEvent(const EventT &event);
+  void onEvent(const SubgEvent &event);
+  void onEvent(const OpSeqEvent &event);
 
 protected:
-  EventRecorder *_rec;
+  TraceBuffer *_buf;
 };
 
 #endif // __ONERT_UTIL_EVENT_COLLECTOR_H__
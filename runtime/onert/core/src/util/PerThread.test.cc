@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PerThread.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace onert;
+
+TEST(PerThread, same_object_on_same_thread)
+{
+  util::PerThread<int> objects;
+  int num_created = 0;
+  auto create = [&]() {
+    ++num_created;
+    return std::make_unique<int>(1);
+  };
+
+  auto first = objects.get(create);
+  auto second = objects.get(create);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(num_created, 1);
+  ASSERT_EQ(objects.size(), 1);
+}
+
+TEST(PerThread, object_per_thread)
+{
+  util::PerThread<int> objects;
+  auto create = []() { return std::make_unique<int>(0); };
+
+  int *main_object = objects.get(create);
+  int *thread_object = nullptr;
+  std::thread thread{[&]() {
+    thread_object = objects.get(create);
+    ASSERT_EQ(objects.size(), 2);
+  }};
+  thread.join();
+
+  ASSERT_NE(main_object, thread_object);
+  // The object of an exited thread is freed
+  ASSERT_EQ(objects.size(), 1);
+}
+
+TEST(PerThread, for_each)
+{
+  util::PerThread<int> objects;
+  auto create = []() { return std::make_unique<int>(1); };
+
+  auto object = objects.get(create);
+  objects.forEach([](int *value) { *value = 2; });
+  ASSERT_EQ(*object, 2);
+}
+
+TEST(PerThread, neg_destroyed_owner)
+{
+  auto create = [](int value) { return [value]() { return std::make_unique<int>(value); }; };
+
+  // A new owner never gets the object of an owner destroyed before, even at the same address
+  for (int i = 0; i < 4; ++i)
+  {
+    util::PerThread<int> objects;
+    ASSERT_EQ(*objects.get(create(i)), i);
+  }
+
+  // Owners which outlive a thread do not keep its object
+  auto objects = std::make_unique<util::PerThread<int>>();
+  std::thread thread{[&]() {
+    objects->get(create(0));
+    objects.reset();
+  }};
+  thread.join();
+  ASSERT_EQ(objects, nullptr);
+}
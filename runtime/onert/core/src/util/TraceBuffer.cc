@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <tuple>
+
+TraceRing::TraceRing(size_t capacity)
+{
+  // Round up to a power of 2 to wrap the index with a mask
+  size_t size = 1;
+  while (size < capacity)
+    size <<= 1;
+  _records.resize(size);
+  _mask = size - 1;
+}
+
+void TraceRing::collect(std::vector<TraceRecord> &out) const
+{
+  const auto head = _head.load(std::memory_order_acquire);
+  const auto first = head > _records.size() ? head - _records.size() : 0;
+  for (auto i = first; i < head; ++i)
+    out.emplace_back(_records[i & _mask]);
+}
+
+uint64_t TraceRing::dropped() const
+{
+  const auto head = _head.load(std::memory_order_acquire);
+  return head > _records.size() ? head - _records.size() : 0;
+}
+
+namespace
+{
+
+uint64_t nextBufferId()
+{
+  static std::atomic<uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+TraceBuffer::TraceBuffer(size_t capacity_per_thread)
+  : _id{nextBufferId()}, _capacity{capacity_per_thread}
+{
+  assert(_capacity > 0);
+}
+
+TraceRing &TraceBuffer::localRing()
+{
+  struct Cache
+  {
+    uint64_t id = 0;
+    TraceRing *ring = nullptr;
+  };
+  thread_local Cache cache;
+
+  if (cache.id == _id)
+    return *cache.ring;
+
+  std::lock_guard<std::mutex> lock{_mu};
+  auto &ring = _rings[std::this_thread::get_id()];
+  if (!ring)
+    ring = std::make_unique<TraceRing>(_capacity);
+  cache.id = _id;
+  cache.ring = ring.get();
+  return *ring;
+}
+
+std::vector<TraceRecord> TraceBuffer::collect() const
+{
+  std::vector<TraceRecord> records;
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    for (const auto &ring : _rings)
+      ring.second->collect(records);
+  }
+  std::stable_sort(records.begin(), records.end(),
+                   [](const TraceRecord &lhs, const TraceRecord &rhs) { return lhs.ts < rhs.ts; });
+  return records;
+}
+
+std::vector<TraceRecord> TraceBuffer::collectPaired() const
+{
+  auto records = collect();
+
+  // Match each end with the latest open begin of the same event
+  std::map<std::tuple<uint32_t, uint32_t, uint32_t>, std::vector<size_t>> opened;
+  std::vector<bool> paired(records.size(), false);
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    const auto &record = records[i];
+    const auto key = std::make_tuple(record.session_index, record.subg_index, record.op_index);
+    auto &begins = opened[key];
+    if (record.begin)
+    {
+      begins.emplace_back(i);
+    }
+    else if (!begins.empty())
+    {
+      paired[begins.back()] = true;
+      paired[i] = true;
+      begins.pop_back();
+    }
+  }
+
+  size_t n = 0;
+  for (size_t i = 0; i < records.size(); ++i)
+    if (paired[i])
+      records[n++] = records[i];
+  records.resize(n);
+  return records;
+}
+
+uint64_t TraceBuffer::dropped() const
+{
+  std::lock_guard<std::mutex> lock{_mu};
+  uint64_t dropped = 0;
+  for (const auto &ring : _rings)
+    dropped += ring.second->dropped();
+  return dropped;
+}
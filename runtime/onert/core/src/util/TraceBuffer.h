@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_BUFFER_H__
+#define __ONERT_UTIL_TRACE_BUFFER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Fixed-size binary record of a tracing event
+ *
+ * Strings such as operation names and backend ids are not stored. They are resolved from indices
+ * when the records are converted for EventWriter.
+ */
+struct TraceRecord
+{
+  static constexpr uint32_t kSubgraph = UINT32_MAX; ///< op_index of subgraph events
+
+  uint64_t ts;         ///< Monotonic clock in nanoseconds
+  const void *backend; ///< Opaque backend handle, nullptr for subgraph events
+  uint32_t session_index;
+  uint32_t subg_index;
+  uint32_t op_index;
+  uint32_t begin;  ///< 1 for begin edge, 0 for end edge
+  uint32_t maxrss; ///< Filled only in debug build
+  uint32_t minflt; ///< Filled only in debug build
+};
+
+/**
+ * @brief Ring buffer of TraceRecord written by a single thread
+ *
+ * When the ring is full, the oldest records are overwritten.
+ */
+class TraceRing
+{
+public:
+  TraceRing(size_t capacity);
+
+public:
+  void push(const TraceRecord &record)
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    _records[head & _mask] = record;
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Append records remaining in the ring to @c out, from the oldest
+   * @note  Call this after the writing thread stops pushing
+   */
+  void collect(std::vector<TraceRecord> &out) const;
+  uint64_t dropped() const;
+
+private:
+  std::vector<TraceRecord> _records;
+  size_t _mask;
+  std::atomic<uint64_t> _head{0};
+};
+
+/**
+ * @brief Set of per-thread TraceRing
+ *
+ * push() takes a lock only the first time a thread pushes to this buffer. After that, records are
+ * written to the ring of the thread without synchronization with other threads.
+ */
+class TraceBuffer
+{
+public:
+  static constexpr size_t kDefaultCapacity = 1 << 16;
+
+public:
+  TraceBuffer(size_t capacity_per_thread = kDefaultCapacity);
+
+public:
+  void push(const TraceRecord &record) { localRing().push(record); }
+
+  /**
+   * @brief Get records of all threads sorted by timestamp
+   * @note  Call this after all threads stop pushing
+   */
+  std::vector<TraceRecord> collect() const;
+  /**
+   * @brief Get records like collect(), without begin or end records whose pair is missing
+   * @note  A pair is missing when its other record was overwritten or has not been pushed
+   */
+  std::vector<TraceRecord> collectPaired() const;
+  uint64_t dropped() const;
+
+private:
+  TraceRing &localRing();
+
+private:
+  const uint64_t _id; // Unique among buffers to validate the cache of each thread
+  const size_t _capacity;
+  mutable std::mutex _mu;
+  std::unordered_map<std::thread::id, std::unique_ptr<TraceRing>> _rings;
+};
+
+#endif // __ONERT_UTIL_TRACE_BUFFER_H__
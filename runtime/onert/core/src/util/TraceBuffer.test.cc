@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceBuffer.h"
+#include "EventCollector.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TraceRecord makeRecord(uint64_t ts, uint32_t op_index)
+{
+  TraceRecord record{};
+  record.ts = ts;
+  record.op_index = op_index;
+  record.begin = 1;
+  return record;
+}
+
+TraceRecord makeEdge(uint64_t ts, uint32_t op_index, bool begin)
+{
+  auto record = makeRecord(ts, op_index);
+  record.begin = begin ? 1 : 0;
+  return record;
+}
+
+} // namespace
+
+TEST(TraceBuffer, collect_sorted)
+{
+  TraceBuffer buffer;
+  buffer.push(makeRecord(30, 0));
+  buffer.push(makeRecord(10, 1));
+  buffer.push(makeRecord(20, 2));
+
+  const auto records = buffer.collect();
+  ASSERT_EQ(records.size(), 3);
+  ASSERT_EQ(records[0].op_index, 1);
+  ASSERT_EQ(records[1].op_index, 2);
+  ASSERT_EQ(records[2].op_index, 0);
+  ASSERT_EQ(buffer.dropped(), 0);
+}
+
+TEST(TraceBuffer, overwrite_oldest)
+{
+  TraceBuffer buffer{4};
+  for (uint32_t i = 0; i < 10; ++i)
+    buffer.push(makeRecord(i, i));
+
+  const auto records = buffer.collect();
+  ASSERT_EQ(records.size(), 4);
+  ASSERT_EQ(records.front().op_index, 6);
+  ASSERT_EQ(records.back().op_index, 9);
+  ASSERT_EQ(buffer.dropped(), 6);
+}
+
+TEST(TraceBuffer, multi_thread)
+{
+  constexpr uint32_t num_threads = 4;
+  constexpr uint32_t num_records = 1000;
+
+  TraceBuffer buffer;
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&buffer, t]() {
+      for (uint32_t i = 0; i < num_records; ++i)
+        buffer.push(makeRecord(i * num_threads + t, t));
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  const auto records = buffer.collect();
+  ASSERT_EQ(records.size(), num_threads * num_records);
+  for (size_t i = 0; i < records.size(); ++i)
+    ASSERT_EQ(records[i].ts, i);
+}
+
+TEST(TraceBuffer, neg_separate_buffers)
+{
+  // The ring cached for a thread must not be shared with another buffer
+  TraceBuffer buffer1;
+  TraceBuffer buffer2;
+  buffer1.push(makeRecord(0, 0));
+  buffer2.push(makeRecord(0, 1));
+  buffer1.push(makeRecord(1, 2));
+
+  ASSERT_EQ(buffer1.collect().size(), 2);
+  ASSERT_EQ(buffer2.collect().size(), 1);
+}
+
+TEST(TraceBuffer, collect_paired_merge_threads)
+{
+  // Each thread pushes to its own ring, and timestamps of threads interleave
+  TraceBuffer buffer;
+  std::thread thread0([&buffer]() {
+    buffer.push(makeEdge(0, 0, true));
+    buffer.push(makeEdge(3, 0, false));
+    buffer.push(makeEdge(4, 2, true));
+    buffer.push(makeEdge(7, 2, false));
+  });
+  std::thread thread1([&buffer]() {
+    buffer.push(makeEdge(1, 1, true));
+    buffer.push(makeEdge(2, 1, false));
+    buffer.push(makeEdge(5, 3, true));
+    buffer.push(makeEdge(6, 3, false));
+  });
+  thread0.join();
+  thread1.join();
+
+  const auto records = buffer.collectPaired();
+  ASSERT_EQ(records.size(), 8);
+  const std::vector<uint32_t> expected_ops{0, 1, 1, 0, 2, 3, 3, 2};
+  const std::vector<uint32_t> expected_begins{1, 1, 0, 0, 1, 1, 0, 0};
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    ASSERT_EQ(records[i].ts, i);
+    ASSERT_EQ(records[i].op_index, expected_ops[i]);
+    ASSERT_EQ(records[i].begin, expected_begins[i]);
+  }
+}
+
+TEST(TraceBuffer, collect_paired_nested)
+{
+  // Subgraph events of the same subgraph nest when the subgraph is called recursively
+  TraceBuffer buffer;
+  buffer.push(makeEdge(0, TraceRecord::kSubgraph, true));
+  buffer.push(makeEdge(1, TraceRecord::kSubgraph, true));
+  buffer.push(makeEdge(2, TraceRecord::kSubgraph, false));
+  buffer.push(makeEdge(3, TraceRecord::kSubgraph, false));
+
+  ASSERT_EQ(buffer.collectPaired().size(), 4);
+}
+
+TEST(TraceBuffer, neg_collect_paired_orphans)
+{
+  // Begin of op 0 is overwritten, and op 2 has not ended
+  TraceBuffer buffer{4};
+  buffer.push(makeEdge(0, 0, true));
+  buffer.push(makeEdge(1, 0, false));
+  buffer.push(makeEdge(2, 1, true));
+  buffer.push(makeEdge(3, 1, false));
+  buffer.push(makeEdge(4, 2, true));
+
+  ASSERT_EQ(buffer.collect().size(), 4);
+  const auto records = buffer.collectPaired();
+  ASSERT_EQ(records.size(), 2);
+  ASSERT_EQ(records[0].op_index, 1);
+  ASSERT_EQ(records[0].begin, 1);
+  ASSERT_EQ(records[1].op_index, 1);
+  ASSERT_EQ(records[1].begin, 0);
+}
+
+TEST(TraceBuffer, record_cost)
+{
+  // Each operation costs two events, and the result tells the shortest operation whose tracing
+  // overhead stays under 1%
+  constexpr uint32_t num_events = 1 << 16;
+  onert::util::TracingCtx tracing_ctx;
+  TraceBuffer buffer{num_events};
+  EventCollector collector{&buffer};
+  static int backend;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < num_events / 2; ++i)
+  {
+    collector.onEvent(
+      EventCollector::OpSeqEvent{&tracing_ctx, EventCollector::Edge::BEGIN, 0, &backend, i});
+    collector.onEvent(
+      EventCollector::OpSeqEvent{&tracing_ctx, EventCollector::Edge::END, 0, &backend, i});
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  const double event_ns =
+    std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(num_events);
+  RecordProperty("event_ns", std::to_string(event_ns));
+  RecordProperty("min_op_us_for_1_percent", std::to_string(2 * event_ns * 100 / 1000));
+  ASSERT_EQ(buffer.collectPaired().size(), num_events);
+  ASSERT_EQ(buffer.dropped(), 0);
+}
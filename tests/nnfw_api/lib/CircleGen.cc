@@ -139,6 +139,13 @@ uint32_t CircleGen::addOperatorAveragePool2D(const OperatorParams &params, circl
                                 circle::BuiltinOptions_Pool2DOptions, options);
 }
 
+uint32_t CircleGen::addOperatorBatchMatMul(const OperatorParams &params, bool adj_x, bool adj_y)
+{
+  auto options = circle::CreateBatchMatMulOptions(_fbb, adj_x, adj_y).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_BATCH_MATMUL,
+                                circle::BuiltinOptions_BatchMatMulOptions, options);
+}
+
 uint32_t CircleGen::addOperatorCast(const OperatorParams &params, circle::TensorType input_type,
                                     circle::TensorType output_type)
 {
@@ -174,6 +181,13 @@ uint32_t CircleGen::addOperatorCos(const OperatorParams &params)
                                 circle::BuiltinOptions_CosOptions, options);
 }
 
+uint32_t CircleGen::addOperatorDequantize(const OperatorParams &params)
+{
+  auto options = circle::CreateDequantizeOptions(_fbb).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_DEQUANTIZE,
+                                circle::BuiltinOptions_DequantizeOptions, options);
+}
+
 uint32_t CircleGen::addOperatorDepthToSpace(const OperatorParams &params, int32_t block_size)
 {
   auto options = circle::CreateDepthToSpaceOptions(_fbb, block_size).Union();
@@ -329,6 +343,12 @@ uint32_t CircleGen::addOperatorLeakyRelu(const OperatorParams &params, float alp
                                 circle::BuiltinOptions_LeakyReluOptions, options);
 }
 
+uint32_t CircleGen::addOperatorLogistic(const OperatorParams &params)
+{
+  return addOperatorWithOptions(params, circle::BuiltinOperator_LOGISTIC,
+                                circle::BuiltinOptions_NONE, 0);
+}
+
 uint32_t CircleGen::addOperatorLogSoftmax(const OperatorParams &params)
 {
   auto options = circle::CreateLogSoftmaxOptions(_fbb).Union();
@@ -477,6 +497,20 @@ uint32_t CircleGen::addOperatorShape(const OperatorParams &params, circle::Tenso
                                 circle::BuiltinOptions_RankOptions, options);
 }
 
+uint32_t CircleGen::addOperatorRmsNorm(const OperatorParams &params, float epsilon)
+{
+  auto options = circle::CreateRmsNormOptions(_fbb, epsilon).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_RMS_NORM,
+                                circle::BuiltinOptions_RmsNormOptions, options);
+}
+
+uint32_t CircleGen::addOperatorRoPE(const OperatorParams &params, circle::RoPEMode mode)
+{
+  auto options = circle::CreateRoPEOptions(_fbb, mode).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_ROPE,
+                                circle::BuiltinOptions_RoPEOptions, options);
+}
+
 uint32_t CircleGen::addOperatorSelect(const OperatorParams &params)
 {
   auto options = circle::CreateSelectOptions(_fbb).Union();
@@ -531,6 +565,12 @@ uint32_t CircleGen::addOperatorSub(const OperatorParams &params,
                                 circle::BuiltinOptions_SubOptions, options);
 }
 
+uint32_t CircleGen::addOperatorTanh(const OperatorParams &params)
+{
+  return addOperatorWithOptions(params, circle::BuiltinOperator_TANH, circle::BuiltinOptions_NONE,
+                                0);
+}
+
 uint32_t CircleGen::addOperatorTile(const OperatorParams &params)
 {
   auto options = circle::CreateTileOptions(_fbb).Union();
@@ -147,6 +147,7 @@ public:
   uint32_t addOperatorAveragePool2D(const OperatorParams &params, circle::Padding padding,
                                     int stride_w, int stride_h, int filter_w, int filter_h,
                                     circle::ActivationFunctionType actfn);
+  uint32_t addOperatorBatchMatMul(const OperatorParams &params, bool adj_x, bool adj_y);
   uint32_t addOperatorBatchToSpaceND(const OperatorParams &params);
   uint32_t addOperatorCast(const OperatorParams &params, circle::TensorType input_type,
                            circle::TensorType output_type);
@@ -156,6 +157,7 @@ public:
                              int stride_h, circle::ActivationFunctionType actfn, int dilation_w = 1,
                              int dilation_h = 1);
   uint32_t addOperatorCos(const OperatorParams &params);
+  uint32_t addOperatorDequantize(const OperatorParams &params);
   uint32_t addOperatorDepthToSpace(const OperatorParams &params, int32_t block_size);
   uint32_t addOperatorDepthwiseConv2D(const OperatorParams &params, circle::Padding padding,
                                       int stride_w, int stride_h, int depth_multiplier,
@@ -186,6 +188,7 @@ public:
   uint32_t addOperatorLeakyRelu(const OperatorParams &params, float alpha);
   uint32_t addOperatorLess(const OperatorParams &params);
   uint32_t addOperatorLessEqual(const OperatorParams &params);
+  uint32_t addOperatorLogistic(const OperatorParams &params);
   uint32_t addOperatorLogSoftmax(const OperatorParams &params);
   uint32_t addOperatorMul(const OperatorParams &params, circle::ActivationFunctionType actfn);
   uint32_t addOperatorMaxPool2D(const OperatorParams &params, circle::Padding padding, int stride_w,
@@ -212,6 +215,8 @@ public:
                                      bool half_pixel_centers = false);
   uint32_t addOperatorResizeNearestNeighbor(const OperatorParams &params);
   uint32_t addOperatorReverseV2(const OperatorParams &params);
+  uint32_t addOperatorRmsNorm(const OperatorParams &params, float epsilon);
+  uint32_t addOperatorRoPE(const OperatorParams &params, circle::RoPEMode mode);
   uint32_t addOperatorShape(const OperatorParams &params,
                             circle::TensorType type = circle::TensorType::TensorType_INT32);
   uint32_t addOperatorSelect(const OperatorParams &params);
@@ -225,6 +230,7 @@ public:
                                    int32_t end_mask = 0, int32_t ellipsis_mask = 0,
                                    int32_t new_axis_mask = 0, int32_t shrink_axis_mask = 0);
   uint32_t addOperatorSub(const OperatorParams &params, circle::ActivationFunctionType actfn);
+  uint32_t addOperatorTanh(const OperatorParams &params);
   uint32_t addOperatorTile(const OperatorParams &params);
   uint32_t addOperatorTranspose(const OperatorParams &params);
   uint32_t addOperatorWhile(const OperatorParams &params, uint32_t cond_subg, uint32_t body_subg);
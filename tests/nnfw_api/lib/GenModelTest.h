@@ -36,6 +36,8 @@ inline size_t sizeOfNnfwType(NNFW_TYPE type)
     case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
     case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
       return 1;
+    case NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+      return 2;
     case NNFW_TYPE_TENSOR_FLOAT32:
     case NNFW_TYPE_TENSOR_INT32:
       return 4;
@@ -414,6 +416,9 @@ protected:
             case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
               compareBuffersExact<int8_t>(ref_output, output, i);
               break;
+            case NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+              compareBuffersExact<int16_t>(ref_output, output, i);
+              break;
             case NNFW_TYPE_TENSOR_INT32:
               compareBuffersExact<int32_t>(ref_output, output, i);
               break;
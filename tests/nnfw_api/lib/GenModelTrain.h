@@ -20,6 +20,7 @@
 #include "GenModelTest.h"
 #include "CirclePlusGen.h"
 
+#include <map>
 #include <numeric>
 #include <tuple>
 
@@ -172,6 +173,15 @@ static TrainCaseData uniformTCD(const std::vector<std::vector<std::vector<T>>> &
   return ret;
 }
 
+/**
+ * @brief Runtime configs to train with, and how far their losses may be from the first set's
+ */
+struct TrainConfigSet
+{
+  std::map<std::string, std::string> configs;
+  float tolerance = 0.f;
+};
+
 /**
  * @brief A train configuration class
  */
@@ -179,7 +189,8 @@ class GenModelTrainContext : public GenModelTestContext
 {
 public:
   GenModelTrainContext(CircleBuffers &&cbufs)
-    : GenModelTestContext(std::move(cbufs.circle)), _cpbuf{std::move(cbufs.circle_plus)}, _epoch(0)
+    : GenModelTestContext(std::move(cbufs.circle)), _cpbuf{std::move(cbufs.circle_plus)}, _epoch(0),
+      _memory_budget(0), _config_sets(1)
   {
     // DO NOTHING
   }
@@ -216,10 +227,38 @@ public:
     _epoch = epoch;
   }
 
+  uint64_t memory_budget() const { return _memory_budget; }
+
+  /**
+   * @brief Set the memory budget for activations, which is not in circle plus
+   *
+   * @param memory_budget Bytes for activations kept for backwarding. 0 means no limit.
+   */
+  void setMemoryBudget(uint64_t memory_budget) { _memory_budget = memory_budget; }
+
+  const std::vector<TrainConfigSet> &config_sets() const { return _config_sets; }
+
+  /**
+   * @brief Add a set of configs to train with once more
+   *
+   * Train cases run once per config set in a new session, with the configs set by
+   * nnfw_set_config after training information. The first set has no configs. Its losses are
+   * checked against the expected losses, and losses of the other sets against the first set's.
+   *
+   * @param configs   Config names and values
+   * @param tolerance Max difference from losses of the first set, 0 means identical
+   */
+  void addConfigSet(const std::map<std::string, std::string> &configs, float tolerance = 0.f)
+  {
+    _config_sets.push_back({configs, tolerance});
+  }
+
 private:
   CircleBuffer _cpbuf;
   std::vector<TrainCaseData> _train_cases;
   int32_t _epoch;
+  uint64_t _memory_budget;
+  std::vector<TrainConfigSet> _config_sets;
 };
 
 /**
@@ -246,8 +285,21 @@ protected:
     ASSERT_EQ(_context->backends().size(), 1);
     ASSERT_STREQ(_context->backends()[0].c_str(), "train");
 
-    for (std::string backend : _context->backends())
+    // Each backend trains once per config set, the first set first
+    std::vector<std::pair<std::string, size_t>> runs;
+    for (const auto &backend : _context->backends())
+      for (size_t set_index = 0; set_index < _context->config_sets().size(); ++set_index)
+        runs.emplace_back(backend, set_index);
+
+    // Losses of the first config set, [train case * epoch][output]
+    std::vector<std::vector<float>> first_losses;
+    for (auto [backend, set_index] : runs)
     {
+      const auto &config_set = _context->config_sets()[set_index];
+      if (set_index == 0)
+        first_losses.clear();
+      size_t loss_index = 0;
+
       // NOTE If we can prepare many times for one model loading on same session,
       //      we can move nnfw_create_session to SetUp and
       //      nnfw_load_circle_from_buffer to outside forloop
@@ -304,8 +356,13 @@ protected:
 
         tri = LoadTrainInfo(circle_plus);
       }
+      tri.memory_budget = _context->memory_budget();
       NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(_so.session, &tri));
 
+      // Configs are set after training information, which would overwrite some of them
+      for (const auto &[key, value] : config_set.configs)
+        NNFW_ENSURE_SUCCESS(nnfw_set_config(_so.session, key.c_str(), value.c_str()));
+
       // prepare for training
       NNFW_ENSURE_SUCCESS(nnfw_train_prepare(_so.session));
 
@@ -411,13 +468,23 @@ protected:
 
           ASSERT_EQ(ref_losses[epoch].size(), actual_losses.size());
 
+          // The first config set is checked against expected losses, and the others against
+          // losses of the first one
+          if (set_index == 0)
+            first_losses.emplace_back(actual_losses);
+          const auto &expected_losses =
+            set_index == 0 ? ref_losses[epoch] : first_losses.at(loss_index);
+          const float tolerance = set_index == 0 ? 0.001f : config_set.tolerance;
+          ++loss_index;
+
           // TODO better way for handling FP error?
           for (uint32_t i = 0; i < actual_losses.size(); i++)
           {
             const float actual = actual_losses[i];
-            const float expected = ref_losses[epoch][i];
-            EXPECT_NEAR(expected, actual, 0.001)
-              << "Loss " << epoch + 1 << "/" << num_epoch << " #" << i;
+            const float expected = expected_losses[i];
+            EXPECT_NEAR(expected, actual, tolerance)
+              << "Loss " << epoch + 1 << "/" << num_epoch << " #" << i << " of config set "
+              << set_index;
           }
         }
       }
@@ -19,6 +19,8 @@
 
 #include <ggml.h>
 
+#include <cstring>
+
 bool tensorInfoEqual(const nnfw_tensorinfo &info1, const nnfw_tensorinfo &info2)
 {
   if (info1.dtype != info2.dtype)
@@ -41,22 +43,70 @@ uint64_t tensorInfoNumElements(const nnfw_tensorinfo &ti)
   return n;
 }
 
-std::vector<uint8_t> quantData(const std::vector<float> &buf_val, const circle::TensorType type)
+namespace
+{
+
+ggml_type ggmlType(const circle::TensorType type)
 {
   switch (type)
   {
     case circle::TensorType::TensorType_GGML_Q4_0:
-    {
-      size_t num_elems = buf_val.size();
-      const size_t block_size = ggml_blck_size(GGML_TYPE_Q4_0);
-      const int64_t num_block = num_elems / block_size;
-      const size_t block_struct_size = ggml_type_size(GGML_TYPE_Q4_0);
-
-      auto buf = std::vector<uint8_t>(num_block * block_struct_size);
-      ggml_quantize_chunk(GGML_TYPE_Q4_0, buf_val.data(), buf.data(), 0, 1, num_elems, nullptr);
-      return buf;
-    }
+      return GGML_TYPE_Q4_0;
+    case circle::TensorType::TensorType_GGML_Q8_0:
+      return GGML_TYPE_Q8_0;
     default:
       throw std::runtime_error("Unsupported tensor type");
   }
 }
+
+} // namespace
+
+std::vector<uint8_t> quantData(const std::vector<float> &buf_val, const circle::TensorType type)
+{
+  const auto ggml_type = ggmlType(type);
+  size_t num_elems = buf_val.size();
+  const size_t block_size = ggml_blck_size(ggml_type);
+  const int64_t num_block = num_elems / block_size;
+  const size_t block_struct_size = ggml_type_size(ggml_type);
+
+  auto buf = std::vector<uint8_t>(num_block * block_struct_size);
+  ggml_quantize_chunk(ggml_type, buf_val.data(), buf.data(), 0, 1, num_elems, nullptr);
+  return buf;
+}
+
+std::vector<float> dequantData(const std::vector<uint8_t> &buf, const circle::TensorType type)
+{
+  // Block layout (Q4_0, Q8_0): fp16 scale followed by 32 quantized values
+  //   Q4_0: value[j] = (low nibble of qs[j] - 8) * d, value[j + 16] = (high nibble of qs[j] - 8) * d
+  //   Q8_0: value[j] = (int8_t)qs[j] * d
+  const auto ggml_type = ggmlType(type);
+  const size_t block_size = ggml_blck_size(ggml_type);
+  const size_t block_struct_size = ggml_type_size(ggml_type);
+  const size_t num_block = buf.size() / block_struct_size;
+
+  std::vector<float> buf_val(num_block * block_size);
+  for (size_t b = 0; b < num_block; ++b)
+  {
+    const uint8_t *block = buf.data() + b * block_struct_size;
+    ggml_fp16_t d_half;
+    std::memcpy(&d_half, block, sizeof(d_half));
+    const float d = ggml_fp16_to_fp32(d_half);
+    const uint8_t *qs = block + sizeof(d_half);
+    float *out = buf_val.data() + b * block_size;
+
+    if (ggml_type == GGML_TYPE_Q4_0)
+    {
+      for (size_t j = 0; j < block_size / 2; ++j)
+      {
+        out[j] = ((qs[j] & 0x0F) - 8) * d;
+        out[j + block_size / 2] = ((qs[j] >> 4) - 8) * d;
+      }
+    }
+    else
+    {
+      for (size_t j = 0; j < block_size; ++j)
+        out[j] = static_cast<int8_t>(qs[j]) * d;
+    }
+  }
+  return buf_val;
+}
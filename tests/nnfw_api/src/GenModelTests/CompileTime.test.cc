@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains compile time benchmarks with large generated models.
+ *
+ * Each test records how long nnfw_prepare takes for each executor as a test property, and fails
+ * when it takes longer than a loose limit. The limit is far above the expected time so that loaded
+ * machines do not fail, but catches quadratic regressions. Set NNFW_API_TEST_MAX_PREPARE_SECONDS
+ * to change the limit, e.g. on emulators.
+ */
+
+#include "fixtures.h"
+
+#include <chrono>
+#include <cstdlib>
+
+namespace
+{
+
+constexpr double kDefaultMaxPrepareSeconds = 10.0;
+
+// Max compile time given by NNFW_API_TEST_MAX_PREPARE_SECONDS, or the default limit
+double maxPrepareSeconds()
+{
+  const char *limit = std::getenv("NNFW_API_TEST_MAX_PREPARE_SECONDS");
+  const double seconds = limit == nullptr ? 0.0 : std::atof(limit);
+  return seconds > 0 ? seconds : kDefaultMaxPrepareSeconds;
+}
+
+/**
+ * @brief Generate a model with @c num_ops Add operations where each operation reads the outputs
+ *        of the previous two operations, so that every operand has multiple consumers
+ *
+ *   (( in0 )) (( in1 ))
+ *        \     /  |
+ *        [ Add ]  |
+ *           |  \  |
+ *           |  [ Add ]
+ *           |  /  |
+ *          ...   ...
+ */
+CircleBuffer genLadderAddModel(int num_ops)
+{
+  CircleGen cgen;
+  const auto type = circle::TensorType::TensorType_FLOAT32;
+  int prev2 = cgen.addTensor({{1, 4}, type});
+  int prev1 = cgen.addTensor({{1, 4}, type});
+  const std::vector<int> inputs{prev2, prev1};
+  for (int i = 0; i < num_ops; ++i)
+  {
+    int out = cgen.addTensor({{1, 4}, type});
+    cgen.addOperatorAdd({{prev2, prev1}, {out}}, circle::ActivationFunctionType_NONE);
+    prev2 = prev1;
+    prev1 = out;
+  }
+  cgen.setInputsAndOutputs(inputs, {prev1});
+  return cgen.finish();
+}
+
+} // namespace
+
+class CompileTimeBenchmark : public ValidationTestSessionCreated,
+                             public ::testing::WithParamInterface<const char *>
+{
+};
+
+TEST_P(CompileTimeBenchmark, large_ladder_model)
+{
+  constexpr int num_ops = 3000;
+  const char *executor = GetParam();
+  auto cbuf = genLadderAddModel(num_ops);
+
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "EXECUTOR", executor));
+
+  const auto begin = std::chrono::steady_clock::now();
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+  const auto end = std::chrono::steady_clock::now();
+  const double seconds = std::chrono::duration<double>(end - begin).count();
+
+  RecordProperty("executor", executor);
+  RecordProperty("num_ops", num_ops);
+  RecordProperty("prepare_ms", static_cast<int>(seconds * 1000));
+  ASSERT_LT(seconds, maxPrepareSeconds())
+    << executor << " executor took " << seconds << " s to prepare " << num_ops << " ops";
+
+  // Compiled model must still run
+  std::vector<float> in0(4, 0), in1(4, 0), out(4, -1);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, in0.data(),
+                                     in0.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 1, NNFW_TYPE_TENSOR_FLOAT32, in1.data(),
+                                     in1.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, out.data(), out.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_EQ(out, std::vector<float>(4, 0));
+}
+
+TEST_P(CompileTimeBenchmark, ladder_model_result)
+{
+  // Each output is the sum of the previous two, so the result is a Fibonacci number. It is exact
+  // only if every operation runs once, after both of its producers.
+  constexpr int num_ops = 30;
+  const char *executor = GetParam();
+  auto cbuf = genLadderAddModel(num_ops);
+
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "EXECUTOR", executor));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  std::vector<float> in0(4, 1), in1(4, 1), out(4, -1);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, in0.data(),
+                                     in0.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 1, NNFW_TYPE_TENSOR_FLOAT32, in1.data(),
+                                     in1.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, out.data(), out.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  // F(num_ops + 2) with F(1) = F(2) = 1, which is exactly representable in float
+  ASSERT_EQ(out, std::vector<float>(4, 2178309.f));
+}
+
+INSTANTIATE_TEST_SUITE_P(GenModelTest, CompileTimeBenchmark,
+                         ::testing::Values("Linear", "Dataflow", "Parallel"));
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "common.h"
+#include "CircleGen.h"
+
+#include <thread>
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 4], dtype=float)
+ *       #1 = const (shape = [1, 4], dtype=float)
+ *       #2 = add(#0, #1)
+ */
+auto build_model_batching_add()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  uint32_t rhs_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int lhs = cgen.addTensor({{1, 4}, f32});
+  int rhs = cgen.addTensor({{1, 4}, f32, rhs_buf});
+  int out = cgen.addTensor({{1, 4}, f32});
+  cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs}, {out});
+  return cgen.finish();
+}
+
+TEST(TestBatching, concurrent_requests)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_batching_add();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_batching(session, 4, 10000));
+
+  constexpr uint32_t thread_count = 8;
+  std::vector<char> results(thread_count, 0);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      const float v = static_cast<float>(t);
+      std::vector<float> input{v, v, v, v};
+      std::vector<float> output(4);
+      const void *inputs[] = {input.data()};
+      void *outputs[] = {output.data()};
+      if (nnfw_run_batched(session, inputs, outputs) != NNFW_STATUS_NO_ERROR)
+        return;
+      results[t] = output == std::vector<float>{v + 1, v + 2, v + 3, v + 4};
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (uint32_t t = 0; t < thread_count; ++t)
+    EXPECT_TRUE(results[t]) << "request " << t;
+
+  nnfw_batching_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_batching_stats(session, &stats));
+  EXPECT_EQ(stats.request_count, thread_count);
+  EXPECT_GE(stats.batch_count, 2u);
+  EXPECT_LE(stats.batch_count, thread_count);
+
+  // Normal run is not allowed on batching session
+  ASSERT_EQ(nnfw_run(session), NNFW_STATUS_INVALID_STATE);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestBatching, neg_zero_max_batch)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_batching_add();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+
+  ASSERT_EQ(nnfw_prepare_batching(session, 0, 1000), NNFW_STATUS_ERROR);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestBatching, neg_run_before_prepare)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_batching_add();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  float input[4] = {};
+  float output[4] = {};
+  const void *inputs[] = {input};
+  void *outputs[] = {output};
+  ASSERT_EQ(nnfw_run_batched(session, inputs, outputs), NNFW_STATUS_INVALID_STATE);
+
+  nnfw_batching_stats stats;
+  ASSERT_EQ(nnfw_get_batching_stats(session, &stats), NNFW_STATUS_INVALID_STATE);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
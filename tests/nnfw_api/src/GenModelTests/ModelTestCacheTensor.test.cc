@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "common.h"
+#include "CircleGen.h"
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, N, 2], dtype=float) // cache of previous steps
+ *       #1 = placeholder (shape = [1, 1, 2], dtype=float) // new token
+ *       #2 = concat(#0, #1, axis=1)                      // updated cache, model output 0
+ *       #3 = sum(#2, axis=1)                             // model output 1
+ */
+auto build_model_cache_concat()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  uint32_t axis_buf = cgen.addBuffer(std::vector<int32_t>{1});
+  int cache_in = cgen.addTensor({{1, 1, 2}, f32});
+  int token = cgen.addTensor({{1, 1, 2}, f32});
+  int cache_out = cgen.addTensor({{1, 2, 2}, f32});
+  int axis = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, axis_buf});
+  int sum = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorConcatenation({{cache_in, token}, {cache_out}}, 1,
+                                circle::ActivationFunctionType_NONE);
+  cgen.addOperatorReduce({{cache_out, axis}, {sum}}, circle::BuiltinOperator_SUM, false);
+  cgen.setInputsAndOutputs({cache_in, token}, {cache_out, sum});
+  return cgen.finish();
+}
+
+TEST(TestCacheTensor, incremental_concat)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_cache_concat();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  // Cache is zero-filled [1, 1, 2] at first, and grows up to [1, 8, 2]
+  nnfw_tensorinfo max_info = {NNFW_TYPE_TENSOR_FLOAT32, 3, {1, 8, 2}};
+  NNFW_ENSURE_SUCCESS(nnfw_set_cache_tensor(session, 0, 0, &max_info));
+
+  std::vector<float> token(2);
+  std::vector<float> sum(2);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 1, NNFW_TYPE_TENSOR_FLOAT32, token.data(),
+                                     sizeof(float) * token.size()));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(session, 1, NNFW_TYPE_TENSOR_FLOAT32, sum.data(), sizeof(float) * sum.size()));
+
+  const std::vector<std::vector<float>> tokens = {{1, 2}, {3, 4}, {5, 6}};
+  const std::vector<std::vector<float>> expected = {{1, 2}, {4, 6}, {9, 12}};
+  for (uint32_t step = 0; step < tokens.size(); ++step)
+  {
+    token = tokens[step];
+    NNFW_ENSURE_SUCCESS(nnfw_run(session));
+    ASSERT_EQ(sum, expected[step]);
+
+    // Input shape of the cache follows output shape of the step
+    nnfw_tensorinfo ti_cache = {};
+    NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &ti_cache));
+    ASSERT_EQ(ti_cache.rank, 3);
+    ASSERT_EQ(ti_cache.dims[1], static_cast<int32_t>(step + 2));
+  }
+
+  // Start new sequence
+  NNFW_ENSURE_SUCCESS(nnfw_reset_cache_tensors(session));
+  token = {7, 8};
+  NNFW_ENSURE_SUCCESS(nnfw_run(session));
+  ASSERT_EQ(sum, (std::vector<float>{7, 8}));
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestCacheTensor, incremental_concat_reserve)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_cache_concat();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  // Dynamic tensors depending on the cache reuse their memory while the cache grows
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "RESERVE_DYNAMIC_TENSORS", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  nnfw_tensorinfo max_info = {NNFW_TYPE_TENSOR_FLOAT32, 3, {1, 8, 2}};
+  NNFW_ENSURE_SUCCESS(nnfw_set_cache_tensor(session, 0, 0, &max_info));
+
+  std::vector<float> token(2);
+  std::vector<float> sum(2);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 1, NNFW_TYPE_TENSOR_FLOAT32, token.data(),
+                                     sizeof(float) * token.size()));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(session, 1, NNFW_TYPE_TENSOR_FLOAT32, sum.data(), sizeof(float) * sum.size()));
+
+  // Run two sequences, the second one on memory reserved by the first one
+  for (int sequence = 0; sequence < 2; ++sequence)
+  {
+    NNFW_ENSURE_SUCCESS(nnfw_reset_cache_tensors(session));
+    std::vector<float> expected = {0, 0};
+    for (uint32_t step = 0; step < 7; ++step)
+    {
+      token = {static_cast<float>(step), static_cast<float>(step * 2)};
+      expected[0] += token[0];
+      expected[1] += token[1];
+      NNFW_ENSURE_SUCCESS(nnfw_run(session));
+      ASSERT_EQ(sum, expected);
+    }
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 3, 2], dtype=float) // fixed-size cache of last 3 steps
+ *       #1 = placeholder (shape = [1, 1, 2], dtype=float) // new token
+ *       #2 = slice(#0, begin=[0, 1, 0], size=[1, 2, 2])  // drop the oldest step
+ *       #3 = concat(#2, #1, axis=1)                      // updated cache, model output 0
+ *       #4 = sum(#3, axis=1)                             // model output 1
+ */
+auto build_model_cache_window()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  auto i32 = circle::TensorType::TensorType_INT32;
+  uint32_t begin_buf = cgen.addBuffer(std::vector<int32_t>{0, 1, 0});
+  uint32_t size_buf = cgen.addBuffer(std::vector<int32_t>{1, 2, 2});
+  uint32_t axis_buf = cgen.addBuffer(std::vector<int32_t>{1});
+  int cache_in = cgen.addTensor({{1, 3, 2}, f32});
+  int token = cgen.addTensor({{1, 1, 2}, f32});
+  int begin = cgen.addTensor({{3}, i32, begin_buf});
+  int size = cgen.addTensor({{3}, i32, size_buf});
+  int sliced = cgen.addTensor({{1, 2, 2}, f32});
+  int cache_out = cgen.addTensor({{1, 3, 2}, f32});
+  int axis = cgen.addTensor({{1}, i32, axis_buf});
+  int sum = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorSlice({{cache_in, begin, size}, {sliced}});
+  cgen.addOperatorConcatenation({{sliced, token}, {cache_out}}, 1,
+                                circle::ActivationFunctionType_NONE);
+  cgen.addOperatorReduce({{cache_out, axis}, {sum}}, circle::BuiltinOperator_SUM, false);
+  cgen.setInputsAndOutputs({cache_in, token}, {cache_out, sum});
+  return cgen.finish();
+}
+
+TEST(TestCacheTensor, fixed_size_window)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_cache_window();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  nnfw_tensorinfo max_info = {NNFW_TYPE_TENSOR_FLOAT32, 3, {1, 3, 2}};
+  NNFW_ENSURE_SUCCESS(nnfw_set_cache_tensor(session, 0, 0, &max_info));
+
+  std::vector<float> token(2);
+  std::vector<float> sum(2);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 1, NNFW_TYPE_TENSOR_FLOAT32, token.data(),
+                                     sizeof(float) * token.size()));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(session, 1, NNFW_TYPE_TENSOR_FLOAT32, sum.data(), sizeof(float) * sum.size()));
+
+  const std::vector<std::vector<float>> tokens = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+  const std::vector<std::vector<float>> expected = {{1, 2}, {4, 6}, {9, 12}, {15, 18}};
+  for (uint32_t step = 0; step < tokens.size(); ++step)
+  {
+    token = tokens[step];
+    NNFW_ENSURE_SUCCESS(nnfw_run(session));
+    ASSERT_EQ(sum, expected[step]);
+
+    // Input shape of the cache is kept
+    nnfw_tensorinfo ti_cache = {};
+    NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &ti_cache));
+    ASSERT_EQ(ti_cache.rank, 3);
+    ASSERT_EQ(ti_cache.dims[1], 3);
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestCacheTensor, neg_set_before_prepare)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_cache_concat();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+
+  nnfw_tensorinfo max_info = {NNFW_TYPE_TENSOR_FLOAT32, 3, {1, 8, 2}};
+  ASSERT_EQ(nnfw_set_cache_tensor(session, 0, 0, &max_info), NNFW_STATUS_INVALID_STATE);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestCacheTensor, neg_invalid_info)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_cache_concat();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  // Type mismatch
+  nnfw_tensorinfo int_info = {NNFW_TYPE_TENSOR_INT32, 3, {1, 8, 2}};
+  ASSERT_EQ(nnfw_set_cache_tensor(session, 0, 0, &int_info), NNFW_STATUS_ERROR);
+  // Smaller than current input
+  nnfw_tensorinfo small_info = {NNFW_TYPE_TENSOR_FLOAT32, 1, {1}};
+  ASSERT_EQ(nnfw_set_cache_tensor(session, 0, 0, &small_info), NNFW_STATUS_ERROR);
+  // Out of range
+  nnfw_tensorinfo max_info = {NNFW_TYPE_TENSOR_FLOAT32, 3, {1, 8, 2}};
+  ASSERT_EQ(nnfw_set_cache_tensor(session, 2, 0, &max_info), NNFW_STATUS_ERROR);
+  // Bound twice
+  NNFW_ENSURE_SUCCESS(nnfw_set_cache_tensor(session, 0, 0, &max_info));
+  ASSERT_EQ(nnfw_set_cache_tensor(session, 0, 0, &max_info), NNFW_STATUS_ERROR);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "common.h"
+#include "CircleGen.h"
+
+#include <thread>
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 4], dtype=float)
+ *       #1 = const (shape = [1, 4], dtype=float) // weight shared by contexts
+ *       #2 = mul(#0, #1)
+ *       #3 = add(#2, #0)
+ */
+auto build_model_shared_weight()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  uint32_t weight_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int in = cgen.addTensor({{1, 4}, f32});
+  int weight = cgen.addTensor({{1, 4}, f32, weight_buf});
+  int mul = cgen.addTensor({{1, 4}, f32});
+  int out = cgen.addTensor({{1, 4}, f32});
+  cgen.addOperatorMul({{in, weight}, {mul}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorAdd({{mul, in}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+TEST(TestExecutionContext, concurrent_run)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "EXECUTION_CONTEXT_ENABLE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  constexpr uint32_t context_count = 4;
+  std::vector<nnfw_session *> contexts(context_count, nullptr);
+  for (auto &context : contexts)
+    NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(session, &context));
+
+  // Each thread runs its own context with different inputs
+  std::vector<char> results(context_count, 0);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < context_count; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      auto context = contexts[t];
+      std::vector<float> input(4);
+      std::vector<float> output(4);
+      if (nnfw_set_input(context, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                         sizeof(float) * input.size()) != NNFW_STATUS_NO_ERROR ||
+          nnfw_set_output(context, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                          sizeof(float) * output.size()) != NNFW_STATUS_NO_ERROR)
+        return;
+
+      bool ok = true;
+      for (uint32_t step = 0; step < 16; ++step)
+      {
+        const float v = static_cast<float>(t * 100 + step);
+        input = {v, v, v, v};
+        if (nnfw_run(context) != NNFW_STATUS_NO_ERROR)
+          return;
+        ok = ok && (output == std::vector<float>{2 * v, 3 * v, 4 * v, 5 * v});
+      }
+      results[t] = ok;
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (uint32_t t = 0; t < context_count; ++t)
+    EXPECT_TRUE(results[t]) << "context " << t;
+
+  // Original session still works
+  std::vector<float> input{1, 1, 1, 1};
+  std::vector<float> output(4);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                                     sizeof(float) * input.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                      sizeof(float) * output.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_run(session));
+  ASSERT_EQ(output, (std::vector<float>{2, 3, 4, 5}));
+
+  for (auto context : contexts)
+    NNFW_ENSURE_SUCCESS(nnfw_close_session(context));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+// Run session for steps with inputs from base, and check outputs of all steps
+bool run_steps(nnfw_session *session, float base, uint32_t steps)
+{
+  std::vector<float> input(4);
+  std::vector<float> output(4);
+  if (nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                     sizeof(float) * input.size()) != NNFW_STATUS_NO_ERROR ||
+      nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                      sizeof(float) * output.size()) != NNFW_STATUS_NO_ERROR)
+    return false;
+
+  bool ok = true;
+  for (uint32_t step = 0; step < steps; ++step)
+  {
+    const float v = base + static_cast<float>(step);
+    input = {v, v, v, v};
+    if (nnfw_run(session) != NNFW_STATUS_NO_ERROR)
+      return false;
+    ok = ok && (output == std::vector<float>{2 * v, 3 * v, 4 * v, 5 * v});
+  }
+  return ok;
+}
+
+TEST(TestExecutionContext, concurrent_create_and_run)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "EXECUTION_CONTEXT_ENABLE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  // Two threads create their contexts at the same time, and run them while the original
+  // session runs on the main thread
+  constexpr uint32_t context_count = 2;
+  std::vector<nnfw_session *> contexts(context_count, nullptr);
+  std::vector<char> results(context_count, 0);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < context_count; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      if (nnfw_create_execution_context(session, &contexts[t]) != NNFW_STATUS_NO_ERROR)
+        return;
+      results[t] = run_steps(contexts[t], static_cast<float>((t + 1) * 100), 32);
+    });
+  }
+  const bool session_result = run_steps(session, 0, 32);
+  for (auto &thread : threads)
+    thread.join();
+
+  EXPECT_TRUE(session_result);
+  for (uint32_t t = 0; t < context_count; ++t)
+    EXPECT_TRUE(results[t]) << "context " << t;
+
+  for (auto context : contexts)
+  {
+    if (context)
+      NNFW_ENSURE_SUCCESS(nnfw_close_session(context));
+  }
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestExecutionContext, neg_before_prepare)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+
+  nnfw_session *context = nullptr;
+  ASSERT_EQ(nnfw_create_execution_context(session, &context), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(context, nullptr);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestExecutionContext, neg_without_config)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  // Lowering result is not kept without EXECUTION_CONTEXT_ENABLE
+  nnfw_session *context = nullptr;
+  ASSERT_EQ(nnfw_create_execution_context(session, &context), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(context, nullptr);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestExecutionContext, neg_null_context)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  ASSERT_EQ(nnfw_create_execution_context(session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_create_execution_context(nullptr, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestExecutionContext, context_outlives_session)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "EXECUTION_CONTEXT_ENABLE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  nnfw_session *context = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(session, &context));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+
+  // Weights shared with the closed session are still alive
+  ASSERT_TRUE(run_steps(context, 1, 4));
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(context));
+}
+
+TEST(TestExecutionContext, neg_context_of_context)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_shared_weight();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "EXECUTION_CONTEXT_ENABLE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  nnfw_session *context = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(session, &context));
+  nnfw_session *context_of_context = nullptr;
+  ASSERT_EQ(nnfw_create_execution_context(context, &context_of_context),
+            NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(context_of_context, nullptr);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(context));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains GenModelTest test cases of models with FLOAT16 tensors.
+ *
+ * nnfw API has no FLOAT16 input or output type, so models cast their FLOAT32 inputs and outputs.
+ * Values are chosen to be exact in FLOAT16.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+namespace
+{
+
+// IEEE binary16 encodings
+constexpr uint16_t kF16Zero = 0x0000;
+constexpr uint16_t kF16Quarter = 0x3400;
+constexpr uint16_t kF16Half = 0x3800;
+constexpr uint16_t kF16One = 0x3C00;
+constexpr uint16_t kF16Two = 0x4000;
+constexpr uint16_t kF16MinusHalf = 0xB800;
+constexpr uint16_t kF16MinusOne = 0xBC00;
+constexpr uint16_t kF16MinusTwo = 0xC000;
+
+} // namespace
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 4], dtype=float32)
+ *       #1 = cast(#0)                       // float16
+ *       #2 = fully_connected(#1, W, B)      // float16 weights and bias
+ *       #3 = add(#2, C)                     // float16
+ *       #4 = cast(#3)                       // float32, model output
+ */
+TEST_F(GenModelTest, Float16_FullyConnected_Add)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  // W = [[1, 2, 0.5, -1], [0.25, 0, -2, 1]], B = [1, -0.5], C = [0.5, 2]
+  uint32_t weight_buf = cgen.addBuffer(std::vector<uint16_t>{
+    kF16One, kF16Two, kF16Half, kF16MinusOne, kF16Quarter, kF16Zero, kF16MinusTwo, kF16One});
+  uint32_t bias_buf = cgen.addBuffer(std::vector<uint16_t>{kF16One, kF16MinusHalf});
+  uint32_t addend_buf = cgen.addBuffer(std::vector<uint16_t>{kF16Half, kF16Two});
+  int in = cgen.addTensor({{1, 4}, f32});
+  int in16 = cgen.addTensor({{1, 4}, f16});
+  int weight = cgen.addTensor({{2, 4}, f16, weight_buf});
+  int bias = cgen.addTensor({{2}, f16, bias_buf});
+  int fc16 = cgen.addTensor({{1, 2}, f16});
+  int addend = cgen.addTensor({{1, 2}, f16, addend_buf});
+  int out16 = cgen.addTensor({{1, 2}, f16});
+  int out = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorCast({{in}, {in16}}, f32, f16);
+  cgen.addOperatorFullyConnected({{in16, weight, bias}, {fc16}});
+  cgen.addOperatorAdd({{fc16, addend}, {out16}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorCast({{out16}, {out}}, f16, f32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4}}, {{4, -0.25}}));
+  _context->addTestCase(uniformTCD<float>({{-2, 0.5, 1, 0}}, {{1, -1}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+/**
+ * @brief Testing the following model, as fp16 quantized models of TFLite are:
+ *       #0 = placeholder (shape = [1, 4], dtype=float32)
+ *       #1 = dequantize(W)                  // float16 weights to float32
+ *       #2 = fully_connected(#0, #1)        // float32, model output
+ */
+TEST_F(GenModelTest, Float16_Dequantize_FullyConnected)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  uint32_t weight_buf = cgen.addBuffer(std::vector<uint16_t>{
+    kF16One, kF16Two, kF16Half, kF16MinusOne, kF16Quarter, kF16Zero, kF16MinusTwo, kF16One});
+  int in = cgen.addTensor({{1, 4}, f32});
+  int weight16 = cgen.addTensor({{2, 4}, f16, weight_buf});
+  int weight = cgen.addTensor({{2, 4}, f32});
+  int out = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorDequantize({{weight16}, {weight}});
+  cgen.addOperatorFullyConnected({{in, weight, -1}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4}}, {{2.5, -1.75}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 2, 3], dtype=float32)
+ *       #1 = placeholder (shape = [1, 3, 2], dtype=float32)
+ *       #2 = cast(#0), #3 = cast(#1)        // float16
+ *       #4 = batch_matmul(#2, #3)           // float16
+ *       #5 = cast(#4)                       // float32, model output
+ */
+TEST_F(GenModelTest, Float16_BatchMatMul)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  int lhs = cgen.addTensor({{1, 2, 3}, f32});
+  int rhs = cgen.addTensor({{1, 3, 2}, f32});
+  int lhs16 = cgen.addTensor({{1, 2, 3}, f16});
+  int rhs16 = cgen.addTensor({{1, 3, 2}, f16});
+  int out16 = cgen.addTensor({{1, 2, 2}, f16});
+  int out = cgen.addTensor({{1, 2, 2}, f32});
+  cgen.addOperatorCast({{lhs}, {lhs16}}, f32, f16);
+  cgen.addOperatorCast({{rhs}, {rhs16}}, f32, f16);
+  cgen.addOperatorBatchMatMul({{lhs16, rhs16}, {out16}}, false, false);
+  cgen.addOperatorCast({{out16}, {out}}, f16, f32);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{1, 2, 3, 4, 5, 6}, {1, 0, 0, 1, 1, 1}}, {{4, 5, 10, 11}}));
+  _context->addTestCase(uniformTCD<float>({{0.5, -1, 2, 0, 0.25, -2}, {2, 1, -1, 0.5, 0.5, -1}},
+                                          {{3, -2, -1.25, 2.125}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 3, 3, 1], dtype=float32)
+ *       #1 = cast(#0)                       // float16
+ *       #2 = conv2d(#1, K, B)               // float16 kernel [1, 2, 2, 1] and bias, VALID
+ *       #3 = cast(#2)                       // float32, model output
+ */
+TEST_F(GenModelTest, Float16_Conv2D)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  // K = [[1, 0], [0, 1]], B = [0.5]
+  uint32_t kernel_buf =
+    cgen.addBuffer(std::vector<uint16_t>{kF16One, kF16Zero, kF16Zero, kF16One});
+  uint32_t bias_buf = cgen.addBuffer(std::vector<uint16_t>{kF16Half});
+  int in = cgen.addTensor({{1, 3, 3, 1}, f32});
+  int in16 = cgen.addTensor({{1, 3, 3, 1}, f16});
+  int kernel = cgen.addTensor({{1, 2, 2, 1}, f16, kernel_buf});
+  int bias = cgen.addTensor({{1}, f16, bias_buf});
+  int out16 = cgen.addTensor({{1, 2, 2, 1}, f16});
+  int out = cgen.addTensor({{1, 2, 2, 1}, f32});
+  cgen.addOperatorCast({{in}, {in16}}, f32, f16);
+  cgen.addOperatorConv2D({{in16, kernel, bias}, {out16}}, circle::Padding_VALID, 1, 1,
+                         circle::ActivationFunctionType_NONE);
+  cgen.addOperatorCast({{out16}, {out}}, f16, f32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{1, 2, 3, 4, 5, 6, 7, 8, 9}}, {{6.5, 8.5, 12.5, 14.5}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 2, 2, 2], dtype=float32)
+ *       #1 = cast(#0)                       // float16
+ *       #2 = depthwise_conv2d(#1, K, B)     // float16 kernel [1, 2, 2, 2] and bias, VALID
+ *       #3 = cast(#2)                       // float32, model output
+ */
+TEST_F(GenModelTest, Float16_DepthwiseConv2D)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  // K of channel 0 = [[1, 1], [1, 1]], K of channel 1 = [[2, 0], [-1, 0.5]], B = [0, 1]
+  uint32_t kernel_buf = cgen.addBuffer(std::vector<uint16_t>{
+    kF16One, kF16Two, kF16One, kF16Zero, kF16One, kF16MinusOne, kF16One, kF16Half});
+  uint32_t bias_buf = cgen.addBuffer(std::vector<uint16_t>{kF16Zero, kF16One});
+  int in = cgen.addTensor({{1, 2, 2, 2}, f32});
+  int in16 = cgen.addTensor({{1, 2, 2, 2}, f16});
+  int kernel = cgen.addTensor({{1, 2, 2, 2}, f16, kernel_buf});
+  int bias = cgen.addTensor({{2}, f16, bias_buf});
+  int out16 = cgen.addTensor({{1, 1, 1, 2}, f16});
+  int out = cgen.addTensor({{1, 1, 1, 2}, f32});
+  cgen.addOperatorCast({{in}, {in16}}, f32, f16);
+  cgen.addOperatorDepthwiseConv2D({{in16, kernel, bias}, {out16}}, circle::Padding_VALID, 1, 1, 1,
+                                  circle::ActivationFunctionType_NONE);
+  cgen.addOperatorCast({{out16}, {out}}, f16, f32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4, 5, 6, 7, 8}}, {{16, 3}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+/**
+ * @brief Testing the following model:
+ *       #0 = placeholder (shape = [1, 4], dtype=float32)
+ *       #1 = cast(#0)                       // float16
+ *       #2 = softmax(#1)                    // float16
+ *       #3 = cast(#2)                       // float32, model output
+ */
+TEST_F(GenModelTest, Float16_Softmax)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  int in = cgen.addTensor({{1, 4}, f32});
+  int in16 = cgen.addTensor({{1, 4}, f16});
+  int out16 = cgen.addTensor({{1, 4}, f16});
+  int out = cgen.addTensor({{1, 4}, f32});
+  cgen.addOperatorCast({{in}, {in16}}, f32, f16);
+  cgen.addOperatorSoftmax({{in16}, {out16}}, 1.0);
+  cgen.addOperatorCast({{out16}, {out}}, f16, f32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 1, -20, -20}}, {{0.5, 0.5, 0, 0}}));
+  // 1.0986328125 is ln(3) rounded to FLOAT16
+  _context->addTestCase(uniformTCD<float>({{0, 1.0986328125, 0, 1.0986328125}},
+                                          {{0.125, 0.375, 0.125, 0.375}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+/**
+ * @brief BatchMatMul does not mix FLOAT16 with another type
+ */
+TEST_F(GenModelTest, neg_Float16_BatchMatMul_MixedType)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  int lhs = cgen.addTensor({{1, 2, 3}, f32});
+  int rhs = cgen.addTensor({{1, 3, 2}, f32});
+  int lhs16 = cgen.addTensor({{1, 2, 3}, f16});
+  int out = cgen.addTensor({{1, 2, 2}, f32});
+  cgen.addOperatorCast({{lhs}, {lhs16}}, f32, f16);
+  cgen.addOperatorBatchMatMul({{lhs16, rhs}, {out}}, false, false);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_Float16_Cast_Int32)
+{
+  CircleGen cgen;
+  const auto f16 = circle::TensorType::TensorType_FLOAT16;
+  const auto i32 = circle::TensorType::TensorType_INT32;
+  int in = cgen.addTensor({{1, 4}, i32});
+  int in16 = cgen.addTensor({{1, 4}, f16});
+  int out = cgen.addTensor({{1, 4}, i32});
+  cgen.addOperatorCast({{in}, {in16}}, i32, f16);
+  cgen.addOperatorCast({{in16}, {out}}, f16, i32);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixtures.h"
+
+#include <numeric>
+
+namespace
+{
+
+/**
+ * @brief Generate a model with @c num_branches FullyConnected operations which read the same
+ *        input and can run at once, and a chain of Add operations which sums their outputs
+ *
+ * Weights of the i-th branch are all (i + 1), so each output element is
+ * (1 + 2 + ... + num_branches) * sum(input).
+ */
+CircleBuffer genWideFullyConnectedModel(int num_branches, int size)
+{
+  CircleGen cgen;
+  const auto type = circle::TensorType::TensorType_FLOAT32;
+  int input = cgen.addTensor({{1, size}, type});
+  uint32_t bias_buf = cgen.addBuffer(std::vector<float>(size, 0.f));
+  int bias = cgen.addTensor({{size}, type, bias_buf});
+  int sum = -1;
+  for (int i = 0; i < num_branches; ++i)
+  {
+    std::vector<float> weight_data(size * size, static_cast<float>(i + 1));
+    uint32_t weight_buf = cgen.addBuffer(weight_data);
+    int weight = cgen.addTensor({{size, size}, type, weight_buf});
+    int branch = cgen.addTensor({{1, size}, type});
+    cgen.addOperatorFullyConnected({{input, weight, bias}, {branch}});
+    if (sum == -1)
+    {
+      sum = branch;
+      continue;
+    }
+    int out = cgen.addTensor({{1, size}, type});
+    cgen.addOperatorAdd({{sum, branch}, {out}}, circle::ActivationFunctionType_NONE);
+    sum = out;
+  }
+  cgen.setInputsAndOutputs({input}, {sum});
+  return cgen.finish();
+}
+
+} // namespace
+
+TEST_F(ValidationTestSessionCreated, ParallelExecutor_concurrent_workers)
+{
+  constexpr int num_branches = 8;
+  constexpr int size = 16;
+  auto cbuf = genWideFullyConnectedModel(num_branches, size);
+
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "EXECUTOR", "Parallel"));
+  // Several workers run kernels of the cpu backend at once, so they must not share a ruy context
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "PARALLEL_NUM_WORKERS", "4"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  std::vector<float> input(size);
+  std::iota(input.begin(), input.end(), 1.f);
+  const float input_sum = std::accumulate(input.begin(), input.end(), 0.f);
+  const float expected = num_branches * (num_branches + 1) / 2 * input_sum;
+
+  std::vector<float> output(size);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                                     input.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                      output.size() * sizeof(float)));
+  for (int run = 0; run < 10; ++run)
+  {
+    std::fill(output.begin(), output.end(), 0.f);
+    NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+    ASSERT_EQ(output, std::vector<float>(size, expected));
+  }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTrain.h"
+
+namespace
+{
+
+// (( Input )) -> [ FC ] -> [ Relu ] -> [ FC ] -> [ Relu ] -> [ FC ] -> (( Output ))
+CircleBuffers genFCReluChain()
+{
+  CirclePlusGen cgen;
+
+  std::vector<float> weight1_data(8 * 2);
+  for (int i = 0; i < 8 * 2; ++i)
+    weight1_data[i] = 0.1f * (i % 5) - 0.2f;
+  std::vector<float> weight2_data(8 * 8);
+  std::vector<float> weight3_data(8 * 8);
+  for (int i = 0; i < 8 * 8; ++i)
+  {
+    weight2_data[i] = 0.05f * (i % 7) - 0.15f;
+    weight3_data[i] = 0.05f * (i % 5) - 0.1f;
+  }
+  uint32_t weight1_buf = cgen.addBuffer(weight1_data);
+  uint32_t weight2_buf = cgen.addBuffer(weight2_data);
+  uint32_t weight3_buf = cgen.addBuffer(weight3_data);
+  uint32_t bias1_buf = cgen.addBuffer(std::vector<float>(8, 0.f));
+  uint32_t bias2_buf = cgen.addBuffer(std::vector<float>(8, 0.f));
+  uint32_t bias3_buf = cgen.addBuffer(std::vector<float>(8, 0.f));
+
+  int input = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_FLOAT32});
+  int weight1 = cgen.addTensor({{8, 2}, circle::TensorType::TensorType_FLOAT32, weight1_buf});
+  int weight2 = cgen.addTensor({{8, 8}, circle::TensorType::TensorType_FLOAT32, weight2_buf});
+  int weight3 = cgen.addTensor({{8, 8}, circle::TensorType::TensorType_FLOAT32, weight3_buf});
+  int bias1 = cgen.addTensor({{8}, circle::TensorType::TensorType_FLOAT32, bias1_buf});
+  int bias2 = cgen.addTensor({{8}, circle::TensorType::TensorType_FLOAT32, bias2_buf});
+  int bias3 = cgen.addTensor({{8}, circle::TensorType::TensorType_FLOAT32, bias3_buf});
+  int fc1_output = cgen.addTensor({{1, 8}, circle::TensorType::TensorType_FLOAT32});
+  int relu1_output = cgen.addTensor({{1, 8}, circle::TensorType::TensorType_FLOAT32});
+  int fc2_output = cgen.addTensor({{1, 8}, circle::TensorType::TensorType_FLOAT32});
+  int relu2_output = cgen.addTensor({{1, 8}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 8}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{input, weight1, bias1}, {fc1_output}});
+  cgen.addOperatorRelu({{fc1_output}, {relu1_output}});
+  cgen.addOperatorFullyConnected({{relu1_output, weight2, bias2}, {fc2_output}});
+  cgen.addOperatorRelu({{fc2_output}, {relu2_output}});
+  cgen.addOperatorFullyConnected({{relu2_output, weight3, bias3}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  float learning_rate = 0.01f;
+  int32_t batch_size = 1;
+  cgen.addTrainInfo({circle::Optimizer::Optimizer_SGD, learning_rate,
+                     circle::LossFn::LossFn_MEAN_SQUARED_ERROR,
+                     circle::LossReductionType::LossReductionType_SumOverBatchSize, batch_size,
+                     NNFW_TRAIN_TRAINABLE_ALL});
+
+  return cgen.finish();
+}
+
+TrainCaseData genFCReluChainCase()
+{
+  return uniformTCD<float>({{{1, 3}}, {{2, 1}}},                                     // inputs
+                           {{{2, 1, 5, 5, 2, 1, 5, 5}}, {{2, 1, 5, 5, 2, 1, 5, 6}}}, // expected
+                           {{14.4052f}, {14.2610f}, {14.1183f}, {13.9770f}}          // loss
+  );
+}
+
+} // namespace
+
+TEST_F(GenModelTrain, Recompute_FC_Relu_Chain)
+{
+  _context = std::make_unique<GenModelTrainContext>(genFCReluChain());
+  _context->addTrainCase(genFCReluChainCase());
+  _context->setBackends({"train"});
+  _context->setEpoch(4);
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTrain, Recompute_FC_Relu_Chain_MemoryBudget)
+{
+  // Recomputing activations in backwarding must not change losses
+  _context = std::make_unique<GenModelTrainContext>(genFCReluChain());
+  _context->addTrainCase(genFCReluChainCase());
+  _context->setBackends({"train"});
+  _context->setEpoch(4);
+  // Too small budget to keep all activations
+  _context->setMemoryBudget(1);
+
+  SUCCEED();
+}
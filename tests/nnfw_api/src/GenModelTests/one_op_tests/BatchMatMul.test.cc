@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include "common.h"
+
+#include <memory>
+
+class BatchMatMulGGMLVariation : public GenModelTest,
+                                 public ::testing::WithParamInterface<circle::TensorType>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(GenModelTest, BatchMatMulGGMLVariation,
+                         ::testing::Values(circle::TensorType::TensorType_GGML_Q4_0,
+                                           circle::TensorType::TensorType_GGML_Q8_0));
+
+// Compare with float BatchMatMul using dequantized rhs, rhs is broadcasted over lhs batch
+// Lhs values are -1, 0, 1 so that ggml's internal q8_0 quantization of lhs is lossless
+TEST_P(BatchMatMulGGMLVariation, OneOp_BatchMatMul_GGML)
+{
+  const auto rhs_type = GetParam();
+  const int batch = 2;
+  const int rows = 3;
+  const int depth = 64;
+  const int cols = 4;
+
+  std::vector<float> rhs_data(cols * depth);
+  for (uint32_t i = 0; i < rhs_data.size(); i++)
+    rhs_data[i] = static_cast<float>(static_cast<int>(i * 5 % 11) - 5) * 0.2f;
+  std::vector<float> lhs_data(batch * rows * depth);
+  for (uint32_t i = 0; i < lhs_data.size(); i++)
+    lhs_data[i] = static_cast<float>(static_cast<int>(i % 3) - 1);
+
+  auto rhs_vector = quantData(rhs_data, rhs_type);
+  auto dequant_rhs = dequantData(rhs_vector, rhs_type);
+  std::vector<float> output_data(batch * rows * cols);
+  for (int r = 0; r < batch * rows; r++)
+  {
+    for (int c = 0; c < cols; c++)
+    {
+      float sum = 0.f;
+      for (int d = 0; d < depth; d++)
+        sum += lhs_data[r * depth + d] * dequant_rhs[c * depth + d];
+      output_data[r * cols + c] = sum;
+    }
+  }
+
+  CircleGen cgen;
+  uint32_t rhs_buf = cgen.addBuffer(rhs_vector);
+  int lhs = cgen.addTensor({{batch, rows, depth}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{cols, depth}, rhs_type, rhs_buf});
+  int output = cgen.addTensor({{batch, rows, cols}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {output}}, false, true);
+  cgen.setInputsAndOutputs({lhs}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({lhs_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_P(BatchMatMulGGMLVariation, neg_OneOp_BatchMatMul_GGML_InvalidLhsType)
+{
+  const auto rhs_type = GetParam();
+
+  CircleGen cgen;
+  std::vector<float> rhs_data(4 * 32);
+  uint32_t rhs_buf = cgen.addBuffer(quantData(rhs_data, rhs_type));
+  int lhs = cgen.addTensor({{1, 32}, circle::TensorType::TensorType_INT32});
+  int rhs = cgen.addTensor({{4, 32}, rhs_type, rhs_buf});
+  int output = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {output}}, false, true);
+  cgen.setInputsAndOutputs({lhs}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
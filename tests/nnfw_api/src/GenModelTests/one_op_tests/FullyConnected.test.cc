@@ -16,6 +16,8 @@
 
 #include "GenModelTest.h"
 
+#include "common.h"
+
 #include <memory>
 
 TEST_F(GenModelTest, OneOp_FullyConnected)
@@ -57,6 +59,119 @@ TEST_F(GenModelTest, OneOp_FullyConnected)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_FullyConnected_Int16)
+{
+  CircleGen cgen;
+  // int16 activations with int8 weights and int64 bias, all symmetric
+  std::vector<int8_t> weight_data{4, 0, 0, 0, 4, 4, 4, 4};
+  std::vector<int64_t> bias_data{8, -8};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  int weight = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_INT8, weight_buf}, 0.25, 0);
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_INT64, bias_buf}, 0.125, 0);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT16}, 0.25, 0);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{2, 4, -2, 6}}, {{8, 16}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Int16_PerChannel)
+{
+  CircleGen cgen;
+  // Weights are quantized per output channel as circle-quantizer does: one scale and zero zero
+  // point for each row of weights, and bias scales are input scale times weight scales
+  std::vector<int8_t> weight_data{4, 0, 0, 0, 2, 2, 2, 2};
+  std::vector<int64_t> bias_data{8, -8};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  std::vector<float> weight_scales{0.25, 0.5};
+  std::vector<int64_t> weight_zero_points{0, 0};
+  std::vector<float> bias_scales{0.125, 0.25};
+  std::vector<int64_t> bias_zero_points{0, 0};
+  int input = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  int weight = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_INT8, weight_buf},
+                              weight_scales, weight_zero_points);
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_INT64, bias_buf}, bias_scales,
+                            bias_zero_points);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT16}, 0.25, 0);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{2, 4, -2, 6}}, {{8, 12}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Int16_CircleQuantizer)
+{
+  // Quantized values and parameters of FullyConnected_003 by circle-quantizer, taken from
+  // compiler/pota-quantization-value-test/expected_outputs/FullyConnected_003/channel/int16
+  CircleGen cgen;
+  const std::vector<int16_t> weight_row{4096,   8192,  -12288, -16384, -20479, 24575,
+                                        -28671, 32767, 16384,  -8192,  12288,  -4096,
+                                        -32767, -24575, 28671, 20479};
+  std::vector<int16_t> weight_data;
+  for (int i = 0; i < 4; ++i)
+    weight_data.insert(weight_data.end(), weight_row.begin(), weight_row.end());
+  std::vector<int64_t> bias_data{27619368, -55238737, -82858105, 110477474};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  std::vector<float> weight_scales(4, 0.00024414807580797754);
+  std::vector<int64_t> weight_zero_points(4, 0);
+  std::vector<float> bias_scales(4, 3.620647604581258e-08);
+  std::vector<int64_t> bias_zero_points(4, 0);
+  int input =
+    cgen.addTensor({{1, 16}, circle::TensorType::TensorType_INT16}, 0.00014829720021225512, 0);
+  int weight = cgen.addTensor({{4, 16}, circle::TensorType::TensorType_INT16, weight_buf},
+                              weight_scales, weight_zero_points);
+  int bias = cgen.addTensor({{4}, circle::TensorType::TensorType_INT64, bias_buf}, bias_scales,
+                            bias_zero_points);
+  int output =
+    cgen.addTensor({{1, 4}, circle::TensorType::TensorType_INT16}, 0.003870659740641713, 0);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Input is test_inputs/FullyConnected_003/channel/int16/0.txt quantized with the input scale.
+  // Output is the float result of 1068.10, 293.03, 34.68 and 1843.16 rounded in output scale.
+  _context->addTestCase(uniformTCD<int16_t>({{10714, -31994, -5838, -20087, 29987, -31399, -25939,
+                                              13, -18678, 3559, 24625, -20863, -24281, 4886, 15218,
+                                              -30234}},
+                                            {{1068, 293, 35, 1843}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_neg_FullyConnected_Int16_PerChannel_Asymm)
+{
+  CircleGen cgen;
+  std::vector<int8_t> weight_data{4, 0, 0, 0, 2, 2, 2, 2};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<float> weight_scales{0.25, 0.5};
+  std::vector<int64_t> weight_zero_points{0, 1};
+  int input = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  int weight = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_INT8, weight_buf},
+                              weight_scales, weight_zero_points);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT16}, 0.25, 0);
+  cgen.addOperatorFullyConnected({{input, weight, -1}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
 #if defined(__aarch64__)
 TEST_F(GenModelTest, OneOp_FullyConnectedShuffled16x1Float32)
 {
@@ -207,3 +322,82 @@ TEST_F(GenModelTest, neg_OneOp_FullyConnected_NoBias)
 
   SUCCEED();
 }
+
+class FullyConnectedGGMLVariation : public GenModelTest,
+                                    public ::testing::WithParamInterface<circle::TensorType>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(GenModelTest, FullyConnectedGGMLVariation,
+                         ::testing::Values(circle::TensorType::TensorType_GGML_Q4_0,
+                                           circle::TensorType::TensorType_GGML_Q8_0));
+
+// Compare with float FullyConnected using dequantized weights
+// Input values are -1, 0, 1 so that ggml's internal q8_0 quantization of input is lossless
+TEST_P(FullyConnectedGGMLVariation, OneOp_FullyConnected_GGML)
+{
+  const auto weight_type = GetParam();
+  const int batch_size = 3;
+  const int input_size = 64;
+  const int num_units = 8;
+
+  std::vector<float> weight_data(num_units * input_size);
+  for (uint32_t i = 0; i < weight_data.size(); i++)
+    weight_data[i] = static_cast<float>(static_cast<int>(i * 7 % 13) - 6) * 0.1f;
+  std::vector<float> bias_data(num_units);
+  for (uint32_t i = 0; i < bias_data.size(); i++)
+    bias_data[i] = static_cast<float>(i) * 0.5f;
+  std::vector<float> input_data(batch_size * input_size);
+  for (uint32_t i = 0; i < input_data.size(); i++)
+    input_data[i] = static_cast<float>(static_cast<int>(i % 3) - 1);
+
+  auto weight_vector = quantData(weight_data, weight_type);
+  auto dequant_weight = dequantData(weight_vector, weight_type);
+  std::vector<float> output_data(batch_size * num_units);
+  for (int b = 0; b < batch_size; b++)
+  {
+    for (int n = 0; n < num_units; n++)
+    {
+      float sum = bias_data[n];
+      for (int k = 0; k < input_size; k++)
+        sum += input_data[b * input_size + k] * dequant_weight[n * input_size + k];
+      output_data[b * num_units + n] = sum;
+    }
+  }
+
+  CircleGen cgen;
+  uint32_t weight_buf = cgen.addBuffer(weight_vector);
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{batch_size, input_size}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor({{num_units, input_size}, weight_type, weight_buf});
+  int bias = cgen.addTensor({{num_units}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int output = cgen.addTensor({{batch_size, num_units}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({input_data}, {output_data}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_P(FullyConnectedGGMLVariation, neg_OneOp_FullyConnected_GGML_InvalidOutType)
+{
+  const auto weight_type = GetParam();
+
+  CircleGen cgen;
+  std::vector<float> weight_data(4 * 32);
+  uint32_t weight_buf = cgen.addBuffer(quantData(weight_data, weight_type));
+  int input = cgen.addTensor({{1, 32}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor({{4, 32}, weight_type, weight_buf});
+  int output = cgen.addTensor({{1, 4}, weight_type});
+  cgen.addOperatorFullyConnected({{input, weight, -1 /* Optional bias */}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
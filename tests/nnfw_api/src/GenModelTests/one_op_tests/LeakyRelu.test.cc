@@ -32,6 +32,21 @@ TEST_F(GenModelTest, OneOp_LeakyRelu)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_LeakyRelu_Int16)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  int out = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_INT16}, 0.25, 0);
+  cgen.addOperatorLeakyRelu({{in}, {out}}, 0.5);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{0, 2, 6, 2, -2, -4}}, {{0, 4, 12, 4, -2, -4}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, neg_OneOp_LeakyRelu_InvalidType)
 {
   CircleGen cgen;
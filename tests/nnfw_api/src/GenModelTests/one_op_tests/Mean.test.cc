@@ -40,6 +40,23 @@ TEST_F(GenModelTest, OneOp_Mean)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_Mean_Int16)
+{
+  CircleGen cgen;
+  uint32_t axis_buf = cgen.addBuffer(std::vector<int32_t>{1, 2});
+  int in = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_INT16}, 1.0, 0);
+  int axis = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, axis_buf});
+  int out = cgen.addTensor({{1}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  cgen.addOperatorMean({{in, axis}, {out}}, true);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{1, 2, 3, 4, 5, 6, 7, 8, 9}}, {{10}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 CircleBuffer genWrongMeanModel()
 {
   CircleGen cgen;
@@ -50,6 +50,23 @@ TEST_F(GenModelTest, OneOp_Mul_Int8_VarVar)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_Mul_Int16_VarVar)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  int rhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT16}, 0.25, 0);
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT16}, 0.125, 0);
+  cgen.addOperatorMul({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<int16_t>({{2, -4, 6, 8}, {4, 8, -12, 16}}, {{8, -32, -72, 128}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, OneOp_MulBroadcast_Uint8_VarVar)
 {
   CircleGen cgen;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+TEST_F(GenModelTest, OneOp_RmsNorm)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{1, 2, 0.5, 1});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0.5, 0, -1});
+  int gamma = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorRmsNorm({{in, gamma, beta}, {out}}, 1e-6f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{1, 2, 3, 4, -2, 2, -2, 2}},
+                      {{0.36515, 1.96059, 0.54772, 0.46059, -1, 2.5, -0.5, 0}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_RmsNorm_SingleGammaBeta)
+{
+  // gamma and beta of [1], as FuseRmsNormPass of luci makes, are broadcast to all channels
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{2});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0.5});
+  int gamma = cgen.addTensor({{1}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{1}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorRmsNorm({{in, gamma, beta}, {out}}, 0.f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{1, 2, 3, 4, -2, 2, -2, 2}},
+                      {{1.230297, 1.960593, 2.690890, 3.421187, -1.5, 2.5, -1.5, 2.5}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_RmsNorm_InvalidGammaShape)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{1, 1});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0, 0, 0});
+  int gamma = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorRmsNorm({{in, gamma, beta}, {out}}, 1e-6f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_RmsNorm_InvalidType)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<int32_t>{1, 1, 1, 1});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<int32_t>{0, 0, 0, 0});
+  int gamma = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, beta_buf});
+  int in = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_INT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_INT32});
+
+  cgen.addOperatorRmsNorm({{in, gamma, beta}, {out}}, 1e-6f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
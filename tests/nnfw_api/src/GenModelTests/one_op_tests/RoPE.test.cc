@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+// Input [batch=1, heads=1, seq_len=2, head_size=4], angles are (p * 1.0, p * 0.5) at position p
+TEST_F(GenModelTest, OneOp_RoPE_GPT_NEOX)
+{
+  CircleGen cgen;
+  uint32_t sin_buf =
+    cgen.addBuffer(std::vector<float>{0, 0, 0, 0, 0.841471, 0.479426, 0.841471, 0.479426});
+  uint32_t cos_buf =
+    cgen.addBuffer(std::vector<float>{1, 1, 1, 1, 0.540302, 0.877583, 0.540302, 0.877583});
+  int sin_table = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32, sin_buf});
+  int cos_table = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32, cos_buf});
+  int in = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorRoPE({{in, sin_table, cos_table}, {out}}, circle::RoPEMode_GPT_NEOX);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4, 5, 6, 7, 8}},
+                                          {{1, 2, 3, 4, -3.18879, 1.43009, 7.98947, 9.89721}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_RoPE_GPT_J)
+{
+  CircleGen cgen;
+  uint32_t sin_buf =
+    cgen.addBuffer(std::vector<float>{0, 0, 0, 0, 0.841471, 0.841471, 0.479426, 0.479426});
+  uint32_t cos_buf =
+    cgen.addBuffer(std::vector<float>{1, 1, 1, 1, 0.540302, 0.540302, 0.877583, 0.877583});
+  int sin_table = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32, sin_buf});
+  int cos_table = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32, cos_buf});
+  int in = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorRoPE({{in, sin_table, cos_table}, {out}}, circle::RoPEMode_GPT_J);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4, 5, 6, 7, 8}},
+                                          {{1, 2, 3, 4, -2.34731, 7.44917, 2.30767, 10.37664}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_RoPE_InvalidTableShape)
+{
+  CircleGen cgen;
+  uint32_t sin_buf = cgen.addBuffer(std::vector<float>{0, 0, 0, 0, 0, 0});
+  uint32_t cos_buf = cgen.addBuffer(std::vector<float>{1, 1, 1, 1, 1, 1});
+  int sin_table = cgen.addTensor({{1, 1, 2, 3}, circle::TensorType::TensorType_FLOAT32, sin_buf});
+  int cos_table = cgen.addTensor({{1, 1, 2, 3}, circle::TensorType::TensorType_FLOAT32, cos_buf});
+  int in = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorRoPE({{in, sin_table, cos_table}, {out}}, circle::RoPEMode_GPT_NEOX);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
@@ -45,7 +45,11 @@ INSTANTIATE_TEST_SUITE_P(
     // int8 value
     SoftmaxParam{
       uniformTCD<int8_t>({{0, -6, 2, 4, 3, -2, 10, 1}}, {{-68, -95, -55, -38, -70, -93, -12, -81}}),
-      circle::TensorType::TensorType_INT8, 1.0, 0}));
+      circle::TensorType::TensorType_INT8, 1.0, 0},
+    // int16 value
+    SoftmaxParam{uniformTCD<int16_t>({{0, -6, 2, 4, 3, -2, 10, 1}},
+                                     {{7689, 4220, 9390, 11469, 7382, 4478, 14864, 6043}}),
+                 circle::TensorType::TensorType_INT16, 1.0, 0}));
 
 TEST_P(SoftmaxVariation, Test)
 {
@@ -65,6 +69,10 @@ TEST_P(SoftmaxVariation, Test)
     out_scale = 1.0f / 256;
     out_zero_point = -128;
   }
+  else if (param.data_type == circle::TensorType::TensorType_INT16)
+  {
+    out_scale = 1.0f / 32768;
+  }
 
   int input =
     cgen.addTensor({{1, 2, 1, 4}, param.data_type}, param.input_scale, param.input_zero_point);
@@ -74,7 +82,59 @@ TEST_P(SoftmaxVariation, Test)
 
   _context = std::make_unique<GenModelTestContext>(cgen.finish());
   _context->addTestCase(param.tcd);
-  _context->setBackends({"cpu", "acl_neon", "acl_cl"});
+  if (param.data_type == circle::TensorType::TensorType_INT16)
+    _context->setBackends({"cpu"});
+  else
+    _context->setBackends({"cpu", "acl_neon", "acl_cl"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Softmax_Int16_CircleQuantizerScale)
+{
+  // circle-quantizer sets the output scale of int16 Softmax to 1/32767
+  CircleGen cgen;
+  int input = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0, 0);
+  int out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0f / 32767, 0);
+  cgen.addOperatorSoftmax({{input}, {out}}, 0.1);
+  cgen.setInputsAndOutputs({input}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{0, -6, 2, 4, 3, -2, 10, 1}},
+                                            {{7689, 4220, 9390, 11469, 7382, 4478, 14864, 6043}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Softmax_Int16_OutputScale)
+{
+  // Output is rescaled from 1/32768 to the scale of output tensor
+  CircleGen cgen;
+  int input = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0, 0);
+  int out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0f / 16384, 0);
+  cgen.addOperatorSoftmax({{input}, {out}}, 0.1);
+  cgen.setInputsAndOutputs({input}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{0, -6, 2, 4, 3, -2, 10, 1}},
+                                            {{3845, 2110, 4695, 5735, 3691, 2239, 7432, 3022}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Softmax_Int16_AsymmOutput)
+{
+  CircleGen cgen;
+  int input = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0, 0);
+  int out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0f / 32768, 1);
+  cgen.addOperatorSoftmax({{input}, {out}}, 0.1);
+  cgen.setInputsAndOutputs({input}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
 
   SUCCEED();
 }
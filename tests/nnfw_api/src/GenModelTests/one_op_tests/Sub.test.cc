@@ -50,6 +50,22 @@ TEST_F(GenModelTest, OneOp_Sub_Int8_VarVar)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_Sub_Int16_VarVar)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT16}, 1.0, 0);
+  int rhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT16}, 2.0, 0);
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT16}, 0.5, 0);
+  cgen.addOperatorSub({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{1, 3, 2, 4}, {5, -4, -7, 4}}, {{-18, 22, 32, -8}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, OneOp_SubBroadcast_Uint8_VarVar)
 {
   CircleGen cgen;
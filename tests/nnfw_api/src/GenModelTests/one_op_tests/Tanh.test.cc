@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_Tanh_Int16)
+{
+  // Input is in [-8, 8) and output is Q0.15
+  CircleGen cgen;
+  int in = cgen.addTensor({{1, 6}, circle::TensorType::TensorType_INT16}, 1.0f / 4096, 0);
+  int out = cgen.addTensor({{1, 6}, circle::TensorType::TensorType_INT16}, 1.0f / 32768, 0);
+  cgen.addOperatorTanh({{in}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int16_t>({{-16384, -4096, 0, 2048, 4096, 16384}},
+                                            {{-32746, -24957, 0, 15144, 24957, 32746}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Tanh_Int16_AsymmInput)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{1, 6}, circle::TensorType::TensorType_INT16}, 1.0f / 4096, 1);
+  int out = cgen.addTensor({{1, 6}, circle::TensorType::TensorType_INT16}, 1.0f / 32768, 0);
+  cgen.addOperatorTanh({{in}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
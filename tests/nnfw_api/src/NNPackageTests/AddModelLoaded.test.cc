@@ -218,6 +218,11 @@ TEST_F(ValidationTestAddModelLoaded, debug_set_config)
   NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "USE_SCHEDULER", "1"));
   NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "PROFILING_MODE", "0"));
   NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "PROFILING_MODE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "PIPELINE_CAPACITY", "4"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "EXECUTION_CONTEXT_ENABLE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "RESERVE_DYNAMIC_TENSORS", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "TRAIN_NUM_REPLICAS", "2"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "TRAIN_FLAT_OPTIMIZER", "1"));
   SUCCEED();
 }
 
@@ -230,6 +235,28 @@ TEST_F(ValidationTestAddModelLoaded, neg_debug_set_config)
   // wrong keys
   ASSERT_EQ(nnfw_set_config(_session, "", "1"), NNFW_STATUS_ERROR);
   ASSERT_EQ(nnfw_set_config(_session, "BAD_KEY", "1"), NNFW_STATUS_ERROR);
+
+  // wrong values
+  ASSERT_EQ(nnfw_set_config(_session, "TRAIN_ACTIVATION_STASH", "fp8"), NNFW_STATUS_ERROR);
+}
+
+TEST_F(ValidationTestAddModelLoaded, train_activation_stash)
+{
+  // TRAIN_ACTIVATION_STASH config and training information set the same mode
+  nnfw_train_info info;
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "TRAIN_ACTIVATION_STASH", "bf16"));
+  NNFW_ENSURE_SUCCESS(nnfw_train_get_traininfo(_session, &info));
+  ASSERT_EQ(info.activation_stash, NNFW_TRAIN_ACTIVATION_STASH_BF16);
+
+  nnfw_train_info new_info;
+  new_info.activation_stash = NNFW_TRAIN_ACTIVATION_STASH_FP16;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(_session, &new_info));
+  NNFW_ENSURE_SUCCESS(nnfw_train_get_traininfo(_session, &info));
+  ASSERT_EQ(info.activation_stash, NNFW_TRAIN_ACTIVATION_STASH_FP16);
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "TRAIN_ACTIVATION_STASH", ""));
+  NNFW_ENSURE_SUCCESS(nnfw_train_get_traininfo(_session, &info));
+  ASSERT_EQ(info.activation_stash, NNFW_TRAIN_ACTIVATION_STASH_NONE);
 }
 
 TEST_F(ValidationTestAddModelLoaded, debug_get_config)
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+# Generate a ResNet-style model and random training data for benchmarking onert_train
+#
+# The model is
+#   (( Input )) -> [ Conv 3x3, Relu ] -> [ Residual block ] x N -> [ Mean ] -> [ FC ]
+#               -> [ Softmax ] -> (( Output ))
+# and each residual block is
+#   x -> [ Conv 3x3, Relu ] -> [ Conv 3x3 ] -> [ Add x ] -> [ Relu ]
+#
+# It writes <prefix>.tflite, <prefix>.input.bin and <prefix>.expected.bin to the output directory.
+# The data files are raw float32 files which onert_train reads with --load_input:raw and
+# --load_expected:raw.
+
+import argparse
+import os
+
+os.environ['TF_CPP_MIN_LOG_LEVEL'] = '2'
+
+import numpy as np
+import tensorflow as tf
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Generate a ResNet-style model and data for onert_train')
+    parser.add_argument('--out-dir', default='out', help='output directory (default: out)')
+    parser.add_argument('--prefix', default='resnet', help='output file prefix (default: resnet)')
+    parser.add_argument('--size', type=int, default=32, help='input height and width (default: 32)')
+    parser.add_argument('--channels',
+                        type=int,
+                        default=64,
+                        help='channels of residual blocks (default: 64)')
+    parser.add_argument('--blocks',
+                        type=int,
+                        default=4,
+                        help='number of residual blocks (default: 4)')
+    parser.add_argument('--classes', type=int, default=10, help='number of classes (default: 10)')
+    parser.add_argument('--samples',
+                        type=int,
+                        default=256,
+                        help='number of training samples (default: 256)')
+    parser.add_argument('--seed', type=int, default=0, help='random seed (default: 0)')
+    return parser.parse_args()
+
+
+def residual_block(x, channels):
+    y = tf.keras.layers.Conv2D(channels, 3, padding='same', activation='relu')(x)
+    y = tf.keras.layers.Conv2D(channels, 3, padding='same')(y)
+    y = tf.keras.layers.Add()([x, y])
+    return tf.keras.layers.ReLU()(y)
+
+
+def build_model(args):
+    inputs = tf.keras.Input(shape=(args.size, args.size, 3), batch_size=1)
+    x = tf.keras.layers.Conv2D(args.channels, 3, padding='same', activation='relu')(inputs)
+    for _ in range(args.blocks):
+        x = residual_block(x, args.channels)
+    x = tf.keras.layers.GlobalAveragePooling2D()(x)
+    x = tf.keras.layers.Dense(args.classes)(x)
+    outputs = tf.keras.layers.Softmax()(x)
+    return tf.keras.Model(inputs, outputs)
+
+
+def main():
+    args = parse_args()
+    tf.random.set_seed(args.seed)
+    rng = np.random.default_rng(args.seed)
+
+    model = build_model(args)
+    converter = tf.lite.TFLiteConverter.from_keras_model(model)
+    tflite_model = converter.convert()
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    path = os.path.join(args.out_dir, args.prefix)
+    with open(path + '.tflite', 'wb') as f:
+        f.write(tflite_model)
+
+    inputs = rng.standard_normal((args.samples, args.size, args.size, 3), dtype=np.float32)
+    labels = rng.integers(0, args.classes, args.samples)
+    expected = np.eye(args.classes, dtype=np.float32)[labels]
+    inputs.tofile(path + '.input.bin')
+    expected.tofile(path + '.expected.bin')
+
+    print(f'{path}.tflite: {args.blocks} residual blocks of {args.channels} channels, '
+          f'{args.size}x{args.size} input')
+    print(f'{path}.input.bin, {path}.expected.bin: {args.samples} samples')
+
+
+if __name__ == '__main__':
+    main()
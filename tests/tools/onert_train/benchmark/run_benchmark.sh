@@ -0,0 +1,107 @@
+#!/bin/bash
+
+# Measure training steps/sec of one or more onert_train binaries on the same model and data
+#
+# Each binary trains the model for the given epochs, and the average ms/step of the epochs after
+# the first one, which warms up, is reported with its steps/sec. Passing the binaries of two builds
+# compares them, e.g. before and after a change:
+#
+# ```
+# $ ./run_benchmark.sh --model=out/resnet.tflite --data=out/resnet \
+#     before/bin/onert_train after/bin/onert_train
+# ```
+
+MODEL=
+DATA=
+EPOCH=5
+BATCH_SIZE=32
+RESULT=
+NUM_THREADS=${NUM_THREADS:-1}
+BINARIES=()
+
+function Usage()
+{
+    echo "Usage: ./run_benchmark.sh --model=<model> --data=<prefix> [options] <onert_train>..."
+    echo ""
+    echo "--model=<file>         : model file, e.g. generated by gen_resnet.py"
+    echo "--data=<prefix>        : prefix of <prefix>.input.bin and <prefix>.expected.bin"
+    echo "--epoch=<num>          : number of epochs, the first of which is not measured (default: 5)"
+    echo "--batch_size=<num>     : batch size (default: 32)"
+    echo "--result=<file>        : append results to a CSV file of binary,ms/step,steps/sec"
+    echo ""
+    echo "NUM_THREADS environment variable sets the threads of kernels (default: 1)"
+}
+
+for i in "$@"
+do
+    case $i in
+        -h|--help|help)
+            Usage
+            exit 1
+            ;;
+        --model=*)
+            MODEL=${i#*=}
+            ;;
+        --data=*)
+            DATA=${i#*=}
+            ;;
+        --epoch=*)
+            EPOCH=${i#*=}
+            ;;
+        --batch_size=*)
+            BATCH_SIZE=${i#*=}
+            ;;
+        --result=*)
+            RESULT=${i#*=}
+            ;;
+        *)
+            BINARIES+=("$i")
+            ;;
+    esac
+done
+
+if [ -z "$MODEL" ] || [ -z "$DATA" ] || [ ${#BINARIES[@]} -eq 0 ]; then
+    Usage
+    exit 1
+fi
+
+if [ "$EPOCH" -lt 2 ]; then
+    echo "--epoch should be 2 or more since the first epoch is not measured"
+    exit 1
+fi
+
+if [ -n "$RESULT" ] && [ ! -s "$RESULT" ]; then
+    echo "binary,ms/step,steps/sec" > "$RESULT"
+fi
+
+for BINARY in "${BINARIES[@]}"
+do
+    LOG=$(NUM_THREADS=$NUM_THREADS "$BINARY" \
+        --load_input:raw "$DATA.input.bin" \
+        --load_expected:raw "$DATA.expected.bin" \
+        --epoch "$EPOCH" \
+        --batch_size "$BATCH_SIZE" \
+        --optimizer 1 \
+        --learning_rate 0.001 \
+        --loss 2 \
+        --loss_reduction_type 1 \
+        --num_of_trainable_ops -1 \
+        "$MODEL")
+    if [ $? -ne 0 ]; then
+        echo "$LOG"
+        echo "$BINARY failed"
+        exit 1
+    fi
+
+    # "Epoch 2/5 - time: 123.456ms/step - loss: ..."
+    echo "$LOG" | sed -n 's/^Epoch \([0-9]*\)\/[0-9]* - time: \([0-9.]*\)ms\/step.*/\1 \2/p' | \
+        awk -v binary="$BINARY" -v result="$RESULT" '
+            $1 > 1 { sum += $2; n++ }
+            END {
+                if (n == 0) { print binary ": no epoch measured"; exit 1 }
+                ms = sum / n
+                printf "%s: %.3f ms/step, %.3f steps/sec\n", binary, ms, 1000 / ms
+                if (result != "")
+                    printf "%s,%.3f,%.3f\n", binary, ms, 1000 / ms >> result
+            }' || exit 1
+done
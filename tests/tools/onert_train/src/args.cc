@@ -181,6 +181,20 @@ void Args::Initialize(void)
     .type(arser::DataType::INT32)
     .help("Loss reduction type");
   _arser.add_argument("--optimizer").type(arser::DataType::INT32).help("Optimizer type");
+  _arser.add_argument("--momentum")
+    .type(arser::DataType::FLOAT)
+    .help({"Momentum of SGD optimizer", "If not given, plain SGD is used"});
+  _arser.add_argument("--nesterov")
+    .nargs(0)
+    .default_value(false)
+    .help("Use Nesterov momentum with SGD optimizer (default: false)");
+  _arser.add_argument("--weight_decay")
+    .type(arser::DataType::FLOAT)
+    .help({"L2 penalty added to the gradients of weights", "If not given, there is no penalty"});
+  _arser.add_argument("--flat_optimizer")
+    .nargs(0)
+    .default_value(false)
+    .help("Update all trainable tensors in one optimizer step (default: false)");
   _arser.add_argument("--metric")
     .type(arser::DataType::INT32)
     .default_value(-1)
@@ -206,6 +220,15 @@ void Args::Initialize(void)
     .help({"Number of the layers to be trained from the back of the model.",
            "\"-1\" means that all layers will be trained.",
            "\"0\" means that no layer will be trained."});
+  _arser.add_argument("--memory_budget")
+    .type(arser::DataType::INT32)
+    .help({"Memory budget in bytes for activations kept for backwarding",
+           "If activations exceed it, some of them are recomputed during backwarding",
+           "If not given, there is no limit"});
+  _arser.add_argument("--activation_stash")
+    .type(arser::DataType::INT32)
+    .help({"16-bit type of activations kept for backwarding",
+           "0: none(fp32), 1: fp16, 2: bf16", "If not given, model's hyper parameter is used"});
 }
 
 void Args::Parse(const int argc, char **argv)
@@ -284,6 +307,26 @@ void Args::Parse(const int argc, char **argv)
                                              _arser.get<int>("--loss_reduction_type"));
     if (_arser["--optimizer"])
       _optimizer_type = checkValidation("optimizer", valid_optim, _arser.get<int>("--optimizer"));
+    if (_arser["--momentum"])
+    {
+      _momentum = _arser.get<float>("--momentum");
+      if (_momentum.value() < 0.f)
+      {
+        std::cerr << "momentum must be non-negative\n";
+        exit(1);
+      }
+    }
+    _nesterov = _arser.get<bool>("--nesterov");
+    _flat_optimizer = _arser.get<bool>("--flat_optimizer");
+    if (_arser["--weight_decay"])
+    {
+      _weight_decay = _arser.get<float>("--weight_decay");
+      if (_weight_decay.value() < 0.f)
+      {
+        std::cerr << "weight_decay must be non-negative\n";
+        exit(1);
+      }
+    }
     _metric_type = _arser.get<int>("--metric");
 
     _validation_split = _arser.get<float>("--validation_split");
@@ -323,6 +366,21 @@ void Args::Parse(const int argc, char **argv)
 
     if (_arser["--num_of_trainable_ops"])
       _num_of_trainable_ops = _arser.get<int>("--num_of_trainable_ops");
+
+    if (_arser["--memory_budget"])
+    {
+      const auto memory_budget = _arser.get<int>("--memory_budget");
+      if (memory_budget < 0)
+      {
+        std::cerr << "memory_budget must be non-negative\n";
+        exit(1);
+      }
+      _memory_budget = memory_budget;
+    }
+
+    if (_arser["--activation_stash"])
+      _activation_stash = checkValidation("activation_stash", valid_activation_stash,
+                                         _arser.get<int>("--activation_stash"));
   }
   catch (const std::bad_cast &e)
   {
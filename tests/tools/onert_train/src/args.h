@@ -66,12 +66,21 @@ public:
     return _loss_reduction_type;
   }
   const std::optional<NNFW_TRAIN_OPTIMIZER> getOptimizerType(void) const { return _optimizer_type; }
+  const std::optional<float> getMomentum(void) const { return _momentum; }
+  const bool getNesterov(void) const { return _nesterov; }
+  const std::optional<float> getWeightDecay(void) const { return _weight_decay; }
+  const bool getFlatOptimizer(void) const { return _flat_optimizer; }
   const int getMetricType(void) const { return _metric_type; }
   const float getValidationSplit(void) const { return _validation_split; }
   const bool printVersion(void) const { return _print_version; }
   const int getVerboseLevel(void) const { return _verbose_level; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
   uint32_t num_of_trainable_ops(void) const { return _num_of_trainable_ops; }
+  const std::optional<uint64_t> getMemoryBudget(void) const { return _memory_budget; }
+  const std::optional<NNFW_TRAIN_ACTIVATION_STASH> getActivationStash(void) const
+  {
+    return _activation_stash;
+  }
 
 private:
   void Initialize();
@@ -96,6 +105,13 @@ private:
     NNFW_TRAIN_OPTIMIZER_ADAM,
   };
 
+  // supported activation stash type list
+  const std::vector<NNFW_TRAIN_ACTIVATION_STASH> valid_activation_stash = {
+    NNFW_TRAIN_ACTIVATION_STASH_NONE,
+    NNFW_TRAIN_ACTIVATION_STASH_FP16,
+    NNFW_TRAIN_ACTIVATION_STASH_BF16,
+  };
+
 private:
   arser::Arser _arser;
 
@@ -115,12 +131,18 @@ private:
   std::optional<NNFW_TRAIN_LOSS> _loss_type;
   std::optional<NNFW_TRAIN_LOSS_REDUCTION> _loss_reduction_type;
   std::optional<NNFW_TRAIN_OPTIMIZER> _optimizer_type;
+  std::optional<float> _momentum;
+  bool _nesterov = false;
+  std::optional<float> _weight_decay;
+  bool _flat_optimizer = false;
   int _metric_type;
   float _validation_split;
   bool _print_version = false;
   int _verbose_level;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
   int32_t _num_of_trainable_ops;
+  std::optional<uint64_t> _memory_budget;
+  std::optional<NNFW_TRAIN_ACTIVATION_STASH> _activation_stash;
 };
 
 } // end of namespace onert_train
@@ -79,6 +79,15 @@ std::string to_string(NNFW_TRAIN_LOSS_REDUCTION loss_rdt)
   return name_map.at(loss_rdt);
 }
 
+std::string to_string(NNFW_TRAIN_ACTIVATION_STASH stash)
+{
+  static const std::unordered_map<NNFW_TRAIN_ACTIVATION_STASH, std::string> name_map{
+    {NNFW_TRAIN_ACTIVATION_STASH_NONE, "none"},
+    {NNFW_TRAIN_ACTIVATION_STASH_FP16, "fp16"},
+    {NNFW_TRAIN_ACTIVATION_STASH_BF16, "bf16"}};
+  return name_map.at(stash);
+}
+
 std::ostream &operator<<(std::ostream &os, const NNFW_TRAIN_OPTIMIZER &opt)
 {
   os << to_string(opt);
@@ -109,7 +118,12 @@ std::ostream &operator<<(std::ostream &os, const nnfw_train_info &info)
   os << "- batch_size           = " << info.batch_size << "\n";
   os << "- loss_info            = " << info.loss_info << "\n";
   os << "- optimizer            = " << info.opt << "\n";
+  os << "- momentum             = " << info.momentum << "\n";
+  os << "- nesterov             = " << std::boolalpha << info.nesterov << std::noboolalpha << "\n";
+  os << "- weight_decay         = " << info.weight_decay << "\n";
   os << "- num_of_trainable_ops = " << info.num_of_trainable_ops << "\n";
+  os << "- memory_budget        = " << info.memory_budget << "\n";
+  os << "- activation_stash     = " << to_string(info.activation_stash) << "\n";
 
   return os;
 }
@@ -39,6 +39,7 @@ uint64_t bufsize_for(const nnfw_tensorinfo *ti);
 std::string to_string(NNFW_TRAIN_OPTIMIZER opt);
 std::string to_string(NNFW_TRAIN_LOSS loss);
 std::string to_string(NNFW_TRAIN_LOSS_REDUCTION loss_rdt);
+std::string to_string(NNFW_TRAIN_ACTIVATION_STASH stash);
 std::ostream &operator<<(std::ostream &os, const nnfw_train_info &info);
 } // end of namespace onert_train
 #endif // __ONERT_TRAIN_NNFW_UTIL_H__
@@ -143,8 +143,13 @@ int main(const int argc, char **argv)
     tri.loss_info.reduction_type =
       args.getLossReductionType().value_or(tri.loss_info.reduction_type);
     tri.opt = args.getOptimizerType().value_or(tri.opt);
+    tri.momentum = args.getMomentum().value_or(tri.momentum);
+    tri.nesterov = args.getNesterov() || tri.nesterov;
+    tri.weight_decay = args.getWeightDecay().value_or(tri.weight_decay);
 
     tri.num_of_trainable_ops = args.num_of_trainable_ops();
+    tri.memory_budget = args.getMemoryBudget().value_or(tri.memory_budget);
+    tri.activation_stash = args.getActivationStash().value_or(tri.activation_stash);
 
     std::cout << "== training parameter ==" << std::endl;
     std::cout << tri;
@@ -153,6 +158,9 @@ int main(const int argc, char **argv)
     // set training information
     NNPR_ENSURE_STATUS(nnfw_train_set_traininfo(session, &tri));
 
+    if (args.getFlatOptimizer())
+      NNPR_ENSURE_STATUS(nnfw_set_config(session, "TRAIN_FLAT_OPTIMIZER", "1"));
+
     // prepare execution
 
     // TODO When nnfw_{prepare|run} are failed, can't catch the time